@@ -0,0 +1,364 @@
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "slugify.h"
+
+#define ITERATIONS 200000
+
+static const char *corpus[] = {
+    "Ecewo Brings Together Web Development & C Programming",
+    "Hello World",
+    "  Hello,   World!!  ",
+    "10 Tips -- for Writing Faster C Code (Part 2)",
+    "Caf\xC3\xA9 au lait \xE2\x80\x93 \xC3\x9C" "ber die Stra\xC3\x9F" "e",
+    "\xD0\x92\xD1\x81\xD0\xB5\xD0\xBC \xD0\xBF\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82",
+    "Prices: $5, 10% off, \xE2\x82\xAC" "20 or \xC2\xA3" "15",
+    "\xCE\x9A\xCE\xB1\xCE\xBB\xCE\xB7\xCE\xBC\xCE\xAD\xCF\x81\xCE\xB1 \xCE\xBA\xCF\x8C\xCF\x83\xCE\xBC\xCE\xB5",
+};
+
+#define CORPUS_SIZE (sizeof(corpus) / sizeof(corpus[0]))
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static void bench_slugify(void)
+{
+    size_t input_bytes = 0;
+    size_t allocated = 0;
+    size_t checksum = 0;
+
+    for (size_t k = 0; k < CORPUS_SIZE; k++)
+    {
+        input_bytes += strlen(corpus[k]);
+        allocated += slugify_length(corpus[k], NULL);
+    }
+
+    double start = now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        char *slug = slugify(corpus[i % CORPUS_SIZE], NULL);
+        checksum += slug ? (unsigned char)slug[0] : 0;
+        free(slug);
+    }
+    double elapsed = now_ns() - start;
+
+    printf("slugify():        %8.1f ns/call (checksum %zu)\n", elapsed / ITERATIONS, checksum);
+    printf("  heap per corpus: %zu bytes for %zu input bytes\n", allocated, input_bytes);
+}
+
+static void bench_length(void)
+{
+    size_t total = 0;
+
+    double start = now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+        total += slugify_length(corpus[i % CORPUS_SIZE], NULL);
+    double elapsed = now_ns() - start;
+
+    printf("slugify_length(): %8.1f ns/call (total %zu)\n", elapsed / ITERATIONS, total);
+}
+
+static void bench_small(void)
+{
+    size_t checksum = 0;
+
+    double start = now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        slugify_small_t slug = slugify_small(corpus[i % CORPUS_SIZE], NULL);
+        checksum += slug.length;
+        slugify_small_free(&slug);
+    }
+    double elapsed = now_ns() - start;
+
+    printf("slugify_small():  %8.1f ns/call (checksum %zu)\n", elapsed / ITERATIONS, checksum);
+}
+
+static void bench_slugifier(void)
+{
+    size_t checksum = 0;
+    slugifier_t *s = slugifier_create(NULL);
+
+    double start = now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        const char *slug;
+        size_t length = 0;
+        if (slugifier_run(s, corpus[i % CORPUS_SIZE], &slug, &length) == SLUGIFY_SUCCESS)
+            checksum += length;
+    }
+    double elapsed = now_ns() - start;
+
+    printf("slugifier_run():  %8.1f ns/call (checksum %zu)\n", elapsed / ITERATIONS, checksum);
+    slugifier_destroy(s);
+}
+
+/* UTF-16 straight into the engine, next to the same title as UTF-8 */
+static void bench_utf16(void)
+{
+    uint16_t title[128];
+    size_t length = strlen(corpus[0]);
+    for (size_t k = 0; k < length; k++)
+        title[k] = (unsigned char)corpus[0][k];
+
+    char out[256];
+    size_t checksum = 0;
+    double start = now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        if (slugify_ex_utf16(title, length, out, sizeof(out), NULL) == SLUGIFY_SUCCESS)
+            checksum += (unsigned char)out[0];
+    }
+    double elapsed = now_ns() - start;
+
+    printf("slugify_ex_utf16(): %6.1f ns/call (checksum %zu)\n", elapsed / ITERATIONS, checksum);
+}
+
+/* Latin-1 through the per-byte tables */
+static void bench_latin1(void)
+{
+    const char *title = "Caf\xE9 au lait \x96 \xDC" "ber die Stra\xDF" "e, cr\xE8me br\xFBl\xE9" "e";
+    slugify_options_t opts = {.separator = '-', .input_encoding = SLUGIFY_ENCODING_CP1252};
+
+    char out[256];
+    size_t checksum = 0;
+    double start = now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        if (slugify_ex(title, out, sizeof(out), &opts) == SLUGIFY_SUCCESS)
+            checksum += (unsigned char)out[0];
+    }
+    double elapsed = now_ns() - start;
+
+    printf("CP1252 input:       %6.1f ns/call (checksum %zu)\n", elapsed / ITERATIONS, checksum);
+}
+
+/* A query-string title unescaped inside the scan */
+static void bench_url_decode(void)
+{
+    const char *title = "Caf%C3%A9+au+lait+%E2%80%93+%C3%9Cber+die+Stra%C3%9Fe";
+    slugify_options_t opts = {.separator = '-', .url_decode = true};
+
+    char out[SLUGIFY_MAX_OUTPUT(64)];
+    size_t checksum = 0;
+    double start = now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        if (slugify_ex(title, out, sizeof(out), &opts) == SLUGIFY_SUCCESS)
+            checksum += (unsigned char)out[0];
+    }
+    double elapsed = now_ns() - start;
+
+    printf("url_decode:         %6.1f ns/call (checksum %zu)\n", elapsed / ITERATIONS, checksum);
+}
+
+/* CMS title with entities and a tag, decoded in the same pass */
+static void bench_html_decode(void)
+{
+    const char *title = "Tom &amp; Jerry&#8217;s <em>caf&eacute;</em> &ndash; &Uuml;ber die Stra&szlig;e";
+    slugify_options_t opts = {.separator = '-', .html_decode = true};
+
+    char out[SLUGIFY_MAX_OUTPUT(96)];
+    size_t checksum = 0;
+    double start = now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        if (slugify_ex(title, out, sizeof(out), &opts) == SLUGIFY_SUCCESS)
+            checksum += (unsigned char)out[0];
+    }
+    double elapsed = now_ns() - start;
+
+    printf("html_decode:        %6.1f ns/call (checksum %zu)\n", elapsed / ITERATIONS, checksum);
+}
+
+/* Slug plus its dedup hash and short ID, against slugify_ex() alone */
+static void bench_digest(void)
+{
+    char out[SLUGIFY_MAX_OUTPUT(64)];
+    size_t checksum = 0;
+    double start = now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        if (slugify_ex(corpus[i % CORPUS_SIZE], out, sizeof(out), NULL) == SLUGIFY_SUCCESS)
+            checksum += (unsigned char)out[0];
+    }
+    double plain = now_ns() - start;
+
+    slugify_digest_t digest;
+    start = now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        if (slugify_ex_digest(corpus[i % CORPUS_SIZE], out, sizeof(out), NULL, &digest) == SLUGIFY_SUCCESS)
+            checksum += (unsigned char)digest.id[0];
+    }
+    double hashed = now_ns() - start;
+
+    printf("slugify_ex_digest:  %6.1f ns/call, %6.1f without (checksum %zu)\n", hashed / ITERATIONS,
+           plain / ITERATIONS, checksum);
+}
+
+/* Unicode-preserving slug escaped for a URI path in the same pass */
+static void bench_percent(void)
+{
+    slugify_options_t opts = {.separator = '-', .preserve_case = true, .percent_encode = true};
+
+    char out[SLUGIFY_MAX_OUTPUT(64)];
+    size_t checksum = 0;
+    double start = now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        if (slugify_ex(corpus[4], out, sizeof(out), &opts) == SLUGIFY_SUCCESS)
+            checksum += (unsigned char)out[0];
+    }
+    double elapsed = now_ns() - start;
+
+    printf("percent_encode:     %6.1f ns/call (checksum %zu)\n", elapsed / ITERATIONS, checksum);
+}
+
+/* Streaming into a caller's response buffer, the way slugify() output
+ * would otherwise be copied and freed */
+typedef struct
+{
+    char data[256];
+    size_t len;
+} bench_body_t;
+
+static int append_body(void *ctx, const char *data, size_t len)
+{
+    bench_body_t *body = ctx;
+    memcpy(body->data, data, len < sizeof(body->data) ? len : sizeof(body->data));
+    body->len = len;
+    return 0;
+}
+
+static void bench_sink(void)
+{
+    bench_body_t body = {.len = 0};
+    size_t checksum = 0;
+    double start = now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        if (slugify_to_sink(corpus[i % CORPUS_SIZE], append_body, &body, NULL) == SLUGIFY_SUCCESS)
+            checksum += (unsigned char)body.data[0];
+    }
+    double elapsed = now_ns() - start;
+
+    printf("slugify_to_sink():  %6.1f ns/call (checksum %zu)\n", elapsed / ITERATIONS, checksum);
+}
+
+/* A keystroke in the middle of a long title: full rerun against an edit
+ * session, which only rescans the words around the edit */
+static void bench_session(size_t words)
+{
+    size_t size = words * (strlen(corpus[0]) + 1) + 1;
+    char *title = malloc(size);
+    if (!title)
+        return;
+    title[0] = '\0';
+    for (size_t k = 0; k < words; k++)
+    {
+        strcat(title, corpus[0]);
+        strcat(title, " ");
+    }
+
+    size_t checksum = 0;
+    size_t middle = strlen(title) / 2;
+    slugifier_t *full = slugifier_create(NULL);
+    slugify_session_t *session = slugify_session_create(NULL);
+    const char *slug;
+    size_t length = 0;
+
+    double start = now_ns();
+    for (int i = 0; i < ITERATIONS / 10; i++)
+    {
+        title[middle] = (i & 1) ? ' ' : 'x';
+        if (slugifier_run(full, title, &slug, &length) == SLUGIFY_SUCCESS)
+            checksum += length;
+    }
+    double rerun = now_ns() - start;
+
+    slugify_session_set(session, title, &slug, &length);
+    start = now_ns();
+    for (int i = 0; i < ITERATIONS / 10; i++)
+    {
+        if (slugify_session_edit(session, middle, 1, (i & 1) ? " " : "x", 1, &slug, &length) == SLUGIFY_SUCCESS)
+            checksum += length;
+    }
+    double edit = now_ns() - start;
+
+    printf("  %6zu bytes: rerun %9.1f ns, edit %7.1f ns (checksum %zu)\n", strlen(title),
+           rerun / (ITERATIONS / 10), edit / (ITERATIONS / 10), checksum);
+    slugify_session_destroy(session);
+    slugifier_destroy(full);
+    free(title);
+}
+
+/* One title per script, to keep an eye on what each romanization path
+ * costs next to plain Latin */
+static const struct
+{
+    const char *script;
+    const char *text;
+} script_corpus[] = {
+    {"Latin", "Caf\xC3\xA9 au lait \xC3\xBC" "ber die Stra\xC3\x9F" "e"},
+    {"Cyrillic", "\xD0\x92\xD1\x81\xD0\xB5\xD0\xBC \xD0\xBF\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 \xD0\xB8\xD0\xB7 \xD0\x9C\xD0\xBE\xD1\x81\xD0\xBA\xD0\xB2\xD1\x8B"},
+    {"Devanagari", "\xE0\xA4\xA8\xE0\xA4\xAE\xE0\xA4\xB8\xE0\xA5\x8D\xE0\xA4\xA4\xE0\xA5\x87 \xE0\xA4\xA6\xE0\xA5\x81\xE0\xA4\xA8\xE0\xA4\xBF\xE0\xA4\xAF\xE0\xA4\xBE \xE0\xA4\xAD\xE0\xA4\xBE\xE0\xA4\xB0\xE0\xA4\xA4"},
+    {"Tamil", "\xE0\xAE\xA4\xE0\xAE\xAE\xE0\xAE\xBF\xE0\xAE\xB4\xE0\xAF\x8D\xE0\xAE\xA8\xE0\xAE\xBE\xE0\xAE\x9F\xE0\xAF\x81 \xE0\xAE\x85\xE0\xAE\xB0\xE0\xAE\x9A\xE0\xAF\x81"},
+    {"Thai", "\xE0\xB8\xA0\xE0\xB8\xB2\xE0\xB8\xA9\xE0\xB8\xB2\xE0\xB9\x84\xE0\xB8\x97\xE0\xB8\xA2 \xE0\xB9\x80\xE0\xB8\x94\xE0\xB9\x87\xE0\xB8\x81 \xE0\xB8\x81\xE0\xB8\xA3\xE0\xB8\xB8\xE0\xB8\x87\xE0\xB9\x80\xE0\xB8\x97\xE0\xB8\x9E"},
+    {"Hebrew", "\xD7\xA9\xD7\x9C\xD7\x95\xD7\x9D \xD7\xA2\xD7\x95\xD7\x9C\xD7\x9D"},
+    {"Armenian", "\xD4\xB5\xD6\x80\xD6\x87\xD5\xA1\xD5\xB6 \xD5\x80\xD5\xA1\xD5\xB5\xD5\xA1\xD5\xBD\xD5\xBF\xD5\xA1\xD5\xB6"},
+    {"Han", "\xE4\xB8\xAD\xE6\x96\x87\xE6\xA0\x87\xE9\xA2\x98"},
+    {"Hangul", "\xEC\x84\x9C\xEC\x9A\xB8 \xED\x8A\xB9\xEB\xB3\x84\xEC\x8B\x9C"},
+    {"Kana", "\xE3\x81\xA8\xE3\x81\x86\xE3\x81\x8D\xE3\x82\x87\xE3\x81\x86 \xE3\x83\x9E\xE3\x83\x83\xE3\x83\x81\xE3\x83\xA3"},
+};
+
+static void bench_scripts(void)
+{
+    char out[256];
+
+    for (size_t k = 0; k < sizeof(script_corpus) / sizeof(script_corpus[0]); k++)
+    {
+        size_t checksum = 0;
+        size_t bytes = strlen(script_corpus[k].text);
+
+        double start = now_ns();
+        for (int i = 0; i < ITERATIONS; i++)
+        {
+            if (slugify_ex(script_corpus[k].text, out, sizeof(out), NULL) == SLUGIFY_SUCCESS)
+                checksum += (unsigned char)out[0];
+        }
+        double elapsed = now_ns() - start;
+
+        printf("  %-10s %8.1f ns/call %7.1f MB/s (checksum %zu)\n", script_corpus[k].script,
+               elapsed / ITERATIONS, bytes * ITERATIONS / elapsed * 1e3, checksum);
+    }
+}
+
+int main()
+{
+    printf("=== SLUGIFY BENCHMARK (%d iterations) ===\n", ITERATIONS);
+    bench_slugify();
+    bench_length();
+    bench_small();
+    bench_slugifier();
+    bench_utf16();
+    bench_latin1();
+    bench_url_decode();
+    bench_html_decode();
+    bench_digest();
+    bench_percent();
+    bench_sink();
+    printf("slugify_ex() per script:\n");
+    bench_scripts();
+    printf("Keystroke in a long title:\n");
+    bench_session(4);
+    bench_session(40);
+    bench_session(400);
+    return 0;
+}
@@ -8,20 +8,6 @@
 #include <winnls.h>
 #endif
 
-/* UTF-8 utility functions */
-static int utf8_char_length(unsigned char c)
-{
-    if (c < 0x80)
-        return 1;
-    if ((c & 0xE0) == 0xC0)
-        return 2;
-    if ((c & 0xF0) == 0xE0)
-        return 3;
-    if ((c & 0xF8) == 0xF0)
-        return 4;
-    return 1; /* Invalid UTF-8, treat as single byte */
-}
-
 /* Check for overlong encodings and invalid sequences */
 static int is_overlong_encoding(const char *str, size_t char_len, uint32_t codepoint)
 {
@@ -120,74 +106,420 @@ static uint32_t utf8_decode_secure(const char *str, size_t *consumed, int *is_va
     return codepoint;
 }
 
-static int is_utf8_valid(const char *str, size_t len)
+/* True for a complete multi-byte sequence that encodes an ASCII character,
+ * which even lenient decoding rejects */
+static int is_overlong_ascii(const char *str)
 {
-    for (size_t i = 0; i < len;)
-    {
-        unsigned char c = (unsigned char)str[i];
-        int char_len = utf8_char_length(c);
+    unsigned char c = (unsigned char)str[0];
+    size_t char_len = (c >= 0xC0 && c < 0xE0) ? 2 : (c >= 0xE0 && c < 0xF0) ? 3 : (c >= 0xF0 && c < 0xF8) ? 4 : 0;
+    if (char_len == 0)
+        return 0;
 
-        if (i + char_len > len)
+    uint32_t codepoint = c & (0x7F >> char_len);
+    for (size_t k = 1; k < char_len; k++)
+    {
+        if ((str[k] & 0xC0) != 0x80)
             return 0;
+        codepoint = (codepoint << 6) | (str[k] & 0x3F);
+    }
+    return codepoint < 0x80;
+}
 
-        uint32_t codepoint = 0;
+/* Windows-1252 in 0x80-0x9F. The five unassigned bytes stay C1 controls,
+ * as in the WHATWG mapping. */
+static const uint16_t cp1252_high[32] = {
+    0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+    0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178,
+};
 
-        /* Validate continuation bytes and decode codepoint */
-        if (char_len == 1)
-        {
-            codepoint = c;
-        }
-        else if (char_len == 2)
+static uint32_t single_byte_codepoint(int encoding, unsigned char c)
+{
+    if (encoding == SLUGIFY_ENCODING_CP1252 && c >= 0x80 && c < 0xA0)
+        return cp1252_high[c - 0x80];
+    return c;
+}
+
+/* Input as the engine reads it: UTF-8, Latin-1 or CP1252 up to its null
+ * byte, or UTF-16 and UTF-32 with an explicit length. Offsets count code
+ * units, and for URL-encoded or HTML input they stay offsets into the raw
+ * text. There, an invalid character's consumed length is the step that
+ * lenient decoding skips. */
+typedef struct
+{
+    const void *data;
+    size_t length; /* Code units, unused for char input */
+    int width;     /* Bytes per code unit: 1, 2 or 4 */
+    int encoding;  /* SLUGIFY_ENCODING_* of char input */
+    int url;       /* char input has %XX escapes and + for space */
+    int html;      /* char input has character references and tags */
+} slug_input_t;
+
+/* Scalar values that may appear in text: no nulls, surrogates or
+ * non-characters */
+static int is_codepoint_valid(uint32_t codepoint)
+{
+    return codepoint != 0 && codepoint <= UNICODE_MAX_CODEPOINT &&
+           (codepoint < UNICODE_SURROGATE_HIGH_START || codepoint > UNICODE_SURROGATE_LOW_END) &&
+           (codepoint < 0xFDD0 || codepoint > 0xFDEF) && (codepoint & 0xFFFE) != 0xFFFE;
+}
+
+static int hex_digit(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    return -1;
+}
+
+/* Byte at offset i of URL-encoded text, with its raw length in *raw. A '%'
+ * without two hex digits after it stands for itself. */
+static unsigned char url_byte(const char *str, size_t i, size_t *raw)
+{
+    *raw = 1;
+    if (str[i] == '+')
+        return ' ';
+    if (str[i] == '%')
+    {
+        int high = hex_digit(str[i + 1]);
+        int low = (high >= 0) ? hex_digit(str[i + 2]) : -1;
+        if (low >= 0)
         {
-            if ((str[i + 1] & 0xC0) != 0x80)
-                return 0;
-            codepoint = ((c & 0x1F) << 6) | (str[i + 1] & 0x3F);
+            *raw = 3;
+            return (unsigned char)(high << 4 | low);
         }
-        else if (char_len == 3)
+    }
+    return (unsigned char)str[i];
+}
+
+/* Decodes the bytes of one character at offset i: as many as the UTF-8 lead
+ * byte asks for, or one for a single-byte encoding. bytes is null-terminated
+ * and ends[k] is the raw offset just past byte k. */
+static size_t url_sequence(const slug_input_t *in, size_t i, char bytes[5], size_t ends[4])
+{
+    const char *str = in->data;
+    size_t raw;
+    unsigned char lead = url_byte(str, i, &raw);
+    size_t want = 1;
+    if (in->encoding == SLUGIFY_ENCODING_UTF8)
+        want = (lead >= 0xC0 && lead < 0xE0) ? 2 : (lead >= 0xE0 && lead < 0xF0) ? 3 : (lead >= 0xF0 && lead < 0xF8) ? 4 : 1;
+
+    size_t n = 0;
+    bytes[n] = (char)lead;
+    ends[n++] = i + raw;
+    while (n < want && str[ends[n - 1]] != '\0')
+    {
+        bytes[n] = (char)url_byte(str, ends[n - 1], &raw);
+        ends[n] = ends[n - 1] + raw;
+        n++;
+    }
+    bytes[n] = '\0';
+    return n;
+}
+
+/* input_decode() for URL-encoded input. The unescaped bytes get the same
+ * checks as plain input, and an escaped null is invalid. An invalid
+ * character consumes only its first byte, which is what lenient decoding
+ * steps over. */
+static uint32_t url_decode_at(const slug_input_t *in, size_t i, size_t *consumed, int *is_valid)
+{
+    char bytes[5];
+    size_t ends[4];
+    url_sequence(in, i, bytes, ends);
+
+    uint32_t codepoint;
+    size_t used = 1;
+    if (in->encoding == SLUGIFY_ENCODING_UTF8)
+    {
+        codepoint = utf8_decode_secure(bytes, &used, is_valid);
+    }
+    else
+    {
+        codepoint = single_byte_codepoint(in->encoding, (unsigned char)bytes[0]);
+        *is_valid = 1;
+    }
+    if (bytes[0] == '\0')
+        *is_valid = 0;
+
+    *consumed = (*is_valid ? ends[used - 1] : ends[0]) - i;
+    return *is_valid ? codepoint : 0;
+}
+
+#define HTML_TAG_MAX 512 /* Longer "tags" are read as text, which bounds the search for '>' */
+
+#ifndef SLUGIFY_NO_ENTITIES
+#include "slugify_entities.h"
+
+/* FNV-1a as in stop_word_hash(), but case-sensitive: &Eacute; is not &eacute; */
+static uint32_t entity_hash(const char *name, size_t len, uint32_t seed)
+{
+    uint32_t h = 2166136261u ^ (seed * 0x9E3779B9u);
+    for (size_t k = 0; k < len; k++)
+    {
+        h ^= (unsigned char)name[k];
+        h *= 16777619u;
+    }
+    return h ^ (h >> 16);
+}
+
+/* Code point of the named reference, 0 if there is none */
+static uint32_t html_entity_lookup(const char *name, size_t len)
+{
+    uint32_t seed = html_entity_displacements[entity_hash(name, len, 0) % HTML_ENTITY_BUCKETS];
+    uint16_t index = html_entity_slots[entity_hash(name, len, seed) % HTML_ENTITY_SLOTS];
+    if (index == HTML_ENTITY_EMPTY)
+        return 0;
+
+    const char *candidate = &html_entity_names[html_entity_offsets[index]];
+    if (strncmp(candidate, name, len) != 0 || candidate[len] != '\0')
+        return 0;
+    return html_entity_codepoints[index];
+}
+#endif
+
+/* Character reference at offset i, which holds '&': &name; or &#digits;
+ * or &#xhex;. Returns its length, or 0 when the '&' is plain text. Numbers
+ * past U+10FFFF saturate so the caller rejects them. */
+static size_t html_reference(const char *str, size_t i, uint32_t *codepoint)
+{
+    size_t k = i + 1;
+    if (str[k] == '#')
+    {
+        int hex = (str[k + 1] == 'x' || str[k + 1] == 'X');
+        uint32_t value = 0;
+        size_t digits = 0;
+        for (k += 1 + hex;; k++, digits++)
         {
-            if ((str[i + 1] & 0xC0) != 0x80 || (str[i + 2] & 0xC0) != 0x80)
-                return 0;
-            codepoint = ((c & 0x0F) << 12) | ((str[i + 1] & 0x3F) << 6) | (str[i + 2] & 0x3F);
+            int d = hex ? hex_digit(str[k]) : (str[k] >= '0' && str[k] <= '9') ? str[k] - '0' : -1;
+            if (d < 0)
+                break;
+            if (value <= UNICODE_MAX_CODEPOINT)
+                value = value * (hex ? 16 : 10) + (uint32_t)d;
         }
-        else if (char_len == 4)
+        if (digits == 0 || str[k] != ';')
+            return 0;
+        *codepoint = value;
+        return k + 1 - i;
+    }
+
+#ifndef SLUGIFY_NO_ENTITIES
+    while (k - i <= HTML_ENTITY_MAX_NAME && (unsigned char)str[k] < 128 &&
+           (slugify_ascii_class[(unsigned char)str[k]] == SLUGIFY_CLASS_LOWER ||
+            slugify_ascii_class[(unsigned char)str[k]] == SLUGIFY_CLASS_UPPER))
+        k++;
+    size_t len = k - i - 1;
+    if (len == 0 || str[k] != ';')
+        return 0;
+    *codepoint = html_entity_lookup(&str[i + 1], len);
+    return *codepoint ? len + 2 : 0;
+#else
+    return 0;
+#endif
+}
+
+/* Length of the tag at offset i, which holds '<', or 0 when the '<' is
+ * plain text. A tag starts with a letter, '/', '!' or '?' and runs to the
+ * next '>'. */
+static size_t html_tag(const char *str, size_t i)
+{
+    unsigned char c = (unsigned char)str[i + 1];
+    if (!((c | 0x20) >= 'a' && (c | 0x20) <= 'z') && c != '/' && c != '!' && c != '?')
+        return 0;
+    for (size_t k = i + 1; k - i < HTML_TAG_MAX && str[k] != '\0'; k++)
+    {
+        if (str[k] == '>')
+            return k + 1 - i;
+    }
+    return 0;
+}
+
+/* input_decode() for HTML text. A reference decodes to its character, with
+ * the Windows-1252 reading HTML gives to references in 0x80-0x9F. A tag
+ * reads as a space, so words on either side of <br> stay apart. */
+static uint32_t html_decode_at(const slug_input_t *in, size_t i, size_t *consumed, int *is_valid)
+{
+    const char *str = in->data;
+    uint32_t codepoint = 0;
+    size_t len;
+
+    if (str[i] == '&' && (len = html_reference(str, i, &codepoint)) > 0)
+    {
+        if (codepoint >= 0x80 && codepoint < 0xA0)
+            codepoint = single_byte_codepoint(SLUGIFY_ENCODING_CP1252, (unsigned char)codepoint);
+        *consumed = len;
+        *is_valid = is_codepoint_valid(codepoint);
+        return *is_valid ? codepoint : 0;
+    }
+    if (str[i] == '<' && (len = html_tag(str, i)) > 0)
+    {
+        *consumed = len;
+        *is_valid = 1;
+        return ' ';
+    }
+
+    if (in->encoding != SLUGIFY_ENCODING_UTF8)
+    {
+        *consumed = 1;
+        *is_valid = 1;
+        return single_byte_codepoint(in->encoding, (unsigned char)str[i]);
+    }
+    codepoint = utf8_decode_secure(&str[i], consumed, is_valid);
+    if (!*is_valid)
+        *consumed = 1;
+    return codepoint;
+}
+
+static int input_end(const slug_input_t *in, size_t i)
+{
+    if (in->width == 1)
+        return ((const char *)in->data)[i] == '\0';
+    return i >= in->length;
+}
+
+/* Decodes the code point at offset i. UTF-16 and UTF-32 get the same checks
+ * as UTF-8: surrogates must pair up, and nulls, non-characters and values
+ * past U+10FFFF are invalid. */
+static uint32_t input_decode(const slug_input_t *in, size_t i, size_t *consumed, int *is_valid)
+{
+    if (in->url)
+        return url_decode_at(in, i, consumed, is_valid);
+    if (in->html)
+        return html_decode_at(in, i, consumed, is_valid);
+    if (in->width == 1 && in->encoding == SLUGIFY_ENCODING_UTF8)
+        return utf8_decode_secure((const char *)in->data + i, consumed, is_valid);
+
+    uint32_t codepoint;
+    if (in->width == 1)
+    {
+        // Every byte of a single-byte encoding is a valid character
+        *consumed = 1;
+        *is_valid = 1;
+        return single_byte_codepoint(in->encoding, ((const unsigned char *)in->data)[i]);
+    }
+
+    *consumed = 1;
+    if (in->width == 2)
+    {
+        const uint16_t *units = in->data;
+        codepoint = units[i];
+        if (codepoint < 0x80)
         {
-            if ((str[i + 1] & 0xC0) != 0x80 || (str[i + 2] & 0xC0) != 0x80 || (str[i + 3] & 0xC0) != 0x80)
-                return 0;
-            codepoint = ((c & 0x07) << 18) | ((str[i + 1] & 0x3F) << 12) | ((str[i + 2] & 0x3F) << 6) | (str[i + 3] & 0x3F);
+            *is_valid = codepoint != 0;
+            return codepoint;
         }
-        else
+        if (codepoint >= 0xD800 && codepoint <= 0xDBFF && i + 1 < in->length &&
+            units[i + 1] >= 0xDC00 && units[i + 1] <= UNICODE_SURROGATE_LOW_END)
         {
-            return 0; /* Invalid first byte */
+            codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (units[i + 1] - 0xDC00);
+            *consumed = 2;
         }
+    }
+    else
+    {
+        codepoint = ((const uint32_t *)in->data)[i];
+    }
 
-        /* Check for overlong encodings */
-        if (is_overlong_encoding(&str[i], char_len, codepoint))
-            return 0;
-
-        /* Check for invalid Unicode ranges */
-        if (codepoint > 0x10FFFF)
-            return 0; /* Beyond valid Unicode range */
+    *is_valid = is_codepoint_valid(codepoint);
+    return *is_valid ? codepoint : 0;
+}
 
-        /* Check for UTF-16 surrogates (invalid in UTF-8) */
-        if (codepoint >= 0xD800 && codepoint <= 0xDFFF)
-            return 0;
+/* is_overlong_ascii() for the character at offset i, after unescaping */
+static int input_overlong_ascii(const slug_input_t *in, size_t i)
+{
+    if (in->width != 1)
+        return 0;
+    if (!in->url)
+        return is_overlong_ascii((const char *)in->data + i);
 
-        /* Check for non-characters */
-        if ((codepoint >= 0xFDD0 && codepoint <= 0xFDEF) ||
-            (codepoint & 0xFFFE) == 0xFFFE)
-            return 0;
+    char bytes[5];
+    size_t ends[4];
+    url_sequence(in, i, bytes, ends);
+    return is_overlong_ascii(bytes);
+}
 
-        i += char_len;
+/* Encodes a valid code point, returning its length */
+static size_t utf8_encode(uint32_t codepoint, char out[4])
+{
+    if (codepoint < 0x80)
+    {
+        out[0] = (char)codepoint;
+        return 1;
     }
-    return 1;
+    if (codepoint < 0x800)
+    {
+        out[0] = (char)(0xC0 | (codepoint >> 6));
+        out[1] = (char)(0x80 | (codepoint & 0x3F));
+        return 2;
+    }
+    if (codepoint < 0x10000)
+    {
+        out[0] = (char)(0xE0 | (codepoint >> 12));
+        out[1] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (codepoint & 0x3F));
+        return 3;
+    }
+    out[0] = (char)(0xF0 | (codepoint >> 18));
+    out[1] = (char)(0x80 | ((codepoint >> 12) & 0x3F));
+    out[2] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+    out[3] = (char)(0x80 | (codepoint & 0x3F));
+    return 4;
 }
 
-/* Comprehensive transliteration table */
-static const struct
+/* Phrases match UTF-8 bytes, so UTF-16, UTF-32, single-byte, URL-encoded and
+ * HTML input is converted from offset from when they are set. With lenient decoding a
+ * bad character becomes the byte 0xFF, which is just as invalid in UTF-8.
+ * Single-byte text has no such byte, so there the policy is applied here.
+ * Overlong ASCII is always rejected. Returns NULL and sets *rc on invalid
+ * input or no memory. */
+static char *input_to_utf8(const slug_input_t *in, size_t from, int policy, int *rc)
 {
-    uint32_t unicode;
-    const char *ascii;
-} transliteration_table[] = {
+    size_t size = 1;
+    for (size_t i = from; !input_end(in, i);)
+    {
+        size_t consumed = 0;
+        int is_valid = 0;
+        char bytes[4];
+        uint32_t codepoint = input_decode(in, i, &consumed, &is_valid);
+        if (!is_valid && (policy == SLUGIFY_INVALID_REJECT || input_overlong_ascii(in, i)))
+        {
+            *rc = SLUGIFY_ERROR_INVALID;
+            return NULL;
+        }
+        size += is_valid ? utf8_encode(codepoint, bytes) : 1;
+        i += consumed;
+    }
+
+    char *utf8 = malloc(size);
+    if (!utf8)
+    {
+        *rc = SLUGIFY_ERROR_MEMORY;
+        return NULL;
+    }
+
+    size_t j = 0;
+    for (size_t i = from; !input_end(in, i);)
+    {
+        size_t consumed = 0;
+        int is_valid = 0;
+        uint32_t codepoint = input_decode(in, i, &consumed, &is_valid);
+        if (is_valid)
+            j += utf8_encode(codepoint, &utf8[j]);
+        else if (in->encoding == SLUGIFY_ENCODING_UTF8)
+            utf8[j++] = (char)0xFF;
+        else if (policy == SLUGIFY_INVALID_SEPARATOR)
+            utf8[j++] = ' ';
+        i += consumed;
+    }
+    utf8[j] = '\0';
+    return utf8;
+}
+
+/* Comprehensive transliteration table, sorted by code point */
+static const transliteration_entry_t transliteration_table[] = {
     /* Symbols */
     {0x24, "dollar"},
     {0x25, "percent"},
@@ -204,190 +536,40 @@ static const struct
     {0xAE, "(r)"},
     {0xBA, "o"},
 
-    /* Latin Extended */
-    {0xC0, "A"},
-    {0xC1, "A"},
-    {0xC2, "A"},
-    {0xC3, "A"},
-    {0xC4, "A"},
-    {0xC5, "A"}, /* À-Å */
+    /* Latin Extended: only letters without a canonical decomposition,
+     * accented letters are covered by decomposition_ranges */
     {0xC6, "AE"},
-    {0xC7, "C"}, /* Æ, Ç */
-    {0xC8, "E"},
-    {0xC9, "E"},
-    {0xCA, "E"},
-    {0xCB, "E"}, /* È-Ë */
-    {0xCC, "I"},
-    {0xCD, "I"},
-    {0xCE, "I"},
-    {0xCF, "I"}, /* Ì-Ï */
     {0xD0, "D"},
-    {0xD1, "N"}, /* Ð, Ñ */
-    {0xD2, "O"},
-    {0xD3, "O"},
-    {0xD4, "O"},
-    {0xD5, "O"},
-    {0xD6, "O"},
-    {0xD8, "O"}, /* Ò-Ö, Ø */
-    {0xD9, "U"},
-    {0xDA, "U"},
-    {0xDB, "U"},
-    {0xDC, "U"}, /* Ù-Ü */
-    {0xDD, "Y"},
+    {0xD8, "O"},
     {0xDE, "TH"},
-    {0xDF, "ss"}, /* Ý, Þ, ß */
+    {0xDF, "ss"},
 
     /* Lowercase versions */
-    {0xE0, "a"},
-    {0xE1, "a"},
-    {0xE2, "a"},
-    {0xE3, "a"},
-    {0xE4, "a"},
-    {0xE5, "a"},
     {0xE6, "ae"},
-    {0xE7, "c"},
-    {0xE8, "e"},
-    {0xE9, "e"},
-    {0xEA, "e"},
-    {0xEB, "e"},
-    {0xEC, "i"},
-    {0xED, "i"},
-    {0xEE, "i"},
-    {0xEF, "i"},
     {0xF0, "d"},
-    {0xF1, "n"},
-    {0xF2, "o"},
-    {0xF3, "o"},
-    {0xF4, "o"},
-    {0xF5, "o"},
-    {0xF6, "o"},
     {0xF8, "o"},
-    {0xF9, "u"},
-    {0xFA, "u"},
-    {0xFB, "u"},
-    {0xFC, "u"},
-    {0xFD, "y"},
     {0xFE, "th"},
-    {0xFF, "y"},
 
     /* Extended Latin A */
-    {0x100, "A"},
-    {0x101, "a"},
-    {0x102, "A"},
-    {0x103, "a"},
-    {0x104, "A"},
-    {0x105, "a"},
-    {0x106, "C"},
-    {0x107, "c"},
-    {0x10C, "C"},
-    {0x10D, "c"},
-    {0x10E, "D"},
-    {0x10F, "d"},
     {0x110, "DJ"},
     {0x111, "dj"},
-    {0x112, "E"},
-    {0x113, "e"},
-    {0x116, "E"},
-    {0x117, "e"},
-    {0x118, "e"},
-    {0x119, "e"},
-    {0x11A, "E"},
-    {0x11B, "e"},
-    {0x11E, "G"},
-    {0x11F, "g"},
-    {0x122, "G"},
-    {0x123, "g"},
-    {0x128, "I"},
-    {0x129, "i"},
-    {0x12A, "i"},
-    {0x12B, "i"},
-    {0x12E, "I"},
-    {0x12F, "i"},
-    {0x130, "I"},
     {0x131, "i"},
-    {0x136, "k"},
-    {0x137, "k"},
-    {0x13B, "L"},
-    {0x13C, "l"},
-    {0x13D, "L"},
-    {0x13E, "l"},
     {0x141, "L"},
     {0x142, "l"},
-    {0x143, "N"},
-    {0x144, "n"},
-    {0x145, "N"},
-    {0x146, "n"},
-    {0x147, "N"},
-    {0x148, "n"},
-    {0x14C, "O"},
-    {0x14D, "o"},
-    {0x150, "O"},
-    {0x151, "o"},
     {0x152, "OE"},
     {0x153, "oe"},
-    {0x154, "R"},
-    {0x155, "r"},
-    {0x158, "R"},
-    {0x159, "r"},
-    {0x15A, "S"},
-    {0x15B, "s"},
-    {0x15E, "S"},
-    {0x15F, "s"},
-    {0x160, "S"},
-    {0x161, "s"},
-    {0x162, "T"},
-    {0x163, "t"},
-    {0x164, "T"},
-    {0x165, "t"},
-    {0x168, "U"},
-    {0x169, "u"},
-    {0x16A, "u"},
-    {0x16B, "u"},
-    {0x16E, "U"},
-    {0x16F, "u"},
-    {0x170, "U"},
-    {0x171, "u"},
-    {0x172, "U"},
-    {0x173, "u"},
-    {0x174, "W"},
-    {0x175, "w"},
-    {0x176, "Y"},
-    {0x177, "y"},
-    {0x178, "Y"},
-    {0x179, "Z"},
-    {0x17A, "z"},
-    {0x17B, "Z"},
-    {0x17C, "z"},
-    {0x17D, "Z"},
-    {0x17E, "z"},
 
     /* Extended Latin B */
     {0x18F, "E"},
     {0x192, "f"},
-    {0x1A0, "O"},
-    {0x1A1, "o"},
-    {0x1AF, "U"},
-    {0x1B0, "u"},
     {0x1C8, "LJ"},
     {0x1C9, "lj"},
     {0x1CB, "NJ"},
     {0x1CC, "nj"},
-    {0x218, "S"},
-    {0x219, "s"},
-    {0x21A, "T"},
-    {0x21B, "t"},
     {0x259, "e"},
     {0x2DA, "o"},
 
     /* Greek */
-    {0x386, "A"},
-    {0x388, "E"},
-    {0x389, "H"},
-    {0x38A, "I"},
-    {0x38C, "O"},
-    {0x38E, "Y"},
-    {0x38F, "W"},
-    {0x390, "i"},
     {0x391, "A"},
     {0x392, "B"},
     {0x393, "G"},
@@ -412,13 +594,6 @@ static const struct
     {0x3A7, "X"},
     {0x3A8, "PS"},
     {0x3A9, "W"},
-    {0x3AA, "I"},
-    {0x3AB, "Y"},
-    {0x3AC, "a"},
-    {0x3AD, "e"},
-    {0x3AE, "h"},
-    {0x3AF, "i"},
-    {0x3B0, "y"},
     {0x3B1, "a"},
     {0x3B2, "b"},
     {0x3B3, "g"},
@@ -444,11 +619,6 @@ static const struct
     {0x3C7, "x"},
     {0x3C8, "ps"},
     {0x3C9, "w"},
-    {0x3CA, "i"},
-    {0x3CB, "y"},
-    {0x3CC, "o"},
-    {0x3CD, "y"},
-    {0x3CE, "w"},
 
     /* Cyrillic */
     {0x401, "Yo"},
@@ -555,6 +725,128 @@ static const struct
     {0x4E8, "OE"},
     {0x4E9, "oe"},
 
+    /* Armenian */
+    {0x531, "A"},
+    {0x532, "B"},
+    {0x533, "G"},
+    {0x534, "D"},
+    {0x535, "E"},
+    {0x536, "Z"},
+    {0x537, "E"},
+    {0x538, "Y"},
+    {0x539, "T"},
+    {0x53A, "ZH"},
+    {0x53B, "I"},
+    {0x53C, "L"},
+    {0x53D, "KH"},
+    {0x53E, "TS"},
+    {0x53F, "K"},
+    {0x540, "H"},
+    {0x541, "DZ"},
+    {0x542, "GH"},
+    {0x543, "CH"},
+    {0x544, "M"},
+    {0x545, "Y"},
+    {0x546, "N"},
+    {0x547, "SH"},
+    {0x548, "O"},
+    {0x549, "CH"},
+    {0x54A, "P"},
+    {0x54B, "J"},
+    {0x54C, "R"},
+    {0x54D, "S"},
+    {0x54E, "V"},
+    {0x54F, "T"},
+    {0x550, "R"},
+    {0x551, "TS"},
+    {0x552, "W"},
+    {0x553, "P"},
+    {0x554, "K"},
+    {0x555, "O"},
+    {0x556, "F"},
+    {0x561, "a"},
+    {0x562, "b"},
+    {0x563, "g"},
+    {0x564, "d"},
+    {0x565, "e"},
+    {0x566, "z"},
+    {0x567, "e"},
+    {0x568, "y"},
+    {0x569, "t"},
+    {0x56A, "zh"},
+    {0x56B, "i"},
+    {0x56C, "l"},
+    {0x56D, "kh"},
+    {0x56E, "ts"},
+    {0x56F, "k"},
+    {0x570, "h"},
+    {0x571, "dz"},
+    {0x572, "gh"},
+    {0x573, "ch"},
+    {0x574, "m"},
+    {0x575, "y"},
+    {0x576, "n"},
+    {0x577, "sh"},
+    {0x578, "o"},
+    {0x579, "ch"},
+    {0x57A, "p"},
+    {0x57B, "j"},
+    {0x57C, "r"},
+    {0x57D, "s"},
+    {0x57E, "v"},
+    {0x57F, "t"},
+    {0x580, "r"},
+    {0x581, "ts"},
+    {0x582, "w"},
+    {0x583, "p"},
+    {0x584, "k"},
+    {0x585, "o"},
+    {0x586, "f"},
+    {0x587, "ev"},
+
+    /* Hebrew: vowel points first, then the consonants */
+    {0x5B1, "e"},
+    {0x5B2, "a"},
+    {0x5B3, "o"},
+    {0x5B4, "i"},
+    {0x5B5, "e"},
+    {0x5B6, "e"},
+    {0x5B7, "a"},
+    {0x5B8, "a"},
+    {0x5B9, "o"},
+    {0x5BA, "o"},
+    {0x5BB, "u"},
+    {0x5D0, ""},
+    {0x5D1, "b"},
+    {0x5D2, "g"},
+    {0x5D3, "d"},
+    {0x5D4, "h"},
+    {0x5D5, "v"},
+    {0x5D6, "z"},
+    {0x5D7, "kh"},
+    {0x5D8, "t"},
+    {0x5D9, "y"},
+    {0x5DA, "kh"},
+    {0x5DB, "k"},
+    {0x5DC, "l"},
+    {0x5DD, "m"},
+    {0x5DE, "m"},
+    {0x5DF, "n"},
+    {0x5E0, "n"},
+    {0x5E1, "s"},
+    {0x5E2, ""},
+    {0x5E3, "f"},
+    {0x5E4, "p"},
+    {0x5E5, "ts"},
+    {0x5E6, "ts"},
+    {0x5E7, "k"},
+    {0x5E8, "r"},
+    {0x5E9, "sh"},
+    {0x5EA, "t"},
+    {0x5F0, "v"},
+    {0x5F1, "oy"},
+    {0x5F2, "ay"},
+
     /* Arabic */
     {0x621, "a"},
     {0x622, "aa"},
@@ -626,6 +918,15 @@ static const struct
     {0x6F8, "8"},
     {0x6F9, "9"},
 
+    /* Indic letters outside the shared ISCII layout */
+    {0x9CE, "t"},
+    {0xD7A, "n"},
+    {0xD7B, "n"},
+    {0xD7C, "r"},
+    {0xD7D, "l"},
+    {0xD7E, "l"},
+    {0xD7F, "k"},
+
     /* Georgian */
     {0x10D0, "a"},
     {0x10D1, "b"},
@@ -661,98 +962,6 @@ static const struct
     {0x10EF, "j"},
     {0x10F0, "h"},
 
-    /* Vietnamese Extended */
-    {0x1EA0, "A"},
-    {0x1EA1, "a"},
-    {0x1EA2, "A"},
-    {0x1EA3, "a"},
-    {0x1EA4, "A"},
-    {0x1EA5, "a"},
-    {0x1EA6, "A"},
-    {0x1EA7, "a"},
-    {0x1EA8, "A"},
-    {0x1EA9, "a"},
-    {0x1EAA, "A"},
-    {0x1EAB, "a"},
-    {0x1EAC, "A"},
-    {0x1EAD, "a"},
-    {0x1EAE, "A"},
-    {0x1EAF, "a"},
-    {0x1EB0, "A"},
-    {0x1EB1, "a"},
-    {0x1EB2, "A"},
-    {0x1EB3, "a"},
-    {0x1EB4, "A"},
-    {0x1EB5, "a"},
-    {0x1EB6, "A"},
-    {0x1EB7, "a"},
-    {0x1EB8, "E"},
-    {0x1EB9, "e"},
-    {0x1EBA, "E"},
-    {0x1EBB, "e"},
-    {0x1EBC, "E"},
-    {0x1EBD, "e"},
-    {0x1EBE, "E"},
-    {0x1EBF, "e"},
-    {0x1EC0, "E"},
-    {0x1EC1, "e"},
-    {0x1EC2, "E"},
-    {0x1EC3, "e"},
-    {0x1EC4, "E"},
-    {0x1EC5, "e"},
-    {0x1EC6, "E"},
-    {0x1EC7, "e"},
-    {0x1EC8, "I"},
-    {0x1EC9, "i"},
-    {0x1ECA, "I"},
-    {0x1ECB, "i"},
-    {0x1ECC, "O"},
-    {0x1ECD, "o"},
-    {0x1ECE, "O"},
-    {0x1ECF, "o"},
-    {0x1ED0, "O"},
-    {0x1ED1, "o"},
-    {0x1ED2, "O"},
-    {0x1ED3, "o"},
-    {0x1ED4, "O"},
-    {0x1ED5, "o"},
-    {0x1ED6, "O"},
-    {0x1ED7, "o"},
-    {0x1ED8, "O"},
-    {0x1ED9, "o"},
-    {0x1EDA, "O"},
-    {0x1EDB, "o"},
-    {0x1EDC, "O"},
-    {0x1EDD, "o"},
-    {0x1EDE, "O"},
-    {0x1EDF, "o"},
-    {0x1EE0, "O"},
-    {0x1EE1, "o"},
-    {0x1EE2, "O"},
-    {0x1EE3, "o"},
-    {0x1EE4, "U"},
-    {0x1EE5, "u"},
-    {0x1EE6, "U"},
-    {0x1EE7, "u"},
-    {0x1EE8, "U"},
-    {0x1EE9, "u"},
-    {0x1EEA, "U"},
-    {0x1EEB, "u"},
-    {0x1EEC, "U"},
-    {0x1EED, "u"},
-    {0x1EEE, "U"},
-    {0x1EEF, "u"},
-    {0x1EF0, "U"},
-    {0x1EF1, "u"},
-    {0x1EF2, "Y"},
-    {0x1EF3, "y"},
-    {0x1EF4, "Y"},
-    {0x1EF5, "y"},
-    {0x1EF6, "Y"},
-    {0x1EF7, "y"},
-    {0x1EF8, "Y"},
-    {0x1EF9, "y"},
-
     /* Punctuation and symbols */
     {0x2013, "-"},
     {0x2018, "'"},
@@ -798,282 +1007,3464 @@ static const struct
     {0x2665, "love"},
     {0x5143, "yuan"},
     {0x5186, "yen"},
-    {0xFDFC, "rial"},
     {0xFDF5, "laa"},
     {0xFDF7, "laa"},
     {0xFDF9, "lai"},
     {0xFDFB, "la"},
+    {0xFDFC, "rial"},
 
     {0, NULL} /* End marker */
 };
 
-/* Binary search in transliteration table */
-static const char *transliterate_char(uint32_t codepoint)
+/* Canonical decompositions (NFD) reduced to their lowercase base letter.
+ * Every code point in [first, first + span] is base plus combining marks,
+ * so the accented Latin, Greek and Cyrillic letters need no table entries
+ * of their own. The base letter goes through the table again (U+1F00 ->
+ * U+03B1 -> "a"). Generated from the Unicode 14.0 character database. */
+static const struct
+{
+    uint16_t first;
+    uint8_t span;
+    uint16_t base;
+} decomposition_ranges[] = {
+    {0x00C0, 5, 0x61}, {0x00C7, 0, 0x63}, {0x00C8, 3, 0x65}, {0x00CC, 3, 0x69},
+    {0x00D1, 0, 0x6E}, {0x00D2, 4, 0x6F}, {0x00D9, 3, 0x75}, {0x00DD, 0, 0x79},
+    {0x00E0, 5, 0x61}, {0x00E7, 0, 0x63}, {0x00E8, 3, 0x65}, {0x00EC, 3, 0x69},
+    {0x00F1, 0, 0x6E}, {0x00F2, 4, 0x6F}, {0x00F9, 3, 0x75}, {0x00FD, 0, 0x79},
+    {0x00FF, 0, 0x79}, {0x0100, 5, 0x61}, {0x0106, 7, 0x63}, {0x010E, 1, 0x64},
+    {0x0112, 9, 0x65}, {0x011C, 7, 0x67}, {0x0124, 1, 0x68}, {0x0128, 8, 0x69},
+    {0x0134, 1, 0x6A}, {0x0136, 1, 0x6B}, {0x0139, 5, 0x6C}, {0x0143, 5, 0x6E},
+    {0x014C, 5, 0x6F}, {0x0154, 5, 0x72}, {0x015A, 7, 0x73}, {0x0162, 3, 0x74},
+    {0x0168, 11, 0x75}, {0x0174, 1, 0x77}, {0x0176, 2, 0x79}, {0x0179, 5, 0x7A},
+    {0x01A0, 1, 0x6F}, {0x01AF, 1, 0x75}, {0x01CD, 1, 0x61}, {0x01CF, 1, 0x69},
+    {0x01D1, 1, 0x6F}, {0x01D3, 9, 0x75}, {0x01DE, 3, 0x61}, {0x01E2, 1, 0xE6},
+    {0x01E6, 1, 0x67}, {0x01E8, 1, 0x6B}, {0x01EA, 3, 0x6F}, {0x01EE, 1, 0x292},
+    {0x01F0, 0, 0x6A}, {0x01F4, 1, 0x67}, {0x01F8, 1, 0x6E}, {0x01FA, 1, 0x61},
+    {0x01FC, 1, 0xE6}, {0x01FE, 1, 0xF8}, {0x0200, 3, 0x61}, {0x0204, 3, 0x65},
+    {0x0208, 3, 0x69}, {0x020C, 3, 0x6F}, {0x0210, 3, 0x72}, {0x0214, 3, 0x75},
+    {0x0218, 1, 0x73}, {0x021A, 1, 0x74}, {0x021E, 1, 0x68}, {0x0226, 1, 0x61},
+    {0x0228, 1, 0x65}, {0x022A, 7, 0x6F}, {0x0232, 1, 0x79}, {0x0386, 0, 0x3B1},
+    {0x0388, 0, 0x3B5}, {0x0389, 0, 0x3B7}, {0x038A, 0, 0x3B9}, {0x038C, 0, 0x3BF},
+    {0x038E, 0, 0x3C5}, {0x038F, 0, 0x3C9}, {0x0390, 0, 0x3B9}, {0x03AA, 0, 0x3B9},
+    {0x03AB, 0, 0x3C5}, {0x03AC, 0, 0x3B1}, {0x03AD, 0, 0x3B5}, {0x03AE, 0, 0x3B7},
+    {0x03AF, 0, 0x3B9}, {0x03B0, 0, 0x3C5}, {0x03CA, 0, 0x3B9}, {0x03CB, 0, 0x3C5},
+    {0x03CC, 0, 0x3BF}, {0x03CD, 0, 0x3C5}, {0x03CE, 0, 0x3C9}, {0x03D3, 1, 0x3D2},
+    {0x0400, 1, 0x435}, {0x0403, 0, 0x433}, {0x0407, 0, 0x456}, {0x040C, 0, 0x43A},
+    {0x040D, 0, 0x438}, {0x040E, 0, 0x443}, {0x0419, 0, 0x438}, {0x0439, 0, 0x438},
+    {0x0450, 1, 0x435}, {0x0453, 0, 0x433}, {0x0457, 0, 0x456}, {0x045C, 0, 0x43A},
+    {0x045D, 0, 0x438}, {0x045E, 0, 0x443}, {0x0476, 1, 0x475}, {0x04C1, 1, 0x436},
+    {0x04D0, 3, 0x430}, {0x04D6, 1, 0x435}, {0x04DA, 1, 0x4D9}, {0x04DC, 1, 0x436},
+    {0x04DE, 1, 0x437}, {0x04E2, 3, 0x438}, {0x04E6, 1, 0x43E}, {0x04EA, 1, 0x4E9},
+    {0x04EC, 1, 0x44D}, {0x04EE, 5, 0x443}, {0x04F4, 1, 0x447}, {0x04F8, 1, 0x44B},
+    {0x1E00, 1, 0x61}, {0x1E02, 5, 0x62}, {0x1E08, 1, 0x63}, {0x1E0A, 9, 0x64},
+    {0x1E14, 9, 0x65}, {0x1E1E, 1, 0x66}, {0x1E20, 1, 0x67}, {0x1E22, 9, 0x68},
+    {0x1E2C, 3, 0x69}, {0x1E30, 5, 0x6B}, {0x1E36, 7, 0x6C}, {0x1E3E, 5, 0x6D},
+    {0x1E44, 7, 0x6E}, {0x1E4C, 7, 0x6F}, {0x1E54, 3, 0x70}, {0x1E58, 7, 0x72},
+    {0x1E60, 9, 0x73}, {0x1E6A, 7, 0x74}, {0x1E72, 9, 0x75}, {0x1E7C, 3, 0x76},
+    {0x1E80, 9, 0x77}, {0x1E8A, 3, 0x78}, {0x1E8E, 1, 0x79}, {0x1E90, 5, 0x7A},
+    {0x1E96, 0, 0x68}, {0x1E97, 0, 0x74}, {0x1E98, 0, 0x77}, {0x1E99, 0, 0x79},
+    {0x1E9B, 0, 0x17F}, {0x1EA0, 23, 0x61}, {0x1EB8, 15, 0x65}, {0x1EC8, 3, 0x69},
+    {0x1ECC, 23, 0x6F}, {0x1EE4, 13, 0x75}, {0x1EF2, 7, 0x79}, {0x1F00, 15, 0x3B1},
+    {0x1F10, 5, 0x3B5}, {0x1F18, 5, 0x3B5}, {0x1F20, 15, 0x3B7}, {0x1F30, 15, 0x3B9},
+    {0x1F40, 5, 0x3BF}, {0x1F48, 5, 0x3BF}, {0x1F50, 7, 0x3C5}, {0x1F59, 0, 0x3C5},
+    {0x1F5B, 0, 0x3C5}, {0x1F5D, 0, 0x3C5}, {0x1F5F, 0, 0x3C5}, {0x1F60, 15, 0x3C9},
+    {0x1F70, 1, 0x3B1}, {0x1F72, 1, 0x3B5}, {0x1F74, 1, 0x3B7}, {0x1F76, 1, 0x3B9},
+    {0x1F78, 1, 0x3BF}, {0x1F7A, 1, 0x3C5}, {0x1F7C, 1, 0x3C9}, {0x1F80, 15, 0x3B1},
+    {0x1F90, 15, 0x3B7}, {0x1FA0, 15, 0x3C9}, {0x1FB0, 4, 0x3B1}, {0x1FB6, 6, 0x3B1},
+    {0x1FC2, 2, 0x3B7}, {0x1FC6, 1, 0x3B7}, {0x1FC8, 1, 0x3B5}, {0x1FCA, 2, 0x3B7},
+    {0x1FD0, 3, 0x3B9}, {0x1FD6, 5, 0x3B9}, {0x1FE0, 3, 0x3C5}, {0x1FE4, 1, 0x3C1},
+    {0x1FE6, 5, 0x3C5}, {0x1FEC, 0, 0x3C1}, {0x1FF2, 2, 0x3C9}, {0x1FF6, 1, 0x3C9},
+    {0x1FF8, 1, 0x3BF}, {0x1FFA, 2, 0x3C9},
+};
+
+/* Base letter of a precomposed character, 0 if it does not decompose */
+static uint32_t decompose_base(uint32_t codepoint)
 {
-    int lo = 0, hi = (sizeof(transliteration_table) / sizeof(transliteration_table[0])) - 2;
-    while (lo <= hi)
+    size_t lo = 0, hi = sizeof(decomposition_ranges) / sizeof(decomposition_ranges[0]);
+    while (lo < hi)
     {
-        int mid = (lo + hi) >> 1;
-        uint32_t u = transliteration_table[mid].unicode;
-        if (u == codepoint)
-            return transliteration_table[mid].ascii;
-        if (u < codepoint)
+        size_t mid = (lo + hi) >> 1;
+        uint32_t first = decomposition_ranges[mid].first;
+        if (codepoint < first)
+            hi = mid;
+        else if (codepoint > first + decomposition_ranges[mid].span)
             lo = mid + 1;
         else
-            hi = mid - 1;
+            return decomposition_ranges[mid].base;
     }
-    return NULL;
+    return 0;
 }
 
-static uint32_t utf8_decode(const char *str, size_t *consumed)
-{
-    unsigned char c = (unsigned char)str[0];
-    uint32_t codepoint = 0;
+/* General Category of every code point, reduced to what matters for a slug:
+ * spaces (Z*) and punctuation (P*) become separators, combining marks (M*)
+ * are dropped, and letters, digits and symbols (everything else) go through
+ * transliteration. Three-stage table: cp >> 11 selects a block of 64 leaf
+ * indices, cp >> 5 selects a leaf of 32 two-bit classes. 4032 bytes in
+ * total, generated from the Unicode 14.0 character database. */
+#define UNICODE_CLASS_OTHER 0
+#define UNICODE_CLASS_PUNCT 1
+#define UNICODE_CLASS_MARK 2
+#define UNICODE_CLASS_SPACE 3
 
-    if (c < 0x80)
+static const uint8_t unicode_class_top[544] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x08, 0x09, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x11, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x12, 0x07, 0x13, 0x14, 0x15, 0x16, 0x17, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x18, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+};
+
+static const uint8_t unicode_class_mid[25][64] = {
     {
-        *consumed = 1;
-        return c;
-    }
-    else if ((c & 0xE0) == 0xC0)
+        0x00, 0x01, 0x02, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x06, 0x07, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0A, 0x0B, 0x0C, 0x0D,
+        0x0E, 0x00, 0x0F, 0x10, 0x00, 0x00, 0x11, 0x12, 0x13, 0x14, 0x15, 0x00, 0x00, 0x16, 0x00, 0x17,
+    },
     {
-        *consumed = 2;
-        codepoint = (c & 0x1F) << 6;
-        codepoint |= (str[1] & 0x3F);
-    }
-    else if ((c & 0xF0) == 0xE0)
+        0x18, 0x19, 0x1A, 0x00, 0x1B, 0x00, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x22, 0x23, 0x26, 0x27, 0x22, 0x23, 0x28, 0x29, 0x22, 0x23, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x00,
+        0x2F, 0x23, 0x30, 0x31, 0x32, 0x23, 0x30, 0x2B, 0x1E, 0x33, 0x34, 0x2B, 0x22, 0x00, 0x35, 0x36,
+        0x00, 0x37, 0x38, 0x00, 0x00, 0x39, 0x3A, 0x00, 0x3B, 0x3C, 0x00, 0x3D, 0x3E, 0x3F, 0x40, 0x00,
+    },
     {
-        *consumed = 3;
-        codepoint = (c & 0x0F) << 12;
-        codepoint |= ((str[1] & 0x3F) << 6);
-        codepoint |= (str[2] & 0x3F);
-    }
-    else if ((c & 0xF8) == 0xF0)
+        0x00, 0x41, 0x42, 0x43, 0x44, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x47, 0x00, 0x00, 0x00, 0x00,
+        0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x49, 0x4A, 0x00, 0x00, 0x4B, 0x4C, 0x4D, 0x4E, 0x4E, 0x00, 0x4F, 0x50, 0x00,
+    },
     {
-        *consumed = 4;
-        codepoint = (c & 0x07) << 18;
-        codepoint |= ((str[1] & 0x3F) << 12);
-        codepoint |= ((str[2] & 0x3F) << 6);
-        codepoint |= (str[3] & 0x3F);
-    }
-    else
+        0x51, 0x00, 0x00, 0x00, 0x52, 0x53, 0x00, 0x00, 0x00, 0x54, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x56, 0x00, 0x57, 0x58, 0x00, 0x59, 0x5A, 0x00, 0x2F, 0x4F, 0x5B, 0x5C, 0x5D, 0x5E, 0x00, 0x5F,
+        0x00, 0x60, 0x00, 0x61, 0x00, 0x00, 0x62, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
     {
-        *consumed = 1;
-        return c; /* Invalid UTF-8 */
-    }
+        0x64, 0x65, 0x66, 0x67, 0x68, 0x00, 0x14, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x6D, 0x6E,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x70, 0x71,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x05,
+        0x74, 0x75, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x77, 0x78, 0x00, 0x00, 0x79, 0x48, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x7A, 0x00, 0x00, 0x7B, 0x2D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x7D, 0x7E, 0x00, 0x7F, 0x80, 0x4F, 0x81, 0x82, 0x00, 0x83, 0x84, 0x00, 0x1E, 0x85, 0x86, 0x87,
+        0x00, 0x88, 0x89, 0x8A, 0x00, 0x8B, 0x8C, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x90, 0x91, 0x92, 0x93, 0x00, 0x00, 0x00, 0x00, 0x94, 0x02, 0x95, 0x96, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x9A, 0x9B, 0x00, 0x9C, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x9F, 0xA0, 0xA1, 0x9B, 0x00, 0x00, 0x00, 0xA2, 0x00, 0xA3, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x00, 0xA8, 0x00, 0x00, 0x00,
+    },
+    {
+        0x5D, 0x1B, 0xA9, 0xAA, 0x5D, 0xAB, 0xAC, 0x00, 0x5D, 0xAD, 0xAE, 0xAF, 0x5D, 0x85, 0xB0, 0x00,
+        0x00, 0xB1, 0x00, 0x00, 0x00, 0xB2, 0xB3, 0x15, 0x1E, 0x33, 0x24, 0xB4, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xB5, 0xB6, 0x00, 0x00, 0x14, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xB9, 0x00,
+        0x00, 0x14, 0xBA, 0xBB, 0x00, 0xBC, 0x00, 0x00, 0x46, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xC1, 0xC2,
+        0xC3, 0xC4, 0xC5, 0x00, 0xC6, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0x00, 0x00, 0x00, 0xCC, 0xCD, 0x00, 0xCE, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9B,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0xD3, 0x00, 0xD4, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x05, 0xD8, 0x00, 0x00, 0xD9,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xDB, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDE, 0xDF, 0x00, 0x00,
+        0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x05, 0xE1, 0x05, 0xE2, 0xE3, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0xE5, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xEB,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+};
 
-    return codepoint;
-}
+static const uint8_t unicode_class_leaf[236][8] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x57, 0x54, 0x15, 0x55, 0x00, 0x00, 0x50, 0x40},
+    {0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x45},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04},
+    {0x07, 0x40, 0x40, 0x00, 0x00, 0x50, 0x40, 0x40},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x10},
+    {0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x80, 0xAA, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55},
+    {0x00, 0x00, 0x14, 0x00, 0xA8, 0xAA, 0xAA, 0xAA},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A},
+    {0x69, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00},
+    {0x00, 0x00, 0x14, 0x05, 0xAA, 0xAA, 0x6A, 0x54},
+    {0x00, 0x00, 0x80, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA},
+    {0x00, 0x00, 0x50, 0x05, 0x02, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xAA, 0x82},
+    {0xAA, 0x82, 0xA2, 0x0A, 0x00, 0x00, 0x00, 0x00},
+    {0x55, 0x55, 0x55, 0x05, 0x08, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA},
+    {0xAA, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xA0, 0xAA, 0xAA, 0x02, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x80, 0xAA, 0xAA, 0x40, 0x05, 0x08},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x8A, 0xAA},
+    {0xAA, 0xA8, 0xA8, 0x0A, 0x55, 0x55, 0x55, 0x15},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x10},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA},
+    {0x00, 0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA},
+    {0x8A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA},
+    {0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xA2},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0xAA, 0x00, 0x00},
+    {0xA0, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00},
+    {0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2},
+    {0xAA, 0x82, 0x82, 0x0A, 0x00, 0x80, 0x00, 0x00},
+    {0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24},
+    {0x2A, 0x80, 0x82, 0x0A, 0x08, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x0A, 0x18, 0x00, 0x00},
+    {0xAA, 0x8A, 0x8A, 0x0A, 0x00, 0x00, 0x00, 0x00},
+    {0xA0, 0x00, 0x00, 0x00, 0x01, 0x00, 0xA0, 0xAA},
+    {0xAA, 0x82, 0x82, 0x0A, 0x00, 0xA8, 0x00, 0x00},
+    {0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0},
+    {0x2A, 0xA0, 0xA2, 0x0A, 0x00, 0x80, 0x00, 0x00},
+    {0xAA, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xAA, 0xA2, 0xA2, 0x0A, 0x00, 0x28, 0x00, 0x00},
+    {0xA0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00},
+    {0xA8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xA2},
+    {0xAA, 0xA2, 0xA2, 0x0A, 0x00, 0x80, 0x00, 0x00},
+    {0x00, 0x00, 0x20, 0x80, 0xAA, 0x22, 0xAA, 0xAA},
+    {0x00, 0x00, 0x00, 0x00, 0xA0, 0x01, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x08, 0xAA, 0x2A, 0x00},
+    {0x00, 0x80, 0xAA, 0x6A, 0x00, 0x00, 0x50, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x08, 0xAA, 0xAA, 0x02},
+    {0x00, 0x00, 0xAA, 0x0A, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x55, 0x55, 0x55, 0x15, 0x01, 0x0A, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x58, 0xA5},
+    {0x00, 0x00, 0x00, 0x00, 0xA8, 0xAA, 0xAA, 0xAA},
+    {0xAA, 0xA6, 0x00, 0xA8, 0xAA, 0xAA, 0xA8, 0xAA},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x02},
+    {0x00, 0x20, 0x00, 0x00, 0x55, 0x01, 0x14, 0x00},
+    {0x00, 0x00, 0x80, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A},
+    {0x00, 0x00, 0x50, 0x55, 0x00, 0xA0, 0x0A, 0xA0},
+    {0xA2, 0x82, 0xAA, 0x0A, 0xA8, 0x02, 0x00, 0x00},
+    {0xA0, 0xAA, 0xAA, 0x8A, 0x00, 0x00, 0xA0, 0x0A},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8},
+    {0x55, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00},
+    {0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01},
+    {0x00, 0x00, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xA0, 0x0A, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xA0, 0x16, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x15, 0x15, 0x08},
+    {0x55, 0x55, 0x95, 0x8A, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xAA, 0xAA, 0xAA, 0x00, 0xAA, 0xAA, 0xAA, 0x00},
+    {0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xAA, 0x50},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xAA, 0x2A},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x82},
+    {0x55, 0x15, 0x55, 0x05, 0xAA, 0xAA, 0xAA, 0xAA},
+    {0xAA, 0xAA, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0x00},
+    {0xAA, 0x02, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55},
+    {0x01, 0x00, 0x80, 0xAA, 0xAA, 0x00, 0x00, 0x14},
+    {0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xA8, 0xAA, 0xAA, 0x0A, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x55},
+    {0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x40, 0x55},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50},
+    {0x55, 0x55, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xAA},
+    {0xAA, 0xAA, 0x02, 0x08, 0x00, 0x82, 0x0A, 0x00},
+    {0xFF, 0xFF, 0x3F, 0x00, 0x55, 0x55, 0x55, 0x55},
+    {0x55, 0x55, 0x0F, 0xC0, 0x55, 0x55, 0x55, 0x55},
+    {0x55, 0x54, 0x55, 0x55, 0x45, 0x55, 0x55, 0xD5},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14},
+    {0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0x02, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00},
+    {0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00},
+    {0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05},
+    {0x00, 0x00, 0x00, 0x80, 0x0A, 0x00, 0x54, 0x51},
+    {0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55},
+    {0x55, 0x55, 0x55, 0x15, 0x55, 0x55, 0x55, 0x55},
+    {0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x05},
+    {0x57, 0x00, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55},
+    {0x00, 0x00, 0xA0, 0xAA, 0x01, 0x00, 0x00, 0x04},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00},
+    {0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x80, 0x6A, 0xAA, 0xAA, 0x1A},
+    {0x00, 0x00, 0x00, 0x00, 0x5A, 0x55, 0x00, 0x00},
+    {0x20, 0x20, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x80, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00},
+    {0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xAA, 0x0A, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0x00, 0x15, 0x81},
+    {0x00, 0xA0, 0xAA, 0x5A, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x80, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x40},
+    {0x00, 0x00, 0x00, 0x00, 0x80, 0xAA, 0xAA, 0xAA},
+    {0x56, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x50},
+    {0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xA8, 0xAA, 0xAA, 0x2A, 0x00, 0x00},
+    {0x80, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x55},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0A},
+    {0x00, 0x00, 0x00, 0x00, 0xA2, 0x82, 0x02, 0xA0},
+    {0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50},
+    {0x00, 0x00, 0x80, 0xAA, 0x05, 0x28, 0x00, 0x00},
+    {0x80, 0xAA, 0x6A, 0x0A, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x05, 0x00},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55},
+    {0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x55, 0x55},
+    {0x45, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x54, 0x54, 0x15, 0x55, 0x00, 0x00, 0x50, 0x40},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44},
+    {0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08},
+    {0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x2A, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40},
+    {0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00},
+    {0xA8, 0x28, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x80},
+    {0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x01, 0x00},
+    {0x00, 0x28, 0x00, 0x00, 0x55, 0x15, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x01},
+    {0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xA0, 0xAA, 0xAA, 0x02, 0x54, 0x05, 0x00},
+    {0xA0, 0x5A, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xAA, 0x6A, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x82, 0x02, 0x00, 0x80},
+    {0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x6A, 0x51},
+    {0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x80, 0xAA, 0xAA, 0xAA, 0x02, 0x00, 0x00},
+    {0x55, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x80, 0x05, 0x00, 0x00},
+    {0x02, 0x54, 0xA9, 0xA6, 0x00, 0x00, 0x40, 0x54},
+    {0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x55, 0x25},
+    {0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80},
+    {0xA0, 0xA0, 0xAA, 0x02, 0xAA, 0x02, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xAA, 0xAA},
+    {0xAA, 0x2A, 0x40, 0x55, 0x00, 0x00, 0x50, 0x24},
+    {0xAA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x80, 0xAA, 0x0A, 0xAA, 0xAA},
+    {0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x0A},
+    {0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x55, 0x55, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x80, 0xAA, 0xAA, 0xAA, 0x04, 0x00},
+    {0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x15},
+    {0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x6A, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xAA, 0x8A, 0x82, 0x2A},
+    {0xA2, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xA8, 0xAA, 0xA0, 0xAA},
+    {0x12, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xA8, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x80, 0xAA, 0x8A, 0x6A},
+    {0x55, 0x95, 0x00, 0x00, 0xA8, 0xAA, 0xAA, 0x00},
+    {0x00, 0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0x5A, 0x51},
+    {0x00, 0x00, 0x00, 0x80, 0xAA, 0x2A, 0xAA, 0xAA},
+    {0x54, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xA0, 0xAA, 0xAA, 0xAA},
+    {0xAA, 0xAA, 0xA8, 0xAA, 0xAA, 0x2A, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xA8, 0x2A, 0x20, 0x8A},
+    {0xAA, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xA0, 0x2A, 0x8A, 0xAA, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x80, 0x6A, 0x01, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xAA, 0x06, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xAA, 0x6A, 0x55, 0x00},
+    {0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0x00},
+    {0x00, 0x00, 0x00, 0x80, 0xA8, 0xAA, 0xAA, 0xAA},
+    {0xAA, 0xAA, 0x00, 0x80, 0x2A, 0x00, 0x00, 0x00},
+    {0x10, 0x02, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68},
+    {0xAA, 0xAA, 0xAA, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA},
+    {0xAA, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xA8, 0x0A, 0xA8, 0x2A, 0x00, 0x80, 0xAA},
+    {0x2A, 0xA8, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00},
+    {0xA0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A, 0x80, 0xAA},
+    {0xAA, 0xAA, 0xAA, 0x02, 0x00, 0x08, 0x00, 0x00},
+    {0x00, 0x42, 0x55, 0x00, 0x00, 0x00, 0x80, 0xAA},
+    {0xA8, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00},
+    {0xAA, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0x82, 0xAA},
+    {0x8A, 0xA2, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xAA, 0x2A, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x50},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00},
+};
 
-static slugify_options_t slugify_default_options(void)
+static int unicode_class(uint32_t codepoint)
 {
-    slugify_options_t opts = {0};
-    opts.preserve_case = false;
-    opts.separator = '-';
-    opts.max_length = 0;
-    return opts;
+    uint8_t leaf = unicode_class_mid[unicode_class_top[codepoint >> 11]][(codepoint >> 5) & 63];
+    uint8_t bits = unicode_class_leaf[leaf][(codepoint & 31) >> 2];
+    return (bits >> ((codepoint & 3) * 2)) & 3;
 }
 
-static size_t slugify_length(const char *input, const slugify_options_t *options)
-{
-    if (!input)
-        return 0;
-
-    slugify_options_t opts = options ? *options : slugify_default_options();
-    size_t estimated = 0;
+#ifndef SLUGIFY_NO_PINYIN
+#include "slugify_pinyin.h"
 
-    for (size_t i = 0; input[i] != '\0';)
+/* Pinyin of a BMP Han ideograph, NULL if it has none. The data is const,
+ * so its pages are only faulted in once Han text actually shows up. */
+static const char *pinyin_lookup(uint32_t codepoint)
+{
+    for (size_t r = 0; r < sizeof(pinyin_ranges) / sizeof(pinyin_ranges[0]); r++)
     {
-        size_t consumed;
-        uint32_t codepoint = utf8_decode(&input[i], &consumed);
+        if (codepoint < pinyin_ranges[r].first || codepoint > pinyin_ranges[r].last)
+            continue;
 
-        if (codepoint < 128)
-        {
-            char c = (char)codepoint;
-            if (isalnum(c))
-            {
-                estimated++;
-            }
-            else
-            {
-                const char *trans = transliterate_char(codepoint);
-                if (trans)
-                {
-                    estimated += strlen(trans);
-                }
-                else if (isspace((unsigned char)c) || ispunct((unsigned char)c))
-                {
-                    estimated++;
-                }
-            }
-        }
-        else if (opts.preserve_case)
-        {
-            estimated += consumed;
-        }
-        else
-        {
-            const char *trans = transliterate_char(codepoint);
-            if (trans)
-            {
-                estimated += strlen(trans);
-            }
-        }
+        uint32_t offset = codepoint - pinyin_ranges[r].first;
+        uint16_t block = pinyin_directory[pinyin_ranges[r].directory + (offset >> 6)];
+        if (block == PINYIN_NO_BLOCK)
+            return NULL;
 
-        i += consumed;
+        size_t bit = ((size_t)block * 64 + (offset & 63)) * PINYIN_BITS;
+        const uint8_t *p = &pinyin_blocks[bit >> 3];
+        unsigned index = ((unsigned)(p[0] | (p[1] << 8)) >> (bit & 7)) & ((1u << PINYIN_BITS) - 1);
+        return index ? pinyin_syllables[index - 1] : NULL;
     }
-
-    return estimated + 1; /* +1 for null terminator */
+    return NULL;
 }
+#endif
 
-static int slugify_ex(const char *input, char *output, size_t out_size,
-                      const slugify_options_t *options)
+/* Han ideographs are read one syllable at a time, so each is its own word */
+static int is_han(uint32_t codepoint)
 {
-    if (!input || !output || out_size == 0)
-    {
-        return SLUGIFY_ERROR_INVALID;
-    }
+    return (codepoint >= 0x3400 && codepoint <= 0x4DBF) ||
+           (codepoint >= 0x4E00 && codepoint <= 0x9FFF) ||
+           (codepoint >= 0xF900 && codepoint <= 0xFAFF) ||
+           (codepoint >= 0x20000 && codepoint <= 0x3134F);
+}
 
-    slugify_options_t opts = options ? *options : slugify_default_options();
-    size_t j = 0; // output index
+/* Hangul syllables are romanized arithmetically (Revised Romanization):
+ * U+AC00 + (lead * 21 + vowel) * 28 + tail. */
+#define HANGUL_FIRST 0xAC00
+#define HANGUL_LAST 0xD7A3
+#define HANGUL_VOWELS 21
+#define HANGUL_TAILS 28
+#define HANGUL_SILENT_LEAD 11 /* ㅇ, which takes the previous tail */
 
-    size_t input_len = strlen(input);
-    if (!is_utf8_valid(input, input_len))
-    {
-        return SLUGIFY_ERROR_INVALID;
-    }
+static const char hangul_leads[19][3] = {
+    "g", "kk", "n", "d", "tt", "r", "m", "b", "pp", "s",
+    "ss", "", "j", "jj", "ch", "k", "t", "p", "h"};
 
-    for (size_t i = 0; input[i] != '\0' && j < out_size - 1;)
-    {
+static const char hangul_vowels[HANGUL_VOWELS][4] = {
+    "a", "ae", "ya", "yae", "eo", "e", "yeo", "ye", "o", "wa",
+    "wae", "oe", "yo", "u", "wo", "we", "wi", "yu", "eu", "ui", "i"};
+
+/* Tail as written at the end of a word or before a consonant */
+static const char hangul_tails[HANGUL_TAILS][3] = {
+    "", "k", "k", "k", "n", "n", "n", "t", "l", "k",
+    "m", "l", "l", "l", "p", "l", "m", "p", "p", "t",
+    "t", "ng", "t", "t", "k", "t", "p", "t"};
+
+/* Tail as written when it carries over to a following silent lead */
+static const char hangul_liaisons[HANGUL_TAILS][3] = {
+    "", "g", "kk", "ks", "n", "nj", "n", "d", "r", "lg",
+    "lm", "lb", "ls", "lt", "lp", "r", "m", "b", "ps", "s",
+    "ss", "ng", "j", "ch", "k", "t", "p", ""};
+
+/* Hepburn romaji for U+3041..U+3096, shared by katakana at +0x60.
+ * The last four entries exist only for katakana (U+30F7..U+30FA). */
+#define KANA_HIRAGANA 0x3041
+#define KANA_KATAKANA 0x30A1
+#define KANA_HIRAGANA_COUNT 86
+#define KANA_KATAKANA_COUNT 90
+#define KANA_SMALL_TSU 0x22
+#define KANA_U 0x05
+
+static const char kana_romaji[KANA_KATAKANA_COUNT][4] = {
+    "a", "a", "i", "i", "u", "u", "e", "e", "o", "o",            /* 0x3041 */
+    "ka", "ga", "ki", "gi", "ku", "gu", "ke", "ge", "ko", "go",   /* 0x304B */
+    "sa", "za", "shi", "ji", "su", "zu", "se", "ze", "so", "zo",  /* 0x3055 */
+    "ta", "da", "chi", "ji", "", "tsu", "zu", "te", "de", "to",   /* 0x305F */
+    "do", "na", "ni", "nu", "ne", "no", "ha", "ba", "pa", "hi",   /* 0x3069 */
+    "bi", "pi", "fu", "bu", "pu", "he", "be", "pe", "ho", "bo",   /* 0x3073 */
+    "po", "ma", "mi", "mu", "me", "mo", "ya", "ya", "yu", "yu",   /* 0x307D */
+    "yo", "yo", "ra", "ri", "ru", "re", "ro", "wa", "wa", "i",    /* 0x3087 */
+    "e", "o", "n", "vu", "ka", "ke", "va", "vi", "ve", "vo"};     /* 0x3091 */
+
+/* Offset of a kana into kana_romaji, or -1 */
+static int kana_offset(uint32_t codepoint)
+{
+    if (codepoint >= KANA_HIRAGANA && codepoint < KANA_HIRAGANA + KANA_HIRAGANA_COUNT)
+        return (int)(codepoint - KANA_HIRAGANA);
+    if (codepoint >= KANA_KATAKANA && codepoint < KANA_KATAKANA + KANA_KATAKANA_COUNT)
+        return (int)(codepoint - KANA_KATAKANA);
+    return -1;
+}
+
+static int kana_is_small_y(int offset)
+{
+    return offset == 0x42 || offset == 0x44 || offset == 0x46;
+}
+
+static int kana_is_small_vowel(int offset)
+{
+    return offset >= 0 && offset <= 8 && (offset & 1) == 0;
+}
+
+static int is_vowel(char c)
+{
+    return c == 'a' || c == 'i' || c == 'u' || c == 'e' || c == 'o';
+}
+
+/* Decode the code point at offset i without consuming it. Returns 0 at the
+ * end of input or on a malformed sequence, which the main loop then reports. */
+static uint32_t peek_codepoint(const slug_input_t *in, size_t i, size_t *consumed)
+{
+    int is_valid = 0;
+    if (input_end(in, i))
+        return 0;
+    uint32_t codepoint = input_decode(in, i, consumed, &is_valid);
+    return is_valid ? codepoint : 0;
+}
+
+/* Romaji for the kana at offset, merged with a following small ya/yu/yo or
+ * small vowel (きゃ -> kya, ティ -> ti) and with the う that lengthens an
+ * o or u in hiragana (きょう -> kyo). Returns the code units consumed after
+ * the kana itself; out needs room for 6 bytes. The long vowel mark ー has no
+ * reading and is dropped like any other unmapped letter, matching Hepburn
+ * with its macrons stripped. */
+static size_t romanize_kana(const slug_input_t *in, size_t next, int offset, int hiragana, char *out)
+{
+    const char *romaji = kana_romaji[offset];
+    size_t len = strlen(romaji);
+    size_t extra = 0;
+    size_t consumed = 0;
+    int next_offset = kana_offset(peek_codepoint(in, next, &consumed));
+
+    memcpy(out, romaji, len + 1);
+
+    if (len >= 2 && romaji[len - 1] == 'i' && kana_is_small_y(next_offset))
+    {
+        // shi, chi and ji already carry the y sound
+        len--;
+        if (out[len - 1] != 'h' && out[len - 1] != 'j')
+            out[len++] = 'y';
+        out[len++] = kana_romaji[next_offset][1];
+        out[len] = '\0';
+        extra = consumed;
+    }
+    else if (len >= 1 && kana_is_small_vowel(next_offset) && (len >= 2 || romaji[0] == 'u') &&
+             is_vowel(romaji[len - 1]))
+    {
+        // ファ -> fa, ウィ -> wi
+        len--;
+        if (len == 0)
+            out[len++] = 'w';
+        out[len++] = kana_romaji[next_offset][0];
+        out[len] = '\0';
+        extra = consumed;
+    }
+
+    if (hiragana && len > 0 && (out[len - 1] == 'o' || out[len - 1] == 'u'))
+    {
+        size_t after = 0;
+        if (peek_codepoint(in, next + extra, &after) == KANA_HIRAGANA + KANA_U)
+            extra += after;
+    }
+    return extra;
+}
+
+/* The nine Indic scripts from Devanagari to Malayalam inherit the ISCII
+ * layout: each occupies 128 code points and the same offset holds the same
+ * letter, so one table serves all of them. Consonants are stored without
+ * their inherent a. */
+#define INDIC_FIRST 0x0900
+#define INDIC_LAST 0x0D7F
+#define INDIC_LETTERS 0x64
+#define INDIC_NUKTA 0x3C
+#define INDIC_VIRAMA 0x4D
+#define INDIC_DIGIT_ZERO 0x66
+#define GURMUKHI_TIPPI 0x0A70
+
+static const char indic_letters[INDIC_LETTERS][4] = {
+    "", "n", "n", "h", "a", "a", "a", "i",          /* 0x00 */
+    "i", "u", "u", "ri", "li", "e", "e", "e",       /* 0x08 */
+    "ai", "o", "o", "o", "au", "k", "kh", "g",      /* 0x10 */
+    "gh", "n", "ch", "chh", "j", "jh", "n", "t",    /* 0x18 */
+    "th", "d", "dh", "n", "t", "th", "d", "dh",     /* 0x20 */
+    "n", "n", "p", "ph", "b", "bh", "m", "y",       /* 0x28 */
+    "r", "r", "l", "l", "zh", "v", "sh", "sh",      /* 0x30 */
+    "s", "h", "", "", "", "", "a", "i",             /* 0x38 */
+    "i", "u", "u", "ri", "ri", "e", "e", "e",       /* 0x40 */
+    "ai", "o", "o", "o", "au", "", "", "",          /* 0x48 */
+    "om", "", "", "", "", "", "", "",               /* 0x50 */
+    "q", "kh", "gh", "z", "r", "rh", "f", "y",      /* 0x58 */
+    "ri", "li", "li", "li"};                        /* 0x60 */
+
+/* Per script, in block order: whether a word-final consonant drops its
+ * inherent a (Hindi भारत -> bharat), and how the anusvara is read. A
+ * consonant keeps the a before another letter or a nasal sign. */
+static const struct
+{
+    uint8_t final_schwa_deletion;
+    char anusvara;
+} indic_scripts[9] = {
+    {1, 'n'}, /* Devanagari */
+    {1, 'n'}, /* Bengali */
+    {1, 'n'}, /* Gurmukhi */
+    {1, 'n'}, /* Gujarati */
+    {0, 'n'}, /* Oriya */
+    {0, 'm'}, /* Tamil */
+    {0, 'm'}, /* Telugu */
+    {0, 'm'}, /* Kannada */
+    {0, 'm'}, /* Malayalam */
+};
+
+static int indic_is_vowel(unsigned offset)
+{
+    return (offset >= 0x04 && offset <= 0x14) || offset == 0x50 || offset == 0x60 || offset == 0x61;
+}
+
+static int indic_is_consonant(unsigned offset)
+{
+    return (offset >= 0x15 && offset <= 0x39) || (offset >= 0x58 && offset <= 0x5F);
+}
+
+static int indic_is_vowel_sign(unsigned offset)
+{
+    return (offset >= 0x3E && offset <= 0x4C) || offset == 0x62 || offset == 0x63;
+}
+
+/* Consonant plus nukta, as its precomposed offset (क + ़ -> क़ -> q) */
+static unsigned indic_nukta_form(unsigned offset)
+{
+    switch (offset)
+    {
+    case 0x15:
+        return 0x58;
+    case 0x16:
+        return 0x59;
+    case 0x17:
+        return 0x5A;
+    case 0x1C:
+        return 0x5B;
+    case 0x21:
+        return 0x5C;
+    case 0x22:
+        return 0x5D;
+    case 0x2B:
+        return 0x5E;
+    case 0x2F:
+        return 0x5F;
+    default:
+        return offset;
+    }
+}
+
+/* One Indic syllable: a vowel, or a consonant with an optional nukta
+ * followed by a virama, a vowel sign or the inherent a, then an optional
+ * candrabindu, anusvara or visarga. */
+static int romanize_indic(uint32_t codepoint, const slug_input_t *in, size_t next, char out[16], size_t *extra)
+{
+    uint32_t block = codepoint & ~(uint32_t)0x7F;
+    unsigned script = (codepoint - INDIC_FIRST) >> 7;
+    unsigned offset = codepoint & 0x7F;
+    size_t consumed = 0;
+    uint32_t following;
+
+    if (offset >= INDIC_DIGIT_ZERO && offset < INDIC_DIGIT_ZERO + 10)
+    {
+        out[0] = (char)('0' + offset - INDIC_DIGIT_ZERO);
+        out[1] = '\0';
+        return 1;
+    }
+    if (!indic_is_vowel(offset) && !indic_is_consonant(offset))
+        return 0;
+
+    following = peek_codepoint(in, next, &consumed);
+    if (indic_is_consonant(offset))
+    {
+        if (following == block + INDIC_NUKTA)
+        {
+            offset = indic_nukta_form(offset);
+            *extra += consumed;
+            following = peek_codepoint(in, next + *extra, &consumed);
+        }
+        strcpy(out, indic_letters[offset]);
+
+        unsigned sign = following - block;
+        if (following == block + INDIC_VIRAMA)
+        {
+            *extra += consumed;
+        }
+        else if (following >= block && sign < INDIC_LETTERS && indic_is_vowel_sign(sign))
+        {
+            strcat(out, indic_letters[sign]);
+            *extra += consumed;
+        }
+        else if (!indic_scripts[script].final_schwa_deletion || following == GURMUKHI_TIPPI ||
+                 (following >= block && sign < 0x80 &&
+                  (sign <= 0x03 || indic_is_vowel(sign) || indic_is_consonant(sign))))
+        {
+            strcat(out, "a");
+        }
+        following = peek_codepoint(in, next + *extra, &consumed);
+    }
+    else
+    {
+        strcpy(out, indic_letters[offset]);
+    }
+
+    // Nasalization and visarga close the syllable
+    if (following == block + 0x01 || following == block + 0x02 || following == block + 0x03 ||
+        following == GURMUKHI_TIPPI)
+    {
+        size_t len = strlen(out);
+        out[len] = (following == block + 0x03) ? 'h' : indic_scripts[script].anusvara;
+        out[len + 1] = '\0';
+        *extra += consumed;
+    }
+    return 1;
+}
+
+/* Thai consonants, standalone vowels and the leading vowels เ แ โ ใ ไ,
+ * which are written before the consonant they follow in speech */
+#define THAI_FIRST 0x0E00
+#define THAI_LAST 0x0E7F
+#define THAI_LETTERS 0x45
+#define THAI_LEADING_FIRST 0x0E40
+#define THAI_LEADING_LAST 0x0E44
+#define THAI_DIGIT_ZERO 0x0E50
+
+static const char thai_letters[THAI_LETTERS][4] = {
+    "", "k", "kh", "kh", "kh", "kh", "kh", "ng",    /* 0x0E00 */
+    "ch", "ch", "ch", "s", "ch", "y", "d", "t",     /* 0x0E08 */
+    "th", "th", "th", "n", "d", "t", "th", "th",    /* 0x0E10 */
+    "th", "n", "b", "p", "ph", "f", "ph", "f",      /* 0x0E18 */
+    "ph", "m", "y", "r", "rue", "l", "lue", "w",    /* 0x0E20 */
+    "s", "s", "s", "h", "l", "", "h", "",           /* 0x0E28 */
+    "a", "a", "a", "am", "i", "i", "ue", "ue",      /* 0x0E30 */
+    "u", "u", "", "", "", "", "", "",               /* 0x0E38 */
+    "e", "ae", "o", "ai", "ai"};                    /* 0x0E40 */
+
+static int thai_is_consonant(uint32_t codepoint)
+{
+    return codepoint >= 0x0E01 && codepoint <= 0x0E2E;
+}
+
+static int thai_is_mark(uint32_t codepoint)
+{
+    return codepoint == 0x0E31 || (codepoint >= 0x0E34 && codepoint <= 0x0E3A) ||
+           (codepoint >= 0x0E47 && codepoint <= 0x0E4E);
+}
+
+/* Append the vowel signs above and below a consonant; tone marks and the
+ * other diacritics have no romanization and are skipped. A run of stacked
+ * signs is consumed whole but only the first few fit into out. */
+static size_t thai_marks(const slug_input_t *in, size_t next, char out[16])
+{
+    size_t extra = 0;
+    size_t consumed = 0;
+    uint32_t following;
+
+    while (thai_is_mark(following = peek_codepoint(in, next + extra, &consumed)))
+    {
+        if (following - THAI_FIRST < THAI_LETTERS && strlen(out) + 2 < 11)
+            strcat(out, thai_letters[following - THAI_FIRST]);
+        extra += consumed;
+    }
+    return extra;
+}
+
+static int romanize_thai(uint32_t codepoint, const slug_input_t *in, size_t next, char out[16], size_t *extra)
+{
+    if (codepoint >= THAI_DIGIT_ZERO && codepoint < THAI_DIGIT_ZERO + 10)
+    {
+        out[0] = (char)('0' + codepoint - THAI_DIGIT_ZERO);
+        out[1] = '\0';
+        return 1;
+    }
+    if (codepoint - THAI_FIRST >= THAI_LETTERS || thai_letters[codepoint - THAI_FIRST][0] == '\0')
+        return 0;
+
+    if (codepoint >= THAI_LEADING_FIRST && codepoint <= THAI_LEADING_LAST)
+    {
+        // เ + ด -> de: the consonant is read first
+        size_t consumed = 0;
+        uint32_t consonant = peek_codepoint(in, next, &consumed);
+        if (!thai_is_consonant(consonant))
+        {
+            strcpy(out, thai_letters[codepoint - THAI_FIRST]);
+            return 1;
+        }
+        strcpy(out, thai_letters[consonant - THAI_FIRST]);
+        *extra = consumed;
+        *extra += thai_marks(in, next + *extra, out);
+
+        // เ-า is the diphthong ao
+        if (codepoint == THAI_LEADING_FIRST && peek_codepoint(in, next + *extra, &consumed) == 0x0E32)
+        {
+            strcat(out, "ao");
+            *extra += consumed;
+        }
+        else
+        {
+            strcat(out, thai_letters[codepoint - THAI_FIRST]);
+        }
+        return 1;
+    }
+
+    strcpy(out, thai_letters[codepoint - THAI_FIRST]);
+    if (thai_is_consonant(codepoint))
+        *extra = thai_marks(in, next, out);
+    return 1;
+}
+
+/* Romanize the Hangul, kana, Indic or Thai syllable starting at codepoint.
+ * next is the offset just past it; *extra receives how many further code
+ * units were folded in. Returns 0 when codepoint belongs to none of these scripts.
+ * Other scripts bail out after two range checks. */
+static int romanize_syllable(uint32_t codepoint, const slug_input_t *in, size_t next, char out[16], size_t *extra)
+{
+    *extra = 0;
+
+    if (codepoint >= INDIC_FIRST && codepoint <= INDIC_LAST)
+        return romanize_indic(codepoint, in, next, out, extra);
+    if (codepoint >= THAI_FIRST && codepoint <= THAI_LAST)
+        return romanize_thai(codepoint, in, next, out, extra);
+
+    if (codepoint >= HANGUL_FIRST && codepoint <= HANGUL_LAST)
+    {
+        uint32_t index = codepoint - HANGUL_FIRST;
+        unsigned tail = index % HANGUL_TAILS;
+        size_t consumed = 0;
+        uint32_t following = peek_codepoint(in, next, &consumed);
+        int liaison = following >= HANGUL_FIRST && following <= HANGUL_LAST &&
+                      (following - HANGUL_FIRST) / (HANGUL_VOWELS * HANGUL_TAILS) == HANGUL_SILENT_LEAD;
+
+        strcpy(out, hangul_leads[index / (HANGUL_VOWELS * HANGUL_TAILS)]);
+        strcat(out, hangul_vowels[(index / HANGUL_TAILS) % HANGUL_VOWELS]);
+        strcat(out, liaison ? hangul_liaisons[tail] : hangul_tails[tail]);
+        return 1;
+    }
+
+    int offset = kana_offset(codepoint);
+    if (offset < 0)
+        return 0;
+
+    if (offset == KANA_SMALL_TSU)
+    {
+        // っ doubles the consonant that follows: まっちゃ -> matcha
+        size_t consumed = 0;
+        uint32_t following = peek_codepoint(in, next, &consumed);
+        int next_offset = kana_offset(following);
+        out[0] = '\0';
+        if (next_offset >= 0 && next_offset != KANA_SMALL_TSU && !is_vowel(kana_romaji[next_offset][0]))
+        {
+            out[0] = (kana_romaji[next_offset][0] == 'c') ? 't' : kana_romaji[next_offset][0];
+            *extra = consumed + romanize_kana(in, next + consumed, next_offset,
+                                              following < KANA_KATAKANA, &out[1]);
+        }
+        return 1;
+    }
+
+    *extra = romanize_kana(in, next, offset, codepoint < KANA_KATAKANA, out);
+    return 1;
+}
+
+/* ASCII classification, shared with the inline fast path in slugify.h.
+ * Matches isalnum/isspace/ispunct in the C locale, with the bytes that have
+ * a transliteration entry ($ % & < > |) split out. */
+#define D SLUGIFY_CLASS_DROP
+#define L SLUGIFY_CLASS_LOWER
+#define U SLUGIFY_CLASS_UPPER
+#define S SLUGIFY_CLASS_SEPARATOR
+#define X SLUGIFY_CLASS_TRANSLIT
+const unsigned char slugify_ascii_class[128] = {
+    D, D, D, D, D, D, D, D, D, S, S, S, S, S, D, D, /* 0x00 */
+    D, D, D, D, D, D, D, D, D, D, D, D, D, D, D, D, /* 0x10 */
+    S, S, S, S, X, X, X, S, S, S, S, S, S, S, S, S, /* 0x20 */
+    L, L, L, L, L, L, L, L, L, L, S, S, X, S, X, S, /* 0x30 */
+    S, U, U, U, U, U, U, U, U, U, U, U, U, U, U, U, /* 0x40 */
+    U, U, U, U, U, U, U, U, U, U, U, S, S, S, S, S, /* 0x50 */
+    S, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, /* 0x60 */
+    L, L, L, L, L, L, L, L, L, L, L, S, X, S, S, D, /* 0x70 */
+};
+#undef D
+#undef L
+#undef U
+#undef S
+#undef X
+
+/* A lookup table is a sorted entry array searched with a binary search.
+ * The built-in table and tables from slugify_table_create() share this
+ * layout, so a custom table costs the same per character. */
+struct slugify_table
+{
+    const transliteration_entry_t *entries;
+    size_t count;
+    char *strings; /* Copies of the replacement strings, NULL for built-in */
+    int alnum;     /* Has an entry for an ASCII letter or digit */
+};
+
+static const slugify_table_t builtin_table = {
+    transliteration_table,
+    sizeof(transliteration_table) / sizeof(transliteration_table[0]) - 1, /* Skip end marker */
+    NULL,
+    0,
+};
+
+/* Binary search in transliteration table. Halving a window of fixed
+ * length lets the step compile to a conditional move, which costs less
+ * than the mispredicted branch of a search that stops early. */
+static const char *transliterate_char(const slugify_table_t *table, uint32_t codepoint)
+{
+    const transliteration_entry_t *base = table->entries;
+    size_t n = table->count;
+    if (n == 0)
+        return NULL;
+    while (n > 1)
+    {
+        size_t half = n >> 1;
+        base = (base[half].unicode <= codepoint) ? base + half : base;
+        n -= half;
+    }
+    return base->unicode == codepoint ? base->ascii : NULL;
+}
+
+typedef struct
+{
+    uint32_t unicode;
+    size_t index;
+} table_sort_key_t;
+
+static int compare_sort_keys(const void *a, const void *b)
+{
+    const table_sort_key_t *ka = a, *kb = b;
+    if (ka->unicode != kb->unicode)
+        return ka->unicode < kb->unicode ? -1 : 1;
+    return ka->index < kb->index ? -1 : (ka->index > kb->index);
+}
+
+static slugify_table_t *table_merge(const slugify_table_t *base,
+                                    const transliteration_entry_t *entries, size_t count)
+{
+    if (!entries && count > 0)
+        return NULL;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        uint32_t u = entries[i].unicode;
+        if (u == 0 || u > UNICODE_MAX_CODEPOINT ||
+            (u >= UNICODE_SURROGATE_HIGH_START && u <= UNICODE_SURROGATE_LOW_END))
+            return NULL;
+    }
+
+    // Sort user entries by code point; for duplicates the last one wins
+    table_sort_key_t *keys = malloc((count ? count : 1) * sizeof(*keys));
+    if (!keys)
+        return NULL;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        keys[i].unicode = entries[i].unicode;
+        keys[i].index = i;
+    }
+    qsort(keys, count, sizeof(*keys), compare_sort_keys);
+
+    size_t unique = 0;
+    size_t string_bytes = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (i + 1 < count && keys[i + 1].unicode == keys[i].unicode)
+            continue;
+
+        const char *ascii = entries[keys[i].index].ascii;
+        keys[unique++] = keys[i];
+        string_bytes += (ascii ? strlen(ascii) : 0) + 1;
+    }
+
+    slugify_table_t *table = calloc(1, sizeof(*table));
+    transliteration_entry_t *merged = malloc((base->count + unique) * sizeof(*merged));
+    char *strings = malloc(string_bytes ? string_bytes : 1);
+    if (!table || !merged || !strings)
+    {
+        free(keys);
+        free(table);
+        free(merged);
+        free(strings);
+        return NULL;
+    }
+
+    // Merge with the base entries, user entries override
+    table->alnum = base->alnum;
+    size_t b = 0, u = 0, n = 0;
+    char *next = strings;
+    while (b < base->count || u < unique)
+    {
+        if (u == unique || (b < base->count && base->entries[b].unicode < keys[u].unicode))
+        {
+            merged[n++] = base->entries[b++];
+            continue;
+        }
+
+        if (b < base->count && base->entries[b].unicode == keys[u].unicode)
+            b++;
+
+        const char *ascii = entries[keys[u].index].ascii;
+        size_t len = ascii ? strlen(ascii) : 0;
+        memcpy(next, ascii ? ascii : "", len + 1);
+        if (keys[u].unicode < 128 && (slugify_ascii_class[keys[u].unicode] == SLUGIFY_CLASS_LOWER ||
+                                      slugify_ascii_class[keys[u].unicode] == SLUGIFY_CLASS_UPPER))
+            table->alnum = 1;
+
+        merged[n].unicode = keys[u].unicode;
+        merged[n].ascii = next;
+        n++;
+        next += len + 1;
+        u++;
+    }
+
+    free(keys);
+    table->entries = merged;
+    table->count = n;
+    table->strings = strings;
+    return table;
+}
+
+void slugify_table_free(slugify_table_t *table)
+{
+    if (!table)
+        return;
+
+    free((void *)table->entries);
+    free(table->strings);
+    free(table);
+}
+
+/* Language profiles: the built-in table with each profile's overrides merged in */
+#include "slugify_languages.h"
+
+/* Fails to compile when transliteration_table has changed since the profiles were generated */
+typedef char language_tables_current[sizeof(transliteration_table) / sizeof(transliteration_table[0]) - 1 ==
+                                             LANGUAGE_BASE_COUNT ? 1 : -1];
+
+slugify_table_t *slugify_table_create(const transliteration_entry_t *entries, size_t count)
+{
+    return table_merge(&builtin_table, entries, count);
+}
+
+slugify_table_t *slugify_table_create_for(int language, const transliteration_entry_t *entries,
+                                          size_t count)
+{
+    if (language < 0 || language >= SLUGIFY_LANG_COUNT)
+        return NULL;
+    if (language == SLUGIFY_LANG_DEFAULT)
+        return table_merge(&builtin_table, entries, count);
+
+    return table_merge(&language_tables[language], entries, count);
+}
+
+/* Picks the lookup table for a call; NULL for an unknown language */
+static const slugify_table_t *resolve_table(const slugify_options_t *opts, int *rc)
+{
+    *rc = SLUGIFY_SUCCESS;
+    if (opts->table)
+        return opts->table;
+    if (opts->language == SLUGIFY_LANG_DEFAULT)
+        return &builtin_table;
+    if (opts->language < 0 || opts->language >= SLUGIFY_LANG_COUNT)
+    {
+        *rc = SLUGIFY_ERROR_INVALID;
+        return NULL;
+    }
+    return &language_tables[opts->language];
+}
+
+static const slugify_options_t slugify_defaults = {.preserve_case = false, .separator = '-', .max_length = 0};
+
+static slugify_options_t slugify_default_options(void)
+{
+    return slugify_defaults;
+}
+
+/* Stop words: compress-hash-displace (CHD) perfect hashing. A first hash
+ * picks a bucket, the bucket's displacement seeds a second hash that gives
+ * each word its own slot, so a lookup is two hashes and one compare. The
+ * built-in sets are generated offline with the same hash; user sets are
+ * built by slugify_stop_words_create(). */
+#define STOP_WORD_EMPTY 0xFFFF
+#define STOP_WORD_MAX_SEED 0xFFFF
+
+struct slugify_stop_words
+{
+    const char *const *words; /* Lower case */
+    const uint16_t *displacements;
+    const uint16_t *slots;    /* Index into words, or STOP_WORD_EMPTY */
+    uint32_t count;
+    uint32_t buckets;
+    uint32_t size;
+    char *strings;            /* Owned storage, NULL for built-in sets */
+};
+
+static const char *const english_stop_words[33] = {
+    "a", "an", "and", "are", "as", "at", "be", "but", "by", "for", "from", "has",
+    "have", "he", "in", "is", "it", "its", "of", "on", "or", "she", "so", "that", "the",
+    "their", "they", "this", "to", "was", "were", "will", "with",
+};
+static const uint16_t english_stop_displacements[12] = {
+    2, 10, 1, 3, 2, 4, 5, 0, 2, 3, 25, 14,
+};
+static const uint16_t english_stop_slots[42] = {
+    13, 21, 0xFFFF, 14, 7, 11, 27, 9, 24, 4, 25, 20,
+    2, 0xFFFF, 16, 23, 31, 1, 5, 30, 0xFFFF, 0xFFFF, 0, 28,
+    3, 0xFFFF, 10, 17, 12, 15, 0xFFFF, 18, 6, 26, 32, 29,
+    19, 0xFFFF, 8, 22, 0xFFFF, 0xFFFF,
+};
+
+static const char *const german_stop_words[47] = {
+    "aber", "als", "am", "an", "auch", "auf", "aus", "bei", "das", "dass", "dem", "den",
+    "der", "des", "die", "ein", "eine", "einem", "einen", "einer", "eines", "es",
+    "fuer", "fur", "im", "in", "ist", "mit", "nach", "nicht", "oder", "sich", "sie",
+    "sind", "so", "uber", "ueber", "um", "und", "vom", "von", "vor", "war", "wie", "zu",
+    "zum", "zur",
+};
+static const uint16_t german_stop_displacements[16] = {
+    2, 3, 2, 1, 5, 1, 15, 6, 1, 3, 2, 24,
+    8, 1, 31, 1,
+};
+static const uint16_t german_stop_slots[59] = {
+    38, 13, 23, 0xFFFF, 21, 25, 37, 44, 1, 45, 31, 43,
+    0xFFFF, 7, 3, 35, 12, 0xFFFF, 40, 33, 11, 32, 16, 39,
+    28, 20, 30, 19, 15, 18, 22, 0xFFFF, 41, 6, 8, 0xFFFF,
+    0xFFFF, 4, 42, 29, 46, 24, 26, 0xFFFF, 0xFFFF, 2, 0xFFFF, 0,
+    0xFFFF, 0xFFFF, 34, 27, 17, 5, 9, 10, 0xFFFF, 14, 36,
+};
+static const slugify_stop_words_t builtin_stop_words[] = {
+    {english_stop_words, english_stop_displacements, english_stop_slots, 33, 12, 42, NULL},
+    {german_stop_words, german_stop_displacements, german_stop_slots, 47, 16, 59, NULL},
+};
+
+/* FNV-1a over ASCII-folded bytes, with the seed mixed into the basis */
+static uint32_t stop_word_hash(const char *word, size_t len, uint32_t seed)
+{
+    uint32_t h = 2166136261u ^ (seed * 0x9E3779B9u);
+    for (size_t k = 0; k < len; k++)
+    {
+        unsigned char c = (unsigned char)word[k];
+        if (c >= 'A' && c <= 'Z')
+            c = (unsigned char)(c + ('a' - 'A'));
+        h ^= c;
+        h *= 16777619u;
+    }
+    return h ^ (h >> 16);
+}
+
+static int stop_words_contains(const slugify_stop_words_t *set, const char *word, size_t len)
+{
+    if (set->count == 0)
+        return 0;
+
+    uint32_t seed = set->displacements[stop_word_hash(word, len, 0) % set->buckets];
+    uint16_t index = set->slots[stop_word_hash(word, len, seed) % set->size];
+    if (index == STOP_WORD_EMPTY)
+        return 0;
+
+    const char *candidate = set->words[index];
+    for (size_t k = 0; k < len; k++)
+    {
+        unsigned char c = (unsigned char)word[k];
+        if (c >= 'A' && c <= 'Z')
+            c = (unsigned char)(c + ('a' - 'A'));
+        if ((unsigned char)candidate[k] != c)
+            return 0;
+    }
+    return candidate[len] == '\0';
+}
+
+const slugify_stop_words_t *slugify_stop_words_builtin(int language)
+{
+    switch (language)
+    {
+    case SLUGIFY_LANG_DEFAULT:
+        return &builtin_stop_words[0];
+    case SLUGIFY_LANG_GERMAN:
+        return &builtin_stop_words[1];
+    default:
+        return NULL;
+    }
+}
+
+/* Finds a displacement for every bucket. order lists the words grouped by
+ * bucket, biggest buckets first. Returns 0 when some bucket has no free
+ * seed, so the caller retries with more slots. */
+static int stop_words_place(slugify_stop_words_t *set, uint16_t *displacements, uint16_t *slots,
+                            const uint32_t *bucket_of, const uint32_t *order)
+{
+    for (uint32_t k = 0; k < set->size; k++)
+        slots[k] = STOP_WORD_EMPTY;
+
+    for (uint32_t start = 0; start < set->count;)
+    {
+        uint32_t bucket = bucket_of[order[start]];
+        uint32_t end = start + 1;
+        while (end < set->count && bucket_of[order[end]] == bucket)
+            end++;
+
+        uint32_t seed;
+        for (seed = 1; seed <= STOP_WORD_MAX_SEED; seed++)
+        {
+            uint32_t k;
+            for (k = start; k < end; k++)
+            {
+                const char *word = set->words[order[k]];
+                uint32_t slot = stop_word_hash(word, strlen(word), seed) % set->size;
+                if (slots[slot] != STOP_WORD_EMPTY)
+                    break;
+                slots[slot] = (uint16_t)order[k];
+            }
+            if (k == end)
+                break;
+
+            // Collision: undo this bucket's placements and try the next seed
+            while (k-- > start)
+            {
+                const char *word = set->words[order[k]];
+                slots[stop_word_hash(word, strlen(word), seed) % set->size] = STOP_WORD_EMPTY;
+            }
+        }
+        if (seed > STOP_WORD_MAX_SEED)
+            return 0;
+
+        displacements[bucket] = (uint16_t)seed;
+        start = end;
+    }
+    return 1;
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+slugify_stop_words_t *slugify_stop_words_create(const slugify_stop_words_t *base,
+                                                const char *const *words, size_t count)
+{
+    if (!words && count > 0)
+        return NULL;
+
+    size_t base_count = base ? base->count : 0;
+    size_t total = base_count + count;
+    size_t string_bytes = 0;
+    if (total >= STOP_WORD_EMPTY)
+        return NULL;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        size_t len = words[i] ? strlen(words[i]) : 0;
+        if (len == 0 || len > SLUGIFY_STOP_WORD_MAX)
+            return NULL;
+        string_bytes += len + 1;
+    }
+    for (size_t i = 0; i < base_count; i++)
+        string_bytes += strlen(base->words[i]) + 1;
+
+    slugify_stop_words_t *set = calloc(1, sizeof(*set));
+    const char **list = malloc((total ? total : 1) * sizeof(*list));
+    char *strings = malloc(string_bytes ? string_bytes : 1);
+    if (!set || !list || !strings)
+    {
+        free(set);
+        free(list);
+        free(strings);
+        return NULL;
+    }
+    set->words = list;
+    set->strings = strings;
+
+    // Copy the words in lower case, skipping duplicates
+    char *next = strings;
+    uint32_t n = 0;
+    for (size_t i = 0; i < total; i++)
+    {
+        const char *word = (i < base_count) ? base->words[i] : words[i - base_count];
+        size_t len = strlen(word);
+        for (size_t k = 0; k <= len; k++)
+            next[k] = (char)tolower((unsigned char)word[k]);
+
+        uint32_t j;
+        for (j = 0; j < n && strcmp(list[j], next) != 0; j++)
+            ;
+        if (j < n)
+            continue;
+        list[n++] = next;
+        next += len + 1;
+    }
+
+    set->count = n;
+    set->buckets = n / 3 + 1;
+    set->size = n + n / 4 + 1;
+
+    uint16_t *displacements = calloc(set->buckets, sizeof(*displacements));
+    uint32_t *bucket_of = malloc((n ? n : 1) * sizeof(*bucket_of));
+    uint32_t *order = malloc((n ? n : 1) * sizeof(*order));
+    uint32_t *bucket_size = calloc(set->buckets, sizeof(*bucket_size));
+    uint64_t *keys = malloc(set->buckets * sizeof(*keys));
+    uint16_t *slots = NULL;
+    int placed = 0;
+    set->displacements = displacements;
+
+    if (displacements && bucket_of && order && bucket_size && keys)
+    {
+        for (uint32_t i = 0; i < n; i++)
+        {
+            bucket_of[i] = stop_word_hash(list[i], strlen(list[i]), 0) % set->buckets;
+            bucket_size[bucket_of[i]]++;
+        }
+
+        // Buckets by descending size, then the words of each bucket in turn
+        for (uint32_t b = 0; b < set->buckets; b++)
+            keys[b] = ((uint64_t)(n - bucket_size[b]) << 32) | b;
+        qsort(keys, set->buckets, sizeof(*keys), compare_u64);
+
+        uint32_t filled = 0;
+        for (uint32_t b = 0; b < set->buckets; b++)
+            bucket_size[(uint32_t)keys[b]] = (filled += bucket_size[(uint32_t)keys[b]]);
+        for (uint32_t i = n; i-- > 0;)
+            order[--bucket_size[bucket_of[i]]] = i;
+
+        // A bigger table makes free slots easier to find
+        for (int attempt = 0; attempt < 8 && !placed; attempt++)
+        {
+            free(slots);
+            slots = malloc(set->size * sizeof(*slots));
+            if (!slots)
+                break;
+            placed = stop_words_place(set, displacements, slots, bucket_of, order);
+            if (!placed)
+                set->size += set->size / 8 + 1;
+        }
+    }
+
+    free(bucket_of);
+    free(order);
+    free(bucket_size);
+    free(keys);
+    set->slots = slots;
+    if (!placed)
+    {
+        slugify_stop_words_free(set);
+        return NULL;
+    }
+    return set;
+}
+
+void slugify_stop_words_free(slugify_stop_words_t *stop_words)
+{
+    if (!stop_words || !stop_words->strings)
+        return;
+
+    free((void *)stop_words->words);
+    free((void *)stop_words->displacements);
+    free((void *)stop_words->slots);
+    free(stop_words->strings);
+    free(stop_words);
+}
+
+/* Output writer shared by the sizing and the emitting pass.
+ * When out is NULL nothing is stored and only len is advanced, which lets
+ * slugify_length() run the exact same logic as slugify_ex().
+ * Separators are held back until the next byte arrives, so a trailing
+ * separator is never written and never counted.
+ * With stop words, a word is held back in word[] until it ends at a
+ * separator. It is then either dropped or written.
+ * The only rollback is SLUGIFY_TRUNCATE_WORD, which returns to mark once
+ * the loop stops. Bytes past cap are then skipped rather than failing,
+ * since the rollback may bring len back under it.
+ * With percent_encode, writer_raw() turns a byte into %XX as a whole, and
+ * len, mark and max_length count the escaped bytes. word[] and pending
+ * stay unescaped until they are written.
+ * With a sink, out is a staging buffer holding bytes [flushed, len). When it
+ * fills, everything up to len (or up to mark, when a rollback is possible)
+ * goes to the sink and the rest moves to the front.
+ * With hash, every full stripe that no rollback can take back is hashed
+ * from out as soon as it is written, while it is still in cache; hashed is
+ * where the hash has got to. */
+#define XXH_PRIME64_1 0x9E3779B185EBCA87ull
+#define XXH_PRIME64_2 0xC2B2AE3D27D4EB4Full
+#define XXH_PRIME64_3 0x165667B19E3779F9ull
+#define XXH_PRIME64_4 0x85EBCA77C2B2AE63ull
+#define XXH_PRIME64_5 0x27D4EB2F165667C5ull
+#define XXH_STRIPE 32
+
+/* Streaming XXH64 with seed 0. Whole stripes are read straight from the
+ * caller's bytes; only a partial one is copied into mem. */
+typedef struct
+{
+    uint64_t acc[4];
+    uint64_t total;
+    size_t mem_len;
+    unsigned char mem[XXH_STRIPE];
+} slug_hash_t;
+
+static uint64_t xxh_rotl(uint64_t x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+static uint64_t xxh_read64(const unsigned char *p)
+{
+    return (uint64_t)p[0] | (uint64_t)p[1] << 8 | (uint64_t)p[2] << 16 | (uint64_t)p[3] << 24 |
+           (uint64_t)p[4] << 32 | (uint64_t)p[5] << 40 | (uint64_t)p[6] << 48 | (uint64_t)p[7] << 56;
+}
+
+static uint64_t xxh_round(uint64_t acc, uint64_t lane)
+{
+    acc += lane * XXH_PRIME64_2;
+    return xxh_rotl(acc, 31) * XXH_PRIME64_1;
+}
+
+static uint64_t xxh_merge(uint64_t h, uint64_t acc)
+{
+    h ^= xxh_round(0, acc);
+    return h * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+static void hash_init(slug_hash_t *h)
+{
+    h->acc[0] = XXH_PRIME64_1 + XXH_PRIME64_2;
+    h->acc[1] = XXH_PRIME64_2;
+    h->acc[2] = 0;
+    h->acc[3] = 0 - XXH_PRIME64_1;
+    h->total = 0;
+    h->mem_len = 0;
+}
+
+static void hash_stripe(slug_hash_t *h, const unsigned char *p)
+{
+    for (int k = 0; k < 4; k++)
+        h->acc[k] = xxh_round(h->acc[k], xxh_read64(p + 8 * k));
+}
+
+static void hash_update(slug_hash_t *h, const char *data, size_t len)
+{
+    const unsigned char *p = (const unsigned char *)data;
+    h->total += len;
+
+    if (h->mem_len > 0)
+    {
+        size_t fill = XXH_STRIPE - h->mem_len < len ? XXH_STRIPE - h->mem_len : len;
+        memcpy(h->mem + h->mem_len, p, fill);
+        h->mem_len += fill;
+        p += fill;
+        len -= fill;
+        if (h->mem_len < XXH_STRIPE)
+            return;
+        hash_stripe(h, h->mem);
+        h->mem_len = 0;
+    }
+    for (; len >= XXH_STRIPE; p += XXH_STRIPE, len -= XXH_STRIPE)
+        hash_stripe(h, p);
+    memcpy(h->mem, p, len);
+    h->mem_len = len;
+}
+
+static uint64_t hash_final(const slug_hash_t *h)
+{
+    uint64_t x;
+    if (h->total >= XXH_STRIPE)
+    {
+        x = xxh_rotl(h->acc[0], 1) + xxh_rotl(h->acc[1], 7) + xxh_rotl(h->acc[2], 12) +
+            xxh_rotl(h->acc[3], 18);
+        for (int k = 0; k < 4; k++)
+            x = xxh_merge(x, h->acc[k]);
+    }
+    else
+    {
+        x = XXH_PRIME64_5;
+    }
+    x += h->total;
+
+    const unsigned char *p = h->mem;
+    size_t len = h->mem_len;
+    for (; len >= 8; p += 8, len -= 8)
+        x = xxh_rotl(x ^ xxh_round(0, xxh_read64(p)), 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+    if (len >= 4)
+    {
+        uint64_t lane = (uint64_t)p[0] | (uint64_t)p[1] << 8 | (uint64_t)p[2] << 16 | (uint64_t)p[3] << 24;
+        x = xxh_rotl(x ^ lane * XXH_PRIME64_1, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        p += 4;
+        len -= 4;
+    }
+    for (; len > 0; p++, len--)
+        x = xxh_rotl(x ^ *p * XXH_PRIME64_5, 11) * XXH_PRIME64_1;
+
+    x ^= x >> 33;
+    x *= XXH_PRIME64_2;
+    x ^= x >> 29;
+    x *= XXH_PRIME64_3;
+    return x ^ (x >> 32);
+}
+
+#define WORD_NONE 0    /* Between words */
+#define WORD_HELD 1    /* Short enough to be a stop word, held in word[] */
+#define WORD_WRITTEN 2 /* Too long to be a stop word, written through */
+
+typedef struct
+{
+    char *out;
+    size_t cap;
+    size_t len;
+    char last;    /* Last byte emitted, needed for separator collapsing */
+    char pending; /* Separator waiting for the next byte */
+    const slugify_stop_words_t *stop_words;
+    int word_state;
+    size_t word_len;
+    char word[SLUGIFY_STOP_WORD_MAX];
+    size_t mark;        /* len before the separator of the last word */
+    int truncated;      /* max_length stopped in the middle of a transliteration */
+    int defer_overflow; /* Report a full buffer after the rollback */
+    int escape;         /* percent_encode */
+    slugify_sink_t sink;
+    void *sink_ctx;
+    size_t flushed;    /* Bytes already handed to the sink */
+    slug_hash_t *hash; /* Hash of the output, NULL for none; not used with a sink */
+    size_t hashed;
+    int direct; /* No stop words, escaping, sink, rollback or hash: bytes go straight to out */
+} slug_writer_t;
+
+/* Hashes the stripes written since the last call, up to the rollback point */
+static void writer_hash(slug_writer_t *w)
+{
+    size_t upto = w->defer_overflow ? w->mark : w->len;
+    size_t n = (upto - w->hashed) & ~(size_t)(XXH_STRIPE - 1);
+    // Past cap, defer_overflow skips the bytes and the call fails anyway
+    if (n > 0 && w->hashed + n < w->cap)
+    {
+        hash_update(w->hash, &w->out[w->hashed], n);
+        w->hashed += n;
+    }
+}
+
+/* Hands the staged bytes before upto to the sink */
+static int writer_flush(slug_writer_t *w, size_t upto)
+{
+    size_t n = upto - w->flushed;
+    if (n == 0)
+        return SLUGIFY_SUCCESS;
+    if (w->sink(w->sink_ctx, w->out, n) != 0)
+        return SLUGIFY_ERROR_SINK;
+    memmove(w->out, w->out + n, w->len - upto);
+    w->flushed = upto;
+    return SLUGIFY_SUCCESS;
+}
+
+/* Output bytes for c: 3 for a %XX escape, otherwise 1 */
+static size_t writer_width(const slug_writer_t *w, char c)
+{
+    unsigned char u = (unsigned char)c;
+    if (!w->escape || (u < 128 && (slugify_ascii_class[u] == SLUGIFY_CLASS_LOWER ||
+                                   slugify_ascii_class[u] == SLUGIFY_CLASS_UPPER)))
+        return 1;
+    return (c == '-' || c == '.' || c == '_' || c == '~') ? 1 : 3;
+}
+
+/* writer_raw() for a byte that needs a %XX escape, which is never split */
+static int writer_escaped(slug_writer_t *w, char c)
+{
+    static const char hex[] = "0123456789ABCDEF";
+    unsigned char u = (unsigned char)c;
+    char escape[3] = {'%', hex[u >> 4], hex[u & 0xF]};
+
+    if (w->out)
+    {
+        if (w->sink && w->len - w->flushed + 3 >= w->cap)
+        {
+            int rc = writer_flush(w, w->defer_overflow ? w->mark : w->len);
+            if (rc != SLUGIFY_SUCCESS)
+                return rc;
+        }
+        if (w->len - w->flushed + 3 < w->cap)
+            memcpy(&w->out[w->len - w->flushed], escape, 3);
+        else if (!w->defer_overflow)
+            return SLUGIFY_ERROR_BUFFER;
+    }
+    w->len += 3;
+    w->last = c;
+    if (w->hash && w->len - w->hashed >= XXH_STRIPE)
+        writer_hash(w);
+    return SLUGIFY_SUCCESS;
+}
+
+static int writer_raw(slug_writer_t *w, char c)
+{
+    if (w->escape && writer_width(w, c) == 3)
+        return writer_escaped(w, c);
+
+    if (w->out)
+    {
+        if (w->sink && w->len - w->flushed + 1 >= w->cap)
+        {
+            int rc = writer_flush(w, w->defer_overflow ? w->mark : w->len);
+            if (rc != SLUGIFY_SUCCESS)
+                return rc;
+        }
+        if (w->len - w->flushed + 1 < w->cap)
+            w->out[w->len - w->flushed] = c;
+        else if (!w->defer_overflow)
+            return SLUGIFY_ERROR_BUFFER;
+    }
+    w->len++;
+    w->last = c;
+    if (w->hash && w->len - w->hashed >= XXH_STRIPE)
+        writer_hash(w);
+    return SLUGIFY_SUCCESS;
+}
+
+/* Copies a run of ASCII letters, digits and separators for a direct writer,
+ * keeping len in a register instead of reloading it after every byte
+ * store. Separators collapse as in writer_separator(). Stops before a byte
+ * that does not fit, which the general path then reports. Returns the bytes
+ * read. */
+static size_t writer_ascii_run(slug_writer_t *w, const char *input, int preserve_case, char separator)
+{
+    char *out = w->out;
+    size_t len = w->len;
+    size_t end = out ? w->cap - 1 : SIZE_MAX;
+    char last = w->last;
+    char pending = w->pending;
+    size_t k = 0;
+    for (;; k++)
+    {
+        unsigned char c = (unsigned char)input[k];
+        if (c >= 128)
+            break;
+        int cls = slugify_ascii_class[c];
+        if (cls == SLUGIFY_CLASS_SEPARATOR)
+        {
+            if (len > 0 && !pending && last != separator)
+                pending = separator;
+            continue;
+        }
+        if (cls == SLUGIFY_CLASS_UPPER)
+        {
+            if (!preserve_case)
+                c = (unsigned char)(c + ('a' - 'A'));
+        }
+        else if (cls != SLUGIFY_CLASS_LOWER)
+        {
+            break;
+        }
+
+        size_t n = pending ? 2 : 1;
+        if (len + n > end)
+            break;
+        if (out)
+        {
+            out[len] = pending;
+            out[len + n - 1] = (char)c;
+        }
+        len += n;
+        pending = 0;
+        last = (char)c;
+    }
+    w->len = len;
+    w->last = last;
+    w->pending = pending;
+    return k;
+}
+
+/* writer_put_trans() for a direct writer: one pass over trans with len and
+ * the pending separator in registers, where every byte is one output byte.
+ * limit is max_length, or SIZE_MAX for none. */
+static int writer_trans_run(slug_writer_t *w, const char *trans, int preserve_case, char separator, size_t limit)
+{
+    char *out = w->out;
+    size_t len = w->len;
+    size_t end = out ? w->cap - 1 : SIZE_MAX;
+    char last = w->last;
+    char pending = w->pending;
+    int rc = SLUGIFY_SUCCESS;
+    for (size_t k = 0; trans[k] != '\0'; k++)
+    {
+        char c = trans[k];
+        if (!preserve_case && c >= 'A' && c <= 'Z')
+            c = (char)(c + ('a' - 'A'));
+        if (c == separator)
+        {
+            if (len > 0 && !pending && last != separator)
+                pending = separator;
+            continue;
+        }
+
+        size_t n = pending ? 2 : 1;
+        if (len + n > limit)
+        {
+            w->truncated = 1;
+            break;
+        }
+        if (len + n > end)
+        {
+            rc = SLUGIFY_ERROR_BUFFER;
+            break;
+        }
+        if (out)
+        {
+            out[len] = pending;
+            out[len + n - 1] = c;
+        }
+        len += n;
+        pending = 0;
+        last = c;
+    }
+    w->len = len;
+    w->last = last;
+    w->pending = pending;
+    return rc;
+}
+
+/* Length including the pending separator and any held word */
+static size_t writer_length(const slug_writer_t *w)
+{
+    size_t len = w->len + (w->pending ? writer_width(w, w->pending) : 0) + w->word_len;
+    for (size_t k = 0; w->escape && k < w->word_len; k++)
+        len += writer_width(w, w->word[k]) - 1;
+    return len;
+}
+
+/* Writes the held word, with the separator in front of it */
+static int writer_release(slug_writer_t *w)
+{
+    if (w->pending)
+    {
+        w->mark = w->len;
+        int rc = writer_raw(w, w->pending);
+        if (rc != SLUGIFY_SUCCESS)
+            return rc;
+        w->pending = 0;
+    }
+    for (size_t k = 0; k < w->word_len; k++)
+    {
+        int rc = writer_raw(w, w->word[k]);
+        if (rc != SLUGIFY_SUCCESS)
+            return rc;
+    }
+    w->word_len = 0;
+    return SLUGIFY_SUCCESS;
+}
+
+static int writer_put(slug_writer_t *w, char c)
+{
+    // One test stands in for all of the checks below
+    if (w->direct)
+    {
+        size_t n = w->pending ? 2 : 1;
+        if (w->out)
+        {
+            if (w->len + n >= w->cap)
+                return SLUGIFY_ERROR_BUFFER;
+            w->out[w->len] = w->pending;
+            w->out[w->len + n - 1] = c;
+        }
+        w->len += n;
+        w->pending = 0;
+        w->last = c;
+        return SLUGIFY_SUCCESS;
+    }
+
+    if (w->stop_words && w->word_state != WORD_WRITTEN)
+    {
+        if (w->word_len < SLUGIFY_STOP_WORD_MAX)
+        {
+            w->word[w->word_len++] = c;
+            w->word_state = WORD_HELD;
+            w->last = c;
+            return SLUGIFY_SUCCESS;
+        }
+
+        int rc = writer_release(w);
+        if (rc != SLUGIFY_SUCCESS)
+            return rc;
+        w->word_state = WORD_WRITTEN;
+    }
+
+    if (w->pending)
+    {
+        w->mark = w->len;
+        int rc = writer_raw(w, w->pending);
+        if (rc != SLUGIFY_SUCCESS)
+            return rc;
+        w->pending = 0;
+    }
+    return writer_raw(w, c);
+}
+
+/* Closes the current word. A held stop word is dropped together with its
+ * separator; complete is 0 when max_length cut the word short. */
+static int writer_end_word(slug_writer_t *w, int complete)
+{
+    int rc = SLUGIFY_SUCCESS;
+    if (w->word_state == WORD_HELD)
+    {
+        if (complete && stop_words_contains(w->stop_words, w->word, w->word_len))
+            w->word_len = 0;
+        else
+            rc = writer_release(w);
+    }
+    w->word_state = WORD_NONE;
+    return rc;
+}
+
+/* True once the current word has ended at a separator */
+static int writer_between_words(const slug_writer_t *w)
+{
+    return w->stop_words ? w->word_state == WORD_NONE : w->pending != 0;
+}
+
+/* SLUGIFY_TRUNCATE_WORD: drops the word max_length cut short, together with
+ * the separator in front of it. A first word has nothing to fall back to
+ * and keeps its cut. */
+static void writer_cut_word(slug_writer_t *w)
+{
+    if (w->word_state == WORD_HELD)
+    {
+        if (w->len == 0)
+            return;
+        w->word_len = 0;
+    }
+    else if (w->mark > 0)
+    {
+        w->len = w->mark;
+    }
+    else
+    {
+        return;
+    }
+    w->pending = 0;
+    w->word_state = WORD_NONE;
+}
+
+static int writer_separator(slug_writer_t *w, char separator)
+{
+    if (w->word_state != WORD_NONE)
+    {
+        int rc = writer_end_word(w, 1);
+        if (rc != SLUGIFY_SUCCESS)
+            return rc;
+    }
+
+    // Collapse multiple separators into one
+    if (w->len > 0 && !w->pending && w->last != separator)
+        w->pending = separator;
+    return SLUGIFY_SUCCESS;
+}
+
+static int writer_put_trans(slug_writer_t *w, const char *trans, const slugify_options_t *opts)
+{
+    if (w->direct)
+        return writer_trans_run(w, trans, opts->preserve_case, opts->separator,
+                                opts->max_length > 0 ? opts->max_length : SIZE_MAX);
+
+    for (size_t k = 0; trans[k] != '\0'; k++)
+    {
+        char c = trans[k];
+        if (!opts->preserve_case && c >= 'A' && c <= 'Z')
+            c = (char)(c + ('a' - 'A'));
+
+        // A transliteration such as U+2013 -> "-" collapses like any separator
+        if (c == opts->separator)
+        {
+            int rc = writer_separator(w, c);
+            if (rc != SLUGIFY_SUCCESS)
+                return rc;
+            continue;
+        }
+
+        // The first byte may follow a separator that already used up the room
+        if (opts->max_length > 0 && writer_length(w) + writer_width(w, c) > opts->max_length)
+        {
+            w->truncated = 1;
+            break;
+        }
+
+        int rc = writer_put(w, c);
+        if (rc != SLUGIFY_SUCCESS)
+            return rc;
+    }
+    return SLUGIFY_SUCCESS;
+}
+
+/* True when the whole string is valid UTF-8 */
+static int is_utf8_valid(const char *str)
+{
+    for (size_t i = 0; str[i] != '\0';)
+    {
+        size_t consumed = 0;
+        int is_valid = 0;
+        utf8_decode_secure(&str[i], &consumed, &is_valid);
+        if (!is_valid)
+            return 0;
+        i += consumed;
+    }
+    return 1;
+}
+
+/* Table lookup with decomposition as the fallback. scratch receives the
+ * base letter when it is plain ASCII. */
+static const char *transliterate_letter(const slugify_table_t *table, uint32_t codepoint, char scratch[2])
+{
+    const char *trans = transliterate_char(table, codepoint);
+    if (trans)
+        return trans;
+
+    uint32_t base = decompose_base(codepoint);
+    if (base == 0)
+        return NULL;
+    if (base < 0x80)
+    {
+        scratch[0] = (char)base;
+        scratch[1] = '\0';
+        return scratch;
+    }
+    return transliterate_char(table, base);
+}
+
+/* Phrase replacements: an Aho-Corasick automaton over ASCII-folded bytes.
+ * Bytes are first mapped to classes (0 for bytes that occur in no phrase)
+ * so the dense transition table stays states x classes. */
+#define PHRASE_NONE -1
+
+struct slugify_phrases
+{
+    uint8_t byte_class[256];
+    size_t classes;
+    int32_t *next;        /* Transition table, states x classes */
+    uint32_t *depth;      /* Bytes from the root to each state */
+    int32_t *output;      /* Phrase that ends exactly at each state */
+    int32_t *output_link; /* Nearest proper suffix state with an output */
+    const char **replacements;
+    uint8_t *word_edges;  /* PHRASE_WORD_START | PHRASE_WORD_END */
+    char *strings;
+};
+
+#define PHRASE_WORD_START 1
+#define PHRASE_WORD_END 2
+
+static int is_ascii_alnum(unsigned char c)
+{
+    return c < 128 && (slugify_ascii_class[c] == SLUGIFY_CLASS_LOWER ||
+                       slugify_ascii_class[c] == SLUGIFY_CLASS_UPPER);
+}
+
+void slugify_phrases_free(slugify_phrases_t *phrases)
+{
+    if (!phrases)
+        return;
+
+    free(phrases->next);
+    free(phrases->depth);
+    free(phrases->output);
+    free(phrases->output_link);
+    free(phrases->replacements);
+    free(phrases->word_edges);
+    free(phrases->strings);
+    free(phrases);
+}
+
+slugify_phrases_t *slugify_phrases_create(const slugify_phrase_t *phrases, size_t count)
+{
+    if (!phrases && count > 0)
+        return NULL;
+
+    size_t max_states = 1;
+    size_t string_bytes = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        const char *phrase = phrases[i].phrase;
+        if (!phrase || phrase[0] == '\0' || !is_utf8_valid(phrase))
+            return NULL;
+        max_states += strlen(phrase);
+        string_bytes += (phrases[i].replacement ? strlen(phrases[i].replacement) : 0) + 1;
+    }
+
+    slugify_phrases_t *ph = calloc(1, sizeof(*ph));
+    if (!ph)
+        return NULL;
+
+    // Give every folded byte that occurs in a phrase its own class
+    ph->classes = 1;
+    for (size_t i = 0; i < count; i++)
+    {
+        for (const char *p = phrases[i].phrase; *p; p++)
+        {
+            unsigned char c = (unsigned char)tolower((unsigned char)*p);
+            if (ph->byte_class[c] == 0)
+            {
+                ph->byte_class[c] = (uint8_t)ph->classes++;
+                ph->byte_class[toupper(c)] = ph->byte_class[c];
+            }
+        }
+    }
+
+    ph->next = malloc(max_states * ph->classes * sizeof(*ph->next));
+    ph->depth = calloc(max_states, sizeof(*ph->depth));
+    ph->output = malloc(max_states * sizeof(*ph->output));
+    ph->output_link = malloc(max_states * sizeof(*ph->output_link));
+    ph->replacements = malloc((count ? count : 1) * sizeof(*ph->replacements));
+    ph->word_edges = malloc(count ? count : 1);
+    ph->strings = malloc(string_bytes ? string_bytes : 1);
+    int32_t *fail = malloc(max_states * sizeof(*fail));
+    int32_t *queue = malloc(max_states * sizeof(*queue));
+    if (!ph->next || !ph->depth || !ph->output || !ph->output_link || !ph->replacements ||
+        !ph->word_edges || !ph->strings || !fail || !queue)
+    {
+        free(fail);
+        free(queue);
+        slugify_phrases_free(ph);
+        return NULL;
+    }
+
+    for (size_t k = 0; k < max_states * ph->classes; k++)
+        ph->next[k] = PHRASE_NONE;
+    for (size_t k = 0; k < max_states; k++)
+        ph->output[k] = ph->output_link[k] = PHRASE_NONE;
+
+    // Build the trie; a later duplicate takes over the output
+    size_t states = 1;
+    char *strings = ph->strings;
+    for (size_t i = 0; i < count; i++)
+    {
+        const char *phrase = phrases[i].phrase;
+        size_t len = strlen(phrase);
+        int32_t state = 0;
+        for (size_t k = 0; k < len; k++)
+        {
+            int32_t *slot = &ph->next[(size_t)state * ph->classes + ph->byte_class[(unsigned char)phrase[k]]];
+            if (*slot == PHRASE_NONE)
+            {
+                ph->depth[states] = ph->depth[state] + 1;
+                *slot = (int32_t)states++;
+            }
+            state = *slot;
+        }
+        ph->output[state] = (int32_t)i;
+
+        const char *replacement = phrases[i].replacement ? phrases[i].replacement : "";
+        size_t rlen = strlen(replacement);
+        memcpy(strings, replacement, rlen + 1);
+        ph->replacements[i] = strings;
+        strings += rlen + 1;
+        ph->word_edges[i] = (uint8_t)((is_ascii_alnum((unsigned char)phrase[0]) ? PHRASE_WORD_START : 0) |
+                                      (is_ascii_alnum((unsigned char)phrase[len - 1]) ? PHRASE_WORD_END : 0));
+    }
+
+    // Breadth-first: failure links, then missing transitions borrowed from them
+    size_t head = 0, tail = 0;
+    fail[0] = 0;
+    for (size_t c = 0; c < ph->classes; c++)
+    {
+        int32_t *slot = &ph->next[c];
+        if (*slot == PHRASE_NONE)
+        {
+            *slot = 0;
+        }
+        else
+        {
+            fail[*slot] = 0;
+            queue[tail++] = *slot;
+        }
+    }
+    while (head < tail)
+    {
+        int32_t state = queue[head++];
+        int32_t f = fail[state];
+        ph->output_link[state] = (ph->output[f] != PHRASE_NONE) ? f : ph->output_link[f];
+
+        for (size_t c = 0; c < ph->classes; c++)
+        {
+            int32_t *slot = &ph->next[(size_t)state * ph->classes + c];
+            int32_t borrowed = ph->next[(size_t)f * ph->classes + c];
+            if (*slot == PHRASE_NONE)
+            {
+                *slot = borrowed;
+            }
+            else
+            {
+                fail[*slot] = borrowed;
+                queue[tail++] = *slot;
+            }
+        }
+    }
+
+    free(fail);
+    free(queue);
+    return ph;
+}
+
+/* Leftmost, then longest, phrase occurrence at or after from that respects
+ * its word edges. Scanning stops as soon as no partial match still alive
+ * can start at or before the best match found so far. */
+typedef struct
+{
+    size_t start; /* SIZE_MAX when there is no further match */
+    size_t end;
+    int32_t phrase;
+} phrase_match_t;
+
+static phrase_match_t phrase_find(const slugify_phrases_t *ph, const char *input, size_t from)
+{
+    phrase_match_t best = {SIZE_MAX, 0, PHRASE_NONE};
+    int32_t state = 0;
+
+    for (size_t j = from; input[j] != '\0'; j++)
+    {
+        state = ph->next[(size_t)state * ph->classes + ph->byte_class[(unsigned char)input[j]]];
+        if (best.phrase != PHRASE_NONE && j + 1 - ph->depth[state] > best.start)
+            break;
+
+        int32_t s = (ph->output[state] != PHRASE_NONE) ? state : ph->output_link[state];
+        for (; s != PHRASE_NONE; s = ph->output_link[s])
+        {
+            int32_t phrase = ph->output[s];
+            size_t start = j + 1 - ph->depth[s];
+            if (start > best.start || (start == best.start && j + 1 <= best.end))
+                continue;
+            if ((ph->word_edges[phrase] & PHRASE_WORD_START) && start > 0 &&
+                is_ascii_alnum((unsigned char)input[start - 1]))
+                continue;
+            if ((ph->word_edges[phrase] & PHRASE_WORD_END) && is_ascii_alnum((unsigned char)input[j + 1]))
+                continue;
+            best.start = start;
+            best.end = j + 1;
+            best.phrase = phrase;
+        }
+    }
+    return best;
+}
+
+/* Emits a replacement: letters and digits as they are, anything else as a
+ * separator */
+static int writer_put_phrase(slug_writer_t *w, const char *replacement, const slugify_options_t *opts)
+{
+    for (size_t k = 0; replacement[k] != '\0'; k++)
+    {
+        unsigned char c = (unsigned char)replacement[k];
+        if (!is_ascii_alnum(c))
+        {
+            int rc = writer_separator(w, opts->separator);
+            if (rc != SLUGIFY_SUCCESS)
+                return rc;
+            continue;
+        }
+
+        if (opts->max_length > 0 && writer_length(w) >= opts->max_length)
+        {
+            w->truncated = 1;
+            break;
+        }
+
+        int rc = writer_put(w, opts->preserve_case ? (char)c : (char)tolower(c));
+        if (rc != SLUGIFY_SUCCESS)
+            return rc;
+    }
+    return SLUGIFY_SUCCESS;
+}
+
+/* Rules that span several code points. Sequences are stored case-folded
+ * and without accents, zero-padded and sorted, so narrowing a binary search
+ * one position at a time walks them like a trie and the longest complete
+ * sequence wins. language restricts a rule to one profile. */
+#define MULTI_RULE_MAX 3
+
+typedef struct
+{
+    uint32_t sequence[MULTI_RULE_MAX];
+    uint8_t length;
+    uint8_t language;
+    const char *transliteration;
+} multi_rule_t;
+
+static const multi_rule_t multi_rules[] = {
+    /* Greek diphthongs (ELOT 743) and the nasal γγ */
+    {{0x3B1, 0x3C5}, 2, SLUGIFY_LANG_DEFAULT, "av"},
+    {{0x3B3, 0x3B3}, 2, SLUGIFY_LANG_DEFAULT, "ng"},
+    {{0x3B5, 0x3C5}, 2, SLUGIFY_LANG_DEFAULT, "ev"},
+    {{0x3BF, 0x3C5}, 2, SLUGIFY_LANG_DEFAULT, "ou"},
+
+    /* Ukrainian зг, kept apart from ж (KMU 2010) */
+    {{0x437, 0x433}, 2, SLUGIFY_LANG_UKRAINIAN, "zgh"},
+};
+
+#define MULTI_RULE_COUNT (sizeof(multi_rules) / sizeof(multi_rules[0]))
+
+/* Prefilter over U+0370..U+04FF: set for every code point that folds to the
+ * first code point of some rule (upper case and accented forms included).
+ * Regenerate whenever a rule with a new first code point is added. */
+#define MULTI_RULE_FIRST 0x370
+#define MULTI_RULE_LAST 0x4FF
+
+static const uint32_t multi_rule_starts[13] = {
+    0x11400000, 0x3000802A, 0x1000802A, 0x00000000, 0x00000000, 0x00000080, 0x00000080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000C000, 0x00000000};
+
+/* Lower-case, accentless form of a Greek or Cyrillic letter */
+static uint32_t multi_rule_fold(uint32_t codepoint)
+{
+    // The basic letters carry no accent, except Й and й; skip the search for them
+    int basic = (codepoint >= 0x391 && codepoint <= 0x3C9 && (codepoint <= 0x3A9 || codepoint >= 0x3B1)) ||
+                (codepoint >= 0x410 && codepoint <= 0x44F && codepoint != 0x419 && codepoint != 0x439);
+    uint32_t base = basic ? 0 : decompose_base(codepoint);
+    if (base)
+        codepoint = base;
+    if ((codepoint >= 0x391 && codepoint <= 0x3A9) || (codepoint >= 0x410 && codepoint <= 0x42F))
+        return codepoint + 0x20;
+    if (codepoint >= 0x400 && codepoint <= 0x40F)
+        return codepoint + 0x50;
+    return codepoint;
+}
+
+/* Longest rule starting at codepoint, or NULL. next is the offset just past
+ * codepoint; *extra receives the code units of the further code points matched.
+ * Costs one range check and one bit test when no rule can start here. */
+static const char *multi_rule_match(uint32_t codepoint, const slug_input_t *in, size_t next, int language, size_t *extra)
+{
+    uint32_t offset = codepoint - MULTI_RULE_FIRST;
+    if (codepoint < MULTI_RULE_FIRST || codepoint > MULTI_RULE_LAST ||
+        !(multi_rule_starts[offset >> 5] & (1u << (offset & 31))))
+        return NULL;
+
+    const char *best = NULL;
+    size_t lo = 0, hi = MULTI_RULE_COUNT;
+    size_t matched = 0;
+    uint32_t folded = multi_rule_fold(codepoint);
+
+    for (size_t depth = 0; depth < MULTI_RULE_MAX && folded; depth++)
+    {
+        // Narrow [lo, hi) to the rules whose sequence continues with folded
+        size_t first = lo, last = hi;
+        while (first < last)
+        {
+            size_t mid = (first + last) >> 1;
+            if (multi_rules[mid].sequence[depth] < folded)
+                first = mid + 1;
+            else
+                last = mid;
+        }
+        last = first;
+        while (last < hi && multi_rules[last].sequence[depth] == folded)
+            last++;
+        if (first == last)
+            break;
+        lo = first;
+        hi = last;
+
+        // Zero padding sorts complete sequences first
+        for (size_t r = lo; r < hi && multi_rules[r].length == depth + 1; r++)
+        {
+            if (multi_rules[r].language == SLUGIFY_LANG_DEFAULT || multi_rules[r].language == language)
+            {
+                best = multi_rules[r].transliteration;
+                *extra = matched;
+            }
+        }
+
+        size_t consumed = 0;
+        folded = multi_rule_fold(peek_codepoint(in, next + matched, &consumed));
+        matched += consumed;
+    }
+    return best;
+}
+
+/* Checkpoints for slugify_session_edit(). Each maps an input offset to the
+ * writer state in front of it. They sit at ASCII separators, which no
+ * lookahead reads past, so everything before one depends only on the input
+ * before it. A separator decoded from %XX is not one: a lookahead or a
+ * broken sequence in front of it reads all three bytes. */
+typedef struct
+{
+    size_t in;
+    size_t out;
+    char last;
+    char pending;
+} slug_checkpoint_t;
+
+typedef struct
+{
+    slug_checkpoint_t *points; /* Recorded by this scan */
+    size_t count;
+    size_t cap;
+    const slug_checkpoint_t *old; /* Previous scan, NULL for none */
+    size_t old_count;
+    size_t old_next;  /* First old checkpoint not yet passed */
+    size_t sync_from; /* First offset past the edit */
+    size_t inserted;
+    size_t deleted;
+    int synced; /* Stopped where the old scan had the same state */
+} slug_trace_t;
+
+/* Records a checkpoint at offset i, or stops the scan once the state matches
+ * the old scan at the same unchanged input, since all that follows would be
+ * the same too. */
+static int trace_checkpoint(slug_trace_t *trace, size_t i, const slug_writer_t *w)
+{
+    if (trace->old && i >= trace->sync_from)
+    {
+        size_t old_in = i - trace->inserted + trace->deleted;
+        while (trace->old_next < trace->old_count && trace->old[trace->old_next].in < old_in)
+            trace->old_next++;
+
+        const slug_checkpoint_t *cp = &trace->old[trace->old_next];
+        if (trace->old_next < trace->old_count && cp->in == old_in && cp->last == w->last &&
+            cp->pending == w->pending && (cp->out > 0) == (w->len > 0))
+        {
+            trace->synced = 1;
+            return SLUGIFY_SUCCESS;
+        }
+    }
+
+    if (trace->count == trace->cap)
+    {
+        size_t cap = trace->cap ? trace->cap * 2 : 16;
+        slug_checkpoint_t *points = realloc(trace->points, cap * sizeof(*points));
+        if (!points)
+            return SLUGIFY_ERROR_MEMORY;
+        trace->points = points;
+        trace->cap = cap;
+    }
+    trace->points[trace->count++] = (slug_checkpoint_t){i, w->len, w->last, w->pending};
+    return SLUGIFY_SUCCESS;
+}
+
+/* Validate whatever is left after max_length stopped the main loop, so a
+ * truncated slug never hides a malformed tail. Lenient decoding only
+ * rejects overlong ASCII there too. */
+static int is_input_valid(const slug_input_t *in, size_t i, int lenient)
+{
+    while (!input_end(in, i))
+    {
         size_t consumed = 0;
-        uint32_t codepoint = utf8_decode(&input[i], &consumed);
+        int is_valid = 0;
+        input_decode(in, i, &consumed, &is_valid);
+        if (!is_valid)
+        {
+            if (!lenient || input_overlong_ascii(in, i))
+                return 0;
+            if (!in->url && !in->html)
+                consumed = 1;
+        }
+        i += consumed;
+    }
+    return 1;
+}
+
+/* True when the code point at offset i would have continued the word that
+ * max_length cut off */
+static int continues_word(const slug_input_t *in, size_t i)
+{
+    size_t consumed = 0;
+    int is_valid = 0;
+    uint32_t codepoint = input_decode(in, i, &consumed, &is_valid);
+
+    if (codepoint < 128)
+        return slugify_ascii_class[codepoint] == SLUGIFY_CLASS_LOWER ||
+               slugify_ascii_class[codepoint] == SLUGIFY_CLASS_UPPER ||
+               slugify_ascii_class[codepoint] == SLUGIFY_CLASS_TRANSLIT;
+
+    int uclass = unicode_class(codepoint);
+    return uclass != UNICODE_CLASS_SPACE && uclass != UNICODE_CLASS_PUNCT;
+}
+
+/* Single-byte input resolved per byte. Each table holds, for every byte
+ * from 0x80, what the engine would make of its code point: a
+ * transliteration, charset_separator, or NULL to drop it. */
+typedef struct
+{
+    const char *slugs[128]; /* Indexed by byte - 0x80 */
+} charset_table_t;
+
+static const char charset_separator[] = "";
+
+#include "slugify_charsets.h"
+
+/* NULL when the options need the general path: a custom table, or
+ * preserve_case, which copies letters instead of transliterating them */
+static const charset_table_t *charset_table(const slugify_options_t *opts)
+{
+    if (opts->table || opts->preserve_case)
+        return NULL;
+    return charset_tables[opts->input_encoding - SLUGIFY_ENCODING_LATIN1][opts->language];
+}
+
+/* Core engine. Decodes, validates and emits in a single pass, starting at
+ * offset i with the writer state in front of it. trace, if set, collects
+ * checkpoints. Phrases need UTF-8 input. */
+static int slugify_scan(const slug_input_t *in, size_t i, slug_writer_t *w, const slugify_options_t *opts,
+                        slug_trace_t *trace)
+{
+    int rc;
+    const slugify_table_t *table = resolve_table(opts, &rc);
+    if (!table)
+        return rc;
+    if (opts->truncate < SLUGIFY_TRUNCATE_UTF8 || opts->truncate > SLUGIFY_TRUNCATE_WORD)
+        return SLUGIFY_ERROR_INVALID;
+    if (opts->input_encoding < SLUGIFY_ENCODING_UTF8 || opts->input_encoding >= SLUGIFY_ENCODING_COUNT)
+        return SLUGIFY_ERROR_INVALID;
+    if (opts->invalid_input < SLUGIFY_INVALID_REJECT || opts->invalid_input > SLUGIFY_INVALID_DROP)
+        return SLUGIFY_ERROR_INVALID;
+
+    if (opts->url_decode && opts->html_decode)
+        return SLUGIFY_ERROR_INVALID;
+
+    // char input takes its encoding from the options
+    slug_input_t narrow;
+    const charset_table_t *charset = NULL;
+    if (in->width == 1 &&
+        (opts->input_encoding != SLUGIFY_ENCODING_UTF8 || opts->url_decode || opts->html_decode))
+    {
+        narrow = *in;
+        narrow.encoding = opts->input_encoding;
+        narrow.url = opts->url_decode;
+        narrow.html = opts->html_decode;
+        in = &narrow;
+        // The per-byte tables read raw bytes
+        if (!narrow.url && !narrow.html)
+            charset = charset_table(opts);
+    }
+
+    // Phrases match UTF-8 bytes, so any other input is converted for them first
+    if ((in->width != 1 || in->url || in->html || in->encoding != SLUGIFY_ENCODING_UTF8) && opts->phrases)
+    {
+        slugify_options_t plain_opts = *opts;
+        plain_opts.input_encoding = SLUGIFY_ENCODING_UTF8;
+        plain_opts.url_decode = false;
+        plain_opts.html_decode = false;
+        char *plain = input_to_utf8(in, i, opts->invalid_input, &rc);
+        if (!plain)
+            return rc;
+        slug_input_t plain_in = {plain, 0, 1, SLUGIFY_ENCODING_UTF8, 0, 0};
+        rc = slugify_scan(&plain_in, 0, w, &plain_opts, NULL);
+        free(plain);
+        return rc;
+    }
+
+    w->stop_words = opts->stop_words;
+    w->defer_overflow = opts->truncate == SLUGIFY_TRUNCATE_WORD && opts->max_length > 0;
+    w->escape = opts->percent_encode;
+    w->direct = !w->stop_words && !w->escape && !w->sink && !w->defer_overflow && !w->hash;
+    // Read through locals, which byte stores to the output cannot alias
+    const char *input = (in->width == 1) ? in->data : NULL;
+    const char *plain = (in->url || in->html) ? NULL : input;
+    // Bytes that start an escape, a reference or a tag
+    const char special[2] = {in->url ? '%' : '&', in->url ? '+' : '<'};
+    const uint16_t *units = (in->width == 2) ? in->data : NULL;
+    // Options read on every iteration, for the same reason
+    const int preserve_case = opts->preserve_case;
+    const size_t max_length = opts->max_length;
+    const slugify_phrases_t *phrases = opts->phrases;
+    const char separator = opts->separator;
+    const int language = opts->table ? SLUGIFY_LANG_DEFAULT : opts->language;
+    phrase_match_t match = {SIZE_MAX, 0, PHRASE_NONE};
+    if (phrases)
+        match = phrase_find(phrases, input, i);
+    // Nothing can hold back, limit, watch or remap a plain run of ASCII letters and separators
+    const char *fast =
+        (plain && w->direct && !trace && !phrases && max_length == 0 && !opts->table) ? plain : NULL;
+
+    while (input ? input[i] != '\0' : i < in->length)
+    {
+        if (fast)
+        {
+            size_t run = writer_ascii_run(w, &fast[i], preserve_case, separator);
+            i += run;
+            if (run > 0)
+                continue;
+        }
+
+        size_t consumed = 1;
+        int is_valid = 1;
+        uint32_t codepoint;
+        if (plain && in->encoding == SLUGIFY_ENCODING_UTF8)
+            codepoint = utf8_decode_secure(&plain[i], &consumed, &is_valid);
+        else if (plain)
+            codepoint = single_byte_codepoint(in->encoding, (unsigned char)plain[i]);
+        else if (input && (unsigned char)input[i] < 0x80 && input[i] != special[0] && input[i] != special[1])
+            codepoint = (unsigned char)input[i]; // Plain ASCII in URL-encoded or HTML input
+        else if (units && units[i] - 1u < 0x7F) // ASCII UTF-16 skips the decoder
+            codepoint = units[i];
+        else
+            codepoint = input_decode(in, i, &consumed, &is_valid);
 
-        if (opts.max_length > 0 && j >= opts.max_length)
+        if (!is_valid)
+        {
+            if (opts->invalid_input == SLUGIFY_INVALID_REJECT || input_overlong_ascii(in, i))
+                return SLUGIFY_ERROR_INVALID;
+
+            // One byte or code unit at a time; the rest of a broken sequence follows the same way
+            if (!in->url && !in->html)
+                consumed = 1;
+            if (opts->invalid_input == SLUGIFY_INVALID_DROP)
+            {
+                i += consumed;
+                continue;
+            }
+            // Read as a space, so max_length and stop words treat it like any separator
+            codepoint = ' ';
+        }
+
+        if (trace && is_valid && consumed == 1 && codepoint < 128 &&
+            slugify_ascii_class[codepoint] == SLUGIFY_CLASS_SEPARATOR)
+        {
+            if ((rc = trace_checkpoint(trace, i, w)) != SLUGIFY_SUCCESS)
+                return rc;
+            if (trace->synced)
+                return SLUGIFY_SUCCESS;
+        }
+
+        // A held stop word that ends right here is dropped first, which may make room
+        if (max_length > 0 && writer_length(w) >= max_length && w->word_state == WORD_HELD &&
+            !w->truncated && codepoint < 128 && slugify_ascii_class[codepoint] == SLUGIFY_CLASS_SEPARATOR)
+        {
+            if ((rc = writer_end_word(w, 1)) != SLUGIFY_SUCCESS)
+                return rc;
+        }
+
+        if (max_length > 0 && writer_length(w) >= max_length)
             break;
 
+        if (phrases)
+        {
+            // A sequence rule may have swallowed the start of the match
+            if (match.start < i)
+                match = phrase_find(phrases, input, i);
+            if (match.start == i)
+            {
+                if ((rc = writer_put_phrase(w, phrases->replacements[match.phrase], opts)) != SLUGIFY_SUCCESS)
+                    return rc;
+                i = match.end;
+                match = phrase_find(phrases, input, i);
+                continue;
+            }
+        }
+
         if (codepoint < 128)
         {
             char c = (char)codepoint;
 
-            if (isalnum((unsigned char)c))
+            switch (slugify_ascii_class[codepoint])
+            {
+            case SLUGIFY_CLASS_UPPER:
+            case SLUGIFY_CLASS_LOWER:
+            {
+                // Searched only when the custom table remaps a letter or digit
+                const char *trans = (opts->table && opts->table->alnum) ? transliterate_char(table, codepoint) : NULL;
+                if (trans)
+                    rc = writer_put_trans(w, trans, opts);
+                else if (slugify_ascii_class[codepoint] == SLUGIFY_CLASS_UPPER && !preserve_case)
+                    rc = writer_put(w, (char)(c + ('a' - 'A')));
+                else
+                    rc = writer_put(w, c);
+                if (rc != SLUGIFY_SUCCESS)
+                    return rc;
+                break;
+            }
+            case SLUGIFY_CLASS_TRANSLIT:
+                if ((rc = writer_put_trans(w, transliterate_char(table, codepoint), opts)) != SLUGIFY_SUCCESS)
+                    return rc;
+                break;
+            default:
+            {
+                // Custom tables may also map punctuation and control characters
+                const char *trans = opts->table ? transliterate_char(table, codepoint) : NULL;
+                if (trans)
+                {
+                    if ((rc = writer_put_trans(w, trans, opts)) != SLUGIFY_SUCCESS)
+                        return rc;
+                }
+                else if (slugify_ascii_class[codepoint] == SLUGIFY_CLASS_SEPARATOR)
+                {
+                    if ((rc = writer_separator(w, separator)) != SLUGIFY_SUCCESS)
+                        return rc;
+                }
+                // Ignore control characters
+                break;
+            }
+            }
+        }
+        else if (charset)
+        {
+            // One lookup stands in for the general path below
+            const char *slug = charset->slugs[(unsigned char)plain[i] - 0x80];
+            if (slug == charset_separator)
+            {
+                if ((rc = writer_separator(w, separator)) != SLUGIFY_SUCCESS)
+                    return rc;
+            }
+            else if (slug)
+            {
+                if ((rc = writer_put_trans(w, slug, opts)) != SLUGIFY_SUCCESS)
+                    return rc;
+            }
+        }
+        else
+        {
+            int uclass = unicode_class(codepoint);
+            const char *trans = NULL;
+            size_t extra = 0;
+
+            if (preserve_case)
             {
-                char out_char = (opts.preserve_case) ? c : (char)tolower((unsigned char)c);
+                if (uclass == UNICODE_CLASS_SPACE || uclass == UNICODE_CLASS_PUNCT)
+                {
+                    if ((rc = writer_separator(w, separator)) != SLUGIFY_SUCCESS)
+                        return rc;
+                }
+                else
+                {
+                    // Copy the UTF-8 bytes, re-encoded for UTF-16 and UTF-32 input
+                    char bytes[4];
+                    size_t n = utf8_encode(codepoint, bytes);
 
-                if (j + 1 >= out_size)
-                    return SLUGIFY_ERROR_BUFFER;
+                    // A sequence that does not fit is left out whole, unless the cut is a hard one
+                    if (max_length > 0 && writer_length(w) + n * writer_width(w, bytes[0]) > max_length)
+                    {
+                        for (size_t k = 0; opts->truncate == SLUGIFY_TRUNCATE_BYTE &&
+                                           writer_length(w) + writer_width(w, bytes[k]) <= max_length;
+                             k++)
+                        {
+                            if ((rc = writer_put(w, bytes[k])) != SLUGIFY_SUCCESS)
+                                return rc;
+                        }
+                        break;
+                    }
 
-                output[j++] = out_char;
+                    for (size_t k = 0; k < n; k++)
+                    {
+                        if ((rc = writer_put(w, bytes[k])) != SLUGIFY_SUCCESS)
+                            return rc;
+                    }
+                }
+            }
+            // Multi-code-point rules first, so ου is not read as ο + υ
+            else if ((trans = multi_rule_match(codepoint, in, i + consumed, language, &extra)) != NULL)
+            {
+                if ((rc = writer_put_trans(w, trans, opts)) != SLUGIFY_SUCCESS)
+                    return rc;
+                consumed += extra;
             }
             else
             {
-                const char *trans = transliterate_char(codepoint);
-                if (trans)
+                // Attempt to transliterate; only letters and symbols decompose
+                char base[2];
+                char syllable[16];
+                int han = 0;
+                if (uclass == UNICODE_CLASS_OTHER)
                 {
-                    size_t trans_len = strlen(trans);
-                    if (j + trans_len >= out_size)
-                        return SLUGIFY_ERROR_BUFFER;
-
-                    for (size_t k = 0; k < trans_len; k++)
+                    trans = transliterate_letter(table, codepoint, base);
+                    han = is_han(codepoint);
+#ifndef SLUGIFY_NO_PINYIN
+                    if (!trans && han)
+                        trans = pinyin_lookup(codepoint);
+#endif
+                    if (!trans && romanize_syllable(codepoint, in, i + consumed, syllable, &extra))
                     {
-                        char c2 = (opts.preserve_case) ? trans[k] : (char)tolower((unsigned char)trans[k]);
-                        output[j++] = c2;
-
-                        if (opts.max_length > 0 && j >= opts.max_length)
-                            break;
+                        trans = syllable;
+                        consumed += extra;
                     }
                 }
-                else if (isspace((unsigned char)c) || c == '-' || c == '_' || ispunct((unsigned char)c))
+                else if (uclass != UNICODE_CLASS_SPACE)
                 {
-                    // Collapse multiple separators into one
-                    if (j > 0 && output[j - 1] != opts.separator)
-                    {
-                        if (j + 1 >= out_size)
-                            return SLUGIFY_ERROR_BUFFER;
-                        output[j++] = opts.separator;
-                    }
+                    trans = transliterate_char(table, codepoint);
                 }
-                // Ignore other punctuation characters without transliteration
-            }
-        }
-        else
-        {
-            // Non-ASCII characters
-
-            if (opts.preserve_case)
-            {
-                // Copy UTF-8 bytes directly
-                if (j + consumed >= out_size)
-                    return SLUGIFY_ERROR_BUFFER;
 
-                for (size_t k = 0; k < consumed; k++)
+                if (trans)
                 {
-                    output[j++] = input[i + k];
+                    if (han)
+                        if ((rc = writer_separator(w, separator)) != SLUGIFY_SUCCESS)
+                            return rc;
+                    if ((rc = writer_put_trans(w, trans, opts)) != SLUGIFY_SUCCESS)
+                        return rc;
+                    if (han)
+                        if ((rc = writer_separator(w, separator)) != SLUGIFY_SUCCESS)
+                            return rc;
                 }
-            }
-            else
-            {
-                // Attempt to transliterate
-                const char *trans = transliterate_char(codepoint);
-                if (trans)
+                else if (uclass == UNICODE_CLASS_SPACE || uclass == UNICODE_CLASS_PUNCT)
                 {
-                    size_t trans_len = strlen(trans);
-                    if (j + trans_len >= out_size)
-                        return SLUGIFY_ERROR_BUFFER;
-
-                    for (size_t k = 0; k < trans_len; k++)
-                    {
-                        char c2 = (opts.preserve_case) ? trans[k] : (char)tolower((unsigned char)trans[k]);
-                        output[j++] = c2;
-
-                        if (opts.max_length > 0 && j >= opts.max_length)
-                            break;
-                    }
+                    if ((rc = writer_separator(w, separator)) != SLUGIFY_SUCCESS)
+                        return rc;
                 }
-                // If no transliteration, skip the character (do not add anything)
+                // Combining marks and characters without transliteration are skipped
             }
         }
 
         i += consumed;
     }
 
-    // Remove trailing separator if present
-    if (j > 0 && output[j - 1] == opts.separator)
+    // max_length stopped the loop; the rest must still be valid
+    if (!input_end(in, i))
     {
-        j--;
+        if (!is_input_valid(in, i, opts->invalid_input != SLUGIFY_INVALID_REJECT))
+            return SLUGIFY_ERROR_INVALID;
+        if (opts->truncate == SLUGIFY_TRUNCATE_WORD &&
+            (w->truncated || (!writer_between_words(w) && continues_word(in, i))))
+            writer_cut_word(w);
     }
 
-    if (j == 0)
-    {
+    // The last word is complete unless max_length stopped the loop
+    if ((rc = writer_end_word(w, input_end(in, i))) != SLUGIFY_SUCCESS)
+        return rc;
+
+    // A pending separator is simply dropped, so there is nothing to trim
+
+    if (w->out && w->len - w->flushed >= w->cap)
+        return SLUGIFY_ERROR_BUFFER;
+
+    if (w->len == 0)
         return SLUGIFY_ERROR_EMPTY;
-    }
 
-    output[j] = '\0';
     return SLUGIFY_SUCCESS;
 }
 
-char *slugify(const char *input, const slugify_options_t *options)
+static int slugify_run(const char *input, slug_writer_t *w, const slugify_options_t *opts)
 {
-    // If options is NULL, use default options
+    slug_input_t in = {input, 0, 1, SLUGIFY_ENCODING_UTF8, 0, 0};
+    return slugify_scan(&in, 0, w, opts, NULL);
+}
+
+size_t slugify_length(const char *input, const slugify_options_t *options)
+{
+    if (!input)
+        return 0;
+
     slugify_options_t opts = options ? *options : slugify_default_options();
+    slug_writer_t w = {0};
+
+    if (slugify_run(input, &w, &opts) != SLUGIFY_SUCCESS)
+        return 0;
+
+    return w.len + 1; /* +1 for null terminator */
+}
+
+static int slugify_input_ex(const slug_input_t *in, char *output, size_t out_size,
+                            const slugify_options_t *options)
+{
+    // Read in place; the scan never writes to the options
+    const slugify_options_t *opts = options ? options : &slugify_defaults;
+    slug_writer_t w = {.out = output, .cap = out_size};
+
+    int rc = slugify_scan(in, 0, &w, opts, NULL);
+    if (rc != SLUGIFY_SUCCESS)
+        return rc;
+
+    output[w.len] = '\0';
+    return SLUGIFY_SUCCESS;
+}
+
+#define SLUG_STACK_SIZE 256 /* Most slugs are sized and written in a single scan */
+
+static char *slugify_input(const slug_input_t *in, const slugify_options_t *options)
+{
+    // If options is NULL, use default options. Resolved once for both passes.
+    const slugify_options_t *opts = options ? options : &slugify_defaults;
 
-    // Calculate the required buffer length
-    size_t len = slugify_length(input, &opts);
-    if (len == 0)
+    // A slug that fits on the stack is copied out at its exact size
+    char stack[SLUG_STACK_SIZE];
+    slug_writer_t first = {.out = stack, .cap = sizeof(stack)};
+    int rc = slugify_scan(in, 0, &first, opts, NULL);
+    if (rc == SLUGIFY_SUCCESS)
+    {
+        char *buf = malloc(first.len + 1);
+        if (!buf)
+            return NULL;
+        memcpy(buf, stack, first.len);
+        buf[first.len] = '\0';
+        return buf;
+    }
+    if (rc != SLUGIFY_ERROR_BUFFER)
+        return NULL;
+
+    // Calculate the exact buffer length
+    slug_writer_t count = {0};
+    if (slugify_scan(in, 0, &count, opts, NULL) != SLUGIFY_SUCCESS)
         return NULL;
 
     // Allocate the buffer
-    char *buf = malloc(len);
+    char *buf = malloc(count.len + 1);
     if (!buf)
         return NULL;
 
     // Generate the slug
-    int rc = slugify_ex(input, buf, len, &opts);
-    if (rc != SLUGIFY_SUCCESS)
+    slug_writer_t w = {.out = buf, .cap = count.len + 1};
+    if (slugify_scan(in, 0, &w, opts, NULL) != SLUGIFY_SUCCESS)
     {
         free(buf);
         return NULL;
     }
 
     // Return the buffer on success
+    buf[w.len] = '\0';
     return buf;
 }
+
+int slugify_ex(const char *input, char *output, size_t out_size,
+               const slugify_options_t *options)
+{
+    if (!input || !output || out_size == 0)
+    {
+        return SLUGIFY_ERROR_INVALID;
+    }
+
+    slug_input_t in = {input, 0, 1, SLUGIFY_ENCODING_UTF8, 0, 0};
+    return slugify_input_ex(&in, output, out_size, options);
+}
+
+int slugify_ex_digest(const char *input, char *output, size_t out_size,
+                      const slugify_options_t *options, slugify_digest_t *digest)
+{
+    if (!input || !output || out_size == 0 || !digest)
+        return SLUGIFY_ERROR_INVALID;
+
+    static const char base62[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+    slugify_options_t opts = options ? *options : slugify_default_options();
+    slug_hash_t hash;
+    hash_init(&hash);
+    slug_writer_t w = {.out = output, .cap = out_size, .hash = &hash};
+
+    int rc = slugify_run(input, &w, &opts);
+    if (rc != SLUGIFY_SUCCESS)
+        return rc;
+    output[w.len] = '\0';
+
+    // At most a stripe plus a rolled-back word is left
+    hash_update(&hash, &output[w.hashed], w.len - w.hashed);
+    digest->hash = hash_final(&hash);
+
+    uint64_t x = digest->hash;
+    for (int k = SLUGIFY_ID_LENGTH - 1; k >= 0; k--, x /= 62)
+        digest->id[k] = base62[x % 62];
+    digest->id[SLUGIFY_ID_LENGTH] = '\0';
+    return SLUGIFY_SUCCESS;
+}
+
+#define SINK_STAGE_SIZE 512 /* Most slugs reach the sink in a single call */
+
+int slugify_to_sink(const char *input, slugify_sink_t sink, void *ctx,
+                    const slugify_options_t *options)
+{
+    if (!input || !sink)
+        return SLUGIFY_ERROR_INVALID;
+
+    slugify_options_t opts = options ? *options : slugify_default_options();
+
+    // SLUGIFY_TRUNCATE_WORD may take back the whole last word, which has to
+    // stay staged until the end; max_length + 1 bytes hold any slug
+    char stage[SINK_STAGE_SIZE];
+    char *heap = NULL;
+    size_t cap = sizeof(stage);
+    if (opts.truncate == SLUGIFY_TRUNCATE_WORD && opts.max_length >= cap)
+    {
+        cap = opts.max_length + 1;
+        heap = malloc(cap);
+        if (!heap)
+            return SLUGIFY_ERROR_MEMORY;
+    }
+
+    slug_writer_t w = {.out = heap ? heap : stage, .cap = cap, .sink = sink, .sink_ctx = ctx};
+    int rc = slugify_run(input, &w, &opts);
+    if (rc == SLUGIFY_SUCCESS)
+        rc = writer_flush(&w, w.len);
+
+    free(heap);
+    return rc;
+}
+
+char *slugify(const char *input, const slugify_options_t *options)
+{
+    if (!input)
+        return NULL;
+
+    slug_input_t in = {input, 0, 1, SLUGIFY_ENCODING_UTF8, 0, 0};
+    return slugify_input(&in, options);
+}
+
+static int slugify_wide_ex(const slug_input_t *in, char *output, size_t out_size,
+                           const slugify_options_t *options)
+{
+    if (!in->data || !output || out_size == 0)
+        return SLUGIFY_ERROR_INVALID;
+    return slugify_input_ex(in, output, out_size, options);
+}
+
+static char *slugify_wide(const slug_input_t *in, const slugify_options_t *options)
+{
+    if (!in->data)
+        return NULL;
+    return slugify_input(in, options);
+}
+
+int slugify_ex_utf16(const uint16_t *input, size_t length, char *output, size_t out_size,
+                     const slugify_options_t *options)
+{
+    slug_input_t in = {input, length, 2, SLUGIFY_ENCODING_UTF8, 0, 0};
+    return slugify_wide_ex(&in, output, out_size, options);
+}
+
+int slugify_ex_utf32(const uint32_t *input, size_t length, char *output, size_t out_size,
+                     const slugify_options_t *options)
+{
+    slug_input_t in = {input, length, 4, SLUGIFY_ENCODING_UTF8, 0, 0};
+    return slugify_wide_ex(&in, output, out_size, options);
+}
+
+char *slugify_utf16(const uint16_t *input, size_t length, const slugify_options_t *options)
+{
+    slug_input_t in = {input, length, 2, SLUGIFY_ENCODING_UTF8, 0, 0};
+    return slugify_wide(&in, options);
+}
+
+char *slugify_utf32(const uint32_t *input, size_t length, const slugify_options_t *options)
+{
+    slug_input_t in = {input, length, 4, SLUGIFY_ENCODING_UTF8, 0, 0};
+    return slugify_wide(&in, options);
+}
+
+slugify_small_t slugify_small(const char *input, const slugify_options_t *options)
+{
+    slugify_small_t slug;
+    slug.length = 0;
+    slug.heap = NULL;
+
+    if (!input)
+    {
+        slug.status = SLUGIFY_ERROR_INVALID;
+        return slug;
+    }
+
+    slugify_options_t opts = options ? *options : slugify_default_options();
+
+    // Most slugs fit inline, so try that first
+    slug_writer_t w = {.out = slug.buf, .cap = SLUGIFY_SMALL_CAPACITY};
+    slug.status = slugify_run(input, &w, &opts);
+
+    if (slug.status == SLUGIFY_ERROR_BUFFER)
+    {
+        slug_writer_t count = {0};
+        slug.status = slugify_run(input, &count, &opts);
+        if (slug.status != SLUGIFY_SUCCESS)
+            return slug;
+
+        slug.heap = malloc(count.len + 1);
+        if (!slug.heap)
+        {
+            slug.status = SLUGIFY_ERROR_MEMORY;
+            return slug;
+        }
+
+        w = (slug_writer_t){.out = slug.heap, .cap = count.len + 1};
+        slug.status = slugify_run(input, &w, &opts);
+        if (slug.status != SLUGIFY_SUCCESS)
+        {
+            free(slug.heap);
+            slug.heap = NULL;
+            return slug;
+        }
+    }
+
+    if (slug.status == SLUGIFY_SUCCESS)
+    {
+        slug.length = w.len;
+        w.out[w.len] = '\0';
+    }
+    return slug;
+}
+
+void slugify_small_free(slugify_small_t *slug)
+{
+    if (!slug)
+        return;
+
+    free(slug->heap);
+    slug->heap = NULL;
+    slug->length = 0;
+}
+
+/* Reusable context: options are resolved once and the output buffer is
+ * kept between calls, so a warm slugifier does not allocate. */
+#define SLUGIFIER_INITIAL_CAPACITY 256
+
+struct slugifier
+{
+    slugify_options_t opts;
+    char *buf;
+    size_t cap;
+    slugifier_stats_t stats;
+};
+
+slugifier_t *slugifier_create(const slugify_options_t *options)
+{
+    slugifier_t *s = calloc(1, sizeof(*s));
+    if (!s)
+        return NULL;
+
+    s->opts = options ? *options : slugify_default_options();
+    s->buf = malloc(SLUGIFIER_INITIAL_CAPACITY);
+    if (!s->buf)
+    {
+        free(s);
+        return NULL;
+    }
+    s->cap = SLUGIFIER_INITIAL_CAPACITY;
+    return s;
+}
+
+void slugifier_destroy(slugifier_t *s)
+{
+    if (!s)
+        return;
+
+    free(s->buf);
+    free(s);
+}
+
+int slugifier_run(slugifier_t *s, const char *input, const char **slug, size_t *length)
+{
+    if (!s || !input || !slug)
+        return SLUGIFY_ERROR_INVALID;
+
+    s->stats.calls++;
+
+    slug_writer_t w = {.out = s->buf, .cap = s->cap};
+    int rc = slugify_run(input, &w, &s->opts);
+
+    if (rc == SLUGIFY_ERROR_BUFFER)
+    {
+        // Grow to the exact size needed, but at least double
+        slug_writer_t count = {0};
+        rc = slugify_run(input, &count, &s->opts);
+        if (rc == SLUGIFY_SUCCESS)
+        {
+            size_t cap = s->cap * 2 > count.len + 1 ? s->cap * 2 : count.len + 1;
+            char *buf = realloc(s->buf, cap);
+            if (!buf)
+            {
+                rc = SLUGIFY_ERROR_MEMORY;
+            }
+            else
+            {
+                s->buf = buf;
+                s->cap = cap;
+                s->stats.grows++;
+
+                w = (slug_writer_t){.out = s->buf, .cap = s->cap};
+                rc = slugify_run(input, &w, &s->opts);
+            }
+        }
+    }
+
+    if (rc != SLUGIFY_SUCCESS)
+    {
+        s->stats.errors++;
+        return rc;
+    }
+
+    s->buf[w.len] = '\0';
+    s->stats.bytes_out += w.len;
+
+    *slug = s->buf;
+    if (length)
+        *length = w.len;
+    return SLUGIFY_SUCCESS;
+}
+
+slugifier_stats_t slugifier_stats(const slugifier_t *s)
+{
+    slugifier_stats_t empty = {0};
+    return s ? s->stats : empty;
+}
+
+/* Live-edit session. It keeps the input, the slug and the checkpoints of
+ * the last scan. An edit rescans from the last checkpoint in front of it
+ * and stops at the first checkpoint past it where the writer state matches
+ * the old scan; the rest of the old slug is spliced on unchanged. Phrases,
+ * stop words and max_length can carry a change across separators, so with
+ * those every edit is a full scan. */
+struct slugify_session
+{
+    slugify_options_t opts;
+    char *input;
+    size_t length;
+    size_t input_cap;
+    char *out; /* Current slug */
+    size_t out_len;
+    size_t out_cap;
+    char *spare; /* Next slug while it is built */
+    size_t spare_cap;
+    slug_checkpoint_t *points;
+    size_t count;
+    size_t cap;
+    slug_trace_t trace;
+    int stale; /* The last scan failed, so out and points are unusable */
+};
+
+slugify_session_t *slugify_session_create(const slugify_options_t *options)
+{
+    slugify_session_t *s = calloc(1, sizeof(*s));
+    if (!s)
+        return NULL;
+
+    s->opts = options ? *options : slugify_default_options();
+    s->stale = 1;
+    return s;
+}
+
+void slugify_session_destroy(slugify_session_t *s)
+{
+    if (!s)
+        return;
+
+    free(s->input);
+    free(s->out);
+    free(s->spare);
+    free(s->points);
+    free(s->trace.points);
+    free(s);
+}
+
+static int session_reserve(char **buf, size_t *cap, size_t need)
+{
+    if (need <= *cap)
+        return SLUGIFY_SUCCESS;
+
+    size_t grown = *cap * 2 > need ? *cap * 2 : need;
+    char *p = realloc(*buf, grown);
+    if (!p)
+        return SLUGIFY_ERROR_MEMORY;
+    *buf = p;
+    *cap = grown;
+    return SLUGIFY_SUCCESS;
+}
+
+/* Scans the input into spare from checkpoint from (NULL for the start),
+ * growing spare until the slug fits. The prefix before from is copied
+ * from out. */
+static int session_scan(slugify_session_t *s, const slug_checkpoint_t *from, slug_trace_t *trace,
+                        slug_writer_t *w)
+{
+    size_t start = from ? from->in : 0;
+    size_t base = from ? from->out : 0;
+    int rc = session_reserve(&s->spare, &s->spare_cap, SLUGIFY_MAX_OUTPUT(s->length - start) + base);
+    if (rc != SLUGIFY_SUCCESS)
+        return rc;
+    if (base > 0)
+        memcpy(s->spare, s->out, base);
+
+    for (;;)
+    {
+        *w = (slug_writer_t){.out = s->spare, .cap = s->spare_cap, .len = base};
+        if (from)
+        {
+            w->last = from->last;
+            w->pending = from->pending;
+        }
+        if (trace)
+        {
+            trace->count = 0;
+            trace->old_next = 0;
+            trace->synced = 0;
+        }
+
+        slug_input_t in = {s->input, 0, 1, SLUGIFY_ENCODING_UTF8, 0, 0};
+        rc = slugify_scan(&in, start, w, &s->opts, trace);
+        // Custom tables can expand past SLUGIFY_MAX_EXPANSION
+        if (rc != SLUGIFY_ERROR_BUFFER)
+            return rc;
+        if ((rc = session_reserve(&s->spare, &s->spare_cap, s->spare_cap * 2)) != SLUGIFY_SUCCESS)
+            return rc;
+    }
+}
+
+/* Makes spare the current slug and points the caller at it */
+static int session_finish(slugify_session_t *s, size_t len, const char **slug, size_t *length)
+{
+    char *out = s->out;
+    size_t out_cap = s->out_cap;
+    s->out = s->spare;
+    s->out_cap = s->spare_cap;
+    s->spare = out;
+    s->spare_cap = out_cap;
+
+    s->out[len] = '\0';
+    s->out_len = len;
+    s->stale = 0;
+
+    *slug = s->out;
+    if (length)
+        *length = len;
+    return SLUGIFY_SUCCESS;
+}
+
+static int session_full_scan(slugify_session_t *s, const char **slug, size_t *length)
+{
+    s->stale = 1;
+    int incremental = !s->opts.phrases && !s->opts.stop_words && s->opts.max_length == 0;
+    slug_trace_t *trace = incremental ? &s->trace : NULL;
+    s->trace.old = NULL;
+
+    slug_writer_t w;
+    int rc = session_scan(s, NULL, trace, &w);
+    if (rc != SLUGIFY_SUCCESS)
+        return rc;
+
+    // Keep the recorded checkpoints; the old array becomes the next scratch
+    slug_checkpoint_t *points = s->points;
+    size_t cap = s->cap;
+    s->points = s->trace.points;
+    s->count = incremental ? s->trace.count : 0;
+    s->cap = s->trace.cap;
+    s->trace.points = points;
+    s->trace.cap = cap;
+    s->trace.count = 0;
+
+    return session_finish(s, w.len, slug, length);
+}
+
+int slugify_session_set(slugify_session_t *s, const char *input, const char **slug, size_t *length)
+{
+    if (!s || !input || !slug)
+        return SLUGIFY_ERROR_INVALID;
+
+    size_t len = strlen(input);
+    int rc = session_reserve(&s->input, &s->input_cap, len + 1);
+    if (rc != SLUGIFY_SUCCESS)
+        return rc;
+    memcpy(s->input, input, len + 1);
+    s->length = len;
+
+    return session_full_scan(s, slug, length);
+}
+
+int slugify_session_edit(slugify_session_t *s, size_t offset, size_t deleted, const char *inserted,
+                         size_t inserted_len, const char **slug, size_t *length)
+{
+    if (!s || !slug || (!inserted && inserted_len > 0) || !s->input)
+        return SLUGIFY_ERROR_INVALID;
+    if (offset > s->length || deleted > s->length - offset)
+        return SLUGIFY_ERROR_INVALID;
+    if (inserted_len > 0 && memchr(inserted, '\0', inserted_len))
+        return SLUGIFY_ERROR_INVALID;
+
+    // Splice the input
+    size_t len = s->length - deleted + inserted_len;
+    int rc = session_reserve(&s->input, &s->input_cap, len + 1);
+    if (rc != SLUGIFY_SUCCESS)
+        return rc;
+    memmove(s->input + offset + inserted_len, s->input + offset + deleted, s->length - offset - deleted + 1);
+    if (inserted_len > 0)
+        memcpy(s->input + offset, inserted, inserted_len);
+    s->length = len;
+
+    // A tag can reach back over a checkpoint once its '>' is typed
+    if (s->stale || s->opts.phrases || s->opts.stop_words || s->opts.max_length > 0 || s->opts.html_decode)
+        return session_full_scan(s, slug, length);
+
+    // Resume from the last checkpoint strictly in front of the edit
+    size_t lo = 0, hi = s->count;
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if (s->points[mid].in < offset)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo == 0)
+        return session_full_scan(s, slug, length);
+    size_t keep = lo - 1;
+
+    // Old checkpoints before keep cannot match, so the trace skips them
+    slug_trace_t *trace = &s->trace;
+    trace->old = s->points + keep;
+    trace->old_count = s->count - keep;
+    trace->sync_from = offset + inserted_len;
+    trace->inserted = inserted_len;
+    trace->deleted = deleted;
+
+    slug_checkpoint_t from = s->points[keep];
+    slug_writer_t w;
+    s->stale = 1;
+    if ((rc = session_scan(s, &from, trace, &w)) != SLUGIFY_SUCCESS)
+        return rc;
+
+    size_t out_len = w.len;
+    size_t tail = trace->synced ? keep + trace->old_next : s->count;
+    if (trace->synced)
+    {
+        // Everything after the sync point is the old slug, shifted
+        size_t sync_out = s->points[tail].out;
+        size_t rest = s->out_len - sync_out;
+        if ((rc = session_reserve(&s->spare, &s->spare_cap, out_len + rest + 1)) != SLUGIFY_SUCCESS)
+            return rc;
+        memcpy(s->spare + out_len, s->out + sync_out, rest);
+
+        for (size_t k = tail; k < s->count; k++)
+        {
+            s->points[k].in = s->points[k].in - deleted + inserted_len;
+            s->points[k].out = s->points[k].out - sync_out + out_len;
+        }
+        out_len += rest;
+    }
+
+    // points = kept prefix, then the new checkpoints, then the shifted tail
+    size_t count = keep + trace->count + (s->count - tail);
+    if (count > s->cap)
+    {
+        size_t cap = s->cap * 2 > count ? s->cap * 2 : count;
+        slug_checkpoint_t *points = realloc(s->points, cap * sizeof(*points));
+        if (!points)
+            return SLUGIFY_ERROR_MEMORY;
+        s->points = points;
+        s->cap = cap;
+    }
+    memmove(s->points + keep + trace->count, s->points + tail, (s->count - tail) * sizeof(*s->points));
+    if (trace->count > 0)
+        memcpy(s->points + keep, trace->points, trace->count * sizeof(*s->points));
+    s->count = count;
+
+    if (out_len == 0)
+        return SLUGIFY_ERROR_EMPTY;
+    return session_finish(s, out_len, slug, length);
+}
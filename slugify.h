@@ -11,19 +11,123 @@
 #define SLUGIFY_ERROR_INVALID 2
 #define SLUGIFY_ERROR_EMPTY 3
 #define SLUGIFY_ERROR_MEMORY 4
+#define SLUGIFY_ERROR_SINK 5
+
+/* Longest output a single input byte can produce. In UTF-8 the worst
+ * entries in the transliteration table are "percent" and "greater", seven
+ * bytes for one ASCII byte. Single-byte encodings go further: Latin-1 0xA4
+ * is "currency", and CP1252 0x80 kept as a percent-encoded euro sign is
+ * %E2%82%AC. test.c walks every code point and every byte of each encoding
+ * to keep this in sync. */
+#define SLUGIFY_MAX_EXPANSION 9
+
+/* Buffer size, including the null byte, that is always large enough for
+ * slugify_ex() on an input of len bytes. It is a constant expression, so it
+ * can size a stack array: char buf[SLUGIFY_MAX_OUTPUT(64)];
+ * When max_length is set, max_length + 1 bytes are enough as well. The bound
+ * holds with percent_encode too: a UTF-8 byte becomes three. */
+#define SLUGIFY_MAX_OUTPUT(len) ((len) * SLUGIFY_MAX_EXPANSION + 1)
 
 /* Unicode validation limits */
 #define UNICODE_MAX_CODEPOINT 0x10FFFF
 #define UNICODE_SURROGATE_HIGH_START 0xD800
 #define UNICODE_SURROGATE_LOW_END 0xDFFF
 
+/* Language profiles for slugify_options_t.language */
+#define SLUGIFY_LANG_DEFAULT 0
+#define SLUGIFY_LANG_GERMAN 1       /* ä -> ae, ö -> oe, ü -> ue */
+#define SLUGIFY_LANG_DANISH 2       /* å -> aa, æ -> ae, ø -> oe */
+#define SLUGIFY_LANG_NORWEGIAN 3    /* Same as Danish */
+#define SLUGIFY_LANG_RUSSIAN_BGN 4  /* х -> kh, ц -> ts, щ -> shch, й -> y */
+#define SLUGIFY_LANG_RUSSIAN_GOST 5 /* GOST 7.79-2000 B: х -> x, ц -> cz, щ -> shh */
+#define SLUGIFY_LANG_RUSSIAN_ICAO 6 /* Passports: й -> i, ю -> iu, я -> ia */
+#define SLUGIFY_LANG_UKRAINIAN 7    /* г -> h, и -> y, х -> kh */
+#define SLUGIFY_LANG_COUNT 8
+
+/* Encodings of char input for slugify_options_t.input_encoding */
+#define SLUGIFY_ENCODING_UTF8 0
+#define SLUGIFY_ENCODING_LATIN1 1 /* ISO-8859-1, each byte is its code point */
+#define SLUGIFY_ENCODING_CP1252 2 /* Windows-1252, Latin-1 with € „ Œ … in 0x80-0x9F */
+#define SLUGIFY_ENCODING_COUNT 3
+
+/* What malformed input does, for slugify_options_t.invalid_input. Overlong
+ * encodings of ASCII characters are rejected under every policy, since they
+ * are how "/" and "." get smuggled past filters. */
+#define SLUGIFY_INVALID_REJECT 0    /* Fail with SLUGIFY_ERROR_INVALID (default) */
+#define SLUGIFY_INVALID_SEPARATOR 1 /* Each bad byte or code unit becomes a separator */
+#define SLUGIFY_INVALID_DROP 2      /* Each bad byte or code unit is skipped */
+
+/* Compiled transliteration table. See slugify_table_create(). */
+typedef struct slugify_table slugify_table_t;
+
+/* Compiled phrase replacements. See slugify_phrases_create(). */
+typedef struct slugify_phrases slugify_phrases_t;
+
+/* Stop-word set. See slugify_stop_words_builtin(). */
+typedef struct slugify_stop_words slugify_stop_words_t;
+
+/* Longest stop word in bytes; longer words are always kept */
+#define SLUGIFY_STOP_WORD_MAX 16
+
+/* Truncation policies for slugify_options_t.truncate. The slug never
+ * exceeds max_length under any of them. */
+#define SLUGIFY_TRUNCATE_UTF8 0 /* Cut at max_length, never inside a UTF-8 sequence (default) */
+#define SLUGIFY_TRUNCATE_BYTE 1 /* Cut at exactly max_length bytes */
+#define SLUGIFY_TRUNCATE_WORD 2 /* Drop a word that does not fit whole, unless it is the first */
+
 typedef struct
 {
-    char separator;     /* Default: '-' */
-    size_t max_length;  /* Max output length, 0 = no limit */
-    bool preserve_case; /* true to preserve case, false to convert to lowercase (default) */
+    char separator;                         /* Default: '-' */
+    size_t max_length;                      /* Max output length, 0 = no limit */
+    bool preserve_case;                     /* true to preserve case, false to convert to lowercase (default) */
+    const slugify_table_t *table;           /* Custom transliteration table, NULL for the built-in one */
+    int language;                           /* SLUGIFY_LANG_*, ignored when table is set */
+    const slugify_phrases_t *phrases;       /* Phrase replacements, NULL for none */
+    const slugify_stop_words_t *stop_words; /* Words to drop, NULL for none */
+    int truncate;                           /* SLUGIFY_TRUNCATE_*, how max_length cuts */
+    int input_encoding;                     /* SLUGIFY_ENCODING_*, ignored for UTF-16 and UTF-32 */
+    int invalid_input;                      /* SLUGIFY_INVALID_*, what malformed input does */
+    bool percent_encode;                    /* Write bytes other than A-Z a-z 0-9 - . _ ~ as %XX */
+    bool url_decode;                        /* Read %XX and + in char input as a query string would */
+    bool html_decode;                       /* Decode character references and skip tags in char input */
 } slugify_options_t;
 
+/* ASCII byte classes used by slugify_ascii_class */
+#define SLUGIFY_CLASS_DROP 0      /* Control characters, ignored */
+#define SLUGIFY_CLASS_LOWER 1     /* Lowercase letters and digits, copied */
+#define SLUGIFY_CLASS_UPPER 2     /* Uppercase letters, lowered unless preserve_case */
+#define SLUGIFY_CLASS_SEPARATOR 3 /* Whitespace and punctuation */
+#define SLUGIFY_CLASS_TRANSLIT 4  /* Has a transliteration-table entry */
+
+extern const unsigned char slugify_ascii_class[128];
+
+/* Slug returned by value: short results are stored inline, longer ones on
+ * the heap. Read it with slugify_small_str() and release it with
+ * slugify_small_free(). */
+#define SLUGIFY_SMALL_CAPACITY 96
+
+typedef struct
+{
+    int status;    /* SLUGIFY_SUCCESS or an SLUGIFY_ERROR_* code */
+    size_t length; /* Slug length without the null byte */
+    char *heap;    /* NULL while the slug fits in buf */
+    char buf[SLUGIFY_SMALL_CAPACITY];
+} slugify_small_t;
+
+/* Reusable slugifier, one per worker thread. See slugifier_create(). */
+typedef struct slugifier slugifier_t;
+
+/* Live-edit session for one text field. See slugify_session_create(). */
+typedef struct slugify_session slugify_session_t;
+
+typedef struct
+{
+    size_t calls;     /* slugifier_run() calls */
+    size_t errors;    /* Calls that returned an error */
+    size_t grows;     /* Times the output buffer was enlarged */
+    size_t bytes_out; /* Total slug bytes produced */
+} slugifier_stats_t;
+
 /* Transliteration table entry */
 typedef struct
 {
@@ -31,6 +135,224 @@ typedef struct
     const char *ascii;
 } transliteration_entry_t;
 
+/* Phrase replacement, e.g. {"C++", "cpp"} */
+typedef struct
+{
+    const char *phrase;
+    const char *replacement;
+} slugify_phrase_t;
+
 char *slugify(const char *input, const slugify_options_t *options);
 
+/* Writes the slug into a caller-supplied buffer in a single pass. A buffer of
+ * SLUGIFY_MAX_OUTPUT(strlen(input)) bytes never fails with
+ * SLUGIFY_ERROR_BUFFER. Returns SLUGIFY_SUCCESS or an SLUGIFY_ERROR_* code. */
+int slugify_ex(const char *input, char *output, size_t out_size,
+               const slugify_options_t *options);
+
+/* Receives the slug in order, one span at a time. Returns 0 to continue and
+ * anything else to stop with SLUGIFY_ERROR_SINK. */
+typedef int (*slugify_sink_t)(void *ctx, const char *data, size_t len);
+
+/* Streams the slug into sink through a small stack buffer, so it never
+ * exists as a heap string. A typical slug arrives in one call, longer ones
+ * in large chunks. Bytes are passed on only once no later input can take
+ * them back, but input found invalid past the first chunk fails after the
+ * sink has seen part of the slug; buffer the output if that matters.
+ * Returns SLUGIFY_SUCCESS or an SLUGIFY_ERROR_* code. */
+int slugify_to_sink(const char *input, slugify_sink_t sink, void *ctx,
+                    const slugify_options_t *options);
+
+/* 64-bit hash of a slug and its short ID, for dedup indexes and sharding */
+#define SLUGIFY_ID_LENGTH 11 /* Base62 digits of a 64-bit value */
+
+typedef struct
+{
+    uint64_t hash;                 /* XXH64 of the slug bytes, seed 0 */
+    char id[SLUGIFY_ID_LENGTH + 1]; /* hash in base62 (0-9 A-Z a-z), zero-padded */
+} slugify_digest_t;
+
+/* slugify_ex() that also hashes the slug while it is written, so the output
+ * is not read a second time. digest is only filled on success. */
+int slugify_ex_digest(const char *input, char *output, size_t out_size,
+                      const slugify_options_t *options, slugify_digest_t *digest);
+
+/* UTF-16 and UTF-32 input of length code units, decoded straight into the
+ * engine with the same validation as UTF-8; unpaired surrogates and nulls
+ * are invalid. A Windows wchar_t string can be passed as UTF-16. The slug
+ * is UTF-8. For slugify_ex_utf16() a buffer of
+ * SLUGIFY_MAX_OUTPUT(3 * length) bytes is always enough, and
+ * SLUGIFY_MAX_OUTPUT(4 * length) for slugify_ex_utf32(). With phrases the
+ * input is converted to UTF-8 first, since phrases match UTF-8 bytes. */
+char *slugify_utf16(const uint16_t *input, size_t length, const slugify_options_t *options);
+char *slugify_utf32(const uint32_t *input, size_t length, const slugify_options_t *options);
+int slugify_ex_utf16(const uint16_t *input, size_t length, char *output, size_t out_size,
+                     const slugify_options_t *options);
+int slugify_ex_utf32(const uint32_t *input, size_t length, char *output, size_t out_size,
+                     const slugify_options_t *options);
+
+/* Inline fast path for short ASCII titles. Produces the same result as
+ * slugify_ex() and hands the whole input over to it as soon as it meets a
+ * non-ASCII byte or a byte that needs the transliteration table, or right
+ * away when a custom table, phrases, stop words, word truncation,
+ * percent-encoding, URL decoding or HTML decoding are set. Options out of
+ * range go there too, so both return SLUGIFY_ERROR_INVALID for them. */
+static inline int slugify_short(const char *input, char *output, size_t out_size,
+                                const slugify_options_t *options)
+{
+    if (!input || !output || out_size == 0)
+        return SLUGIFY_ERROR_INVALID;
+    if (options && (options->table || options->phrases || options->stop_words ||
+                    options->truncate == SLUGIFY_TRUNCATE_WORD || options->percent_encode ||
+                    options->url_decode || options->html_decode))
+        return slugify_ex(input, output, out_size, options);
+    if (options && (options->language < 0 || options->language >= SLUGIFY_LANG_COUNT ||
+                    options->truncate < SLUGIFY_TRUNCATE_UTF8 || options->truncate > SLUGIFY_TRUNCATE_WORD ||
+                    options->input_encoding < SLUGIFY_ENCODING_UTF8 ||
+                    options->input_encoding >= SLUGIFY_ENCODING_COUNT ||
+                    options->invalid_input < SLUGIFY_INVALID_REJECT || options->invalid_input > SLUGIFY_INVALID_DROP))
+        return slugify_ex(input, output, out_size, options);
+
+    char separator = options ? options->separator : '-';
+    size_t max_length = options ? options->max_length : 0;
+    bool preserve_case = options ? options->preserve_case : false;
+    size_t j = 0;
+    char last = 0;
+    char pending = 0;
+
+    for (size_t i = 0; input[i] != '\0'; i++)
+    {
+        unsigned char c = (unsigned char)input[i];
+        if (c >= 0x80)
+            return slugify_ex(input, output, out_size, options);
+
+        if (max_length > 0 && j + (pending != 0) >= max_length)
+        {
+            /* The engine still validates the rest of the input */
+            for (; input[i] != '\0'; i++)
+            {
+                if ((unsigned char)input[i] >= 0x80)
+                    return slugify_ex(input, output, out_size, options);
+            }
+            break;
+        }
+
+        switch (slugify_ascii_class[c])
+        {
+        case SLUGIFY_CLASS_UPPER:
+            if (!preserve_case)
+                c = (unsigned char)(c + ('a' - 'A'));
+            /* fall through */
+        case SLUGIFY_CLASS_LOWER:
+            if (j + (pending != 0) + 1 >= out_size)
+                return SLUGIFY_ERROR_BUFFER;
+            if (pending)
+            {
+                output[j++] = pending;
+                pending = 0;
+            }
+            output[j++] = (char)c;
+            last = (char)c;
+            break;
+        case SLUGIFY_CLASS_SEPARATOR:
+            if (j > 0 && !pending && last != separator)
+                pending = separator;
+            break;
+        case SLUGIFY_CLASS_TRANSLIT:
+            return slugify_ex(input, output, out_size, options);
+        default:
+            break;
+        }
+    }
+
+    if (j == 0)
+        return SLUGIFY_ERROR_EMPTY;
+
+    output[j] = '\0';
+    return SLUGIFY_SUCCESS;
+}
+
+/* Slugify into a slugify_small_t; allocates only if the slug does not fit
+ * in SLUGIFY_SMALL_CAPACITY bytes. */
+slugify_small_t slugify_small(const char *input, const slugify_options_t *options);
+void slugify_small_free(slugify_small_t *slug);
+
+static inline const char *slugify_small_str(const slugify_small_t *slug)
+{
+    if (slug->status != SLUGIFY_SUCCESS)
+        return NULL;
+    return slug->heap ? slug->heap : slug->buf;
+}
+
+/* Creates a slugifier with options resolved once (NULL for defaults). Its
+ * output buffer is reused, so warm calls make no allocations. Not thread
+ * safe; give each worker its own slugifier. */
+slugifier_t *slugifier_create(const slugify_options_t *options);
+void slugifier_destroy(slugifier_t *s);
+
+/* Slugifies input into the slugifier's buffer. On success *slug points to
+ * the null-terminated slug, valid until the next call or destroy. */
+int slugifier_run(slugifier_t *s, const char *input, const char **slug, size_t *length);
+slugifier_stats_t slugifier_stats(const slugifier_t *s);
+
+/* Creates a session that keeps the slug of one input up to date as it is
+ * edited (NULL options for defaults). Not thread safe. */
+slugify_session_t *slugify_session_create(const slugify_options_t *options);
+void slugify_session_destroy(slugify_session_t *s);
+
+/* Replaces the whole input and slugifies it from scratch. On success *slug
+ * points to the slug, valid until the next call or destroy. */
+int slugify_session_set(slugify_session_t *s, const char *input, const char **slug, size_t *length);
+
+/* Replaces deleted bytes at byte offset with inserted_len bytes of inserted
+ * and updates the slug. Only the words around the edit are slugified again,
+ * unless phrases, stop words or max_length are set. The edit is applied even
+ * when the new input has no valid slug, so editing can go on from there. */
+int slugify_session_edit(slugify_session_t *s, size_t offset, size_t deleted, const char *inserted,
+                         size_t inserted_len, const char **slug, size_t *length);
+
+/* Compiles user entries, merged over the built-in transliteration table,
+ * into the same sorted lookup structure the built-in table uses. User
+ * entries win over built-ins, and the last duplicate wins. Strings are
+ * copied. A NULL string drops the character. Entries for ASCII letters and
+ * digits apply too, each to its own case only. Long replacements can exceed
+ * SLUGIFY_MAX_EXPANSION. Returns NULL on invalid code points or if memory
+ * runs out. */
+slugify_table_t *slugify_table_create(const transliteration_entry_t *entries, size_t count);
+
+/* Same as slugify_table_create(), merged over a SLUGIFY_LANG_* profile */
+slugify_table_t *slugify_table_create_for(int language, const transliteration_entry_t *entries,
+                                          size_t count);
+void slugify_table_free(slugify_table_t *table);
+
+/* Compiles phrase replacements into an Aho-Corasick automaton that runs in
+ * the same pass as slugification. Phrases match ASCII case-insensitively,
+ * the leftmost and then longest match wins, and a phrase that starts or
+ * ends with a letter or digit only matches at a word boundary there. In a
+ * replacement, letters and digits are copied and everything else becomes a
+ * separator; NULL removes the phrase. The last duplicate wins. Strings are
+ * copied. Long replacements can exceed SLUGIFY_MAX_EXPANSION. Returns NULL
+ * on an empty or invalid UTF-8 phrase or if memory runs out. */
+slugify_phrases_t *slugify_phrases_create(const slugify_phrase_t *phrases, size_t count);
+void slugify_phrases_free(slugify_phrases_t *phrases);
+
+/* Built-in stop words for a SLUGIFY_LANG_* profile, in slug form (German
+ * lists both "fur" and "fuer"). SLUGIFY_LANG_DEFAULT selects English.
+ * Returns NULL for languages without a list. The set is static; do not
+ * free it. */
+const slugify_stop_words_t *slugify_stop_words_builtin(int language);
+
+/* Builds a stop-word set from words, merged over base (NULL for none).
+ * Words match whole slug words, ASCII case-insensitively. Dropping every
+ * word of the input yields SLUGIFY_ERROR_EMPTY, and a word cut short by
+ * max_length is kept. Strings are copied. Returns NULL on an empty word,
+ * a word longer than SLUGIFY_STOP_WORD_MAX, or if memory runs out. */
+slugify_stop_words_t *slugify_stop_words_create(const slugify_stop_words_t *base,
+                                                const char *const *words, size_t count);
+void slugify_stop_words_free(slugify_stop_words_t *stop_words);
+
+/* Exact buffer size slugify() needs for input, including the terminating
+ * null byte. Returns 0 if input is invalid or produces an empty slug. */
+size_t slugify_length(const char *input, const slugify_options_t *options);
+
 #endif
@@ -0,0 +1,172 @@
+#ifndef SLUGIFY_CHARSETS_H
+#define SLUGIFY_CHARSETS_H
+
+/* Per-byte slugs for Latin-1 and Windows-1252 input, included only by
+ * slugify.c. Entry c - 0x80 is what the engine makes of byte c under the
+ * profile: its transliteration, SEP for a separator, or NULL to drop it.
+ * Generated from transliteration_table and slugify_languages.h with the
+ * general path; profiles that agree on all 128 bytes share a table.
+ * Regenerate whenever either changes. */
+
+#define SEP charset_separator
+
+static const charset_table_t charset_latin1_default = {{
+    /* 80 */ NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    /* 88 */ NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    /* 90 */ NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    /* 98 */ NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    /* A0 */ SEP, SEP, "cent", "pound", "currency", "yen", NULL, SEP,
+    /* A8 */ NULL, "(c)", "a", SEP, NULL, NULL, "(r)", NULL,
+    /* B0 */ NULL, NULL, NULL, NULL, NULL, NULL, SEP, SEP,
+    /* B8 */ NULL, NULL, "o", SEP, NULL, NULL, NULL, SEP,
+    /* C0 */ "a", "a", "a", "a", "a", "a", "AE", "c",
+    /* C8 */ "e", "e", "e", "e", "i", "i", "i", "i",
+    /* D0 */ "D", "n", "o", "o", "o", "o", "o", NULL,
+    /* D8 */ "O", "u", "u", "u", "u", "y", "TH", "ss",
+    /* E0 */ "a", "a", "a", "a", "a", "a", "ae", "c",
+    /* E8 */ "e", "e", "e", "e", "i", "i", "i", "i",
+    /* F0 */ "d", "n", "o", "o", "o", "o", "o", NULL,
+    /* F8 */ "o", "u", "u", "u", "u", "y", "th", "y",
+}};
+
+static const charset_table_t charset_latin1_german = {{
+    /* 80 */ NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    /* 88 */ NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    /* 90 */ NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    /* 98 */ NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    /* A0 */ SEP, SEP, "cent", "pound", "currency", "yen", NULL, SEP,
+    /* A8 */ NULL, "(c)", "a", SEP, NULL, NULL, "(r)", NULL,
+    /* B0 */ NULL, NULL, NULL, NULL, NULL, NULL, SEP, SEP,
+    /* B8 */ NULL, NULL, "o", SEP, NULL, NULL, NULL, SEP,
+    /* C0 */ "a", "a", "a", "a", "Ae", "a", "AE", "c",
+    /* C8 */ "e", "e", "e", "e", "i", "i", "i", "i",
+    /* D0 */ "D", "n", "o", "o", "o", "o", "Oe", NULL,
+    /* D8 */ "O", "u", "u", "u", "Ue", "y", "TH", "ss",
+    /* E0 */ "a", "a", "a", "a", "ae", "a", "ae", "c",
+    /* E8 */ "e", "e", "e", "e", "i", "i", "i", "i",
+    /* F0 */ "d", "n", "o", "o", "o", "o", "oe", NULL,
+    /* F8 */ "o", "u", "u", "u", "ue", "y", "th", "y",
+}};
+
+static const charset_table_t charset_latin1_scandinavian = {{
+    /* 80 */ NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    /* 88 */ NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    /* 90 */ NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    /* 98 */ NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    /* A0 */ SEP, SEP, "cent", "pound", "currency", "yen", NULL, SEP,
+    /* A8 */ NULL, "(c)", "a", SEP, NULL, NULL, "(r)", NULL,
+    /* B0 */ NULL, NULL, NULL, NULL, NULL, NULL, SEP, SEP,
+    /* B8 */ NULL, NULL, "o", SEP, NULL, NULL, NULL, SEP,
+    /* C0 */ "a", "a", "a", "a", "Ae", "Aa", "AE", "c",
+    /* C8 */ "e", "e", "e", "e", "i", "i", "i", "i",
+    /* D0 */ "D", "n", "o", "o", "o", "o", "Oe", NULL,
+    /* D8 */ "Oe", "u", "u", "u", "u", "y", "TH", "ss",
+    /* E0 */ "a", "a", "a", "a", "ae", "aa", "ae", "c",
+    /* E8 */ "e", "e", "e", "e", "i", "i", "i", "i",
+    /* F0 */ "d", "n", "o", "o", "o", "o", "oe", NULL,
+    /* F8 */ "oe", "u", "u", "u", "u", "y", "th", "y",
+}};
+
+static const charset_table_t charset_cp1252_default = {{
+    /* 80 */ "euro", NULL, SEP, "f", "\"", "...", "+", SEP,
+    /* 88 */ NULL, SEP, "s", SEP, "OE", NULL, "z", NULL,
+    /* 90 */ NULL, "'", "'", "\"", "\"", "*", "-", SEP,
+    /* 98 */ NULL, "tm", "s", SEP, "oe", NULL, "z", "y",
+    /* A0 */ SEP, SEP, "cent", "pound", "currency", "yen", NULL, SEP,
+    /* A8 */ NULL, "(c)", "a", SEP, NULL, NULL, "(r)", NULL,
+    /* B0 */ NULL, NULL, NULL, NULL, NULL, NULL, SEP, SEP,
+    /* B8 */ NULL, NULL, "o", SEP, NULL, NULL, NULL, SEP,
+    /* C0 */ "a", "a", "a", "a", "a", "a", "AE", "c",
+    /* C8 */ "e", "e", "e", "e", "i", "i", "i", "i",
+    /* D0 */ "D", "n", "o", "o", "o", "o", "o", NULL,
+    /* D8 */ "O", "u", "u", "u", "u", "y", "TH", "ss",
+    /* E0 */ "a", "a", "a", "a", "a", "a", "ae", "c",
+    /* E8 */ "e", "e", "e", "e", "i", "i", "i", "i",
+    /* F0 */ "d", "n", "o", "o", "o", "o", "o", NULL,
+    /* F8 */ "o", "u", "u", "u", "u", "y", "th", "y",
+}};
+
+static const charset_table_t charset_cp1252_german = {{
+    /* 80 */ "euro", NULL, SEP, "f", "\"", "...", "+", SEP,
+    /* 88 */ NULL, SEP, "s", SEP, "OE", NULL, "z", NULL,
+    /* 90 */ NULL, "'", "'", "\"", "\"", "*", "-", SEP,
+    /* 98 */ NULL, "tm", "s", SEP, "oe", NULL, "z", "y",
+    /* A0 */ SEP, SEP, "cent", "pound", "currency", "yen", NULL, SEP,
+    /* A8 */ NULL, "(c)", "a", SEP, NULL, NULL, "(r)", NULL,
+    /* B0 */ NULL, NULL, NULL, NULL, NULL, NULL, SEP, SEP,
+    /* B8 */ NULL, NULL, "o", SEP, NULL, NULL, NULL, SEP,
+    /* C0 */ "a", "a", "a", "a", "Ae", "a", "AE", "c",
+    /* C8 */ "e", "e", "e", "e", "i", "i", "i", "i",
+    /* D0 */ "D", "n", "o", "o", "o", "o", "Oe", NULL,
+    /* D8 */ "O", "u", "u", "u", "Ue", "y", "TH", "ss",
+    /* E0 */ "a", "a", "a", "a", "ae", "a", "ae", "c",
+    /* E8 */ "e", "e", "e", "e", "i", "i", "i", "i",
+    /* F0 */ "d", "n", "o", "o", "o", "o", "oe", NULL,
+    /* F8 */ "o", "u", "u", "u", "ue", "y", "th", "y",
+}};
+
+static const charset_table_t charset_cp1252_scandinavian = {{
+    /* 80 */ "euro", NULL, SEP, "f", "\"", "...", "+", SEP,
+    /* 88 */ NULL, SEP, "s", SEP, "OE", NULL, "z", NULL,
+    /* 90 */ NULL, "'", "'", "\"", "\"", "*", "-", SEP,
+    /* 98 */ NULL, "tm", "s", SEP, "oe", NULL, "z", "y",
+    /* A0 */ SEP, SEP, "cent", "pound", "currency", "yen", NULL, SEP,
+    /* A8 */ NULL, "(c)", "a", SEP, NULL, NULL, "(r)", NULL,
+    /* B0 */ NULL, NULL, NULL, NULL, NULL, NULL, SEP, SEP,
+    /* B8 */ NULL, NULL, "o", SEP, NULL, NULL, NULL, SEP,
+    /* C0 */ "a", "a", "a", "a", "Ae", "Aa", "AE", "c",
+    /* C8 */ "e", "e", "e", "e", "i", "i", "i", "i",
+    /* D0 */ "D", "n", "o", "o", "o", "o", "Oe", NULL,
+    /* D8 */ "Oe", "u", "u", "u", "u", "y", "TH", "ss",
+    /* E0 */ "a", "a", "a", "a", "ae", "aa", "ae", "c",
+    /* E8 */ "e", "e", "e", "e", "i", "i", "i", "i",
+    /* F0 */ "d", "n", "o", "o", "o", "o", "oe", NULL,
+    /* F8 */ "oe", "u", "u", "u", "u", "y", "th", "y",
+}};
+
+static const charset_table_t charset_cp1252_ukrainian = {{
+    /* 80 */ "euro", NULL, SEP, "f", "\"", "...", "+", SEP,
+    /* 88 */ NULL, SEP, "s", SEP, "OE", NULL, "z", NULL,
+    /* 90 */ NULL, "'", "", "\"", "\"", "*", "-", SEP,
+    /* 98 */ NULL, "tm", "s", SEP, "oe", NULL, "z", "y",
+    /* A0 */ SEP, SEP, "cent", "pound", "currency", "yen", NULL, SEP,
+    /* A8 */ NULL, "(c)", "a", SEP, NULL, NULL, "(r)", NULL,
+    /* B0 */ NULL, NULL, NULL, NULL, NULL, NULL, SEP, SEP,
+    /* B8 */ NULL, NULL, "o", SEP, NULL, NULL, NULL, SEP,
+    /* C0 */ "a", "a", "a", "a", "a", "a", "AE", "c",
+    /* C8 */ "e", "e", "e", "e", "i", "i", "i", "i",
+    /* D0 */ "D", "n", "o", "o", "o", "o", "o", NULL,
+    /* D8 */ "O", "u", "u", "u", "u", "y", "TH", "ss",
+    /* E0 */ "a", "a", "a", "a", "a", "a", "ae", "c",
+    /* E8 */ "e", "e", "e", "e", "i", "i", "i", "i",
+    /* F0 */ "d", "n", "o", "o", "o", "o", "o", NULL,
+    /* F8 */ "o", "u", "u", "u", "u", "y", "th", "y",
+}};
+
+#undef SEP
+
+static const charset_table_t *const charset_tables[SLUGIFY_ENCODING_COUNT - SLUGIFY_ENCODING_LATIN1]
+                                                  [SLUGIFY_LANG_COUNT] = {
+    [SLUGIFY_ENCODING_LATIN1 - SLUGIFY_ENCODING_LATIN1] = {
+        [SLUGIFY_LANG_DEFAULT] = &charset_latin1_default,
+        [SLUGIFY_LANG_GERMAN] = &charset_latin1_german,
+        [SLUGIFY_LANG_DANISH] = &charset_latin1_scandinavian,
+        [SLUGIFY_LANG_NORWEGIAN] = &charset_latin1_scandinavian,
+        [SLUGIFY_LANG_RUSSIAN_BGN] = &charset_latin1_default,
+        [SLUGIFY_LANG_RUSSIAN_GOST] = &charset_latin1_default,
+        [SLUGIFY_LANG_RUSSIAN_ICAO] = &charset_latin1_default,
+        [SLUGIFY_LANG_UKRAINIAN] = &charset_latin1_default,
+    },
+    [SLUGIFY_ENCODING_CP1252 - SLUGIFY_ENCODING_LATIN1] = {
+        [SLUGIFY_LANG_DEFAULT] = &charset_cp1252_default,
+        [SLUGIFY_LANG_GERMAN] = &charset_cp1252_german,
+        [SLUGIFY_LANG_DANISH] = &charset_cp1252_scandinavian,
+        [SLUGIFY_LANG_NORWEGIAN] = &charset_cp1252_scandinavian,
+        [SLUGIFY_LANG_RUSSIAN_BGN] = &charset_cp1252_default,
+        [SLUGIFY_LANG_RUSSIAN_GOST] = &charset_cp1252_default,
+        [SLUGIFY_LANG_RUSSIAN_ICAO] = &charset_cp1252_default,
+        [SLUGIFY_LANG_UKRAINIAN] = &charset_cp1252_ukrainian,
+    },
+};
+
+#endif
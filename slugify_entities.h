@@ -0,0 +1,1728 @@
+#ifndef SLUGIFY_ENTITIES_H
+#define SLUGIFY_ENTITIES_H
+
+/* HTML named character references, included only by slugify.c. Generated
+ * from the WHATWG list as shipped in Python's html.entities.html5, keeping
+ * the 2125 names that end in ';'. The 93 that expand to two code points
+ * keep the first; the second is a combining mark or variation selector in
+ * all but &fjlig; and &ThickSpace;.
+ *
+ * html_entity_slots is a CHD perfect hash over entity_hash(), as for the
+ * built-in stop words: the bucket's displacement is the seed for the slot.
+ * Names are stored without the ';', null-separated in html_entity_names,
+ * which is a char initializer since a string this long exceeds what C99
+ * compilers must accept. */
+
+#define HTML_ENTITY_COUNT 2125
+#define HTML_ENTITY_BUCKETS 709
+#define HTML_ENTITY_SLOTS 2657
+#define HTML_ENTITY_MAX_NAME 31
+#define HTML_ENTITY_EMPTY 0xFFFF
+
+static const char html_entity_names[16129] = {
+    'A', 'E', 'l', 'i', 'g', 0, 'A', 'M', 'P', 0, 'A', 'a', 'c', 'u', 't', 'e', 0,
+    'A', 'b', 'r', 'e', 'v', 'e', 0, 'A', 'c', 'i', 'r', 'c', 0, 'A', 'c', 'y', 0,
+    'A', 'f', 'r', 0, 'A', 'g', 'r', 'a', 'v', 'e', 0, 'A', 'l', 'p', 'h', 'a', 0,
+    'A', 'm', 'a', 'c', 'r', 0, 'A', 'n', 'd', 0, 'A', 'o', 'g', 'o', 'n', 0,
+    'A', 'o', 'p', 'f', 0, 'A', 'p', 'p', 'l', 'y', 'F', 'u', 'n', 'c', 't', 'i', 'o', 'n', 0,
+    'A', 'r', 'i', 'n', 'g', 0, 'A', 's', 'c', 'r', 0, 'A', 's', 's', 'i', 'g', 'n', 0,
+    'A', 't', 'i', 'l', 'd', 'e', 0, 'A', 'u', 'm', 'l', 0,
+    'B', 'a', 'c', 'k', 's', 'l', 'a', 's', 'h', 0, 'B', 'a', 'r', 'v', 0,
+    'B', 'a', 'r', 'w', 'e', 'd', 0, 'B', 'c', 'y', 0, 'B', 'e', 'c', 'a', 'u', 's', 'e', 0,
+    'B', 'e', 'r', 'n', 'o', 'u', 'l', 'l', 'i', 's', 0, 'B', 'e', 't', 'a', 0,
+    'B', 'f', 'r', 0, 'B', 'o', 'p', 'f', 0, 'B', 'r', 'e', 'v', 'e', 0, 'B', 's', 'c', 'r', 0,
+    'B', 'u', 'm', 'p', 'e', 'q', 0, 'C', 'H', 'c', 'y', 0, 'C', 'O', 'P', 'Y', 0,
+    'C', 'a', 'c', 'u', 't', 'e', 0, 'C', 'a', 'p', 0,
+    'C', 'a', 'p', 'i', 't', 'a', 'l', 'D', 'i', 'f', 'f', 'e', 'r', 'e', 'n', 't', 'i', 'a', 'l', 'D', 0,
+    'C', 'a', 'y', 'l', 'e', 'y', 's', 0, 'C', 'c', 'a', 'r', 'o', 'n', 0,
+    'C', 'c', 'e', 'd', 'i', 'l', 0, 'C', 'c', 'i', 'r', 'c', 0,
+    'C', 'c', 'o', 'n', 'i', 'n', 't', 0, 'C', 'd', 'o', 't', 0,
+    'C', 'e', 'd', 'i', 'l', 'l', 'a', 0, 'C', 'e', 'n', 't', 'e', 'r', 'D', 'o', 't', 0,
+    'C', 'f', 'r', 0, 'C', 'h', 'i', 0, 'C', 'i', 'r', 'c', 'l', 'e', 'D', 'o', 't', 0,
+    'C', 'i', 'r', 'c', 'l', 'e', 'M', 'i', 'n', 'u', 's', 0,
+    'C', 'i', 'r', 'c', 'l', 'e', 'P', 'l', 'u', 's', 0,
+    'C', 'i', 'r', 'c', 'l', 'e', 'T', 'i', 'm', 'e', 's', 0,
+    'C', 'l', 'o', 'c', 'k', 'w', 'i', 's', 'e', 'C', 'o', 'n', 't', 'o', 'u', 'r', 'I', 'n', 't', 'e', 'g', 'r', 'a', 'l', 0,
+    'C', 'l', 'o', 's', 'e', 'C', 'u', 'r', 'l', 'y', 'D', 'o', 'u', 'b', 'l', 'e', 'Q', 'u', 'o', 't', 'e', 0,
+    'C', 'l', 'o', 's', 'e', 'C', 'u', 'r', 'l', 'y', 'Q', 'u', 'o', 't', 'e', 0,
+    'C', 'o', 'l', 'o', 'n', 0, 'C', 'o', 'l', 'o', 'n', 'e', 0,
+    'C', 'o', 'n', 'g', 'r', 'u', 'e', 'n', 't', 0, 'C', 'o', 'n', 'i', 'n', 't', 0,
+    'C', 'o', 'n', 't', 'o', 'u', 'r', 'I', 'n', 't', 'e', 'g', 'r', 'a', 'l', 0,
+    'C', 'o', 'p', 'f', 0, 'C', 'o', 'p', 'r', 'o', 'd', 'u', 'c', 't', 0,
+    'C', 'o', 'u', 'n', 't', 'e', 'r', 'C', 'l', 'o', 'c', 'k', 'w', 'i', 's', 'e', 'C', 'o', 'n', 't', 'o', 'u', 'r', 'I', 'n', 't', 'e', 'g', 'r', 'a', 'l', 0,
+    'C', 'r', 'o', 's', 's', 0, 'C', 's', 'c', 'r', 0, 'C', 'u', 'p', 0,
+    'C', 'u', 'p', 'C', 'a', 'p', 0, 'D', 'D', 0, 'D', 'D', 'o', 't', 'r', 'a', 'h', 'd', 0,
+    'D', 'J', 'c', 'y', 0, 'D', 'S', 'c', 'y', 0, 'D', 'Z', 'c', 'y', 0,
+    'D', 'a', 'g', 'g', 'e', 'r', 0, 'D', 'a', 'r', 'r', 0, 'D', 'a', 's', 'h', 'v', 0,
+    'D', 'c', 'a', 'r', 'o', 'n', 0, 'D', 'c', 'y', 0, 'D', 'e', 'l', 0,
+    'D', 'e', 'l', 't', 'a', 0, 'D', 'f', 'r', 0,
+    'D', 'i', 'a', 'c', 'r', 'i', 't', 'i', 'c', 'a', 'l', 'A', 'c', 'u', 't', 'e', 0,
+    'D', 'i', 'a', 'c', 'r', 'i', 't', 'i', 'c', 'a', 'l', 'D', 'o', 't', 0,
+    'D', 'i', 'a', 'c', 'r', 'i', 't', 'i', 'c', 'a', 'l', 'D', 'o', 'u', 'b', 'l', 'e', 'A', 'c', 'u', 't', 'e', 0,
+    'D', 'i', 'a', 'c', 'r', 'i', 't', 'i', 'c', 'a', 'l', 'G', 'r', 'a', 'v', 'e', 0,
+    'D', 'i', 'a', 'c', 'r', 'i', 't', 'i', 'c', 'a', 'l', 'T', 'i', 'l', 'd', 'e', 0,
+    'D', 'i', 'a', 'm', 'o', 'n', 'd', 0,
+    'D', 'i', 'f', 'f', 'e', 'r', 'e', 'n', 't', 'i', 'a', 'l', 'D', 0, 'D', 'o', 'p', 'f', 0,
+    'D', 'o', 't', 0, 'D', 'o', 't', 'D', 'o', 't', 0,
+    'D', 'o', 't', 'E', 'q', 'u', 'a', 'l', 0,
+    'D', 'o', 'u', 'b', 'l', 'e', 'C', 'o', 'n', 't', 'o', 'u', 'r', 'I', 'n', 't', 'e', 'g', 'r', 'a', 'l', 0,
+    'D', 'o', 'u', 'b', 'l', 'e', 'D', 'o', 't', 0,
+    'D', 'o', 'u', 'b', 'l', 'e', 'D', 'o', 'w', 'n', 'A', 'r', 'r', 'o', 'w', 0,
+    'D', 'o', 'u', 'b', 'l', 'e', 'L', 'e', 'f', 't', 'A', 'r', 'r', 'o', 'w', 0,
+    'D', 'o', 'u', 'b', 'l', 'e', 'L', 'e', 'f', 't', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', 0,
+    'D', 'o', 'u', 'b', 'l', 'e', 'L', 'e', 'f', 't', 'T', 'e', 'e', 0,
+    'D', 'o', 'u', 'b', 'l', 'e', 'L', 'o', 'n', 'g', 'L', 'e', 'f', 't', 'A', 'r', 'r', 'o', 'w', 0,
+    'D', 'o', 'u', 'b', 'l', 'e', 'L', 'o', 'n', 'g', 'L', 'e', 'f', 't', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', 0,
+    'D', 'o', 'u', 'b', 'l', 'e', 'L', 'o', 'n', 'g', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', 0,
+    'D', 'o', 'u', 'b', 'l', 'e', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', 0,
+    'D', 'o', 'u', 'b', 'l', 'e', 'R', 'i', 'g', 'h', 't', 'T', 'e', 'e', 0,
+    'D', 'o', 'u', 'b', 'l', 'e', 'U', 'p', 'A', 'r', 'r', 'o', 'w', 0,
+    'D', 'o', 'u', 'b', 'l', 'e', 'U', 'p', 'D', 'o', 'w', 'n', 'A', 'r', 'r', 'o', 'w', 0,
+    'D', 'o', 'u', 'b', 'l', 'e', 'V', 'e', 'r', 't', 'i', 'c', 'a', 'l', 'B', 'a', 'r', 0,
+    'D', 'o', 'w', 'n', 'A', 'r', 'r', 'o', 'w', 0,
+    'D', 'o', 'w', 'n', 'A', 'r', 'r', 'o', 'w', 'B', 'a', 'r', 0,
+    'D', 'o', 'w', 'n', 'A', 'r', 'r', 'o', 'w', 'U', 'p', 'A', 'r', 'r', 'o', 'w', 0,
+    'D', 'o', 'w', 'n', 'B', 'r', 'e', 'v', 'e', 0,
+    'D', 'o', 'w', 'n', 'L', 'e', 'f', 't', 'R', 'i', 'g', 'h', 't', 'V', 'e', 'c', 't', 'o', 'r', 0,
+    'D', 'o', 'w', 'n', 'L', 'e', 'f', 't', 'T', 'e', 'e', 'V', 'e', 'c', 't', 'o', 'r', 0,
+    'D', 'o', 'w', 'n', 'L', 'e', 'f', 't', 'V', 'e', 'c', 't', 'o', 'r', 0,
+    'D', 'o', 'w', 'n', 'L', 'e', 'f', 't', 'V', 'e', 'c', 't', 'o', 'r', 'B', 'a', 'r', 0,
+    'D', 'o', 'w', 'n', 'R', 'i', 'g', 'h', 't', 'T', 'e', 'e', 'V', 'e', 'c', 't', 'o', 'r', 0,
+    'D', 'o', 'w', 'n', 'R', 'i', 'g', 'h', 't', 'V', 'e', 'c', 't', 'o', 'r', 0,
+    'D', 'o', 'w', 'n', 'R', 'i', 'g', 'h', 't', 'V', 'e', 'c', 't', 'o', 'r', 'B', 'a', 'r', 0,
+    'D', 'o', 'w', 'n', 'T', 'e', 'e', 0,
+    'D', 'o', 'w', 'n', 'T', 'e', 'e', 'A', 'r', 'r', 'o', 'w', 0,
+    'D', 'o', 'w', 'n', 'a', 'r', 'r', 'o', 'w', 0, 'D', 's', 'c', 'r', 0,
+    'D', 's', 't', 'r', 'o', 'k', 0, 'E', 'N', 'G', 0, 'E', 'T', 'H', 0,
+    'E', 'a', 'c', 'u', 't', 'e', 0, 'E', 'c', 'a', 'r', 'o', 'n', 0,
+    'E', 'c', 'i', 'r', 'c', 0, 'E', 'c', 'y', 0, 'E', 'd', 'o', 't', 0, 'E', 'f', 'r', 0,
+    'E', 'g', 'r', 'a', 'v', 'e', 0, 'E', 'l', 'e', 'm', 'e', 'n', 't', 0,
+    'E', 'm', 'a', 'c', 'r', 0,
+    'E', 'm', 'p', 't', 'y', 'S', 'm', 'a', 'l', 'l', 'S', 'q', 'u', 'a', 'r', 'e', 0,
+    'E', 'm', 'p', 't', 'y', 'V', 'e', 'r', 'y', 'S', 'm', 'a', 'l', 'l', 'S', 'q', 'u', 'a', 'r', 'e', 0,
+    'E', 'o', 'g', 'o', 'n', 0, 'E', 'o', 'p', 'f', 0, 'E', 'p', 's', 'i', 'l', 'o', 'n', 0,
+    'E', 'q', 'u', 'a', 'l', 0, 'E', 'q', 'u', 'a', 'l', 'T', 'i', 'l', 'd', 'e', 0,
+    'E', 'q', 'u', 'i', 'l', 'i', 'b', 'r', 'i', 'u', 'm', 0, 'E', 's', 'c', 'r', 0,
+    'E', 's', 'i', 'm', 0, 'E', 't', 'a', 0, 'E', 'u', 'm', 'l', 0,
+    'E', 'x', 'i', 's', 't', 's', 0,
+    'E', 'x', 'p', 'o', 'n', 'e', 'n', 't', 'i', 'a', 'l', 'E', 0, 'F', 'c', 'y', 0,
+    'F', 'f', 'r', 0,
+    'F', 'i', 'l', 'l', 'e', 'd', 'S', 'm', 'a', 'l', 'l', 'S', 'q', 'u', 'a', 'r', 'e', 0,
+    'F', 'i', 'l', 'l', 'e', 'd', 'V', 'e', 'r', 'y', 'S', 'm', 'a', 'l', 'l', 'S', 'q', 'u', 'a', 'r', 'e', 0,
+    'F', 'o', 'p', 'f', 0, 'F', 'o', 'r', 'A', 'l', 'l', 0,
+    'F', 'o', 'u', 'r', 'i', 'e', 'r', 't', 'r', 'f', 0, 'F', 's', 'c', 'r', 0,
+    'G', 'J', 'c', 'y', 0, 'G', 'T', 0, 'G', 'a', 'm', 'm', 'a', 0,
+    'G', 'a', 'm', 'm', 'a', 'd', 0, 'G', 'b', 'r', 'e', 'v', 'e', 0,
+    'G', 'c', 'e', 'd', 'i', 'l', 0, 'G', 'c', 'i', 'r', 'c', 0, 'G', 'c', 'y', 0,
+    'G', 'd', 'o', 't', 0, 'G', 'f', 'r', 0, 'G', 'g', 0, 'G', 'o', 'p', 'f', 0,
+    'G', 'r', 'e', 'a', 't', 'e', 'r', 'E', 'q', 'u', 'a', 'l', 0,
+    'G', 'r', 'e', 'a', 't', 'e', 'r', 'E', 'q', 'u', 'a', 'l', 'L', 'e', 's', 's', 0,
+    'G', 'r', 'e', 'a', 't', 'e', 'r', 'F', 'u', 'l', 'l', 'E', 'q', 'u', 'a', 'l', 0,
+    'G', 'r', 'e', 'a', 't', 'e', 'r', 'G', 'r', 'e', 'a', 't', 'e', 'r', 0,
+    'G', 'r', 'e', 'a', 't', 'e', 'r', 'L', 'e', 's', 's', 0,
+    'G', 'r', 'e', 'a', 't', 'e', 'r', 'S', 'l', 'a', 'n', 't', 'E', 'q', 'u', 'a', 'l', 0,
+    'G', 'r', 'e', 'a', 't', 'e', 'r', 'T', 'i', 'l', 'd', 'e', 0, 'G', 's', 'c', 'r', 0,
+    'G', 't', 0, 'H', 'A', 'R', 'D', 'c', 'y', 0, 'H', 'a', 'c', 'e', 'k', 0, 'H', 'a', 't', 0,
+    'H', 'c', 'i', 'r', 'c', 0, 'H', 'f', 'r', 0,
+    'H', 'i', 'l', 'b', 'e', 'r', 't', 'S', 'p', 'a', 'c', 'e', 0, 'H', 'o', 'p', 'f', 0,
+    'H', 'o', 'r', 'i', 'z', 'o', 'n', 't', 'a', 'l', 'L', 'i', 'n', 'e', 0,
+    'H', 's', 'c', 'r', 0, 'H', 's', 't', 'r', 'o', 'k', 0,
+    'H', 'u', 'm', 'p', 'D', 'o', 'w', 'n', 'H', 'u', 'm', 'p', 0,
+    'H', 'u', 'm', 'p', 'E', 'q', 'u', 'a', 'l', 0, 'I', 'E', 'c', 'y', 0,
+    'I', 'J', 'l', 'i', 'g', 0, 'I', 'O', 'c', 'y', 0, 'I', 'a', 'c', 'u', 't', 'e', 0,
+    'I', 'c', 'i', 'r', 'c', 0, 'I', 'c', 'y', 0, 'I', 'd', 'o', 't', 0, 'I', 'f', 'r', 0,
+    'I', 'g', 'r', 'a', 'v', 'e', 0, 'I', 'm', 0, 'I', 'm', 'a', 'c', 'r', 0,
+    'I', 'm', 'a', 'g', 'i', 'n', 'a', 'r', 'y', 'I', 0, 'I', 'm', 'p', 'l', 'i', 'e', 's', 0,
+    'I', 'n', 't', 0, 'I', 'n', 't', 'e', 'g', 'r', 'a', 'l', 0,
+    'I', 'n', 't', 'e', 'r', 's', 'e', 'c', 't', 'i', 'o', 'n', 0,
+    'I', 'n', 'v', 'i', 's', 'i', 'b', 'l', 'e', 'C', 'o', 'm', 'm', 'a', 0,
+    'I', 'n', 'v', 'i', 's', 'i', 'b', 'l', 'e', 'T', 'i', 'm', 'e', 's', 0,
+    'I', 'o', 'g', 'o', 'n', 0, 'I', 'o', 'p', 'f', 0, 'I', 'o', 't', 'a', 0,
+    'I', 's', 'c', 'r', 0, 'I', 't', 'i', 'l', 'd', 'e', 0, 'I', 'u', 'k', 'c', 'y', 0,
+    'I', 'u', 'm', 'l', 0, 'J', 'c', 'i', 'r', 'c', 0, 'J', 'c', 'y', 0, 'J', 'f', 'r', 0,
+    'J', 'o', 'p', 'f', 0, 'J', 's', 'c', 'r', 0, 'J', 's', 'e', 'r', 'c', 'y', 0,
+    'J', 'u', 'k', 'c', 'y', 0, 'K', 'H', 'c', 'y', 0, 'K', 'J', 'c', 'y', 0,
+    'K', 'a', 'p', 'p', 'a', 0, 'K', 'c', 'e', 'd', 'i', 'l', 0, 'K', 'c', 'y', 0,
+    'K', 'f', 'r', 0, 'K', 'o', 'p', 'f', 0, 'K', 's', 'c', 'r', 0, 'L', 'J', 'c', 'y', 0,
+    'L', 'T', 0, 'L', 'a', 'c', 'u', 't', 'e', 0, 'L', 'a', 'm', 'b', 'd', 'a', 0,
+    'L', 'a', 'n', 'g', 0, 'L', 'a', 'p', 'l', 'a', 'c', 'e', 't', 'r', 'f', 0,
+    'L', 'a', 'r', 'r', 0, 'L', 'c', 'a', 'r', 'o', 'n', 0, 'L', 'c', 'e', 'd', 'i', 'l', 0,
+    'L', 'c', 'y', 0,
+    'L', 'e', 'f', 't', 'A', 'n', 'g', 'l', 'e', 'B', 'r', 'a', 'c', 'k', 'e', 't', 0,
+    'L', 'e', 'f', 't', 'A', 'r', 'r', 'o', 'w', 0,
+    'L', 'e', 'f', 't', 'A', 'r', 'r', 'o', 'w', 'B', 'a', 'r', 0,
+    'L', 'e', 'f', 't', 'A', 'r', 'r', 'o', 'w', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', 0,
+    'L', 'e', 'f', 't', 'C', 'e', 'i', 'l', 'i', 'n', 'g', 0,
+    'L', 'e', 'f', 't', 'D', 'o', 'u', 'b', 'l', 'e', 'B', 'r', 'a', 'c', 'k', 'e', 't', 0,
+    'L', 'e', 'f', 't', 'D', 'o', 'w', 'n', 'T', 'e', 'e', 'V', 'e', 'c', 't', 'o', 'r', 0,
+    'L', 'e', 'f', 't', 'D', 'o', 'w', 'n', 'V', 'e', 'c', 't', 'o', 'r', 0,
+    'L', 'e', 'f', 't', 'D', 'o', 'w', 'n', 'V', 'e', 'c', 't', 'o', 'r', 'B', 'a', 'r', 0,
+    'L', 'e', 'f', 't', 'F', 'l', 'o', 'o', 'r', 0,
+    'L', 'e', 'f', 't', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', 0,
+    'L', 'e', 'f', 't', 'R', 'i', 'g', 'h', 't', 'V', 'e', 'c', 't', 'o', 'r', 0,
+    'L', 'e', 'f', 't', 'T', 'e', 'e', 0,
+    'L', 'e', 'f', 't', 'T', 'e', 'e', 'A', 'r', 'r', 'o', 'w', 0,
+    'L', 'e', 'f', 't', 'T', 'e', 'e', 'V', 'e', 'c', 't', 'o', 'r', 0,
+    'L', 'e', 'f', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 0,
+    'L', 'e', 'f', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'B', 'a', 'r', 0,
+    'L', 'e', 'f', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'E', 'q', 'u', 'a', 'l', 0,
+    'L', 'e', 'f', 't', 'U', 'p', 'D', 'o', 'w', 'n', 'V', 'e', 'c', 't', 'o', 'r', 0,
+    'L', 'e', 'f', 't', 'U', 'p', 'T', 'e', 'e', 'V', 'e', 'c', 't', 'o', 'r', 0,
+    'L', 'e', 'f', 't', 'U', 'p', 'V', 'e', 'c', 't', 'o', 'r', 0,
+    'L', 'e', 'f', 't', 'U', 'p', 'V', 'e', 'c', 't', 'o', 'r', 'B', 'a', 'r', 0,
+    'L', 'e', 'f', 't', 'V', 'e', 'c', 't', 'o', 'r', 0,
+    'L', 'e', 'f', 't', 'V', 'e', 'c', 't', 'o', 'r', 'B', 'a', 'r', 0,
+    'L', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', 0,
+    'L', 'e', 'f', 't', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 0,
+    'L', 'e', 's', 's', 'E', 'q', 'u', 'a', 'l', 'G', 'r', 'e', 'a', 't', 'e', 'r', 0,
+    'L', 'e', 's', 's', 'F', 'u', 'l', 'l', 'E', 'q', 'u', 'a', 'l', 0,
+    'L', 'e', 's', 's', 'G', 'r', 'e', 'a', 't', 'e', 'r', 0,
+    'L', 'e', 's', 's', 'L', 'e', 's', 's', 0,
+    'L', 'e', 's', 's', 'S', 'l', 'a', 'n', 't', 'E', 'q', 'u', 'a', 'l', 0,
+    'L', 'e', 's', 's', 'T', 'i', 'l', 'd', 'e', 0, 'L', 'f', 'r', 0, 'L', 'l', 0,
+    'L', 'l', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', 0, 'L', 'm', 'i', 'd', 'o', 't', 0,
+    'L', 'o', 'n', 'g', 'L', 'e', 'f', 't', 'A', 'r', 'r', 'o', 'w', 0,
+    'L', 'o', 'n', 'g', 'L', 'e', 'f', 't', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', 0,
+    'L', 'o', 'n', 'g', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', 0,
+    'L', 'o', 'n', 'g', 'l', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', 0,
+    'L', 'o', 'n', 'g', 'l', 'e', 'f', 't', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 0,
+    'L', 'o', 'n', 'g', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 0,
+    'L', 'o', 'p', 'f', 0,
+    'L', 'o', 'w', 'e', 'r', 'L', 'e', 'f', 't', 'A', 'r', 'r', 'o', 'w', 0,
+    'L', 'o', 'w', 'e', 'r', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', 0,
+    'L', 's', 'c', 'r', 0, 'L', 's', 'h', 0, 'L', 's', 't', 'r', 'o', 'k', 0, 'L', 't', 0,
+    'M', 'a', 'p', 0, 'M', 'c', 'y', 0,
+    'M', 'e', 'd', 'i', 'u', 'm', 'S', 'p', 'a', 'c', 'e', 0,
+    'M', 'e', 'l', 'l', 'i', 'n', 't', 'r', 'f', 0, 'M', 'f', 'r', 0,
+    'M', 'i', 'n', 'u', 's', 'P', 'l', 'u', 's', 0, 'M', 'o', 'p', 'f', 0,
+    'M', 's', 'c', 'r', 0, 'M', 'u', 0, 'N', 'J', 'c', 'y', 0, 'N', 'a', 'c', 'u', 't', 'e', 0,
+    'N', 'c', 'a', 'r', 'o', 'n', 0, 'N', 'c', 'e', 'd', 'i', 'l', 0, 'N', 'c', 'y', 0,
+    'N', 'e', 'g', 'a', 't', 'i', 'v', 'e', 'M', 'e', 'd', 'i', 'u', 'm', 'S', 'p', 'a', 'c', 'e', 0,
+    'N', 'e', 'g', 'a', 't', 'i', 'v', 'e', 'T', 'h', 'i', 'c', 'k', 'S', 'p', 'a', 'c', 'e', 0,
+    'N', 'e', 'g', 'a', 't', 'i', 'v', 'e', 'T', 'h', 'i', 'n', 'S', 'p', 'a', 'c', 'e', 0,
+    'N', 'e', 'g', 'a', 't', 'i', 'v', 'e', 'V', 'e', 'r', 'y', 'T', 'h', 'i', 'n', 'S', 'p', 'a', 'c', 'e', 0,
+    'N', 'e', 's', 't', 'e', 'd', 'G', 'r', 'e', 'a', 't', 'e', 'r', 'G', 'r', 'e', 'a', 't', 'e', 'r', 0,
+    'N', 'e', 's', 't', 'e', 'd', 'L', 'e', 's', 's', 'L', 'e', 's', 's', 0,
+    'N', 'e', 'w', 'L', 'i', 'n', 'e', 0, 'N', 'f', 'r', 0,
+    'N', 'o', 'B', 'r', 'e', 'a', 'k', 0,
+    'N', 'o', 'n', 'B', 'r', 'e', 'a', 'k', 'i', 'n', 'g', 'S', 'p', 'a', 'c', 'e', 0,
+    'N', 'o', 'p', 'f', 0, 'N', 'o', 't', 0,
+    'N', 'o', 't', 'C', 'o', 'n', 'g', 'r', 'u', 'e', 'n', 't', 0,
+    'N', 'o', 't', 'C', 'u', 'p', 'C', 'a', 'p', 0,
+    'N', 'o', 't', 'D', 'o', 'u', 'b', 'l', 'e', 'V', 'e', 'r', 't', 'i', 'c', 'a', 'l', 'B', 'a', 'r', 0,
+    'N', 'o', 't', 'E', 'l', 'e', 'm', 'e', 'n', 't', 0,
+    'N', 'o', 't', 'E', 'q', 'u', 'a', 'l', 0,
+    'N', 'o', 't', 'E', 'q', 'u', 'a', 'l', 'T', 'i', 'l', 'd', 'e', 0,
+    'N', 'o', 't', 'E', 'x', 'i', 's', 't', 's', 0,
+    'N', 'o', 't', 'G', 'r', 'e', 'a', 't', 'e', 'r', 0,
+    'N', 'o', 't', 'G', 'r', 'e', 'a', 't', 'e', 'r', 'E', 'q', 'u', 'a', 'l', 0,
+    'N', 'o', 't', 'G', 'r', 'e', 'a', 't', 'e', 'r', 'F', 'u', 'l', 'l', 'E', 'q', 'u', 'a', 'l', 0,
+    'N', 'o', 't', 'G', 'r', 'e', 'a', 't', 'e', 'r', 'G', 'r', 'e', 'a', 't', 'e', 'r', 0,
+    'N', 'o', 't', 'G', 'r', 'e', 'a', 't', 'e', 'r', 'L', 'e', 's', 's', 0,
+    'N', 'o', 't', 'G', 'r', 'e', 'a', 't', 'e', 'r', 'S', 'l', 'a', 'n', 't', 'E', 'q', 'u', 'a', 'l', 0,
+    'N', 'o', 't', 'G', 'r', 'e', 'a', 't', 'e', 'r', 'T', 'i', 'l', 'd', 'e', 0,
+    'N', 'o', 't', 'H', 'u', 'm', 'p', 'D', 'o', 'w', 'n', 'H', 'u', 'm', 'p', 0,
+    'N', 'o', 't', 'H', 'u', 'm', 'p', 'E', 'q', 'u', 'a', 'l', 0,
+    'N', 'o', 't', 'L', 'e', 'f', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 0,
+    'N', 'o', 't', 'L', 'e', 'f', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'B', 'a', 'r', 0,
+    'N', 'o', 't', 'L', 'e', 'f', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'E', 'q', 'u', 'a', 'l', 0,
+    'N', 'o', 't', 'L', 'e', 's', 's', 0,
+    'N', 'o', 't', 'L', 'e', 's', 's', 'E', 'q', 'u', 'a', 'l', 0,
+    'N', 'o', 't', 'L', 'e', 's', 's', 'G', 'r', 'e', 'a', 't', 'e', 'r', 0,
+    'N', 'o', 't', 'L', 'e', 's', 's', 'L', 'e', 's', 's', 0,
+    'N', 'o', 't', 'L', 'e', 's', 's', 'S', 'l', 'a', 'n', 't', 'E', 'q', 'u', 'a', 'l', 0,
+    'N', 'o', 't', 'L', 'e', 's', 's', 'T', 'i', 'l', 'd', 'e', 0,
+    'N', 'o', 't', 'N', 'e', 's', 't', 'e', 'd', 'G', 'r', 'e', 'a', 't', 'e', 'r', 'G', 'r', 'e', 'a', 't', 'e', 'r', 0,
+    'N', 'o', 't', 'N', 'e', 's', 't', 'e', 'd', 'L', 'e', 's', 's', 'L', 'e', 's', 's', 0,
+    'N', 'o', 't', 'P', 'r', 'e', 'c', 'e', 'd', 'e', 's', 0,
+    'N', 'o', 't', 'P', 'r', 'e', 'c', 'e', 'd', 'e', 's', 'E', 'q', 'u', 'a', 'l', 0,
+    'N', 'o', 't', 'P', 'r', 'e', 'c', 'e', 'd', 'e', 's', 'S', 'l', 'a', 'n', 't', 'E', 'q', 'u', 'a', 'l', 0,
+    'N', 'o', 't', 'R', 'e', 'v', 'e', 'r', 's', 'e', 'E', 'l', 'e', 'm', 'e', 'n', 't', 0,
+    'N', 'o', 't', 'R', 'i', 'g', 'h', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 0,
+    'N', 'o', 't', 'R', 'i', 'g', 'h', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'B', 'a', 'r', 0,
+    'N', 'o', 't', 'R', 'i', 'g', 'h', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'E', 'q', 'u', 'a', 'l', 0,
+    'N', 'o', 't', 'S', 'q', 'u', 'a', 'r', 'e', 'S', 'u', 'b', 's', 'e', 't', 0,
+    'N', 'o', 't', 'S', 'q', 'u', 'a', 'r', 'e', 'S', 'u', 'b', 's', 'e', 't', 'E', 'q', 'u', 'a', 'l', 0,
+    'N', 'o', 't', 'S', 'q', 'u', 'a', 'r', 'e', 'S', 'u', 'p', 'e', 'r', 's', 'e', 't', 0,
+    'N', 'o', 't', 'S', 'q', 'u', 'a', 'r', 'e', 'S', 'u', 'p', 'e', 'r', 's', 'e', 't', 'E', 'q', 'u', 'a', 'l', 0,
+    'N', 'o', 't', 'S', 'u', 'b', 's', 'e', 't', 0,
+    'N', 'o', 't', 'S', 'u', 'b', 's', 'e', 't', 'E', 'q', 'u', 'a', 'l', 0,
+    'N', 'o', 't', 'S', 'u', 'c', 'c', 'e', 'e', 'd', 's', 0,
+    'N', 'o', 't', 'S', 'u', 'c', 'c', 'e', 'e', 'd', 's', 'E', 'q', 'u', 'a', 'l', 0,
+    'N', 'o', 't', 'S', 'u', 'c', 'c', 'e', 'e', 'd', 's', 'S', 'l', 'a', 'n', 't', 'E', 'q', 'u', 'a', 'l', 0,
+    'N', 'o', 't', 'S', 'u', 'c', 'c', 'e', 'e', 'd', 's', 'T', 'i', 'l', 'd', 'e', 0,
+    'N', 'o', 't', 'S', 'u', 'p', 'e', 'r', 's', 'e', 't', 0,
+    'N', 'o', 't', 'S', 'u', 'p', 'e', 'r', 's', 'e', 't', 'E', 'q', 'u', 'a', 'l', 0,
+    'N', 'o', 't', 'T', 'i', 'l', 'd', 'e', 0,
+    'N', 'o', 't', 'T', 'i', 'l', 'd', 'e', 'E', 'q', 'u', 'a', 'l', 0,
+    'N', 'o', 't', 'T', 'i', 'l', 'd', 'e', 'F', 'u', 'l', 'l', 'E', 'q', 'u', 'a', 'l', 0,
+    'N', 'o', 't', 'T', 'i', 'l', 'd', 'e', 'T', 'i', 'l', 'd', 'e', 0,
+    'N', 'o', 't', 'V', 'e', 'r', 't', 'i', 'c', 'a', 'l', 'B', 'a', 'r', 0,
+    'N', 's', 'c', 'r', 0, 'N', 't', 'i', 'l', 'd', 'e', 0, 'N', 'u', 0,
+    'O', 'E', 'l', 'i', 'g', 0, 'O', 'a', 'c', 'u', 't', 'e', 0, 'O', 'c', 'i', 'r', 'c', 0,
+    'O', 'c', 'y', 0, 'O', 'd', 'b', 'l', 'a', 'c', 0, 'O', 'f', 'r', 0,
+    'O', 'g', 'r', 'a', 'v', 'e', 0, 'O', 'm', 'a', 'c', 'r', 0, 'O', 'm', 'e', 'g', 'a', 0,
+    'O', 'm', 'i', 'c', 'r', 'o', 'n', 0, 'O', 'o', 'p', 'f', 0,
+    'O', 'p', 'e', 'n', 'C', 'u', 'r', 'l', 'y', 'D', 'o', 'u', 'b', 'l', 'e', 'Q', 'u', 'o', 't', 'e', 0,
+    'O', 'p', 'e', 'n', 'C', 'u', 'r', 'l', 'y', 'Q', 'u', 'o', 't', 'e', 0, 'O', 'r', 0,
+    'O', 's', 'c', 'r', 0, 'O', 's', 'l', 'a', 's', 'h', 0, 'O', 't', 'i', 'l', 'd', 'e', 0,
+    'O', 't', 'i', 'm', 'e', 's', 0, 'O', 'u', 'm', 'l', 0,
+    'O', 'v', 'e', 'r', 'B', 'a', 'r', 0, 'O', 'v', 'e', 'r', 'B', 'r', 'a', 'c', 'e', 0,
+    'O', 'v', 'e', 'r', 'B', 'r', 'a', 'c', 'k', 'e', 't', 0,
+    'O', 'v', 'e', 'r', 'P', 'a', 'r', 'e', 'n', 't', 'h', 'e', 's', 'i', 's', 0,
+    'P', 'a', 'r', 't', 'i', 'a', 'l', 'D', 0, 'P', 'c', 'y', 0, 'P', 'f', 'r', 0,
+    'P', 'h', 'i', 0, 'P', 'i', 0, 'P', 'l', 'u', 's', 'M', 'i', 'n', 'u', 's', 0,
+    'P', 'o', 'i', 'n', 'c', 'a', 'r', 'e', 'p', 'l', 'a', 'n', 'e', 0, 'P', 'o', 'p', 'f', 0,
+    'P', 'r', 0, 'P', 'r', 'e', 'c', 'e', 'd', 'e', 's', 0,
+    'P', 'r', 'e', 'c', 'e', 'd', 'e', 's', 'E', 'q', 'u', 'a', 'l', 0,
+    'P', 'r', 'e', 'c', 'e', 'd', 'e', 's', 'S', 'l', 'a', 'n', 't', 'E', 'q', 'u', 'a', 'l', 0,
+    'P', 'r', 'e', 'c', 'e', 'd', 'e', 's', 'T', 'i', 'l', 'd', 'e', 0,
+    'P', 'r', 'i', 'm', 'e', 0, 'P', 'r', 'o', 'd', 'u', 'c', 't', 0,
+    'P', 'r', 'o', 'p', 'o', 'r', 't', 'i', 'o', 'n', 0,
+    'P', 'r', 'o', 'p', 'o', 'r', 't', 'i', 'o', 'n', 'a', 'l', 0, 'P', 's', 'c', 'r', 0,
+    'P', 's', 'i', 0, 'Q', 'U', 'O', 'T', 0, 'Q', 'f', 'r', 0, 'Q', 'o', 'p', 'f', 0,
+    'Q', 's', 'c', 'r', 0, 'R', 'B', 'a', 'r', 'r', 0, 'R', 'E', 'G', 0,
+    'R', 'a', 'c', 'u', 't', 'e', 0, 'R', 'a', 'n', 'g', 0, 'R', 'a', 'r', 'r', 0,
+    'R', 'a', 'r', 'r', 't', 'l', 0, 'R', 'c', 'a', 'r', 'o', 'n', 0,
+    'R', 'c', 'e', 'd', 'i', 'l', 0, 'R', 'c', 'y', 0, 'R', 'e', 0,
+    'R', 'e', 'v', 'e', 'r', 's', 'e', 'E', 'l', 'e', 'm', 'e', 'n', 't', 0,
+    'R', 'e', 'v', 'e', 'r', 's', 'e', 'E', 'q', 'u', 'i', 'l', 'i', 'b', 'r', 'i', 'u', 'm', 0,
+    'R', 'e', 'v', 'e', 'r', 's', 'e', 'U', 'p', 'E', 'q', 'u', 'i', 'l', 'i', 'b', 'r', 'i', 'u', 'm', 0,
+    'R', 'f', 'r', 0, 'R', 'h', 'o', 0,
+    'R', 'i', 'g', 'h', 't', 'A', 'n', 'g', 'l', 'e', 'B', 'r', 'a', 'c', 'k', 'e', 't', 0,
+    'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', 0,
+    'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', 'B', 'a', 'r', 0,
+    'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', 'L', 'e', 'f', 't', 'A', 'r', 'r', 'o', 'w', 0,
+    'R', 'i', 'g', 'h', 't', 'C', 'e', 'i', 'l', 'i', 'n', 'g', 0,
+    'R', 'i', 'g', 'h', 't', 'D', 'o', 'u', 'b', 'l', 'e', 'B', 'r', 'a', 'c', 'k', 'e', 't', 0,
+    'R', 'i', 'g', 'h', 't', 'D', 'o', 'w', 'n', 'T', 'e', 'e', 'V', 'e', 'c', 't', 'o', 'r', 0,
+    'R', 'i', 'g', 'h', 't', 'D', 'o', 'w', 'n', 'V', 'e', 'c', 't', 'o', 'r', 0,
+    'R', 'i', 'g', 'h', 't', 'D', 'o', 'w', 'n', 'V', 'e', 'c', 't', 'o', 'r', 'B', 'a', 'r', 0,
+    'R', 'i', 'g', 'h', 't', 'F', 'l', 'o', 'o', 'r', 0,
+    'R', 'i', 'g', 'h', 't', 'T', 'e', 'e', 0,
+    'R', 'i', 'g', 'h', 't', 'T', 'e', 'e', 'A', 'r', 'r', 'o', 'w', 0,
+    'R', 'i', 'g', 'h', 't', 'T', 'e', 'e', 'V', 'e', 'c', 't', 'o', 'r', 0,
+    'R', 'i', 'g', 'h', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 0,
+    'R', 'i', 'g', 'h', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'B', 'a', 'r', 0,
+    'R', 'i', 'g', 'h', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'E', 'q', 'u', 'a', 'l', 0,
+    'R', 'i', 'g', 'h', 't', 'U', 'p', 'D', 'o', 'w', 'n', 'V', 'e', 'c', 't', 'o', 'r', 0,
+    'R', 'i', 'g', 'h', 't', 'U', 'p', 'T', 'e', 'e', 'V', 'e', 'c', 't', 'o', 'r', 0,
+    'R', 'i', 'g', 'h', 't', 'U', 'p', 'V', 'e', 'c', 't', 'o', 'r', 0,
+    'R', 'i', 'g', 'h', 't', 'U', 'p', 'V', 'e', 'c', 't', 'o', 'r', 'B', 'a', 'r', 0,
+    'R', 'i', 'g', 'h', 't', 'V', 'e', 'c', 't', 'o', 'r', 0,
+    'R', 'i', 'g', 'h', 't', 'V', 'e', 'c', 't', 'o', 'r', 'B', 'a', 'r', 0,
+    'R', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 0, 'R', 'o', 'p', 'f', 0,
+    'R', 'o', 'u', 'n', 'd', 'I', 'm', 'p', 'l', 'i', 'e', 's', 0,
+    'R', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 0, 'R', 's', 'c', 'r', 0,
+    'R', 's', 'h', 0, 'R', 'u', 'l', 'e', 'D', 'e', 'l', 'a', 'y', 'e', 'd', 0,
+    'S', 'H', 'C', 'H', 'c', 'y', 0, 'S', 'H', 'c', 'y', 0, 'S', 'O', 'F', 'T', 'c', 'y', 0,
+    'S', 'a', 'c', 'u', 't', 'e', 0, 'S', 'c', 0, 'S', 'c', 'a', 'r', 'o', 'n', 0,
+    'S', 'c', 'e', 'd', 'i', 'l', 0, 'S', 'c', 'i', 'r', 'c', 0, 'S', 'c', 'y', 0,
+    'S', 'f', 'r', 0, 'S', 'h', 'o', 'r', 't', 'D', 'o', 'w', 'n', 'A', 'r', 'r', 'o', 'w', 0,
+    'S', 'h', 'o', 'r', 't', 'L', 'e', 'f', 't', 'A', 'r', 'r', 'o', 'w', 0,
+    'S', 'h', 'o', 'r', 't', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', 0,
+    'S', 'h', 'o', 'r', 't', 'U', 'p', 'A', 'r', 'r', 'o', 'w', 0, 'S', 'i', 'g', 'm', 'a', 0,
+    'S', 'm', 'a', 'l', 'l', 'C', 'i', 'r', 'c', 'l', 'e', 0, 'S', 'o', 'p', 'f', 0,
+    'S', 'q', 'r', 't', 0, 'S', 'q', 'u', 'a', 'r', 'e', 0,
+    'S', 'q', 'u', 'a', 'r', 'e', 'I', 'n', 't', 'e', 'r', 's', 'e', 'c', 't', 'i', 'o', 'n', 0,
+    'S', 'q', 'u', 'a', 'r', 'e', 'S', 'u', 'b', 's', 'e', 't', 0,
+    'S', 'q', 'u', 'a', 'r', 'e', 'S', 'u', 'b', 's', 'e', 't', 'E', 'q', 'u', 'a', 'l', 0,
+    'S', 'q', 'u', 'a', 'r', 'e', 'S', 'u', 'p', 'e', 'r', 's', 'e', 't', 0,
+    'S', 'q', 'u', 'a', 'r', 'e', 'S', 'u', 'p', 'e', 'r', 's', 'e', 't', 'E', 'q', 'u', 'a', 'l', 0,
+    'S', 'q', 'u', 'a', 'r', 'e', 'U', 'n', 'i', 'o', 'n', 0, 'S', 's', 'c', 'r', 0,
+    'S', 't', 'a', 'r', 0, 'S', 'u', 'b', 0, 'S', 'u', 'b', 's', 'e', 't', 0,
+    'S', 'u', 'b', 's', 'e', 't', 'E', 'q', 'u', 'a', 'l', 0,
+    'S', 'u', 'c', 'c', 'e', 'e', 'd', 's', 0,
+    'S', 'u', 'c', 'c', 'e', 'e', 'd', 's', 'E', 'q', 'u', 'a', 'l', 0,
+    'S', 'u', 'c', 'c', 'e', 'e', 'd', 's', 'S', 'l', 'a', 'n', 't', 'E', 'q', 'u', 'a', 'l', 0,
+    'S', 'u', 'c', 'c', 'e', 'e', 'd', 's', 'T', 'i', 'l', 'd', 'e', 0,
+    'S', 'u', 'c', 'h', 'T', 'h', 'a', 't', 0, 'S', 'u', 'm', 0, 'S', 'u', 'p', 0,
+    'S', 'u', 'p', 'e', 'r', 's', 'e', 't', 0,
+    'S', 'u', 'p', 'e', 'r', 's', 'e', 't', 'E', 'q', 'u', 'a', 'l', 0,
+    'S', 'u', 'p', 's', 'e', 't', 0, 'T', 'H', 'O', 'R', 'N', 0, 'T', 'R', 'A', 'D', 'E', 0,
+    'T', 'S', 'H', 'c', 'y', 0, 'T', 'S', 'c', 'y', 0, 'T', 'a', 'b', 0, 'T', 'a', 'u', 0,
+    'T', 'c', 'a', 'r', 'o', 'n', 0, 'T', 'c', 'e', 'd', 'i', 'l', 0, 'T', 'c', 'y', 0,
+    'T', 'f', 'r', 0, 'T', 'h', 'e', 'r', 'e', 'f', 'o', 'r', 'e', 0,
+    'T', 'h', 'e', 't', 'a', 0, 'T', 'h', 'i', 'c', 'k', 'S', 'p', 'a', 'c', 'e', 0,
+    'T', 'h', 'i', 'n', 'S', 'p', 'a', 'c', 'e', 0, 'T', 'i', 'l', 'd', 'e', 0,
+    'T', 'i', 'l', 'd', 'e', 'E', 'q', 'u', 'a', 'l', 0,
+    'T', 'i', 'l', 'd', 'e', 'F', 'u', 'l', 'l', 'E', 'q', 'u', 'a', 'l', 0,
+    'T', 'i', 'l', 'd', 'e', 'T', 'i', 'l', 'd', 'e', 0, 'T', 'o', 'p', 'f', 0,
+    'T', 'r', 'i', 'p', 'l', 'e', 'D', 'o', 't', 0, 'T', 's', 'c', 'r', 0,
+    'T', 's', 't', 'r', 'o', 'k', 0, 'U', 'a', 'c', 'u', 't', 'e', 0, 'U', 'a', 'r', 'r', 0,
+    'U', 'a', 'r', 'r', 'o', 'c', 'i', 'r', 0, 'U', 'b', 'r', 'c', 'y', 0,
+    'U', 'b', 'r', 'e', 'v', 'e', 0, 'U', 'c', 'i', 'r', 'c', 0, 'U', 'c', 'y', 0,
+    'U', 'd', 'b', 'l', 'a', 'c', 0, 'U', 'f', 'r', 0, 'U', 'g', 'r', 'a', 'v', 'e', 0,
+    'U', 'm', 'a', 'c', 'r', 0, 'U', 'n', 'd', 'e', 'r', 'B', 'a', 'r', 0,
+    'U', 'n', 'd', 'e', 'r', 'B', 'r', 'a', 'c', 'e', 0,
+    'U', 'n', 'd', 'e', 'r', 'B', 'r', 'a', 'c', 'k', 'e', 't', 0,
+    'U', 'n', 'd', 'e', 'r', 'P', 'a', 'r', 'e', 'n', 't', 'h', 'e', 's', 'i', 's', 0,
+    'U', 'n', 'i', 'o', 'n', 0, 'U', 'n', 'i', 'o', 'n', 'P', 'l', 'u', 's', 0,
+    'U', 'o', 'g', 'o', 'n', 0, 'U', 'o', 'p', 'f', 0, 'U', 'p', 'A', 'r', 'r', 'o', 'w', 0,
+    'U', 'p', 'A', 'r', 'r', 'o', 'w', 'B', 'a', 'r', 0,
+    'U', 'p', 'A', 'r', 'r', 'o', 'w', 'D', 'o', 'w', 'n', 'A', 'r', 'r', 'o', 'w', 0,
+    'U', 'p', 'D', 'o', 'w', 'n', 'A', 'r', 'r', 'o', 'w', 0,
+    'U', 'p', 'E', 'q', 'u', 'i', 'l', 'i', 'b', 'r', 'i', 'u', 'm', 0,
+    'U', 'p', 'T', 'e', 'e', 0, 'U', 'p', 'T', 'e', 'e', 'A', 'r', 'r', 'o', 'w', 0,
+    'U', 'p', 'a', 'r', 'r', 'o', 'w', 0,
+    'U', 'p', 'd', 'o', 'w', 'n', 'a', 'r', 'r', 'o', 'w', 0,
+    'U', 'p', 'p', 'e', 'r', 'L', 'e', 'f', 't', 'A', 'r', 'r', 'o', 'w', 0,
+    'U', 'p', 'p', 'e', 'r', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', 0,
+    'U', 'p', 's', 'i', 0, 'U', 'p', 's', 'i', 'l', 'o', 'n', 0, 'U', 'r', 'i', 'n', 'g', 0,
+    'U', 's', 'c', 'r', 0, 'U', 't', 'i', 'l', 'd', 'e', 0, 'U', 'u', 'm', 'l', 0,
+    'V', 'D', 'a', 's', 'h', 0, 'V', 'b', 'a', 'r', 0, 'V', 'c', 'y', 0,
+    'V', 'd', 'a', 's', 'h', 0, 'V', 'd', 'a', 's', 'h', 'l', 0, 'V', 'e', 'e', 0,
+    'V', 'e', 'r', 'b', 'a', 'r', 0, 'V', 'e', 'r', 't', 0,
+    'V', 'e', 'r', 't', 'i', 'c', 'a', 'l', 'B', 'a', 'r', 0,
+    'V', 'e', 'r', 't', 'i', 'c', 'a', 'l', 'L', 'i', 'n', 'e', 0,
+    'V', 'e', 'r', 't', 'i', 'c', 'a', 'l', 'S', 'e', 'p', 'a', 'r', 'a', 't', 'o', 'r', 0,
+    'V', 'e', 'r', 't', 'i', 'c', 'a', 'l', 'T', 'i', 'l', 'd', 'e', 0,
+    'V', 'e', 'r', 'y', 'T', 'h', 'i', 'n', 'S', 'p', 'a', 'c', 'e', 0, 'V', 'f', 'r', 0,
+    'V', 'o', 'p', 'f', 0, 'V', 's', 'c', 'r', 0, 'V', 'v', 'd', 'a', 's', 'h', 0,
+    'W', 'c', 'i', 'r', 'c', 0, 'W', 'e', 'd', 'g', 'e', 0, 'W', 'f', 'r', 0,
+    'W', 'o', 'p', 'f', 0, 'W', 's', 'c', 'r', 0, 'X', 'f', 'r', 0, 'X', 'i', 0,
+    'X', 'o', 'p', 'f', 0, 'X', 's', 'c', 'r', 0, 'Y', 'A', 'c', 'y', 0, 'Y', 'I', 'c', 'y', 0,
+    'Y', 'U', 'c', 'y', 0, 'Y', 'a', 'c', 'u', 't', 'e', 0, 'Y', 'c', 'i', 'r', 'c', 0,
+    'Y', 'c', 'y', 0, 'Y', 'f', 'r', 0, 'Y', 'o', 'p', 'f', 0, 'Y', 's', 'c', 'r', 0,
+    'Y', 'u', 'm', 'l', 0, 'Z', 'H', 'c', 'y', 0, 'Z', 'a', 'c', 'u', 't', 'e', 0,
+    'Z', 'c', 'a', 'r', 'o', 'n', 0, 'Z', 'c', 'y', 0, 'Z', 'd', 'o', 't', 0,
+    'Z', 'e', 'r', 'o', 'W', 'i', 'd', 't', 'h', 'S', 'p', 'a', 'c', 'e', 0,
+    'Z', 'e', 't', 'a', 0, 'Z', 'f', 'r', 0, 'Z', 'o', 'p', 'f', 0, 'Z', 's', 'c', 'r', 0,
+    'a', 'a', 'c', 'u', 't', 'e', 0, 'a', 'b', 'r', 'e', 'v', 'e', 0, 'a', 'c', 0,
+    'a', 'c', 'E', 0, 'a', 'c', 'd', 0, 'a', 'c', 'i', 'r', 'c', 0, 'a', 'c', 'u', 't', 'e', 0,
+    'a', 'c', 'y', 0, 'a', 'e', 'l', 'i', 'g', 0, 'a', 'f', 0, 'a', 'f', 'r', 0,
+    'a', 'g', 'r', 'a', 'v', 'e', 0, 'a', 'l', 'e', 'f', 's', 'y', 'm', 0,
+    'a', 'l', 'e', 'p', 'h', 0, 'a', 'l', 'p', 'h', 'a', 0, 'a', 'm', 'a', 'c', 'r', 0,
+    'a', 'm', 'a', 'l', 'g', 0, 'a', 'm', 'p', 0, 'a', 'n', 'd', 0,
+    'a', 'n', 'd', 'a', 'n', 'd', 0, 'a', 'n', 'd', 'd', 0,
+    'a', 'n', 'd', 's', 'l', 'o', 'p', 'e', 0, 'a', 'n', 'd', 'v', 0, 'a', 'n', 'g', 0,
+    'a', 'n', 'g', 'e', 0, 'a', 'n', 'g', 'l', 'e', 0, 'a', 'n', 'g', 'm', 's', 'd', 0,
+    'a', 'n', 'g', 'm', 's', 'd', 'a', 'a', 0, 'a', 'n', 'g', 'm', 's', 'd', 'a', 'b', 0,
+    'a', 'n', 'g', 'm', 's', 'd', 'a', 'c', 0, 'a', 'n', 'g', 'm', 's', 'd', 'a', 'd', 0,
+    'a', 'n', 'g', 'm', 's', 'd', 'a', 'e', 0, 'a', 'n', 'g', 'm', 's', 'd', 'a', 'f', 0,
+    'a', 'n', 'g', 'm', 's', 'd', 'a', 'g', 0, 'a', 'n', 'g', 'm', 's', 'd', 'a', 'h', 0,
+    'a', 'n', 'g', 'r', 't', 0, 'a', 'n', 'g', 'r', 't', 'v', 'b', 0,
+    'a', 'n', 'g', 'r', 't', 'v', 'b', 'd', 0, 'a', 'n', 'g', 's', 'p', 'h', 0,
+    'a', 'n', 'g', 's', 't', 0, 'a', 'n', 'g', 'z', 'a', 'r', 'r', 0,
+    'a', 'o', 'g', 'o', 'n', 0, 'a', 'o', 'p', 'f', 0, 'a', 'p', 0, 'a', 'p', 'E', 0,
+    'a', 'p', 'a', 'c', 'i', 'r', 0, 'a', 'p', 'e', 0, 'a', 'p', 'i', 'd', 0,
+    'a', 'p', 'o', 's', 0, 'a', 'p', 'p', 'r', 'o', 'x', 0,
+    'a', 'p', 'p', 'r', 'o', 'x', 'e', 'q', 0, 'a', 'r', 'i', 'n', 'g', 0,
+    'a', 's', 'c', 'r', 0, 'a', 's', 't', 0, 'a', 's', 'y', 'm', 'p', 0,
+    'a', 's', 'y', 'm', 'p', 'e', 'q', 0, 'a', 't', 'i', 'l', 'd', 'e', 0,
+    'a', 'u', 'm', 'l', 0, 'a', 'w', 'c', 'o', 'n', 'i', 'n', 't', 0,
+    'a', 'w', 'i', 'n', 't', 0, 'b', 'N', 'o', 't', 0,
+    'b', 'a', 'c', 'k', 'c', 'o', 'n', 'g', 0,
+    'b', 'a', 'c', 'k', 'e', 'p', 's', 'i', 'l', 'o', 'n', 0,
+    'b', 'a', 'c', 'k', 'p', 'r', 'i', 'm', 'e', 0, 'b', 'a', 'c', 'k', 's', 'i', 'm', 0,
+    'b', 'a', 'c', 'k', 's', 'i', 'm', 'e', 'q', 0, 'b', 'a', 'r', 'v', 'e', 'e', 0,
+    'b', 'a', 'r', 'w', 'e', 'd', 0, 'b', 'a', 'r', 'w', 'e', 'd', 'g', 'e', 0,
+    'b', 'b', 'r', 'k', 0, 'b', 'b', 'r', 'k', 't', 'b', 'r', 'k', 0,
+    'b', 'c', 'o', 'n', 'g', 0, 'b', 'c', 'y', 0, 'b', 'd', 'q', 'u', 'o', 0,
+    'b', 'e', 'c', 'a', 'u', 's', 0, 'b', 'e', 'c', 'a', 'u', 's', 'e', 0,
+    'b', 'e', 'm', 'p', 't', 'y', 'v', 0, 'b', 'e', 'p', 's', 'i', 0,
+    'b', 'e', 'r', 'n', 'o', 'u', 0, 'b', 'e', 't', 'a', 0, 'b', 'e', 't', 'h', 0,
+    'b', 'e', 't', 'w', 'e', 'e', 'n', 0, 'b', 'f', 'r', 0, 'b', 'i', 'g', 'c', 'a', 'p', 0,
+    'b', 'i', 'g', 'c', 'i', 'r', 'c', 0, 'b', 'i', 'g', 'c', 'u', 'p', 0,
+    'b', 'i', 'g', 'o', 'd', 'o', 't', 0, 'b', 'i', 'g', 'o', 'p', 'l', 'u', 's', 0,
+    'b', 'i', 'g', 'o', 't', 'i', 'm', 'e', 's', 0, 'b', 'i', 'g', 's', 'q', 'c', 'u', 'p', 0,
+    'b', 'i', 'g', 's', 't', 'a', 'r', 0,
+    'b', 'i', 'g', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'd', 'o', 'w', 'n', 0,
+    'b', 'i', 'g', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'u', 'p', 0,
+    'b', 'i', 'g', 'u', 'p', 'l', 'u', 's', 0, 'b', 'i', 'g', 'v', 'e', 'e', 0,
+    'b', 'i', 'g', 'w', 'e', 'd', 'g', 'e', 0, 'b', 'k', 'a', 'r', 'o', 'w', 0,
+    'b', 'l', 'a', 'c', 'k', 'l', 'o', 'z', 'e', 'n', 'g', 'e', 0,
+    'b', 'l', 'a', 'c', 'k', 's', 'q', 'u', 'a', 'r', 'e', 0,
+    'b', 'l', 'a', 'c', 'k', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 0,
+    'b', 'l', 'a', 'c', 'k', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'd', 'o', 'w', 'n', 0,
+    'b', 'l', 'a', 'c', 'k', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'l', 'e', 'f', 't', 0,
+    'b', 'l', 'a', 'c', 'k', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'r', 'i', 'g', 'h', 't', 0,
+    'b', 'l', 'a', 'n', 'k', 0, 'b', 'l', 'k', '1', '2', 0, 'b', 'l', 'k', '1', '4', 0,
+    'b', 'l', 'k', '3', '4', 0, 'b', 'l', 'o', 'c', 'k', 0, 'b', 'n', 'e', 0,
+    'b', 'n', 'e', 'q', 'u', 'i', 'v', 0, 'b', 'n', 'o', 't', 0, 'b', 'o', 'p', 'f', 0,
+    'b', 'o', 't', 0, 'b', 'o', 't', 't', 'o', 'm', 0, 'b', 'o', 'w', 't', 'i', 'e', 0,
+    'b', 'o', 'x', 'D', 'L', 0, 'b', 'o', 'x', 'D', 'R', 0, 'b', 'o', 'x', 'D', 'l', 0,
+    'b', 'o', 'x', 'D', 'r', 0, 'b', 'o', 'x', 'H', 0, 'b', 'o', 'x', 'H', 'D', 0,
+    'b', 'o', 'x', 'H', 'U', 0, 'b', 'o', 'x', 'H', 'd', 0, 'b', 'o', 'x', 'H', 'u', 0,
+    'b', 'o', 'x', 'U', 'L', 0, 'b', 'o', 'x', 'U', 'R', 0, 'b', 'o', 'x', 'U', 'l', 0,
+    'b', 'o', 'x', 'U', 'r', 0, 'b', 'o', 'x', 'V', 0, 'b', 'o', 'x', 'V', 'H', 0,
+    'b', 'o', 'x', 'V', 'L', 0, 'b', 'o', 'x', 'V', 'R', 0, 'b', 'o', 'x', 'V', 'h', 0,
+    'b', 'o', 'x', 'V', 'l', 0, 'b', 'o', 'x', 'V', 'r', 0, 'b', 'o', 'x', 'b', 'o', 'x', 0,
+    'b', 'o', 'x', 'd', 'L', 0, 'b', 'o', 'x', 'd', 'R', 0, 'b', 'o', 'x', 'd', 'l', 0,
+    'b', 'o', 'x', 'd', 'r', 0, 'b', 'o', 'x', 'h', 0, 'b', 'o', 'x', 'h', 'D', 0,
+    'b', 'o', 'x', 'h', 'U', 0, 'b', 'o', 'x', 'h', 'd', 0, 'b', 'o', 'x', 'h', 'u', 0,
+    'b', 'o', 'x', 'm', 'i', 'n', 'u', 's', 0, 'b', 'o', 'x', 'p', 'l', 'u', 's', 0,
+    'b', 'o', 'x', 't', 'i', 'm', 'e', 's', 0, 'b', 'o', 'x', 'u', 'L', 0,
+    'b', 'o', 'x', 'u', 'R', 0, 'b', 'o', 'x', 'u', 'l', 0, 'b', 'o', 'x', 'u', 'r', 0,
+    'b', 'o', 'x', 'v', 0, 'b', 'o', 'x', 'v', 'H', 0, 'b', 'o', 'x', 'v', 'L', 0,
+    'b', 'o', 'x', 'v', 'R', 0, 'b', 'o', 'x', 'v', 'h', 0, 'b', 'o', 'x', 'v', 'l', 0,
+    'b', 'o', 'x', 'v', 'r', 0, 'b', 'p', 'r', 'i', 'm', 'e', 0, 'b', 'r', 'e', 'v', 'e', 0,
+    'b', 'r', 'v', 'b', 'a', 'r', 0, 'b', 's', 'c', 'r', 0, 'b', 's', 'e', 'm', 'i', 0,
+    'b', 's', 'i', 'm', 0, 'b', 's', 'i', 'm', 'e', 0, 'b', 's', 'o', 'l', 0,
+    'b', 's', 'o', 'l', 'b', 0, 'b', 's', 'o', 'l', 'h', 's', 'u', 'b', 0,
+    'b', 'u', 'l', 'l', 0, 'b', 'u', 'l', 'l', 'e', 't', 0, 'b', 'u', 'm', 'p', 0,
+    'b', 'u', 'm', 'p', 'E', 0, 'b', 'u', 'm', 'p', 'e', 0, 'b', 'u', 'm', 'p', 'e', 'q', 0,
+    'c', 'a', 'c', 'u', 't', 'e', 0, 'c', 'a', 'p', 0, 'c', 'a', 'p', 'a', 'n', 'd', 0,
+    'c', 'a', 'p', 'b', 'r', 'c', 'u', 'p', 0, 'c', 'a', 'p', 'c', 'a', 'p', 0,
+    'c', 'a', 'p', 'c', 'u', 'p', 0, 'c', 'a', 'p', 'd', 'o', 't', 0, 'c', 'a', 'p', 's', 0,
+    'c', 'a', 'r', 'e', 't', 0, 'c', 'a', 'r', 'o', 'n', 0, 'c', 'c', 'a', 'p', 's', 0,
+    'c', 'c', 'a', 'r', 'o', 'n', 0, 'c', 'c', 'e', 'd', 'i', 'l', 0,
+    'c', 'c', 'i', 'r', 'c', 0, 'c', 'c', 'u', 'p', 's', 0,
+    'c', 'c', 'u', 'p', 's', 's', 'm', 0, 'c', 'd', 'o', 't', 0, 'c', 'e', 'd', 'i', 'l', 0,
+    'c', 'e', 'm', 'p', 't', 'y', 'v', 0, 'c', 'e', 'n', 't', 0,
+    'c', 'e', 'n', 't', 'e', 'r', 'd', 'o', 't', 0, 'c', 'f', 'r', 0, 'c', 'h', 'c', 'y', 0,
+    'c', 'h', 'e', 'c', 'k', 0, 'c', 'h', 'e', 'c', 'k', 'm', 'a', 'r', 'k', 0,
+    'c', 'h', 'i', 0, 'c', 'i', 'r', 0, 'c', 'i', 'r', 'E', 0, 'c', 'i', 'r', 'c', 0,
+    'c', 'i', 'r', 'c', 'e', 'q', 0,
+    'c', 'i', 'r', 'c', 'l', 'e', 'a', 'r', 'r', 'o', 'w', 'l', 'e', 'f', 't', 0,
+    'c', 'i', 'r', 'c', 'l', 'e', 'a', 'r', 'r', 'o', 'w', 'r', 'i', 'g', 'h', 't', 0,
+    'c', 'i', 'r', 'c', 'l', 'e', 'd', 'R', 0, 'c', 'i', 'r', 'c', 'l', 'e', 'd', 'S', 0,
+    'c', 'i', 'r', 'c', 'l', 'e', 'd', 'a', 's', 't', 0,
+    'c', 'i', 'r', 'c', 'l', 'e', 'd', 'c', 'i', 'r', 'c', 0,
+    'c', 'i', 'r', 'c', 'l', 'e', 'd', 'd', 'a', 's', 'h', 0, 'c', 'i', 'r', 'e', 0,
+    'c', 'i', 'r', 'f', 'n', 'i', 'n', 't', 0, 'c', 'i', 'r', 'm', 'i', 'd', 0,
+    'c', 'i', 'r', 's', 'c', 'i', 'r', 0, 'c', 'l', 'u', 'b', 's', 0,
+    'c', 'l', 'u', 'b', 's', 'u', 'i', 't', 0, 'c', 'o', 'l', 'o', 'n', 0,
+    'c', 'o', 'l', 'o', 'n', 'e', 0, 'c', 'o', 'l', 'o', 'n', 'e', 'q', 0,
+    'c', 'o', 'm', 'm', 'a', 0, 'c', 'o', 'm', 'm', 'a', 't', 0, 'c', 'o', 'm', 'p', 0,
+    'c', 'o', 'm', 'p', 'f', 'n', 0, 'c', 'o', 'm', 'p', 'l', 'e', 'm', 'e', 'n', 't', 0,
+    'c', 'o', 'm', 'p', 'l', 'e', 'x', 'e', 's', 0, 'c', 'o', 'n', 'g', 0,
+    'c', 'o', 'n', 'g', 'd', 'o', 't', 0, 'c', 'o', 'n', 'i', 'n', 't', 0,
+    'c', 'o', 'p', 'f', 0, 'c', 'o', 'p', 'r', 'o', 'd', 0, 'c', 'o', 'p', 'y', 0,
+    'c', 'o', 'p', 'y', 's', 'r', 0, 'c', 'r', 'a', 'r', 'r', 0, 'c', 'r', 'o', 's', 's', 0,
+    'c', 's', 'c', 'r', 0, 'c', 's', 'u', 'b', 0, 'c', 's', 'u', 'b', 'e', 0,
+    'c', 's', 'u', 'p', 0, 'c', 's', 'u', 'p', 'e', 0, 'c', 't', 'd', 'o', 't', 0,
+    'c', 'u', 'd', 'a', 'r', 'r', 'l', 0, 'c', 'u', 'd', 'a', 'r', 'r', 'r', 0,
+    'c', 'u', 'e', 'p', 'r', 0, 'c', 'u', 'e', 's', 'c', 0, 'c', 'u', 'l', 'a', 'r', 'r', 0,
+    'c', 'u', 'l', 'a', 'r', 'r', 'p', 0, 'c', 'u', 'p', 0,
+    'c', 'u', 'p', 'b', 'r', 'c', 'a', 'p', 0, 'c', 'u', 'p', 'c', 'a', 'p', 0,
+    'c', 'u', 'p', 'c', 'u', 'p', 0, 'c', 'u', 'p', 'd', 'o', 't', 0,
+    'c', 'u', 'p', 'o', 'r', 0, 'c', 'u', 'p', 's', 0, 'c', 'u', 'r', 'a', 'r', 'r', 0,
+    'c', 'u', 'r', 'a', 'r', 'r', 'm', 0,
+    'c', 'u', 'r', 'l', 'y', 'e', 'q', 'p', 'r', 'e', 'c', 0,
+    'c', 'u', 'r', 'l', 'y', 'e', 'q', 's', 'u', 'c', 'c', 0,
+    'c', 'u', 'r', 'l', 'y', 'v', 'e', 'e', 0,
+    'c', 'u', 'r', 'l', 'y', 'w', 'e', 'd', 'g', 'e', 0, 'c', 'u', 'r', 'r', 'e', 'n', 0,
+    'c', 'u', 'r', 'v', 'e', 'a', 'r', 'r', 'o', 'w', 'l', 'e', 'f', 't', 0,
+    'c', 'u', 'r', 'v', 'e', 'a', 'r', 'r', 'o', 'w', 'r', 'i', 'g', 'h', 't', 0,
+    'c', 'u', 'v', 'e', 'e', 0, 'c', 'u', 'w', 'e', 'd', 0,
+    'c', 'w', 'c', 'o', 'n', 'i', 'n', 't', 0, 'c', 'w', 'i', 'n', 't', 0,
+    'c', 'y', 'l', 'c', 't', 'y', 0, 'd', 'A', 'r', 'r', 0, 'd', 'H', 'a', 'r', 0,
+    'd', 'a', 'g', 'g', 'e', 'r', 0, 'd', 'a', 'l', 'e', 't', 'h', 0, 'd', 'a', 'r', 'r', 0,
+    'd', 'a', 's', 'h', 0, 'd', 'a', 's', 'h', 'v', 0, 'd', 'b', 'k', 'a', 'r', 'o', 'w', 0,
+    'd', 'b', 'l', 'a', 'c', 0, 'd', 'c', 'a', 'r', 'o', 'n', 0, 'd', 'c', 'y', 0, 'd', 'd', 0,
+    'd', 'd', 'a', 'g', 'g', 'e', 'r', 0, 'd', 'd', 'a', 'r', 'r', 0,
+    'd', 'd', 'o', 't', 's', 'e', 'q', 0, 'd', 'e', 'g', 0, 'd', 'e', 'l', 't', 'a', 0,
+    'd', 'e', 'm', 'p', 't', 'y', 'v', 0, 'd', 'f', 'i', 's', 'h', 't', 0, 'd', 'f', 'r', 0,
+    'd', 'h', 'a', 'r', 'l', 0, 'd', 'h', 'a', 'r', 'r', 0, 'd', 'i', 'a', 'm', 0,
+    'd', 'i', 'a', 'm', 'o', 'n', 'd', 0,
+    'd', 'i', 'a', 'm', 'o', 'n', 'd', 's', 'u', 'i', 't', 0, 'd', 'i', 'a', 'm', 's', 0,
+    'd', 'i', 'e', 0, 'd', 'i', 'g', 'a', 'm', 'm', 'a', 0, 'd', 'i', 's', 'i', 'n', 0,
+    'd', 'i', 'v', 0, 'd', 'i', 'v', 'i', 'd', 'e', 0,
+    'd', 'i', 'v', 'i', 'd', 'e', 'o', 'n', 't', 'i', 'm', 'e', 's', 0,
+    'd', 'i', 'v', 'o', 'n', 'x', 0, 'd', 'j', 'c', 'y', 0, 'd', 'l', 'c', 'o', 'r', 'n', 0,
+    'd', 'l', 'c', 'r', 'o', 'p', 0, 'd', 'o', 'l', 'l', 'a', 'r', 0, 'd', 'o', 'p', 'f', 0,
+    'd', 'o', 't', 0, 'd', 'o', 't', 'e', 'q', 0, 'd', 'o', 't', 'e', 'q', 'd', 'o', 't', 0,
+    'd', 'o', 't', 'm', 'i', 'n', 'u', 's', 0, 'd', 'o', 't', 'p', 'l', 'u', 's', 0,
+    'd', 'o', 't', 's', 'q', 'u', 'a', 'r', 'e', 0,
+    'd', 'o', 'u', 'b', 'l', 'e', 'b', 'a', 'r', 'w', 'e', 'd', 'g', 'e', 0,
+    'd', 'o', 'w', 'n', 'a', 'r', 'r', 'o', 'w', 0,
+    'd', 'o', 'w', 'n', 'd', 'o', 'w', 'n', 'a', 'r', 'r', 'o', 'w', 's', 0,
+    'd', 'o', 'w', 'n', 'h', 'a', 'r', 'p', 'o', 'o', 'n', 'l', 'e', 'f', 't', 0,
+    'd', 'o', 'w', 'n', 'h', 'a', 'r', 'p', 'o', 'o', 'n', 'r', 'i', 'g', 'h', 't', 0,
+    'd', 'r', 'b', 'k', 'a', 'r', 'o', 'w', 0, 'd', 'r', 'c', 'o', 'r', 'n', 0,
+    'd', 'r', 'c', 'r', 'o', 'p', 0, 'd', 's', 'c', 'r', 0, 'd', 's', 'c', 'y', 0,
+    'd', 's', 'o', 'l', 0, 'd', 's', 't', 'r', 'o', 'k', 0, 'd', 't', 'd', 'o', 't', 0,
+    'd', 't', 'r', 'i', 0, 'd', 't', 'r', 'i', 'f', 0, 'd', 'u', 'a', 'r', 'r', 0,
+    'd', 'u', 'h', 'a', 'r', 0, 'd', 'w', 'a', 'n', 'g', 'l', 'e', 0, 'd', 'z', 'c', 'y', 0,
+    'd', 'z', 'i', 'g', 'r', 'a', 'r', 'r', 0, 'e', 'D', 'D', 'o', 't', 0,
+    'e', 'D', 'o', 't', 0, 'e', 'a', 'c', 'u', 't', 'e', 0, 'e', 'a', 's', 't', 'e', 'r', 0,
+    'e', 'c', 'a', 'r', 'o', 'n', 0, 'e', 'c', 'i', 'r', 0, 'e', 'c', 'i', 'r', 'c', 0,
+    'e', 'c', 'o', 'l', 'o', 'n', 0, 'e', 'c', 'y', 0, 'e', 'd', 'o', 't', 0, 'e', 'e', 0,
+    'e', 'f', 'D', 'o', 't', 0, 'e', 'f', 'r', 0, 'e', 'g', 0, 'e', 'g', 'r', 'a', 'v', 'e', 0,
+    'e', 'g', 's', 0, 'e', 'g', 's', 'd', 'o', 't', 0, 'e', 'l', 0,
+    'e', 'l', 'i', 'n', 't', 'e', 'r', 's', 0, 'e', 'l', 'l', 0, 'e', 'l', 's', 0,
+    'e', 'l', 's', 'd', 'o', 't', 0, 'e', 'm', 'a', 'c', 'r', 0, 'e', 'm', 'p', 't', 'y', 0,
+    'e', 'm', 'p', 't', 'y', 's', 'e', 't', 0, 'e', 'm', 'p', 't', 'y', 'v', 0,
+    'e', 'm', 's', 'p', 0, 'e', 'm', 's', 'p', '1', '3', 0, 'e', 'm', 's', 'p', '1', '4', 0,
+    'e', 'n', 'g', 0, 'e', 'n', 's', 'p', 0, 'e', 'o', 'g', 'o', 'n', 0, 'e', 'o', 'p', 'f', 0,
+    'e', 'p', 'a', 'r', 0, 'e', 'p', 'a', 'r', 's', 'l', 0, 'e', 'p', 'l', 'u', 's', 0,
+    'e', 'p', 's', 'i', 0, 'e', 'p', 's', 'i', 'l', 'o', 'n', 0, 'e', 'p', 's', 'i', 'v', 0,
+    'e', 'q', 'c', 'i', 'r', 'c', 0, 'e', 'q', 'c', 'o', 'l', 'o', 'n', 0,
+    'e', 'q', 's', 'i', 'm', 0, 'e', 'q', 's', 'l', 'a', 'n', 't', 'g', 't', 'r', 0,
+    'e', 'q', 's', 'l', 'a', 'n', 't', 'l', 'e', 's', 's', 0, 'e', 'q', 'u', 'a', 'l', 's', 0,
+    'e', 'q', 'u', 'e', 's', 't', 0, 'e', 'q', 'u', 'i', 'v', 0,
+    'e', 'q', 'u', 'i', 'v', 'D', 'D', 0, 'e', 'q', 'v', 'p', 'a', 'r', 's', 'l', 0,
+    'e', 'r', 'D', 'o', 't', 0, 'e', 'r', 'a', 'r', 'r', 0, 'e', 's', 'c', 'r', 0,
+    'e', 's', 'd', 'o', 't', 0, 'e', 's', 'i', 'm', 0, 'e', 't', 'a', 0, 'e', 't', 'h', 0,
+    'e', 'u', 'm', 'l', 0, 'e', 'u', 'r', 'o', 0, 'e', 'x', 'c', 'l', 0,
+    'e', 'x', 'i', 's', 't', 0, 'e', 'x', 'p', 'e', 'c', 't', 'a', 't', 'i', 'o', 'n', 0,
+    'e', 'x', 'p', 'o', 'n', 'e', 'n', 't', 'i', 'a', 'l', 'e', 0,
+    'f', 'a', 'l', 'l', 'i', 'n', 'g', 'd', 'o', 't', 's', 'e', 'q', 0, 'f', 'c', 'y', 0,
+    'f', 'e', 'm', 'a', 'l', 'e', 0, 'f', 'f', 'i', 'l', 'i', 'g', 0,
+    'f', 'f', 'l', 'i', 'g', 0, 'f', 'f', 'l', 'l', 'i', 'g', 0, 'f', 'f', 'r', 0,
+    'f', 'i', 'l', 'i', 'g', 0, 'f', 'j', 'l', 'i', 'g', 0, 'f', 'l', 'a', 't', 0,
+    'f', 'l', 'l', 'i', 'g', 0, 'f', 'l', 't', 'n', 's', 0, 'f', 'n', 'o', 'f', 0,
+    'f', 'o', 'p', 'f', 0, 'f', 'o', 'r', 'a', 'l', 'l', 0, 'f', 'o', 'r', 'k', 0,
+    'f', 'o', 'r', 'k', 'v', 0, 'f', 'p', 'a', 'r', 't', 'i', 'n', 't', 0,
+    'f', 'r', 'a', 'c', '1', '2', 0, 'f', 'r', 'a', 'c', '1', '3', 0,
+    'f', 'r', 'a', 'c', '1', '4', 0, 'f', 'r', 'a', 'c', '1', '5', 0,
+    'f', 'r', 'a', 'c', '1', '6', 0, 'f', 'r', 'a', 'c', '1', '8', 0,
+    'f', 'r', 'a', 'c', '2', '3', 0, 'f', 'r', 'a', 'c', '2', '5', 0,
+    'f', 'r', 'a', 'c', '3', '4', 0, 'f', 'r', 'a', 'c', '3', '5', 0,
+    'f', 'r', 'a', 'c', '3', '8', 0, 'f', 'r', 'a', 'c', '4', '5', 0,
+    'f', 'r', 'a', 'c', '5', '6', 0, 'f', 'r', 'a', 'c', '5', '8', 0,
+    'f', 'r', 'a', 'c', '7', '8', 0, 'f', 'r', 'a', 's', 'l', 0, 'f', 'r', 'o', 'w', 'n', 0,
+    'f', 's', 'c', 'r', 0, 'g', 'E', 0, 'g', 'E', 'l', 0, 'g', 'a', 'c', 'u', 't', 'e', 0,
+    'g', 'a', 'm', 'm', 'a', 0, 'g', 'a', 'm', 'm', 'a', 'd', 0, 'g', 'a', 'p', 0,
+    'g', 'b', 'r', 'e', 'v', 'e', 0, 'g', 'c', 'i', 'r', 'c', 0, 'g', 'c', 'y', 0,
+    'g', 'd', 'o', 't', 0, 'g', 'e', 0, 'g', 'e', 'l', 0, 'g', 'e', 'q', 0,
+    'g', 'e', 'q', 'q', 0, 'g', 'e', 'q', 's', 'l', 'a', 'n', 't', 0, 'g', 'e', 's', 0,
+    'g', 'e', 's', 'c', 'c', 0, 'g', 'e', 's', 'd', 'o', 't', 0,
+    'g', 'e', 's', 'd', 'o', 't', 'o', 0, 'g', 'e', 's', 'd', 'o', 't', 'o', 'l', 0,
+    'g', 'e', 's', 'l', 0, 'g', 'e', 's', 'l', 'e', 's', 0, 'g', 'f', 'r', 0, 'g', 'g', 0,
+    'g', 'g', 'g', 0, 'g', 'i', 'm', 'e', 'l', 0, 'g', 'j', 'c', 'y', 0, 'g', 'l', 0,
+    'g', 'l', 'E', 0, 'g', 'l', 'a', 0, 'g', 'l', 'j', 0, 'g', 'n', 'E', 0,
+    'g', 'n', 'a', 'p', 0, 'g', 'n', 'a', 'p', 'p', 'r', 'o', 'x', 0, 'g', 'n', 'e', 0,
+    'g', 'n', 'e', 'q', 0, 'g', 'n', 'e', 'q', 'q', 0, 'g', 'n', 's', 'i', 'm', 0,
+    'g', 'o', 'p', 'f', 0, 'g', 'r', 'a', 'v', 'e', 0, 'g', 's', 'c', 'r', 0,
+    'g', 's', 'i', 'm', 0, 'g', 's', 'i', 'm', 'e', 0, 'g', 's', 'i', 'm', 'l', 0, 'g', 't', 0,
+    'g', 't', 'c', 'c', 0, 'g', 't', 'c', 'i', 'r', 0, 'g', 't', 'd', 'o', 't', 0,
+    'g', 't', 'l', 'P', 'a', 'r', 0, 'g', 't', 'q', 'u', 'e', 's', 't', 0,
+    'g', 't', 'r', 'a', 'p', 'p', 'r', 'o', 'x', 0, 'g', 't', 'r', 'a', 'r', 'r', 0,
+    'g', 't', 'r', 'd', 'o', 't', 0, 'g', 't', 'r', 'e', 'q', 'l', 'e', 's', 's', 0,
+    'g', 't', 'r', 'e', 'q', 'q', 'l', 'e', 's', 's', 0, 'g', 't', 'r', 'l', 'e', 's', 's', 0,
+    'g', 't', 'r', 's', 'i', 'm', 0, 'g', 'v', 'e', 'r', 't', 'n', 'e', 'q', 'q', 0,
+    'g', 'v', 'n', 'E', 0, 'h', 'A', 'r', 'r', 0, 'h', 'a', 'i', 'r', 's', 'p', 0,
+    'h', 'a', 'l', 'f', 0, 'h', 'a', 'm', 'i', 'l', 't', 0, 'h', 'a', 'r', 'd', 'c', 'y', 0,
+    'h', 'a', 'r', 'r', 0, 'h', 'a', 'r', 'r', 'c', 'i', 'r', 0, 'h', 'a', 'r', 'r', 'w', 0,
+    'h', 'b', 'a', 'r', 0, 'h', 'c', 'i', 'r', 'c', 0, 'h', 'e', 'a', 'r', 't', 's', 0,
+    'h', 'e', 'a', 'r', 't', 's', 'u', 'i', 't', 0, 'h', 'e', 'l', 'l', 'i', 'p', 0,
+    'h', 'e', 'r', 'c', 'o', 'n', 0, 'h', 'f', 'r', 0,
+    'h', 'k', 's', 'e', 'a', 'r', 'o', 'w', 0, 'h', 'k', 's', 'w', 'a', 'r', 'o', 'w', 0,
+    'h', 'o', 'a', 'r', 'r', 0, 'h', 'o', 'm', 't', 'h', 't', 0,
+    'h', 'o', 'o', 'k', 'l', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', 0,
+    'h', 'o', 'o', 'k', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 0,
+    'h', 'o', 'p', 'f', 0, 'h', 'o', 'r', 'b', 'a', 'r', 0, 'h', 's', 'c', 'r', 0,
+    'h', 's', 'l', 'a', 's', 'h', 0, 'h', 's', 't', 'r', 'o', 'k', 0,
+    'h', 'y', 'b', 'u', 'l', 'l', 0, 'h', 'y', 'p', 'h', 'e', 'n', 0,
+    'i', 'a', 'c', 'u', 't', 'e', 0, 'i', 'c', 0, 'i', 'c', 'i', 'r', 'c', 0, 'i', 'c', 'y', 0,
+    'i', 'e', 'c', 'y', 0, 'i', 'e', 'x', 'c', 'l', 0, 'i', 'f', 'f', 0, 'i', 'f', 'r', 0,
+    'i', 'g', 'r', 'a', 'v', 'e', 0, 'i', 'i', 0, 'i', 'i', 'i', 'i', 'n', 't', 0,
+    'i', 'i', 'i', 'n', 't', 0, 'i', 'i', 'n', 'f', 'i', 'n', 0, 'i', 'i', 'o', 't', 'a', 0,
+    'i', 'j', 'l', 'i', 'g', 0, 'i', 'm', 'a', 'c', 'r', 0, 'i', 'm', 'a', 'g', 'e', 0,
+    'i', 'm', 'a', 'g', 'l', 'i', 'n', 'e', 0, 'i', 'm', 'a', 'g', 'p', 'a', 'r', 't', 0,
+    'i', 'm', 'a', 't', 'h', 0, 'i', 'm', 'o', 'f', 0, 'i', 'm', 'p', 'e', 'd', 0, 'i', 'n', 0,
+    'i', 'n', 'c', 'a', 'r', 'e', 0, 'i', 'n', 'f', 'i', 'n', 0,
+    'i', 'n', 'f', 'i', 'n', 't', 'i', 'e', 0, 'i', 'n', 'o', 'd', 'o', 't', 0,
+    'i', 'n', 't', 0, 'i', 'n', 't', 'c', 'a', 'l', 0,
+    'i', 'n', 't', 'e', 'g', 'e', 'r', 's', 0, 'i', 'n', 't', 'e', 'r', 'c', 'a', 'l', 0,
+    'i', 'n', 't', 'l', 'a', 'r', 'h', 'k', 0, 'i', 'n', 't', 'p', 'r', 'o', 'd', 0,
+    'i', 'o', 'c', 'y', 0, 'i', 'o', 'g', 'o', 'n', 0, 'i', 'o', 'p', 'f', 0,
+    'i', 'o', 't', 'a', 0, 'i', 'p', 'r', 'o', 'd', 0, 'i', 'q', 'u', 'e', 's', 't', 0,
+    'i', 's', 'c', 'r', 0, 'i', 's', 'i', 'n', 0, 'i', 's', 'i', 'n', 'E', 0,
+    'i', 's', 'i', 'n', 'd', 'o', 't', 0, 'i', 's', 'i', 'n', 's', 0,
+    'i', 's', 'i', 'n', 's', 'v', 0, 'i', 's', 'i', 'n', 'v', 0, 'i', 't', 0,
+    'i', 't', 'i', 'l', 'd', 'e', 0, 'i', 'u', 'k', 'c', 'y', 0, 'i', 'u', 'm', 'l', 0,
+    'j', 'c', 'i', 'r', 'c', 0, 'j', 'c', 'y', 0, 'j', 'f', 'r', 0, 'j', 'm', 'a', 't', 'h', 0,
+    'j', 'o', 'p', 'f', 0, 'j', 's', 'c', 'r', 0, 'j', 's', 'e', 'r', 'c', 'y', 0,
+    'j', 'u', 'k', 'c', 'y', 0, 'k', 'a', 'p', 'p', 'a', 0, 'k', 'a', 'p', 'p', 'a', 'v', 0,
+    'k', 'c', 'e', 'd', 'i', 'l', 0, 'k', 'c', 'y', 0, 'k', 'f', 'r', 0,
+    'k', 'g', 'r', 'e', 'e', 'n', 0, 'k', 'h', 'c', 'y', 0, 'k', 'j', 'c', 'y', 0,
+    'k', 'o', 'p', 'f', 0, 'k', 's', 'c', 'r', 0, 'l', 'A', 'a', 'r', 'r', 0,
+    'l', 'A', 'r', 'r', 0, 'l', 'A', 't', 'a', 'i', 'l', 0, 'l', 'B', 'a', 'r', 'r', 0,
+    'l', 'E', 0, 'l', 'E', 'g', 0, 'l', 'H', 'a', 'r', 0, 'l', 'a', 'c', 'u', 't', 'e', 0,
+    'l', 'a', 'e', 'm', 'p', 't', 'y', 'v', 0, 'l', 'a', 'g', 'r', 'a', 'n', 0,
+    'l', 'a', 'm', 'b', 'd', 'a', 0, 'l', 'a', 'n', 'g', 0, 'l', 'a', 'n', 'g', 'd', 0,
+    'l', 'a', 'n', 'g', 'l', 'e', 0, 'l', 'a', 'p', 0, 'l', 'a', 'q', 'u', 'o', 0,
+    'l', 'a', 'r', 'r', 0, 'l', 'a', 'r', 'r', 'b', 0, 'l', 'a', 'r', 'r', 'b', 'f', 's', 0,
+    'l', 'a', 'r', 'r', 'f', 's', 0, 'l', 'a', 'r', 'r', 'h', 'k', 0,
+    'l', 'a', 'r', 'r', 'l', 'p', 0, 'l', 'a', 'r', 'r', 'p', 'l', 0,
+    'l', 'a', 'r', 'r', 's', 'i', 'm', 0, 'l', 'a', 'r', 'r', 't', 'l', 0, 'l', 'a', 't', 0,
+    'l', 'a', 't', 'a', 'i', 'l', 0, 'l', 'a', 't', 'e', 0, 'l', 'a', 't', 'e', 's', 0,
+    'l', 'b', 'a', 'r', 'r', 0, 'l', 'b', 'b', 'r', 'k', 0, 'l', 'b', 'r', 'a', 'c', 'e', 0,
+    'l', 'b', 'r', 'a', 'c', 'k', 0, 'l', 'b', 'r', 'k', 'e', 0,
+    'l', 'b', 'r', 'k', 's', 'l', 'd', 0, 'l', 'b', 'r', 'k', 's', 'l', 'u', 0,
+    'l', 'c', 'a', 'r', 'o', 'n', 0, 'l', 'c', 'e', 'd', 'i', 'l', 0,
+    'l', 'c', 'e', 'i', 'l', 0, 'l', 'c', 'u', 'b', 0, 'l', 'c', 'y', 0, 'l', 'd', 'c', 'a', 0,
+    'l', 'd', 'q', 'u', 'o', 0, 'l', 'd', 'q', 'u', 'o', 'r', 0,
+    'l', 'd', 'r', 'd', 'h', 'a', 'r', 0, 'l', 'd', 'r', 'u', 's', 'h', 'a', 'r', 0,
+    'l', 'd', 's', 'h', 0, 'l', 'e', 0, 'l', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', 0,
+    'l', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', 't', 'a', 'i', 'l', 0,
+    'l', 'e', 'f', 't', 'h', 'a', 'r', 'p', 'o', 'o', 'n', 'd', 'o', 'w', 'n', 0,
+    'l', 'e', 'f', 't', 'h', 'a', 'r', 'p', 'o', 'o', 'n', 'u', 'p', 0,
+    'l', 'e', 'f', 't', 'l', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', 's', 0,
+    'l', 'e', 'f', 't', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 0,
+    'l', 'e', 'f', 't', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 's', 0,
+    'l', 'e', 'f', 't', 'r', 'i', 'g', 'h', 't', 'h', 'a', 'r', 'p', 'o', 'o', 'n', 's', 0,
+    'l', 'e', 'f', 't', 'r', 'i', 'g', 'h', 't', 's', 'q', 'u', 'i', 'g', 'a', 'r', 'r', 'o', 'w', 0,
+    'l', 'e', 'f', 't', 't', 'h', 'r', 'e', 'e', 't', 'i', 'm', 'e', 's', 0, 'l', 'e', 'g', 0,
+    'l', 'e', 'q', 0, 'l', 'e', 'q', 'q', 0, 'l', 'e', 'q', 's', 'l', 'a', 'n', 't', 0,
+    'l', 'e', 's', 0, 'l', 'e', 's', 'c', 'c', 0, 'l', 'e', 's', 'd', 'o', 't', 0,
+    'l', 'e', 's', 'd', 'o', 't', 'o', 0, 'l', 'e', 's', 'd', 'o', 't', 'o', 'r', 0,
+    'l', 'e', 's', 'g', 0, 'l', 'e', 's', 'g', 'e', 's', 0,
+    'l', 'e', 's', 's', 'a', 'p', 'p', 'r', 'o', 'x', 0, 'l', 'e', 's', 's', 'd', 'o', 't', 0,
+    'l', 'e', 's', 's', 'e', 'q', 'g', 't', 'r', 0,
+    'l', 'e', 's', 's', 'e', 'q', 'q', 'g', 't', 'r', 0, 'l', 'e', 's', 's', 'g', 't', 'r', 0,
+    'l', 'e', 's', 's', 's', 'i', 'm', 0, 'l', 'f', 'i', 's', 'h', 't', 0,
+    'l', 'f', 'l', 'o', 'o', 'r', 0, 'l', 'f', 'r', 0, 'l', 'g', 0, 'l', 'g', 'E', 0,
+    'l', 'h', 'a', 'r', 'd', 0, 'l', 'h', 'a', 'r', 'u', 0, 'l', 'h', 'a', 'r', 'u', 'l', 0,
+    'l', 'h', 'b', 'l', 'k', 0, 'l', 'j', 'c', 'y', 0, 'l', 'l', 0, 'l', 'l', 'a', 'r', 'r', 0,
+    'l', 'l', 'c', 'o', 'r', 'n', 'e', 'r', 0, 'l', 'l', 'h', 'a', 'r', 'd', 0,
+    'l', 'l', 't', 'r', 'i', 0, 'l', 'm', 'i', 'd', 'o', 't', 0,
+    'l', 'm', 'o', 'u', 's', 't', 0, 'l', 'm', 'o', 'u', 's', 't', 'a', 'c', 'h', 'e', 0,
+    'l', 'n', 'E', 0, 'l', 'n', 'a', 'p', 0, 'l', 'n', 'a', 'p', 'p', 'r', 'o', 'x', 0,
+    'l', 'n', 'e', 0, 'l', 'n', 'e', 'q', 0, 'l', 'n', 'e', 'q', 'q', 0,
+    'l', 'n', 's', 'i', 'm', 0, 'l', 'o', 'a', 'n', 'g', 0, 'l', 'o', 'a', 'r', 'r', 0,
+    'l', 'o', 'b', 'r', 'k', 0,
+    'l', 'o', 'n', 'g', 'l', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', 0,
+    'l', 'o', 'n', 'g', 'l', 'e', 'f', 't', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 0,
+    'l', 'o', 'n', 'g', 'm', 'a', 'p', 's', 't', 'o', 0,
+    'l', 'o', 'n', 'g', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 0,
+    'l', 'o', 'o', 'p', 'a', 'r', 'r', 'o', 'w', 'l', 'e', 'f', 't', 0,
+    'l', 'o', 'o', 'p', 'a', 'r', 'r', 'o', 'w', 'r', 'i', 'g', 'h', 't', 0,
+    'l', 'o', 'p', 'a', 'r', 0, 'l', 'o', 'p', 'f', 0, 'l', 'o', 'p', 'l', 'u', 's', 0,
+    'l', 'o', 't', 'i', 'm', 'e', 's', 0, 'l', 'o', 'w', 'a', 's', 't', 0,
+    'l', 'o', 'w', 'b', 'a', 'r', 0, 'l', 'o', 'z', 0, 'l', 'o', 'z', 'e', 'n', 'g', 'e', 0,
+    'l', 'o', 'z', 'f', 0, 'l', 'p', 'a', 'r', 0, 'l', 'p', 'a', 'r', 'l', 't', 0,
+    'l', 'r', 'a', 'r', 'r', 0, 'l', 'r', 'c', 'o', 'r', 'n', 'e', 'r', 0,
+    'l', 'r', 'h', 'a', 'r', 0, 'l', 'r', 'h', 'a', 'r', 'd', 0, 'l', 'r', 'm', 0,
+    'l', 'r', 't', 'r', 'i', 0, 'l', 's', 'a', 'q', 'u', 'o', 0, 'l', 's', 'c', 'r', 0,
+    'l', 's', 'h', 0, 'l', 's', 'i', 'm', 0, 'l', 's', 'i', 'm', 'e', 0,
+    'l', 's', 'i', 'm', 'g', 0, 'l', 's', 'q', 'b', 0, 'l', 's', 'q', 'u', 'o', 0,
+    'l', 's', 'q', 'u', 'o', 'r', 0, 'l', 's', 't', 'r', 'o', 'k', 0, 'l', 't', 0,
+    'l', 't', 'c', 'c', 0, 'l', 't', 'c', 'i', 'r', 0, 'l', 't', 'd', 'o', 't', 0,
+    'l', 't', 'h', 'r', 'e', 'e', 0, 'l', 't', 'i', 'm', 'e', 's', 0,
+    'l', 't', 'l', 'a', 'r', 'r', 0, 'l', 't', 'q', 'u', 'e', 's', 't', 0,
+    'l', 't', 'r', 'P', 'a', 'r', 0, 'l', 't', 'r', 'i', 0, 'l', 't', 'r', 'i', 'e', 0,
+    'l', 't', 'r', 'i', 'f', 0, 'l', 'u', 'r', 'd', 's', 'h', 'a', 'r', 0,
+    'l', 'u', 'r', 'u', 'h', 'a', 'r', 0, 'l', 'v', 'e', 'r', 't', 'n', 'e', 'q', 'q', 0,
+    'l', 'v', 'n', 'E', 0, 'm', 'D', 'D', 'o', 't', 0, 'm', 'a', 'c', 'r', 0,
+    'm', 'a', 'l', 'e', 0, 'm', 'a', 'l', 't', 0, 'm', 'a', 'l', 't', 'e', 's', 'e', 0,
+    'm', 'a', 'p', 0, 'm', 'a', 'p', 's', 't', 'o', 0,
+    'm', 'a', 'p', 's', 't', 'o', 'd', 'o', 'w', 'n', 0,
+    'm', 'a', 'p', 's', 't', 'o', 'l', 'e', 'f', 't', 0,
+    'm', 'a', 'p', 's', 't', 'o', 'u', 'p', 0, 'm', 'a', 'r', 'k', 'e', 'r', 0,
+    'm', 'c', 'o', 'm', 'm', 'a', 0, 'm', 'c', 'y', 0, 'm', 'd', 'a', 's', 'h', 0,
+    'm', 'e', 'a', 's', 'u', 'r', 'e', 'd', 'a', 'n', 'g', 'l', 'e', 0, 'm', 'f', 'r', 0,
+    'm', 'h', 'o', 0, 'm', 'i', 'c', 'r', 'o', 0, 'm', 'i', 'd', 0,
+    'm', 'i', 'd', 'a', 's', 't', 0, 'm', 'i', 'd', 'c', 'i', 'r', 0,
+    'm', 'i', 'd', 'd', 'o', 't', 0, 'm', 'i', 'n', 'u', 's', 0,
+    'm', 'i', 'n', 'u', 's', 'b', 0, 'm', 'i', 'n', 'u', 's', 'd', 0,
+    'm', 'i', 'n', 'u', 's', 'd', 'u', 0, 'm', 'l', 'c', 'p', 0, 'm', 'l', 'd', 'r', 0,
+    'm', 'n', 'p', 'l', 'u', 's', 0, 'm', 'o', 'd', 'e', 'l', 's', 0, 'm', 'o', 'p', 'f', 0,
+    'm', 'p', 0, 'm', 's', 'c', 'r', 0, 'm', 's', 't', 'p', 'o', 's', 0, 'm', 'u', 0,
+    'm', 'u', 'l', 't', 'i', 'm', 'a', 'p', 0, 'm', 'u', 'm', 'a', 'p', 0, 'n', 'G', 'g', 0,
+    'n', 'G', 't', 0, 'n', 'G', 't', 'v', 0,
+    'n', 'L', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', 0,
+    'n', 'L', 'e', 'f', 't', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 0,
+    'n', 'L', 'l', 0, 'n', 'L', 't', 0, 'n', 'L', 't', 'v', 0,
+    'n', 'R', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 0, 'n', 'V', 'D', 'a', 's', 'h', 0,
+    'n', 'V', 'd', 'a', 's', 'h', 0, 'n', 'a', 'b', 'l', 'a', 0,
+    'n', 'a', 'c', 'u', 't', 'e', 0, 'n', 'a', 'n', 'g', 0, 'n', 'a', 'p', 0,
+    'n', 'a', 'p', 'E', 0, 'n', 'a', 'p', 'i', 'd', 0, 'n', 'a', 'p', 'o', 's', 0,
+    'n', 'a', 'p', 'p', 'r', 'o', 'x', 0, 'n', 'a', 't', 'u', 'r', 0,
+    'n', 'a', 't', 'u', 'r', 'a', 'l', 0, 'n', 'a', 't', 'u', 'r', 'a', 'l', 's', 0,
+    'n', 'b', 's', 'p', 0, 'n', 'b', 'u', 'm', 'p', 0, 'n', 'b', 'u', 'm', 'p', 'e', 0,
+    'n', 'c', 'a', 'p', 0, 'n', 'c', 'a', 'r', 'o', 'n', 0, 'n', 'c', 'e', 'd', 'i', 'l', 0,
+    'n', 'c', 'o', 'n', 'g', 0, 'n', 'c', 'o', 'n', 'g', 'd', 'o', 't', 0,
+    'n', 'c', 'u', 'p', 0, 'n', 'c', 'y', 0, 'n', 'd', 'a', 's', 'h', 0, 'n', 'e', 0,
+    'n', 'e', 'A', 'r', 'r', 0, 'n', 'e', 'a', 'r', 'h', 'k', 0, 'n', 'e', 'a', 'r', 'r', 0,
+    'n', 'e', 'a', 'r', 'r', 'o', 'w', 0, 'n', 'e', 'd', 'o', 't', 0,
+    'n', 'e', 'q', 'u', 'i', 'v', 0, 'n', 'e', 's', 'e', 'a', 'r', 0,
+    'n', 'e', 's', 'i', 'm', 0, 'n', 'e', 'x', 'i', 's', 't', 0,
+    'n', 'e', 'x', 'i', 's', 't', 's', 0, 'n', 'f', 'r', 0, 'n', 'g', 'E', 0, 'n', 'g', 'e', 0,
+    'n', 'g', 'e', 'q', 0, 'n', 'g', 'e', 'q', 'q', 0,
+    'n', 'g', 'e', 'q', 's', 'l', 'a', 'n', 't', 0, 'n', 'g', 'e', 's', 0,
+    'n', 'g', 's', 'i', 'm', 0, 'n', 'g', 't', 0, 'n', 'g', 't', 'r', 0,
+    'n', 'h', 'A', 'r', 'r', 0, 'n', 'h', 'a', 'r', 'r', 0, 'n', 'h', 'p', 'a', 'r', 0,
+    'n', 'i', 0, 'n', 'i', 's', 0, 'n', 'i', 's', 'd', 0, 'n', 'i', 'v', 0,
+    'n', 'j', 'c', 'y', 0, 'n', 'l', 'A', 'r', 'r', 0, 'n', 'l', 'E', 0,
+    'n', 'l', 'a', 'r', 'r', 0, 'n', 'l', 'd', 'r', 0, 'n', 'l', 'e', 0,
+    'n', 'l', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', 0,
+    'n', 'l', 'e', 'f', 't', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 0,
+    'n', 'l', 'e', 'q', 0, 'n', 'l', 'e', 'q', 'q', 0,
+    'n', 'l', 'e', 'q', 's', 'l', 'a', 'n', 't', 0, 'n', 'l', 'e', 's', 0,
+    'n', 'l', 'e', 's', 's', 0, 'n', 'l', 's', 'i', 'm', 0, 'n', 'l', 't', 0,
+    'n', 'l', 't', 'r', 'i', 0, 'n', 'l', 't', 'r', 'i', 'e', 0, 'n', 'm', 'i', 'd', 0,
+    'n', 'o', 'p', 'f', 0, 'n', 'o', 't', 0, 'n', 'o', 't', 'i', 'n', 0,
+    'n', 'o', 't', 'i', 'n', 'E', 0, 'n', 'o', 't', 'i', 'n', 'd', 'o', 't', 0,
+    'n', 'o', 't', 'i', 'n', 'v', 'a', 0, 'n', 'o', 't', 'i', 'n', 'v', 'b', 0,
+    'n', 'o', 't', 'i', 'n', 'v', 'c', 0, 'n', 'o', 't', 'n', 'i', 0,
+    'n', 'o', 't', 'n', 'i', 'v', 'a', 0, 'n', 'o', 't', 'n', 'i', 'v', 'b', 0,
+    'n', 'o', 't', 'n', 'i', 'v', 'c', 0, 'n', 'p', 'a', 'r', 0,
+    'n', 'p', 'a', 'r', 'a', 'l', 'l', 'e', 'l', 0, 'n', 'p', 'a', 'r', 's', 'l', 0,
+    'n', 'p', 'a', 'r', 't', 0, 'n', 'p', 'o', 'l', 'i', 'n', 't', 0, 'n', 'p', 'r', 0,
+    'n', 'p', 'r', 'c', 'u', 'e', 0, 'n', 'p', 'r', 'e', 0, 'n', 'p', 'r', 'e', 'c', 0,
+    'n', 'p', 'r', 'e', 'c', 'e', 'q', 0, 'n', 'r', 'A', 'r', 'r', 0,
+    'n', 'r', 'a', 'r', 'r', 0, 'n', 'r', 'a', 'r', 'r', 'c', 0,
+    'n', 'r', 'a', 'r', 'r', 'w', 0, 'n', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 0,
+    'n', 'r', 't', 'r', 'i', 0, 'n', 'r', 't', 'r', 'i', 'e', 0, 'n', 's', 'c', 0,
+    'n', 's', 'c', 'c', 'u', 'e', 0, 'n', 's', 'c', 'e', 0, 'n', 's', 'c', 'r', 0,
+    'n', 's', 'h', 'o', 'r', 't', 'm', 'i', 'd', 0,
+    'n', 's', 'h', 'o', 'r', 't', 'p', 'a', 'r', 'a', 'l', 'l', 'e', 'l', 0,
+    'n', 's', 'i', 'm', 0, 'n', 's', 'i', 'm', 'e', 0, 'n', 's', 'i', 'm', 'e', 'q', 0,
+    'n', 's', 'm', 'i', 'd', 0, 'n', 's', 'p', 'a', 'r', 0,
+    'n', 's', 'q', 's', 'u', 'b', 'e', 0, 'n', 's', 'q', 's', 'u', 'p', 'e', 0,
+    'n', 's', 'u', 'b', 0, 'n', 's', 'u', 'b', 'E', 0, 'n', 's', 'u', 'b', 'e', 0,
+    'n', 's', 'u', 'b', 's', 'e', 't', 0, 'n', 's', 'u', 'b', 's', 'e', 't', 'e', 'q', 0,
+    'n', 's', 'u', 'b', 's', 'e', 't', 'e', 'q', 'q', 0, 'n', 's', 'u', 'c', 'c', 0,
+    'n', 's', 'u', 'c', 'c', 'e', 'q', 0, 'n', 's', 'u', 'p', 0, 'n', 's', 'u', 'p', 'E', 0,
+    'n', 's', 'u', 'p', 'e', 0, 'n', 's', 'u', 'p', 's', 'e', 't', 0,
+    'n', 's', 'u', 'p', 's', 'e', 't', 'e', 'q', 0,
+    'n', 's', 'u', 'p', 's', 'e', 't', 'e', 'q', 'q', 0, 'n', 't', 'g', 'l', 0,
+    'n', 't', 'i', 'l', 'd', 'e', 0, 'n', 't', 'l', 'g', 0,
+    'n', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'l', 'e', 'f', 't', 0,
+    'n', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'l', 'e', 'f', 't', 'e', 'q', 0,
+    'n', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'r', 'i', 'g', 'h', 't', 0,
+    'n', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'r', 'i', 'g', 'h', 't', 'e', 'q', 0,
+    'n', 'u', 0, 'n', 'u', 'm', 0, 'n', 'u', 'm', 'e', 'r', 'o', 0, 'n', 'u', 'm', 's', 'p', 0,
+    'n', 'v', 'D', 'a', 's', 'h', 0, 'n', 'v', 'H', 'a', 'r', 'r', 0, 'n', 'v', 'a', 'p', 0,
+    'n', 'v', 'd', 'a', 's', 'h', 0, 'n', 'v', 'g', 'e', 0, 'n', 'v', 'g', 't', 0,
+    'n', 'v', 'i', 'n', 'f', 'i', 'n', 0, 'n', 'v', 'l', 'A', 'r', 'r', 0,
+    'n', 'v', 'l', 'e', 0, 'n', 'v', 'l', 't', 0, 'n', 'v', 'l', 't', 'r', 'i', 'e', 0,
+    'n', 'v', 'r', 'A', 'r', 'r', 0, 'n', 'v', 'r', 't', 'r', 'i', 'e', 0,
+    'n', 'v', 's', 'i', 'm', 0, 'n', 'w', 'A', 'r', 'r', 0, 'n', 'w', 'a', 'r', 'h', 'k', 0,
+    'n', 'w', 'a', 'r', 'r', 0, 'n', 'w', 'a', 'r', 'r', 'o', 'w', 0,
+    'n', 'w', 'n', 'e', 'a', 'r', 0, 'o', 'S', 0, 'o', 'a', 'c', 'u', 't', 'e', 0,
+    'o', 'a', 's', 't', 0, 'o', 'c', 'i', 'r', 0, 'o', 'c', 'i', 'r', 'c', 0, 'o', 'c', 'y', 0,
+    'o', 'd', 'a', 's', 'h', 0, 'o', 'd', 'b', 'l', 'a', 'c', 0, 'o', 'd', 'i', 'v', 0,
+    'o', 'd', 'o', 't', 0, 'o', 'd', 's', 'o', 'l', 'd', 0, 'o', 'e', 'l', 'i', 'g', 0,
+    'o', 'f', 'c', 'i', 'r', 0, 'o', 'f', 'r', 0, 'o', 'g', 'o', 'n', 0,
+    'o', 'g', 'r', 'a', 'v', 'e', 0, 'o', 'g', 't', 0, 'o', 'h', 'b', 'a', 'r', 0,
+    'o', 'h', 'm', 0, 'o', 'i', 'n', 't', 0, 'o', 'l', 'a', 'r', 'r', 0,
+    'o', 'l', 'c', 'i', 'r', 0, 'o', 'l', 'c', 'r', 'o', 's', 's', 0,
+    'o', 'l', 'i', 'n', 'e', 0, 'o', 'l', 't', 0, 'o', 'm', 'a', 'c', 'r', 0,
+    'o', 'm', 'e', 'g', 'a', 0, 'o', 'm', 'i', 'c', 'r', 'o', 'n', 0, 'o', 'm', 'i', 'd', 0,
+    'o', 'm', 'i', 'n', 'u', 's', 0, 'o', 'o', 'p', 'f', 0, 'o', 'p', 'a', 'r', 0,
+    'o', 'p', 'e', 'r', 'p', 0, 'o', 'p', 'l', 'u', 's', 0, 'o', 'r', 0,
+    'o', 'r', 'a', 'r', 'r', 0, 'o', 'r', 'd', 0, 'o', 'r', 'd', 'e', 'r', 0,
+    'o', 'r', 'd', 'e', 'r', 'o', 'f', 0, 'o', 'r', 'd', 'f', 0, 'o', 'r', 'd', 'm', 0,
+    'o', 'r', 'i', 'g', 'o', 'f', 0, 'o', 'r', 'o', 'r', 0,
+    'o', 'r', 's', 'l', 'o', 'p', 'e', 0, 'o', 'r', 'v', 0, 'o', 's', 'c', 'r', 0,
+    'o', 's', 'l', 'a', 's', 'h', 0, 'o', 's', 'o', 'l', 0, 'o', 't', 'i', 'l', 'd', 'e', 0,
+    'o', 't', 'i', 'm', 'e', 's', 0, 'o', 't', 'i', 'm', 'e', 's', 'a', 's', 0,
+    'o', 'u', 'm', 'l', 0, 'o', 'v', 'b', 'a', 'r', 0, 'p', 'a', 'r', 0, 'p', 'a', 'r', 'a', 0,
+    'p', 'a', 'r', 'a', 'l', 'l', 'e', 'l', 0, 'p', 'a', 'r', 's', 'i', 'm', 0,
+    'p', 'a', 'r', 's', 'l', 0, 'p', 'a', 'r', 't', 0, 'p', 'c', 'y', 0,
+    'p', 'e', 'r', 'c', 'n', 't', 0, 'p', 'e', 'r', 'i', 'o', 'd', 0,
+    'p', 'e', 'r', 'm', 'i', 'l', 0, 'p', 'e', 'r', 'p', 0,
+    'p', 'e', 'r', 't', 'e', 'n', 'k', 0, 'p', 'f', 'r', 0, 'p', 'h', 'i', 0,
+    'p', 'h', 'i', 'v', 0, 'p', 'h', 'm', 'm', 'a', 't', 0, 'p', 'h', 'o', 'n', 'e', 0,
+    'p', 'i', 0, 'p', 'i', 't', 'c', 'h', 'f', 'o', 'r', 'k', 0, 'p', 'i', 'v', 0,
+    'p', 'l', 'a', 'n', 'c', 'k', 0, 'p', 'l', 'a', 'n', 'c', 'k', 'h', 0,
+    'p', 'l', 'a', 'n', 'k', 'v', 0, 'p', 'l', 'u', 's', 0,
+    'p', 'l', 'u', 's', 'a', 'c', 'i', 'r', 0, 'p', 'l', 'u', 's', 'b', 0,
+    'p', 'l', 'u', 's', 'c', 'i', 'r', 0, 'p', 'l', 'u', 's', 'd', 'o', 0,
+    'p', 'l', 'u', 's', 'd', 'u', 0, 'p', 'l', 'u', 's', 'e', 0,
+    'p', 'l', 'u', 's', 'm', 'n', 0, 'p', 'l', 'u', 's', 's', 'i', 'm', 0,
+    'p', 'l', 'u', 's', 't', 'w', 'o', 0, 'p', 'm', 0,
+    'p', 'o', 'i', 'n', 't', 'i', 'n', 't', 0, 'p', 'o', 'p', 'f', 0,
+    'p', 'o', 'u', 'n', 'd', 0, 'p', 'r', 0, 'p', 'r', 'E', 0, 'p', 'r', 'a', 'p', 0,
+    'p', 'r', 'c', 'u', 'e', 0, 'p', 'r', 'e', 0, 'p', 'r', 'e', 'c', 0,
+    'p', 'r', 'e', 'c', 'a', 'p', 'p', 'r', 'o', 'x', 0,
+    'p', 'r', 'e', 'c', 'c', 'u', 'r', 'l', 'y', 'e', 'q', 0, 'p', 'r', 'e', 'c', 'e', 'q', 0,
+    'p', 'r', 'e', 'c', 'n', 'a', 'p', 'p', 'r', 'o', 'x', 0,
+    'p', 'r', 'e', 'c', 'n', 'e', 'q', 'q', 0, 'p', 'r', 'e', 'c', 'n', 's', 'i', 'm', 0,
+    'p', 'r', 'e', 'c', 's', 'i', 'm', 0, 'p', 'r', 'i', 'm', 'e', 0,
+    'p', 'r', 'i', 'm', 'e', 's', 0, 'p', 'r', 'n', 'E', 0, 'p', 'r', 'n', 'a', 'p', 0,
+    'p', 'r', 'n', 's', 'i', 'm', 0, 'p', 'r', 'o', 'd', 0,
+    'p', 'r', 'o', 'f', 'a', 'l', 'a', 'r', 0, 'p', 'r', 'o', 'f', 'l', 'i', 'n', 'e', 0,
+    'p', 'r', 'o', 'f', 's', 'u', 'r', 'f', 0, 'p', 'r', 'o', 'p', 0,
+    'p', 'r', 'o', 'p', 't', 'o', 0, 'p', 'r', 's', 'i', 'm', 0,
+    'p', 'r', 'u', 'r', 'e', 'l', 0, 'p', 's', 'c', 'r', 0, 'p', 's', 'i', 0,
+    'p', 'u', 'n', 'c', 's', 'p', 0, 'q', 'f', 'r', 0, 'q', 'i', 'n', 't', 0,
+    'q', 'o', 'p', 'f', 0, 'q', 'p', 'r', 'i', 'm', 'e', 0, 'q', 's', 'c', 'r', 0,
+    'q', 'u', 'a', 't', 'e', 'r', 'n', 'i', 'o', 'n', 's', 0,
+    'q', 'u', 'a', 't', 'i', 'n', 't', 0, 'q', 'u', 'e', 's', 't', 0,
+    'q', 'u', 'e', 's', 't', 'e', 'q', 0, 'q', 'u', 'o', 't', 0, 'r', 'A', 'a', 'r', 'r', 0,
+    'r', 'A', 'r', 'r', 0, 'r', 'A', 't', 'a', 'i', 'l', 0, 'r', 'B', 'a', 'r', 'r', 0,
+    'r', 'H', 'a', 'r', 0, 'r', 'a', 'c', 'e', 0, 'r', 'a', 'c', 'u', 't', 'e', 0,
+    'r', 'a', 'd', 'i', 'c', 0, 'r', 'a', 'e', 'm', 'p', 't', 'y', 'v', 0,
+    'r', 'a', 'n', 'g', 0, 'r', 'a', 'n', 'g', 'd', 0, 'r', 'a', 'n', 'g', 'e', 0,
+    'r', 'a', 'n', 'g', 'l', 'e', 0, 'r', 'a', 'q', 'u', 'o', 0, 'r', 'a', 'r', 'r', 0,
+    'r', 'a', 'r', 'r', 'a', 'p', 0, 'r', 'a', 'r', 'r', 'b', 0,
+    'r', 'a', 'r', 'r', 'b', 'f', 's', 0, 'r', 'a', 'r', 'r', 'c', 0,
+    'r', 'a', 'r', 'r', 'f', 's', 0, 'r', 'a', 'r', 'r', 'h', 'k', 0,
+    'r', 'a', 'r', 'r', 'l', 'p', 0, 'r', 'a', 'r', 'r', 'p', 'l', 0,
+    'r', 'a', 'r', 'r', 's', 'i', 'm', 0, 'r', 'a', 'r', 'r', 't', 'l', 0,
+    'r', 'a', 'r', 'r', 'w', 0, 'r', 'a', 't', 'a', 'i', 'l', 0, 'r', 'a', 't', 'i', 'o', 0,
+    'r', 'a', 't', 'i', 'o', 'n', 'a', 'l', 's', 0, 'r', 'b', 'a', 'r', 'r', 0,
+    'r', 'b', 'b', 'r', 'k', 0, 'r', 'b', 'r', 'a', 'c', 'e', 0,
+    'r', 'b', 'r', 'a', 'c', 'k', 0, 'r', 'b', 'r', 'k', 'e', 0,
+    'r', 'b', 'r', 'k', 's', 'l', 'd', 0, 'r', 'b', 'r', 'k', 's', 'l', 'u', 0,
+    'r', 'c', 'a', 'r', 'o', 'n', 0, 'r', 'c', 'e', 'd', 'i', 'l', 0,
+    'r', 'c', 'e', 'i', 'l', 0, 'r', 'c', 'u', 'b', 0, 'r', 'c', 'y', 0, 'r', 'd', 'c', 'a', 0,
+    'r', 'd', 'l', 'd', 'h', 'a', 'r', 0, 'r', 'd', 'q', 'u', 'o', 0,
+    'r', 'd', 'q', 'u', 'o', 'r', 0, 'r', 'd', 's', 'h', 0, 'r', 'e', 'a', 'l', 0,
+    'r', 'e', 'a', 'l', 'i', 'n', 'e', 0, 'r', 'e', 'a', 'l', 'p', 'a', 'r', 't', 0,
+    'r', 'e', 'a', 'l', 's', 0, 'r', 'e', 'c', 't', 0, 'r', 'e', 'g', 0,
+    'r', 'f', 'i', 's', 'h', 't', 0, 'r', 'f', 'l', 'o', 'o', 'r', 0, 'r', 'f', 'r', 0,
+    'r', 'h', 'a', 'r', 'd', 0, 'r', 'h', 'a', 'r', 'u', 0, 'r', 'h', 'a', 'r', 'u', 'l', 0,
+    'r', 'h', 'o', 0, 'r', 'h', 'o', 'v', 0,
+    'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 0,
+    'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 't', 'a', 'i', 'l', 0,
+    'r', 'i', 'g', 'h', 't', 'h', 'a', 'r', 'p', 'o', 'o', 'n', 'd', 'o', 'w', 'n', 0,
+    'r', 'i', 'g', 'h', 't', 'h', 'a', 'r', 'p', 'o', 'o', 'n', 'u', 'p', 0,
+    'r', 'i', 'g', 'h', 't', 'l', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', 's', 0,
+    'r', 'i', 'g', 'h', 't', 'l', 'e', 'f', 't', 'h', 'a', 'r', 'p', 'o', 'o', 'n', 's', 0,
+    'r', 'i', 'g', 'h', 't', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 's', 0,
+    'r', 'i', 'g', 'h', 't', 's', 'q', 'u', 'i', 'g', 'a', 'r', 'r', 'o', 'w', 0,
+    'r', 'i', 'g', 'h', 't', 't', 'h', 'r', 'e', 'e', 't', 'i', 'm', 'e', 's', 0,
+    'r', 'i', 'n', 'g', 0, 'r', 'i', 's', 'i', 'n', 'g', 'd', 'o', 't', 's', 'e', 'q', 0,
+    'r', 'l', 'a', 'r', 'r', 0, 'r', 'l', 'h', 'a', 'r', 0, 'r', 'l', 'm', 0,
+    'r', 'm', 'o', 'u', 's', 't', 0, 'r', 'm', 'o', 'u', 's', 't', 'a', 'c', 'h', 'e', 0,
+    'r', 'n', 'm', 'i', 'd', 0, 'r', 'o', 'a', 'n', 'g', 0, 'r', 'o', 'a', 'r', 'r', 0,
+    'r', 'o', 'b', 'r', 'k', 0, 'r', 'o', 'p', 'a', 'r', 0, 'r', 'o', 'p', 'f', 0,
+    'r', 'o', 'p', 'l', 'u', 's', 0, 'r', 'o', 't', 'i', 'm', 'e', 's', 0,
+    'r', 'p', 'a', 'r', 0, 'r', 'p', 'a', 'r', 'g', 't', 0,
+    'r', 'p', 'p', 'o', 'l', 'i', 'n', 't', 0, 'r', 'r', 'a', 'r', 'r', 0,
+    'r', 's', 'a', 'q', 'u', 'o', 0, 'r', 's', 'c', 'r', 0, 'r', 's', 'h', 0,
+    'r', 's', 'q', 'b', 0, 'r', 's', 'q', 'u', 'o', 0, 'r', 's', 'q', 'u', 'o', 'r', 0,
+    'r', 't', 'h', 'r', 'e', 'e', 0, 'r', 't', 'i', 'm', 'e', 's', 0, 'r', 't', 'r', 'i', 0,
+    'r', 't', 'r', 'i', 'e', 0, 'r', 't', 'r', 'i', 'f', 0,
+    'r', 't', 'r', 'i', 'l', 't', 'r', 'i', 0, 'r', 'u', 'l', 'u', 'h', 'a', 'r', 0,
+    'r', 'x', 0, 's', 'a', 'c', 'u', 't', 'e', 0, 's', 'b', 'q', 'u', 'o', 0, 's', 'c', 0,
+    's', 'c', 'E', 0, 's', 'c', 'a', 'p', 0, 's', 'c', 'a', 'r', 'o', 'n', 0,
+    's', 'c', 'c', 'u', 'e', 0, 's', 'c', 'e', 0, 's', 'c', 'e', 'd', 'i', 'l', 0,
+    's', 'c', 'i', 'r', 'c', 0, 's', 'c', 'n', 'E', 0, 's', 'c', 'n', 'a', 'p', 0,
+    's', 'c', 'n', 's', 'i', 'm', 0, 's', 'c', 'p', 'o', 'l', 'i', 'n', 't', 0,
+    's', 'c', 's', 'i', 'm', 0, 's', 'c', 'y', 0, 's', 'd', 'o', 't', 0,
+    's', 'd', 'o', 't', 'b', 0, 's', 'd', 'o', 't', 'e', 0, 's', 'e', 'A', 'r', 'r', 0,
+    's', 'e', 'a', 'r', 'h', 'k', 0, 's', 'e', 'a', 'r', 'r', 0,
+    's', 'e', 'a', 'r', 'r', 'o', 'w', 0, 's', 'e', 'c', 't', 0, 's', 'e', 'm', 'i', 0,
+    's', 'e', 's', 'w', 'a', 'r', 0, 's', 'e', 't', 'm', 'i', 'n', 'u', 's', 0,
+    's', 'e', 't', 'm', 'n', 0, 's', 'e', 'x', 't', 0, 's', 'f', 'r', 0,
+    's', 'f', 'r', 'o', 'w', 'n', 0, 's', 'h', 'a', 'r', 'p', 0,
+    's', 'h', 'c', 'h', 'c', 'y', 0, 's', 'h', 'c', 'y', 0,
+    's', 'h', 'o', 'r', 't', 'm', 'i', 'd', 0,
+    's', 'h', 'o', 'r', 't', 'p', 'a', 'r', 'a', 'l', 'l', 'e', 'l', 0, 's', 'h', 'y', 0,
+    's', 'i', 'g', 'm', 'a', 0, 's', 'i', 'g', 'm', 'a', 'f', 0,
+    's', 'i', 'g', 'm', 'a', 'v', 0, 's', 'i', 'm', 0, 's', 'i', 'm', 'd', 'o', 't', 0,
+    's', 'i', 'm', 'e', 0, 's', 'i', 'm', 'e', 'q', 0, 's', 'i', 'm', 'g', 0,
+    's', 'i', 'm', 'g', 'E', 0, 's', 'i', 'm', 'l', 0, 's', 'i', 'm', 'l', 'E', 0,
+    's', 'i', 'm', 'n', 'e', 0, 's', 'i', 'm', 'p', 'l', 'u', 's', 0,
+    's', 'i', 'm', 'r', 'a', 'r', 'r', 0, 's', 'l', 'a', 'r', 'r', 0,
+    's', 'm', 'a', 'l', 'l', 's', 'e', 't', 'm', 'i', 'n', 'u', 's', 0,
+    's', 'm', 'a', 's', 'h', 'p', 0, 's', 'm', 'e', 'p', 'a', 'r', 's', 'l', 0,
+    's', 'm', 'i', 'd', 0, 's', 'm', 'i', 'l', 'e', 0, 's', 'm', 't', 0, 's', 'm', 't', 'e', 0,
+    's', 'm', 't', 'e', 's', 0, 's', 'o', 'f', 't', 'c', 'y', 0, 's', 'o', 'l', 0,
+    's', 'o', 'l', 'b', 0, 's', 'o', 'l', 'b', 'a', 'r', 0, 's', 'o', 'p', 'f', 0,
+    's', 'p', 'a', 'd', 'e', 's', 0, 's', 'p', 'a', 'd', 'e', 's', 'u', 'i', 't', 0,
+    's', 'p', 'a', 'r', 0, 's', 'q', 'c', 'a', 'p', 0, 's', 'q', 'c', 'a', 'p', 's', 0,
+    's', 'q', 'c', 'u', 'p', 0, 's', 'q', 'c', 'u', 'p', 's', 0, 's', 'q', 's', 'u', 'b', 0,
+    's', 'q', 's', 'u', 'b', 'e', 0, 's', 'q', 's', 'u', 'b', 's', 'e', 't', 0,
+    's', 'q', 's', 'u', 'b', 's', 'e', 't', 'e', 'q', 0, 's', 'q', 's', 'u', 'p', 0,
+    's', 'q', 's', 'u', 'p', 'e', 0, 's', 'q', 's', 'u', 'p', 's', 'e', 't', 0,
+    's', 'q', 's', 'u', 'p', 's', 'e', 't', 'e', 'q', 0, 's', 'q', 'u', 0,
+    's', 'q', 'u', 'a', 'r', 'e', 0, 's', 'q', 'u', 'a', 'r', 'f', 0, 's', 'q', 'u', 'f', 0,
+    's', 'r', 'a', 'r', 'r', 0, 's', 's', 'c', 'r', 0, 's', 's', 'e', 't', 'm', 'n', 0,
+    's', 's', 'm', 'i', 'l', 'e', 0, 's', 's', 't', 'a', 'r', 'f', 0, 's', 't', 'a', 'r', 0,
+    's', 't', 'a', 'r', 'f', 0,
+    's', 't', 'r', 'a', 'i', 'g', 'h', 't', 'e', 'p', 's', 'i', 'l', 'o', 'n', 0,
+    's', 't', 'r', 'a', 'i', 'g', 'h', 't', 'p', 'h', 'i', 0, 's', 't', 'r', 'n', 's', 0,
+    's', 'u', 'b', 0, 's', 'u', 'b', 'E', 0, 's', 'u', 'b', 'd', 'o', 't', 0,
+    's', 'u', 'b', 'e', 0, 's', 'u', 'b', 'e', 'd', 'o', 't', 0,
+    's', 'u', 'b', 'm', 'u', 'l', 't', 0, 's', 'u', 'b', 'n', 'E', 0,
+    's', 'u', 'b', 'n', 'e', 0, 's', 'u', 'b', 'p', 'l', 'u', 's', 0,
+    's', 'u', 'b', 'r', 'a', 'r', 'r', 0, 's', 'u', 'b', 's', 'e', 't', 0,
+    's', 'u', 'b', 's', 'e', 't', 'e', 'q', 0, 's', 'u', 'b', 's', 'e', 't', 'e', 'q', 'q', 0,
+    's', 'u', 'b', 's', 'e', 't', 'n', 'e', 'q', 0,
+    's', 'u', 'b', 's', 'e', 't', 'n', 'e', 'q', 'q', 0, 's', 'u', 'b', 's', 'i', 'm', 0,
+    's', 'u', 'b', 's', 'u', 'b', 0, 's', 'u', 'b', 's', 'u', 'p', 0, 's', 'u', 'c', 'c', 0,
+    's', 'u', 'c', 'c', 'a', 'p', 'p', 'r', 'o', 'x', 0,
+    's', 'u', 'c', 'c', 'c', 'u', 'r', 'l', 'y', 'e', 'q', 0, 's', 'u', 'c', 'c', 'e', 'q', 0,
+    's', 'u', 'c', 'c', 'n', 'a', 'p', 'p', 'r', 'o', 'x', 0,
+    's', 'u', 'c', 'c', 'n', 'e', 'q', 'q', 0, 's', 'u', 'c', 'c', 'n', 's', 'i', 'm', 0,
+    's', 'u', 'c', 'c', 's', 'i', 'm', 0, 's', 'u', 'm', 0, 's', 'u', 'n', 'g', 0,
+    's', 'u', 'p', 0, 's', 'u', 'p', '1', 0, 's', 'u', 'p', '2', 0, 's', 'u', 'p', '3', 0,
+    's', 'u', 'p', 'E', 0, 's', 'u', 'p', 'd', 'o', 't', 0,
+    's', 'u', 'p', 'd', 's', 'u', 'b', 0, 's', 'u', 'p', 'e', 0,
+    's', 'u', 'p', 'e', 'd', 'o', 't', 0, 's', 'u', 'p', 'h', 's', 'o', 'l', 0,
+    's', 'u', 'p', 'h', 's', 'u', 'b', 0, 's', 'u', 'p', 'l', 'a', 'r', 'r', 0,
+    's', 'u', 'p', 'm', 'u', 'l', 't', 0, 's', 'u', 'p', 'n', 'E', 0,
+    's', 'u', 'p', 'n', 'e', 0, 's', 'u', 'p', 'p', 'l', 'u', 's', 0,
+    's', 'u', 'p', 's', 'e', 't', 0, 's', 'u', 'p', 's', 'e', 't', 'e', 'q', 0,
+    's', 'u', 'p', 's', 'e', 't', 'e', 'q', 'q', 0,
+    's', 'u', 'p', 's', 'e', 't', 'n', 'e', 'q', 0,
+    's', 'u', 'p', 's', 'e', 't', 'n', 'e', 'q', 'q', 0, 's', 'u', 'p', 's', 'i', 'm', 0,
+    's', 'u', 'p', 's', 'u', 'b', 0, 's', 'u', 'p', 's', 'u', 'p', 0,
+    's', 'w', 'A', 'r', 'r', 0, 's', 'w', 'a', 'r', 'h', 'k', 0, 's', 'w', 'a', 'r', 'r', 0,
+    's', 'w', 'a', 'r', 'r', 'o', 'w', 0, 's', 'w', 'n', 'w', 'a', 'r', 0,
+    's', 'z', 'l', 'i', 'g', 0, 't', 'a', 'r', 'g', 'e', 't', 0, 't', 'a', 'u', 0,
+    't', 'b', 'r', 'k', 0, 't', 'c', 'a', 'r', 'o', 'n', 0, 't', 'c', 'e', 'd', 'i', 'l', 0,
+    't', 'c', 'y', 0, 't', 'd', 'o', 't', 0, 't', 'e', 'l', 'r', 'e', 'c', 0, 't', 'f', 'r', 0,
+    't', 'h', 'e', 'r', 'e', '4', 0, 't', 'h', 'e', 'r', 'e', 'f', 'o', 'r', 'e', 0,
+    't', 'h', 'e', 't', 'a', 0, 't', 'h', 'e', 't', 'a', 's', 'y', 'm', 0,
+    't', 'h', 'e', 't', 'a', 'v', 0, 't', 'h', 'i', 'c', 'k', 'a', 'p', 'p', 'r', 'o', 'x', 0,
+    't', 'h', 'i', 'c', 'k', 's', 'i', 'm', 0, 't', 'h', 'i', 'n', 's', 'p', 0,
+    't', 'h', 'k', 'a', 'p', 0, 't', 'h', 'k', 's', 'i', 'm', 0, 't', 'h', 'o', 'r', 'n', 0,
+    't', 'i', 'l', 'd', 'e', 0, 't', 'i', 'm', 'e', 's', 0, 't', 'i', 'm', 'e', 's', 'b', 0,
+    't', 'i', 'm', 'e', 's', 'b', 'a', 'r', 0, 't', 'i', 'm', 'e', 's', 'd', 0,
+    't', 'i', 'n', 't', 0, 't', 'o', 'e', 'a', 0, 't', 'o', 'p', 0,
+    't', 'o', 'p', 'b', 'o', 't', 0, 't', 'o', 'p', 'c', 'i', 'r', 0, 't', 'o', 'p', 'f', 0,
+    't', 'o', 'p', 'f', 'o', 'r', 'k', 0, 't', 'o', 's', 'a', 0,
+    't', 'p', 'r', 'i', 'm', 'e', 0, 't', 'r', 'a', 'd', 'e', 0,
+    't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 0,
+    't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'd', 'o', 'w', 'n', 0,
+    't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'l', 'e', 'f', 't', 0,
+    't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'l', 'e', 'f', 't', 'e', 'q', 0,
+    't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'q', 0,
+    't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'r', 'i', 'g', 'h', 't', 0,
+    't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'r', 'i', 'g', 'h', 't', 'e', 'q', 0,
+    't', 'r', 'i', 'd', 'o', 't', 0, 't', 'r', 'i', 'e', 0,
+    't', 'r', 'i', 'm', 'i', 'n', 'u', 's', 0, 't', 'r', 'i', 'p', 'l', 'u', 's', 0,
+    't', 'r', 'i', 's', 'b', 0, 't', 'r', 'i', 't', 'i', 'm', 'e', 0,
+    't', 'r', 'p', 'e', 'z', 'i', 'u', 'm', 0, 't', 's', 'c', 'r', 0, 't', 's', 'c', 'y', 0,
+    't', 's', 'h', 'c', 'y', 0, 't', 's', 't', 'r', 'o', 'k', 0, 't', 'w', 'i', 'x', 't', 0,
+    't', 'w', 'o', 'h', 'e', 'a', 'd', 'l', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', 0,
+    't', 'w', 'o', 'h', 'e', 'a', 'd', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 0,
+    'u', 'A', 'r', 'r', 0, 'u', 'H', 'a', 'r', 0, 'u', 'a', 'c', 'u', 't', 'e', 0,
+    'u', 'a', 'r', 'r', 0, 'u', 'b', 'r', 'c', 'y', 0, 'u', 'b', 'r', 'e', 'v', 'e', 0,
+    'u', 'c', 'i', 'r', 'c', 0, 'u', 'c', 'y', 0, 'u', 'd', 'a', 'r', 'r', 0,
+    'u', 'd', 'b', 'l', 'a', 'c', 0, 'u', 'd', 'h', 'a', 'r', 0,
+    'u', 'f', 'i', 's', 'h', 't', 0, 'u', 'f', 'r', 0, 'u', 'g', 'r', 'a', 'v', 'e', 0,
+    'u', 'h', 'a', 'r', 'l', 0, 'u', 'h', 'a', 'r', 'r', 0, 'u', 'h', 'b', 'l', 'k', 0,
+    'u', 'l', 'c', 'o', 'r', 'n', 0, 'u', 'l', 'c', 'o', 'r', 'n', 'e', 'r', 0,
+    'u', 'l', 'c', 'r', 'o', 'p', 0, 'u', 'l', 't', 'r', 'i', 0, 'u', 'm', 'a', 'c', 'r', 0,
+    'u', 'm', 'l', 0, 'u', 'o', 'g', 'o', 'n', 0, 'u', 'o', 'p', 'f', 0,
+    'u', 'p', 'a', 'r', 'r', 'o', 'w', 0,
+    'u', 'p', 'd', 'o', 'w', 'n', 'a', 'r', 'r', 'o', 'w', 0,
+    'u', 'p', 'h', 'a', 'r', 'p', 'o', 'o', 'n', 'l', 'e', 'f', 't', 0,
+    'u', 'p', 'h', 'a', 'r', 'p', 'o', 'o', 'n', 'r', 'i', 'g', 'h', 't', 0,
+    'u', 'p', 'l', 'u', 's', 0, 'u', 'p', 's', 'i', 0, 'u', 'p', 's', 'i', 'h', 0,
+    'u', 'p', 's', 'i', 'l', 'o', 'n', 0, 'u', 'p', 'u', 'p', 'a', 'r', 'r', 'o', 'w', 's', 0,
+    'u', 'r', 'c', 'o', 'r', 'n', 0, 'u', 'r', 'c', 'o', 'r', 'n', 'e', 'r', 0,
+    'u', 'r', 'c', 'r', 'o', 'p', 0, 'u', 'r', 'i', 'n', 'g', 0, 'u', 'r', 't', 'r', 'i', 0,
+    'u', 's', 'c', 'r', 0, 'u', 't', 'd', 'o', 't', 0, 'u', 't', 'i', 'l', 'd', 'e', 0,
+    'u', 't', 'r', 'i', 0, 'u', 't', 'r', 'i', 'f', 0, 'u', 'u', 'a', 'r', 'r', 0,
+    'u', 'u', 'm', 'l', 0, 'u', 'w', 'a', 'n', 'g', 'l', 'e', 0, 'v', 'A', 'r', 'r', 0,
+    'v', 'B', 'a', 'r', 0, 'v', 'B', 'a', 'r', 'v', 0, 'v', 'D', 'a', 's', 'h', 0,
+    'v', 'a', 'n', 'g', 'r', 't', 0, 'v', 'a', 'r', 'e', 'p', 's', 'i', 'l', 'o', 'n', 0,
+    'v', 'a', 'r', 'k', 'a', 'p', 'p', 'a', 0,
+    'v', 'a', 'r', 'n', 'o', 't', 'h', 'i', 'n', 'g', 0, 'v', 'a', 'r', 'p', 'h', 'i', 0,
+    'v', 'a', 'r', 'p', 'i', 0, 'v', 'a', 'r', 'p', 'r', 'o', 'p', 't', 'o', 0,
+    'v', 'a', 'r', 'r', 0, 'v', 'a', 'r', 'r', 'h', 'o', 0,
+    'v', 'a', 'r', 's', 'i', 'g', 'm', 'a', 0,
+    'v', 'a', 'r', 's', 'u', 'b', 's', 'e', 't', 'n', 'e', 'q', 0,
+    'v', 'a', 'r', 's', 'u', 'b', 's', 'e', 't', 'n', 'e', 'q', 'q', 0,
+    'v', 'a', 'r', 's', 'u', 'p', 's', 'e', 't', 'n', 'e', 'q', 0,
+    'v', 'a', 'r', 's', 'u', 'p', 's', 'e', 't', 'n', 'e', 'q', 'q', 0,
+    'v', 'a', 'r', 't', 'h', 'e', 't', 'a', 0,
+    'v', 'a', 'r', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'l', 'e', 'f', 't', 0,
+    'v', 'a', 'r', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'r', 'i', 'g', 'h', 't', 0,
+    'v', 'c', 'y', 0, 'v', 'd', 'a', 's', 'h', 0, 'v', 'e', 'e', 0,
+    'v', 'e', 'e', 'b', 'a', 'r', 0, 'v', 'e', 'e', 'e', 'q', 0,
+    'v', 'e', 'l', 'l', 'i', 'p', 0, 'v', 'e', 'r', 'b', 'a', 'r', 0, 'v', 'e', 'r', 't', 0,
+    'v', 'f', 'r', 0, 'v', 'l', 't', 'r', 'i', 0, 'v', 'n', 's', 'u', 'b', 0,
+    'v', 'n', 's', 'u', 'p', 0, 'v', 'o', 'p', 'f', 0, 'v', 'p', 'r', 'o', 'p', 0,
+    'v', 'r', 't', 'r', 'i', 0, 'v', 's', 'c', 'r', 0, 'v', 's', 'u', 'b', 'n', 'E', 0,
+    'v', 's', 'u', 'b', 'n', 'e', 0, 'v', 's', 'u', 'p', 'n', 'E', 0,
+    'v', 's', 'u', 'p', 'n', 'e', 0, 'v', 'z', 'i', 'g', 'z', 'a', 'g', 0,
+    'w', 'c', 'i', 'r', 'c', 0, 'w', 'e', 'd', 'b', 'a', 'r', 0, 'w', 'e', 'd', 'g', 'e', 0,
+    'w', 'e', 'd', 'g', 'e', 'q', 0, 'w', 'e', 'i', 'e', 'r', 'p', 0, 'w', 'f', 'r', 0,
+    'w', 'o', 'p', 'f', 0, 'w', 'p', 0, 'w', 'r', 0, 'w', 'r', 'e', 'a', 't', 'h', 0,
+    'w', 's', 'c', 'r', 0, 'x', 'c', 'a', 'p', 0, 'x', 'c', 'i', 'r', 'c', 0,
+    'x', 'c', 'u', 'p', 0, 'x', 'd', 't', 'r', 'i', 0, 'x', 'f', 'r', 0,
+    'x', 'h', 'A', 'r', 'r', 0, 'x', 'h', 'a', 'r', 'r', 0, 'x', 'i', 0,
+    'x', 'l', 'A', 'r', 'r', 0, 'x', 'l', 'a', 'r', 'r', 0, 'x', 'm', 'a', 'p', 0,
+    'x', 'n', 'i', 's', 0, 'x', 'o', 'd', 'o', 't', 0, 'x', 'o', 'p', 'f', 0,
+    'x', 'o', 'p', 'l', 'u', 's', 0, 'x', 'o', 't', 'i', 'm', 'e', 0,
+    'x', 'r', 'A', 'r', 'r', 0, 'x', 'r', 'a', 'r', 'r', 0, 'x', 's', 'c', 'r', 0,
+    'x', 's', 'q', 'c', 'u', 'p', 0, 'x', 'u', 'p', 'l', 'u', 's', 0,
+    'x', 'u', 't', 'r', 'i', 0, 'x', 'v', 'e', 'e', 0, 'x', 'w', 'e', 'd', 'g', 'e', 0,
+    'y', 'a', 'c', 'u', 't', 'e', 0, 'y', 'a', 'c', 'y', 0, 'y', 'c', 'i', 'r', 'c', 0,
+    'y', 'c', 'y', 0, 'y', 'e', 'n', 0, 'y', 'f', 'r', 0, 'y', 'i', 'c', 'y', 0,
+    'y', 'o', 'p', 'f', 0, 'y', 's', 'c', 'r', 0, 'y', 'u', 'c', 'y', 0, 'y', 'u', 'm', 'l', 0,
+    'z', 'a', 'c', 'u', 't', 'e', 0, 'z', 'c', 'a', 'r', 'o', 'n', 0, 'z', 'c', 'y', 0,
+    'z', 'd', 'o', 't', 0, 'z', 'e', 'e', 't', 'r', 'f', 0, 'z', 'e', 't', 'a', 0,
+    'z', 'f', 'r', 0, 'z', 'h', 'c', 'y', 0, 'z', 'i', 'g', 'r', 'a', 'r', 'r', 0,
+    'z', 'o', 'p', 'f', 0, 'z', 's', 'c', 'r', 0, 'z', 'w', 'j', 0, 'z', 'w', 'n', 'j', 0,
+};
+
+static const uint16_t html_entity_offsets[HTML_ENTITY_COUNT] = {
+    0, 6, 10, 17, 24, 30, 34, 38, 45, 51, 57, 61,
+    67, 72, 86, 92, 97, 104, 111, 116, 126, 131, 138, 142,
+    150, 161, 166, 170, 175, 181, 186, 193, 198, 203, 210, 214,
+    235, 243, 250, 257, 263, 271, 276, 284, 294, 298, 302, 312,
+    324, 335, 347, 372, 394, 410, 416, 423, 433, 440, 456, 461,
+    471, 503, 509, 514, 518, 525, 528, 537, 542, 547, 552, 559,
+    564, 570, 577, 581, 585, 591, 595, 612, 627, 650, 667, 684,
+    692, 706, 711, 715, 722, 731, 753, 763, 779, 795, 816, 830,
+    850, 875, 896, 913, 928, 942, 960, 978, 988, 1001, 1018, 1028,
+    1048, 1066, 1081, 1099, 1118, 1134, 1153, 1161, 1174, 1184, 1189, 1196,
+    1200, 1204, 1211, 1218, 1224, 1228, 1233, 1237, 1244, 1252, 1258, 1275,
+    1296, 1302, 1307, 1315, 1321, 1332, 1344, 1349, 1354, 1358, 1363, 1370,
+    1383, 1387, 1391, 1409, 1431, 1436, 1443, 1454, 1459, 1464, 1467, 1473,
+    1480, 1487, 1494, 1500, 1504, 1509, 1513, 1516, 1521, 1534, 1551, 1568,
+    1583, 1595, 1613, 1626, 1631, 1634, 1641, 1647, 1651, 1657, 1661, 1674,
+    1679, 1694, 1699, 1706, 1719, 1729, 1734, 1740, 1745, 1752, 1758, 1762,
+    1767, 1771, 1778, 1781, 1787, 1798, 1806, 1810, 1819, 1832, 1847, 1862,
+    1868, 1873, 1878, 1883, 1890, 1896, 1901, 1907, 1911, 1915, 1920, 1925,
+    1932, 1938, 1943, 1948, 1954, 1961, 1965, 1969, 1974, 1979, 1984, 1987,
+    1994, 2001, 2006, 2017, 2022, 2029, 2036, 2040, 2057, 2067, 2080, 2100,
+    2112, 2130, 2148, 2163, 2181, 2191, 2206, 2222, 2230, 2243, 2257, 2270,
+    2286, 2304, 2321, 2337, 2350, 2366, 2377, 2391, 2401, 2416, 2433, 2447,
+    2459, 2468, 2483, 2493, 2497, 2500, 2511, 2518, 2532, 2551, 2566, 2580,
+    2599, 2614, 2619, 2634, 2650, 2655, 2659, 2666, 2669, 2673, 2677, 2689,
+    2699, 2703, 2713, 2718, 2723, 2726, 2731, 2738, 2745, 2752, 2756, 2776,
+    2795, 2813, 2835, 2856, 2871, 2879, 2883, 2891, 2908, 2913, 2917, 2930,
+    2940, 2961, 2972, 2981, 2995, 3005, 3016, 3032, 3052, 3070, 3085, 3106,
+    3122, 3138, 3151, 3167, 3186, 3207, 3215, 3228, 3243, 3255, 3273, 3286,
+    3310, 3328, 3340, 3357, 3379, 3397, 3414, 3434, 3456, 3472, 3493, 3511,
+    3534, 3544, 3559, 3571, 3588, 3610, 3627, 3639, 3656, 3665, 3679, 3697,
+    3711, 3726, 3731, 3738, 3741, 3747, 3754, 3760, 3764, 3771, 3775, 3782,
+    3788, 3794, 3802, 3807, 3828, 3843, 3846, 3851, 3858, 3865, 3872, 3877,
+    3885, 3895, 3907, 3923, 3932, 3936, 3940, 3944, 3947, 3957, 3971, 3976,
+    3979, 3988, 4002, 4021, 4035, 4041, 4049, 4060, 4073, 4078, 4082, 4087,
+    4091, 4096, 4101, 4107, 4111, 4118, 4123, 4128, 4135, 4142, 4149, 4153,
+    4156, 4171, 4190, 4211, 4215, 4219, 4237, 4248, 4262, 4282, 4295, 4314,
+    4333, 4349, 4368, 4379, 4388, 4402, 4417, 4431, 4448, 4467, 4485, 4502,
+    4516, 4533, 4545, 4560, 4571, 4576, 4589, 4601, 4606, 4610, 4622, 4629,
+    4634, 4641, 4648, 4651, 4658, 4665, 4671, 4675, 4679, 4694, 4709, 4725,
+    4738, 4744, 4756, 4761, 4766, 4773, 4792, 4805, 4823, 4838, 4858, 4870,
+    4875, 4880, 4884, 4891, 4903, 4912, 4926, 4945, 4959, 4968, 4972, 4976,
+    4985, 4999, 5006, 5012, 5018, 5024, 5029, 5033, 5037, 5044, 5051, 5055,
+    5059, 5069, 5075, 5086, 5096, 5102, 5113, 5128, 5139, 5144, 5154, 5159,
+    5166, 5173, 5178, 5187, 5193, 5200, 5206, 5210, 5217, 5221, 5228, 5234,
+    5243, 5254, 5267, 5284, 5290, 5300, 5306, 5311, 5319, 5330, 5347, 5359,
+    5373, 5379, 5390, 5398, 5410, 5425, 5441, 5446, 5454, 5460, 5465, 5472,
+    5477, 5483, 5488, 5492, 5498, 5505, 5509, 5516, 5521, 5533, 5546, 5564,
+    5578, 5592, 5596, 5601, 5606, 5613, 5619, 5625, 5629, 5634, 5639, 5643,
+    5646, 5651, 5656, 5661, 5666, 5671, 5678, 5684, 5688, 5692, 5697, 5702,
+    5707, 5712, 5719, 5726, 5730, 5735, 5750, 5755, 5759, 5764, 5769, 5776,
+    5783, 5786, 5790, 5794, 5800, 5806, 5810, 5816, 5819, 5823, 5830, 5838,
+    5844, 5850, 5856, 5862, 5866, 5870, 5877, 5882, 5891, 5896, 5900, 5905,
+    5911, 5918, 5927, 5936, 5945, 5954, 5963, 5972, 5981, 5990, 5996, 6004,
+    6013, 6020, 6026, 6034, 6040, 6045, 6048, 6052, 6059, 6063, 6068, 6073,
+    6080, 6089, 6095, 6100, 6104, 6110, 6118, 6125, 6130, 6139, 6145, 6150,
+    6159, 6171, 6181, 6189, 6199, 6206, 6213, 6222, 6227, 6236, 6242, 6246,
+    6252, 6259, 6267, 6275, 6281, 6288, 6293, 6298, 6306, 6310, 6317, 6325,
+    6332, 6340, 6349, 6359, 6368, 6376, 6392, 6406, 6415, 6422, 6431, 6438,
+    6451, 6463, 6477, 6495, 6513, 6532, 6538, 6544, 6550, 6556, 6562, 6566,
+    6574, 6579, 6584, 6588, 6595, 6602, 6608, 6614, 6620, 6626, 6631, 6637,
+    6643, 6649, 6655, 6661, 6667, 6673, 6679, 6684, 6690, 6696, 6702, 6708,
+    6714, 6720, 6727, 6733, 6739, 6745, 6751, 6756, 6762, 6768, 6774, 6780,
+    6789, 6797, 6806, 6812, 6818, 6824, 6830, 6835, 6841, 6847, 6853, 6859,
+    6865, 6871, 6878, 6884, 6891, 6896, 6902, 6907, 6913, 6918, 6924, 6933,
+    6938, 6945, 6950, 6956, 6962, 6969, 6976, 6980, 6987, 6996, 7003, 7010,
+    7017, 7022, 7028, 7034, 7040, 7047, 7054, 7060, 7066, 7074, 7079, 7085,
+    7093, 7098, 7108, 7112, 7117, 7123, 7133, 7137, 7141, 7146, 7151, 7158,
+    7174, 7191, 7200, 7209, 7220, 7232, 7244, 7249, 7258, 7265, 7273, 7279,
+    7288, 7294, 7301, 7309, 7315, 7322, 7327, 7334, 7345, 7355, 7360, 7368,
+    7375, 7380, 7387, 7392, 7399, 7405, 7411, 7416, 7421, 7427, 7432, 7438,
+    7444, 7452, 7460, 7466, 7472, 7479, 7487, 7491, 7500, 7507, 7514, 7521,
+    7527, 7532, 7539, 7547, 7559, 7571, 7580, 7591, 7598, 7613, 7629, 7635,
+    7641, 7650, 7656, 7663, 7668, 7673, 7680, 7687, 7692, 7697, 7703, 7711,
+    7717, 7724, 7728, 7731, 7739, 7745, 7753, 7757, 7763, 7771, 7778, 7782,
+    7788, 7794, 7799, 7807, 7819, 7825, 7829, 7837, 7843, 7847, 7854, 7868,
+    7875, 7880, 7887, 7894, 7901, 7906, 7910, 7916, 7925, 7934, 7942, 7952,
+    7967, 7977, 7992, 8008, 8025, 8034, 8041, 8048, 8053, 8058, 8063, 8070,
+    8076, 8081, 8087, 8093, 8099, 8107, 8112, 8121, 8127, 8132, 8139, 8146,
+    8153, 8158, 8164, 8171, 8175, 8180, 8183, 8189, 8193, 8196, 8203, 8207,
+    8214, 8217, 8226, 8230, 8234, 8241, 8247, 8253, 8262, 8269, 8274, 8281,
+    8288, 8292, 8297, 8303, 8308, 8313, 8320, 8326, 8331, 8339, 8345, 8352,
+    8360, 8366, 8377, 8389, 8396, 8403, 8409, 8417, 8426, 8432, 8438, 8443,
+    8449, 8454, 8458, 8462, 8467, 8472, 8477, 8483, 8495, 8508, 8522, 8526,
+    8533, 8540, 8546, 8553, 8557, 8563, 8569, 8574, 8580, 8586, 8591, 8596,
+    8603, 8608, 8614, 8623, 8630, 8637, 8644, 8651, 8658, 8665, 8672, 8679,
+    8686, 8693, 8700, 8707, 8714, 8721, 8728, 8734, 8740, 8745, 8748, 8752,
+    8759, 8765, 8772, 8776, 8783, 8789, 8793, 8798, 8801, 8805, 8809, 8814,
+    8823, 8827, 8833, 8840, 8848, 8857, 8862, 8869, 8873, 8876, 8880, 8886,
+    8891, 8894, 8898, 8902, 8906, 8910, 8915, 8924, 8928, 8933, 8939, 8945,
+    8950, 8956, 8961, 8966, 8972, 8978, 8981, 8986, 8992, 8998, 9005, 9013,
+    9023, 9030, 9037, 9047, 9058, 9066, 9073, 9083, 9088, 9093, 9100, 9105,
+    9112, 9119, 9124, 9132, 9138, 9143, 9149, 9156, 9166, 9173, 9180, 9184,
+    9193, 9202, 9208, 9215, 9229, 9244, 9249, 9256, 9261, 9268, 9275, 9282,
+    9289, 9296, 9299, 9305, 9309, 9314, 9320, 9324, 9328, 9335, 9338, 9345,
+    9351, 9358, 9364, 9370, 9376, 9382, 9391, 9400, 9406, 9411, 9417, 9420,
+    9427, 9433, 9442, 9449, 9453, 9460, 9469, 9478, 9487, 9495, 9500, 9506,
+    9511, 9516, 9522, 9529, 9534, 9539, 9545, 9553, 9559, 9566, 9572, 9575,
+    9582, 9588, 9593, 9599, 9603, 9607, 9613, 9618, 9623, 9630, 9636, 9642,
+    9649, 9656, 9660, 9664, 9671, 9676, 9681, 9686, 9691, 9697, 9702, 9709,
+    9715, 9718, 9722, 9727, 9734, 9743, 9750, 9757, 9762, 9768, 9775, 9779,
+    9785, 9790, 9796, 9804, 9811, 9818, 9825, 9832, 9840, 9847, 9851, 9858,
+    9863, 9869, 9875, 9881, 9888, 9895, 9901, 9909, 9917, 9924, 9931, 9937,
+    9942, 9946, 9951, 9957, 9964, 9972, 9981, 9986, 9989, 9999, 10013, 10029,
+    10043, 10058, 10073, 10089, 10107, 10127, 10142, 10146, 10150, 10155, 10164, 10168,
+    10174, 10181, 10189, 10198, 10203, 10210, 10221, 10229, 10239, 10250, 10258, 10266,
+    10273, 10280, 10284, 10287, 10291, 10297, 10303, 10310, 10316, 10321, 10324, 10330,
+    10339, 10346, 10352, 10359, 10366, 10377, 10381, 10386, 10395, 10399, 10404, 10410,
+    10416, 10422, 10428, 10434, 10448, 10467, 10478, 10493, 10507, 10522, 10528, 10533,
+    10540, 10548, 10555, 10562, 10566, 10574, 10579, 10584, 10591, 10597, 10606, 10612,
+    10619, 10623, 10629, 10636, 10641, 10645, 10650, 10656, 10662, 10667, 10673, 10680,
+    10687, 10690, 10695, 10701, 10707, 10714, 10721, 10728, 10736, 10743, 10748, 10754,
+    10760, 10769, 10777, 10787, 10792, 10798, 10803, 10808, 10813, 10821, 10825, 10832,
+    10843, 10854, 10863, 10870, 10877, 10881, 10887, 10901, 10905, 10909, 10915, 10919,
+    10926, 10933, 10940, 10946, 10953, 10960, 10968, 10973, 10978, 10985, 10992, 10997,
+    11000, 11005, 11012, 11015, 11024, 11030, 11034, 11038, 11043, 11054, 11070, 11074,
+    11078, 11083, 11095, 11102, 11109, 11115, 11122, 11127, 11131, 11136, 11142, 11148,
+    11156, 11162, 11170, 11179, 11184, 11190, 11197, 11202, 11209, 11216, 11222, 11231,
+    11236, 11240, 11246, 11249, 11255, 11262, 11268, 11276, 11282, 11289, 11296, 11302,
+    11309, 11317, 11321, 11325, 11329, 11334, 11340, 11350, 11355, 11361, 11365, 11370,
+    11376, 11382, 11388, 11391, 11395, 11400, 11404, 11409, 11415, 11419, 11425, 11430,
+    11434, 11445, 11461, 11466, 11472, 11482, 11487, 11493, 11499, 11503, 11509, 11516,
+    11521, 11526, 11530, 11536, 11543, 11552, 11560, 11568, 11576, 11582, 11590, 11598,
+    11606, 11611, 11621, 11628, 11634, 11642, 11646, 11653, 11658, 11664, 11672, 11678,
+    11684, 11691, 11698, 11710, 11716, 11723, 11727, 11734, 11739, 11744, 11754, 11769,
+    11774, 11780, 11787, 11793, 11799, 11807, 11815, 11820, 11826, 11832, 11840, 11850,
+    11861, 11867, 11875, 11880, 11886, 11892, 11900, 11910, 11921, 11926, 11933, 11938,
+    11952, 11968, 11983, 12000, 12003, 12007, 12014, 12020, 12027, 12034, 12039, 12046,
+    12051, 12056, 12064, 12071, 12076, 12081, 12089, 12096, 12104, 12110, 12116, 12123,
+    12129, 12137, 12144, 12147, 12154, 12159, 12164, 12170, 12174, 12180, 12187, 12192,
+    12197, 12204, 12210, 12216, 12220, 12225, 12232, 12236, 12242, 12246, 12251, 12257,
+    12263, 12271, 12277, 12281, 12287, 12293, 12301, 12306, 12313, 12318, 12323, 12329,
+    12335, 12338, 12344, 12348, 12354, 12362, 12367, 12372, 12379, 12384, 12392, 12396,
+    12401, 12408, 12413, 12420, 12427, 12436, 12441, 12447, 12451, 12456, 12465, 12472,
+    12478, 12483, 12487, 12494, 12501, 12508, 12513, 12521, 12525, 12529, 12534, 12541,
+    12547, 12550, 12560, 12564, 12571, 12579, 12586, 12591, 12600, 12606, 12614, 12621,
+    12628, 12634, 12641, 12649, 12657, 12660, 12669, 12674, 12680, 12683, 12687, 12692,
+    12698, 12702, 12707, 12718, 12730, 12737, 12749, 12758, 12767, 12775, 12781, 12788,
+    12793, 12799, 12806, 12811, 12820, 12829, 12838, 12843, 12850, 12856, 12863, 12868,
+    12872, 12879, 12883, 12888, 12893, 12900, 12905, 12917, 12925, 12931, 12939, 12944,
+    12950, 12955, 12962, 12968, 12973, 12978, 12985, 12991, 13000, 13005, 13011, 13017,
+    13024, 13030, 13035, 13042, 13048, 13056, 13062, 13069, 13076, 13083, 13090, 13098,
+    13105, 13111, 13118, 13124, 13134, 13140, 13146, 13153, 13160, 13166, 13174, 13182,
+    13189, 13196, 13202, 13207, 13211, 13216, 13224, 13230, 13237, 13242, 13247, 13255,
+    13264, 13270, 13275, 13279, 13286, 13293, 13297, 13303, 13309, 13316, 13320, 13325,
+    13336, 13351, 13368, 13383, 13399, 13417, 13434, 13450, 13466, 13471, 13484, 13490,
+    13496, 13500, 13507, 13518, 13524, 13530, 13536, 13542, 13548, 13553, 13560, 13568,
+    13573, 13580, 13589, 13595, 13602, 13607, 13611, 13616, 13622, 13629, 13636, 13643,
+    13648, 13654, 13660, 13669, 13677, 13680, 13687, 13693, 13696, 13700, 13705, 13712,
+    13718, 13722, 13729, 13735, 13740, 13746, 13753, 13762, 13768, 13772, 13777, 13783,
+    13789, 13795, 13802, 13808, 13816, 13821, 13826, 13833, 13842, 13848, 13853, 13857,
+    13864, 13870, 13877, 13882, 13891, 13905, 13909, 13915, 13922, 13929, 13933, 13940,
+    13945, 13951, 13956, 13962, 13967, 13973, 13979, 13987, 13995, 14001, 14015, 14022,
+    14031, 14036, 14042, 14046, 14051, 14057, 14064, 14068, 14073, 14080, 14085, 14092,
+    14102, 14107, 14113, 14120, 14126, 14133, 14139, 14146, 14155, 14166, 14172, 14179,
+    14188, 14199, 14203, 14210, 14217, 14222, 14228, 14233, 14240, 14247, 14254, 14259,
+    14265, 14281, 14293, 14299, 14303, 14308, 14315, 14320, 14328, 14336, 14342, 14348,
+    14356, 14364, 14371, 14380, 14390, 14400, 14411, 14418, 14425, 14432, 14437, 14448,
+    14460, 14467, 14479, 14488, 14497, 14505, 14509, 14514, 14518, 14523, 14528, 14533,
+    14538, 14545, 14553, 14558, 14566, 14574, 14582, 14590, 14598, 14604, 14610, 14618,
+    14625, 14634, 14644, 14654, 14665, 14672, 14679, 14686, 14692, 14699, 14705, 14713,
+    14720, 14726, 14733, 14737, 14742, 14749, 14756, 14760, 14765, 14772, 14776, 14783,
+    14793, 14799, 14808, 14815, 14827, 14836, 14843, 14849, 14856, 14862, 14868, 14874,
+    14881, 14890, 14897, 14902, 14907, 14911, 14918, 14925, 14930, 14938, 14943, 14950,
+    14956, 14965, 14978, 14991, 15006, 15016, 15030, 15046, 15053, 15058, 15067, 15075,
+    15081, 15089, 15098, 15103, 15108, 15114, 15121, 15127, 15144, 15162, 15167, 15172,
+    15179, 15184, 15190, 15197, 15203, 15207, 15213, 15220, 15226, 15233, 15237, 15244,
+    15250, 15256, 15262, 15269, 15278, 15285, 15291, 15297, 15301, 15307, 15312, 15320,
+    15332, 15346, 15361, 15367, 15372, 15378, 15386, 15397, 15404, 15413, 15420, 15426,
+    15432, 15437, 15443, 15450, 15455, 15461, 15467, 15472, 15480, 15485, 15490, 15496,
+    15502, 15509, 15520, 15529, 15540, 15547, 15553, 15563, 15568, 15575, 15584, 15597,
+    15611, 15624, 15638, 15647, 15663, 15680, 15684, 15690, 15694, 15701, 15707, 15714,
+    15721, 15726, 15730, 15736, 15742, 15748, 15753, 15759, 15765, 15770, 15777, 15784,
+    15791, 15798, 15806, 15812, 15819, 15825, 15832, 15839, 15843, 15848, 15851, 15854,
+    15861, 15866, 15871, 15877, 15882, 15888, 15892, 15898, 15904, 15907, 15913, 15919,
+    15924, 15929, 15935, 15940, 15947, 15954, 15960, 15966, 15971, 15978, 15985, 15991,
+    15996, 16003, 16010, 16015, 16021, 16025, 16029, 16033, 16038, 16043, 16048, 16053,
+    16058, 16065, 16072, 16076, 16081, 16088, 16093, 16097, 16102, 16110, 16115, 16120,
+    16124,
+};
+
+static const uint32_t html_entity_codepoints[HTML_ENTITY_COUNT] = {
+    0x00C6, 0x0026, 0x00C1, 0x0102, 0x00C2, 0x0410, 0x1D504, 0x00C0, 0x0391, 0x0100,
+    0x2A53, 0x0104, 0x1D538, 0x2061, 0x00C5, 0x1D49C, 0x2254, 0x00C3, 0x00C4, 0x2216,
+    0x2AE7, 0x2306, 0x0411, 0x2235, 0x212C, 0x0392, 0x1D505, 0x1D539, 0x02D8, 0x212C,
+    0x224E, 0x0427, 0x00A9, 0x0106, 0x22D2, 0x2145, 0x212D, 0x010C, 0x00C7, 0x0108,
+    0x2230, 0x010A, 0x00B8, 0x00B7, 0x212D, 0x03A7, 0x2299, 0x2296, 0x2295, 0x2297,
+    0x2232, 0x201D, 0x2019, 0x2237, 0x2A74, 0x2261, 0x222F, 0x222E, 0x2102, 0x2210,
+    0x2233, 0x2A2F, 0x1D49E, 0x22D3, 0x224D, 0x2145, 0x2911, 0x0402, 0x0405, 0x040F,
+    0x2021, 0x21A1, 0x2AE4, 0x010E, 0x0414, 0x2207, 0x0394, 0x1D507, 0x00B4, 0x02D9,
+    0x02DD, 0x0060, 0x02DC, 0x22C4, 0x2146, 0x1D53B, 0x00A8, 0x20DC, 0x2250, 0x222F,
+    0x00A8, 0x21D3, 0x21D0, 0x21D4, 0x2AE4, 0x27F8, 0x27FA, 0x27F9, 0x21D2, 0x22A8,
+    0x21D1, 0x21D5, 0x2225, 0x2193, 0x2913, 0x21F5, 0x0311, 0x2950, 0x295E, 0x21BD,
+    0x2956, 0x295F, 0x21C1, 0x2957, 0x22A4, 0x21A7, 0x21D3, 0x1D49F, 0x0110, 0x014A,
+    0x00D0, 0x00C9, 0x011A, 0x00CA, 0x042D, 0x0116, 0x1D508, 0x00C8, 0x2208, 0x0112,
+    0x25FB, 0x25AB, 0x0118, 0x1D53C, 0x0395, 0x2A75, 0x2242, 0x21CC, 0x2130, 0x2A73,
+    0x0397, 0x00CB, 0x2203, 0x2147, 0x0424, 0x1D509, 0x25FC, 0x25AA, 0x1D53D, 0x2200,
+    0x2131, 0x2131, 0x0403, 0x003E, 0x0393, 0x03DC, 0x011E, 0x0122, 0x011C, 0x0413,
+    0x0120, 0x1D50A, 0x22D9, 0x1D53E, 0x2265, 0x22DB, 0x2267, 0x2AA2, 0x2277, 0x2A7E,
+    0x2273, 0x1D4A2, 0x226B, 0x042A, 0x02C7, 0x005E, 0x0124, 0x210C, 0x210B, 0x210D,
+    0x2500, 0x210B, 0x0126, 0x224E, 0x224F, 0x0415, 0x0132, 0x0401, 0x00CD, 0x00CE,
+    0x0418, 0x0130, 0x2111, 0x00CC, 0x2111, 0x012A, 0x2148, 0x21D2, 0x222C, 0x222B,
+    0x22C2, 0x2063, 0x2062, 0x012E, 0x1D540, 0x0399, 0x2110, 0x0128, 0x0406, 0x00CF,
+    0x0134, 0x0419, 0x1D50D, 0x1D541, 0x1D4A5, 0x0408, 0x0404, 0x0425, 0x040C, 0x039A,
+    0x0136, 0x041A, 0x1D50E, 0x1D542, 0x1D4A6, 0x0409, 0x003C, 0x0139, 0x039B, 0x27EA,
+    0x2112, 0x219E, 0x013D, 0x013B, 0x041B, 0x27E8, 0x2190, 0x21E4, 0x21C6, 0x2308,
+    0x27E6, 0x2961, 0x21C3, 0x2959, 0x230A, 0x2194, 0x294E, 0x22A3, 0x21A4, 0x295A,
+    0x22B2, 0x29CF, 0x22B4, 0x2951, 0x2960, 0x21BF, 0x2958, 0x21BC, 0x2952, 0x21D0,
+    0x21D4, 0x22DA, 0x2266, 0x2276, 0x2AA1, 0x2A7D, 0x2272, 0x1D50F, 0x22D8, 0x21DA,
+    0x013F, 0x27F5, 0x27F7, 0x27F6, 0x27F8, 0x27FA, 0x27F9, 0x1D543, 0x2199, 0x2198,
+    0x2112, 0x21B0, 0x0141, 0x226A, 0x2905, 0x041C, 0x205F, 0x2133, 0x1D510, 0x2213,
+    0x1D544, 0x2133, 0x039C, 0x040A, 0x0143, 0x0147, 0x0145, 0x041D, 0x200B, 0x200B,
+    0x200B, 0x200B, 0x226B, 0x226A, 0x000A, 0x1D511, 0x2060, 0x00A0, 0x2115, 0x2AEC,
+    0x2262, 0x226D, 0x2226, 0x2209, 0x2260, 0x2242, 0x2204, 0x226F, 0x2271, 0x2267,
+    0x226B, 0x2279, 0x2A7E, 0x2275, 0x224E, 0x224F, 0x22EA, 0x29CF, 0x22EC, 0x226E,
+    0x2270, 0x2278, 0x226A, 0x2A7D, 0x2274, 0x2AA2, 0x2AA1, 0x2280, 0x2AAF, 0x22E0,
+    0x220C, 0x22EB, 0x29D0, 0x22ED, 0x228F, 0x22E2, 0x2290, 0x22E3, 0x2282, 0x2288,
+    0x2281, 0x2AB0, 0x22E1, 0x227F, 0x2283, 0x2289, 0x2241, 0x2244, 0x2247, 0x2249,
+    0x2224, 0x1D4A9, 0x00D1, 0x039D, 0x0152, 0x00D3, 0x00D4, 0x041E, 0x0150, 0x1D512,
+    0x00D2, 0x014C, 0x03A9, 0x039F, 0x1D546, 0x201C, 0x2018, 0x2A54, 0x1D4AA, 0x00D8,
+    0x00D5, 0x2A37, 0x00D6, 0x203E, 0x23DE, 0x23B4, 0x23DC, 0x2202, 0x041F, 0x1D513,
+    0x03A6, 0x03A0, 0x00B1, 0x210C, 0x2119, 0x2ABB, 0x227A, 0x2AAF, 0x227C, 0x227E,
+    0x2033, 0x220F, 0x2237, 0x221D, 0x1D4AB, 0x03A8, 0x0022, 0x1D514, 0x211A, 0x1D4AC,
+    0x2910, 0x00AE, 0x0154, 0x27EB, 0x21A0, 0x2916, 0x0158, 0x0156, 0x0420, 0x211C,
+    0x220B, 0x21CB, 0x296F, 0x211C, 0x03A1, 0x27E9, 0x2192, 0x21E5, 0x21C4, 0x2309,
+    0x27E7, 0x295D, 0x21C2, 0x2955, 0x230B, 0x22A2, 0x21A6, 0x295B, 0x22B3, 0x29D0,
+    0x22B5, 0x294F, 0x295C, 0x21BE, 0x2954, 0x21C0, 0x2953, 0x21D2, 0x211D, 0x2970,
+    0x21DB, 0x211B, 0x21B1, 0x29F4, 0x0429, 0x0428, 0x042C, 0x015A, 0x2ABC, 0x0160,
+    0x015E, 0x015C, 0x0421, 0x1D516, 0x2193, 0x2190, 0x2192, 0x2191, 0x03A3, 0x2218,
+    0x1D54A, 0x221A, 0x25A1, 0x2293, 0x228F, 0x2291, 0x2290, 0x2292, 0x2294, 0x1D4AE,
+    0x22C6, 0x22D0, 0x22D0, 0x2286, 0x227B, 0x2AB0, 0x227D, 0x227F, 0x220B, 0x2211,
+    0x22D1, 0x2283, 0x2287, 0x22D1, 0x00DE, 0x2122, 0x040B, 0x0426, 0x0009, 0x03A4,
+    0x0164, 0x0162, 0x0422, 0x1D517, 0x2234, 0x0398, 0x205F, 0x2009, 0x223C, 0x2243,
+    0x2245, 0x2248, 0x1D54B, 0x20DB, 0x1D4AF, 0x0166, 0x00DA, 0x219F, 0x2949, 0x040E,
+    0x016C, 0x00DB, 0x0423, 0x0170, 0x1D518, 0x00D9, 0x016A, 0x005F, 0x23DF, 0x23B5,
+    0x23DD, 0x22C3, 0x228E, 0x0172, 0x1D54C, 0x2191, 0x2912, 0x21C5, 0x2195, 0x296E,
+    0x22A5, 0x21A5, 0x21D1, 0x21D5, 0x2196, 0x2197, 0x03D2, 0x03A5, 0x016E, 0x1D4B0,
+    0x0168, 0x00DC, 0x22AB, 0x2AEB, 0x0412, 0x22A9, 0x2AE6, 0x22C1, 0x2016, 0x2016,
+    0x2223, 0x007C, 0x2758, 0x2240, 0x200A, 0x1D519, 0x1D54D, 0x1D4B1, 0x22AA, 0x0174,
+    0x22C0, 0x1D51A, 0x1D54E, 0x1D4B2, 0x1D51B, 0x039E, 0x1D54F, 0x1D4B3, 0x042F, 0x0407,
+    0x042E, 0x00DD, 0x0176, 0x042B, 0x1D51C, 0x1D550, 0x1D4B4, 0x0178, 0x0416, 0x0179,
+    0x017D, 0x0417, 0x017B, 0x200B, 0x0396, 0x2128, 0x2124, 0x1D4B5, 0x00E1, 0x0103,
+    0x223E, 0x223E, 0x223F, 0x00E2, 0x00B4, 0x0430, 0x00E6, 0x2061, 0x1D51E, 0x00E0,
+    0x2135, 0x2135, 0x03B1, 0x0101, 0x2A3F, 0x0026, 0x2227, 0x2A55, 0x2A5C, 0x2A58,
+    0x2A5A, 0x2220, 0x29A4, 0x2220, 0x2221, 0x29A8, 0x29A9, 0x29AA, 0x29AB, 0x29AC,
+    0x29AD, 0x29AE, 0x29AF, 0x221F, 0x22BE, 0x299D, 0x2222, 0x00C5, 0x237C, 0x0105,
+    0x1D552, 0x2248, 0x2A70, 0x2A6F, 0x224A, 0x224B, 0x0027, 0x2248, 0x224A, 0x00E5,
+    0x1D4B6, 0x002A, 0x2248, 0x224D, 0x00E3, 0x00E4, 0x2233, 0x2A11, 0x2AED, 0x224C,
+    0x03F6, 0x2035, 0x223D, 0x22CD, 0x22BD, 0x2305, 0x2305, 0x23B5, 0x23B6, 0x224C,
+    0x0431, 0x201E, 0x2235, 0x2235, 0x29B0, 0x03F6, 0x212C, 0x03B2, 0x2136, 0x226C,
+    0x1D51F, 0x22C2, 0x25EF, 0x22C3, 0x2A00, 0x2A01, 0x2A02, 0x2A06, 0x2605, 0x25BD,
+    0x25B3, 0x2A04, 0x22C1, 0x22C0, 0x290D, 0x29EB, 0x25AA, 0x25B4, 0x25BE, 0x25C2,
+    0x25B8, 0x2423, 0x2592, 0x2591, 0x2593, 0x2588, 0x003D, 0x2261, 0x2310, 0x1D553,
+    0x22A5, 0x22A5, 0x22C8, 0x2557, 0x2554, 0x2556, 0x2553, 0x2550, 0x2566, 0x2569,
+    0x2564, 0x2567, 0x255D, 0x255A, 0x255C, 0x2559, 0x2551, 0x256C, 0x2563, 0x2560,
+    0x256B, 0x2562, 0x255F, 0x29C9, 0x2555, 0x2552, 0x2510, 0x250C, 0x2500, 0x2565,
+    0x2568, 0x252C, 0x2534, 0x229F, 0x229E, 0x22A0, 0x255B, 0x2558, 0x2518, 0x2514,
+    0x2502, 0x256A, 0x2561, 0x255E, 0x253C, 0x2524, 0x251C, 0x2035, 0x02D8, 0x00A6,
+    0x1D4B7, 0x204F, 0x223D, 0x22CD, 0x005C, 0x29C5, 0x27C8, 0x2022, 0x2022, 0x224E,
+    0x2AAE, 0x224F, 0x224F, 0x0107, 0x2229, 0x2A44, 0x2A49, 0x2A4B, 0x2A47, 0x2A40,
+    0x2229, 0x2041, 0x02C7, 0x2A4D, 0x010D, 0x00E7, 0x0109, 0x2A4C, 0x2A50, 0x010B,
+    0x00B8, 0x29B2, 0x00A2, 0x00B7, 0x1D520, 0x0447, 0x2713, 0x2713, 0x03C7, 0x25CB,
+    0x29C3, 0x02C6, 0x2257, 0x21BA, 0x21BB, 0x00AE, 0x24C8, 0x229B, 0x229A, 0x229D,
+    0x2257, 0x2A10, 0x2AEF, 0x29C2, 0x2663, 0x2663, 0x003A, 0x2254, 0x2254, 0x002C,
+    0x0040, 0x2201, 0x2218, 0x2201, 0x2102, 0x2245, 0x2A6D, 0x222E, 0x1D554, 0x2210,
+    0x00A9, 0x2117, 0x21B5, 0x2717, 0x1D4B8, 0x2ACF, 0x2AD1, 0x2AD0, 0x2AD2, 0x22EF,
+    0x2938, 0x2935, 0x22DE, 0x22DF, 0x21B6, 0x293D, 0x222A, 0x2A48, 0x2A46, 0x2A4A,
+    0x228D, 0x2A45, 0x222A, 0x21B7, 0x293C, 0x22DE, 0x22DF, 0x22CE, 0x22CF, 0x00A4,
+    0x21B6, 0x21B7, 0x22CE, 0x22CF, 0x2232, 0x2231, 0x232D, 0x21D3, 0x2965, 0x2020,
+    0x2138, 0x2193, 0x2010, 0x22A3, 0x290F, 0x02DD, 0x010F, 0x0434, 0x2146, 0x2021,
+    0x21CA, 0x2A77, 0x00B0, 0x03B4, 0x29B1, 0x297F, 0x1D521, 0x21C3, 0x21C2, 0x22C4,
+    0x22C4, 0x2666, 0x2666, 0x00A8, 0x03DD, 0x22F2, 0x00F7, 0x00F7, 0x22C7, 0x22C7,
+    0x0452, 0x231E, 0x230D, 0x0024, 0x1D555, 0x02D9, 0x2250, 0x2251, 0x2238, 0x2214,
+    0x22A1, 0x2306, 0x2193, 0x21CA, 0x21C3, 0x21C2, 0x2910, 0x231F, 0x230C, 0x1D4B9,
+    0x0455, 0x29F6, 0x0111, 0x22F1, 0x25BF, 0x25BE, 0x21F5, 0x296F, 0x29A6, 0x045F,
+    0x27FF, 0x2A77, 0x2251, 0x00E9, 0x2A6E, 0x011B, 0x2256, 0x00EA, 0x2255, 0x044D,
+    0x0117, 0x2147, 0x2252, 0x1D522, 0x2A9A, 0x00E8, 0x2A96, 0x2A98, 0x2A99, 0x23E7,
+    0x2113, 0x2A95, 0x2A97, 0x0113, 0x2205, 0x2205, 0x2205, 0x2003, 0x2004, 0x2005,
+    0x014B, 0x2002, 0x0119, 0x1D556, 0x22D5, 0x29E3, 0x2A71, 0x03B5, 0x03B5, 0x03F5,
+    0x2256, 0x2255, 0x2242, 0x2A96, 0x2A95, 0x003D, 0x225F, 0x2261, 0x2A78, 0x29E5,
+    0x2253, 0x2971, 0x212F, 0x2250, 0x2242, 0x03B7, 0x00F0, 0x00EB, 0x20AC, 0x0021,
+    0x2203, 0x2130, 0x2147, 0x2252, 0x0444, 0x2640, 0xFB03, 0xFB00, 0xFB04, 0x1D523,
+    0xFB01, 0x0066, 0x266D, 0xFB02, 0x25B1, 0x0192, 0x1D557, 0x2200, 0x22D4, 0x2AD9,
+    0x2A0D, 0x00BD, 0x2153, 0x00BC, 0x2155, 0x2159, 0x215B, 0x2154, 0x2156, 0x00BE,
+    0x2157, 0x215C, 0x2158, 0x215A, 0x215D, 0x215E, 0x2044, 0x2322, 0x1D4BB, 0x2267,
+    0x2A8C, 0x01F5, 0x03B3, 0x03DD, 0x2A86, 0x011F, 0x011D, 0x0433, 0x0121, 0x2265,
+    0x22DB, 0x2265, 0x2267, 0x2A7E, 0x2A7E, 0x2AA9, 0x2A80, 0x2A82, 0x2A84, 0x22DB,
+    0x2A94, 0x1D524, 0x226B, 0x22D9, 0x2137, 0x0453, 0x2277, 0x2A92, 0x2AA5, 0x2AA4,
+    0x2269, 0x2A8A, 0x2A8A, 0x2A88, 0x2A88, 0x2269, 0x22E7, 0x1D558, 0x0060, 0x210A,
+    0x2273, 0x2A8E, 0x2A90, 0x003E, 0x2AA7, 0x2A7A, 0x22D7, 0x2995, 0x2A7C, 0x2A86,
+    0x2978, 0x22D7, 0x22DB, 0x2A8C, 0x2277, 0x2273, 0x2269, 0x2269, 0x21D4, 0x200A,
+    0x00BD, 0x210B, 0x044A, 0x2194, 0x2948, 0x21AD, 0x210F, 0x0125, 0x2665, 0x2665,
+    0x2026, 0x22B9, 0x1D525, 0x2925, 0x2926, 0x21FF, 0x223B, 0x21A9, 0x21AA, 0x1D559,
+    0x2015, 0x1D4BD, 0x210F, 0x0127, 0x2043, 0x2010, 0x00ED, 0x2063, 0x00EE, 0x0438,
+    0x0435, 0x00A1, 0x21D4, 0x1D526, 0x00EC, 0x2148, 0x2A0C, 0x222D, 0x29DC, 0x2129,
+    0x0133, 0x012B, 0x2111, 0x2110, 0x2111, 0x0131, 0x22B7, 0x01B5, 0x2208, 0x2105,
+    0x221E, 0x29DD, 0x0131, 0x222B, 0x22BA, 0x2124, 0x22BA, 0x2A17, 0x2A3C, 0x0451,
+    0x012F, 0x1D55A, 0x03B9, 0x2A3C, 0x00BF, 0x1D4BE, 0x2208, 0x22F9, 0x22F5, 0x22F4,
+    0x22F3, 0x2208, 0x2062, 0x0129, 0x0456, 0x00EF, 0x0135, 0x0439, 0x1D527, 0x0237,
+    0x1D55B, 0x1D4BF, 0x0458, 0x0454, 0x03BA, 0x03F0, 0x0137, 0x043A, 0x1D528, 0x0138,
+    0x0445, 0x045C, 0x1D55C, 0x1D4C0, 0x21DA, 0x21D0, 0x291B, 0x290E, 0x2266, 0x2A8B,
+    0x2962, 0x013A, 0x29B4, 0x2112, 0x03BB, 0x27E8, 0x2991, 0x27E8, 0x2A85, 0x00AB,
+    0x2190, 0x21E4, 0x291F, 0x291D, 0x21A9, 0x21AB, 0x2939, 0x2973, 0x21A2, 0x2AAB,
+    0x2919, 0x2AAD, 0x2AAD, 0x290C, 0x2772, 0x007B, 0x005B, 0x298B, 0x298F, 0x298D,
+    0x013E, 0x013C, 0x2308, 0x007B, 0x043B, 0x2936, 0x201C, 0x201E, 0x2967, 0x294B,
+    0x21B2, 0x2264, 0x2190, 0x21A2, 0x21BD, 0x21BC, 0x21C7, 0x2194, 0x21C6, 0x21CB,
+    0x21AD, 0x22CB, 0x22DA, 0x2264, 0x2266, 0x2A7D, 0x2A7D, 0x2AA8, 0x2A7F, 0x2A81,
+    0x2A83, 0x22DA, 0x2A93, 0x2A85, 0x22D6, 0x22DA, 0x2A8B, 0x2276, 0x2272, 0x297C,
+    0x230A, 0x1D529, 0x2276, 0x2A91, 0x21BD, 0x21BC, 0x296A, 0x2584, 0x0459, 0x226A,
+    0x21C7, 0x231E, 0x296B, 0x25FA, 0x0140, 0x23B0, 0x23B0, 0x2268, 0x2A89, 0x2A89,
+    0x2A87, 0x2A87, 0x2268, 0x22E6, 0x27EC, 0x21FD, 0x27E6, 0x27F5, 0x27F7, 0x27FC,
+    0x27F6, 0x21AB, 0x21AC, 0x2985, 0x1D55D, 0x2A2D, 0x2A34, 0x2217, 0x005F, 0x25CA,
+    0x25CA, 0x29EB, 0x0028, 0x2993, 0x21C6, 0x231F, 0x21CB, 0x296D, 0x200E, 0x22BF,
+    0x2039, 0x1D4C1, 0x21B0, 0x2272, 0x2A8D, 0x2A8F, 0x005B, 0x2018, 0x201A, 0x0142,
+    0x003C, 0x2AA6, 0x2A79, 0x22D6, 0x22CB, 0x22C9, 0x2976, 0x2A7B, 0x2996, 0x25C3,
+    0x22B4, 0x25C2, 0x294A, 0x2966, 0x2268, 0x2268, 0x223A, 0x00AF, 0x2642, 0x2720,
+    0x2720, 0x21A6, 0x21A6, 0x21A7, 0x21A4, 0x21A5, 0x25AE, 0x2A29, 0x043C, 0x2014,
+    0x2221, 0x1D52A, 0x2127, 0x00B5, 0x2223, 0x002A, 0x2AF0, 0x00B7, 0x2212, 0x229F,
+    0x2238, 0x2A2A, 0x2ADB, 0x2026, 0x2213, 0x22A7, 0x1D55E, 0x2213, 0x1D4C2, 0x223E,
+    0x03BC, 0x22B8, 0x22B8, 0x22D9, 0x226B, 0x226B, 0x21CD, 0x21CE, 0x22D8, 0x226A,
+    0x226A, 0x21CF, 0x22AF, 0x22AE, 0x2207, 0x0144, 0x2220, 0x2249, 0x2A70, 0x224B,
+    0x0149, 0x2249, 0x266E, 0x266E, 0x2115, 0x00A0, 0x224E, 0x224F, 0x2A43, 0x0148,
+    0x0146, 0x2247, 0x2A6D, 0x2A42, 0x043D, 0x2013, 0x2260, 0x21D7, 0x2924, 0x2197,
+    0x2197, 0x2250, 0x2262, 0x2928, 0x2242, 0x2204, 0x2204, 0x1D52B, 0x2267, 0x2271,
+    0x2271, 0x2267, 0x2A7E, 0x2A7E, 0x2275, 0x226F, 0x226F, 0x21CE, 0x21AE, 0x2AF2,
+    0x220B, 0x22FC, 0x22FA, 0x220B, 0x045A, 0x21CD, 0x2266, 0x219A, 0x2025, 0x2270,
+    0x219A, 0x21AE, 0x2270, 0x2266, 0x2A7D, 0x2A7D, 0x226E, 0x2274, 0x226E, 0x22EA,
+    0x22EC, 0x2224, 0x1D55F, 0x00AC, 0x2209, 0x22F9, 0x22F5, 0x2209, 0x22F7, 0x22F6,
+    0x220C, 0x220C, 0x22FE, 0x22FD, 0x2226, 0x2226, 0x2AFD, 0x2202, 0x2A14, 0x2280,
+    0x22E0, 0x2AAF, 0x2280, 0x2AAF, 0x21CF, 0x219B, 0x2933, 0x219D, 0x219B, 0x22EB,
+    0x22ED, 0x2281, 0x22E1, 0x2AB0, 0x1D4C3, 0x2224, 0x2226, 0x2241, 0x2244, 0x2244,
+    0x2224, 0x2226, 0x22E2, 0x22E3, 0x2284, 0x2AC5, 0x2288, 0x2282, 0x2288, 0x2AC5,
+    0x2281, 0x2AB0, 0x2285, 0x2AC6, 0x2289, 0x2283, 0x2289, 0x2AC6, 0x2279, 0x00F1,
+    0x2278, 0x22EA, 0x22EC, 0x22EB, 0x22ED, 0x03BD, 0x0023, 0x2116, 0x2007, 0x22AD,
+    0x2904, 0x224D, 0x22AC, 0x2265, 0x003E, 0x29DE, 0x2902, 0x2264, 0x003C, 0x22B4,
+    0x2903, 0x22B5, 0x223C, 0x21D6, 0x2923, 0x2196, 0x2196, 0x2927, 0x24C8, 0x00F3,
+    0x229B, 0x229A, 0x00F4, 0x043E, 0x229D, 0x0151, 0x2A38, 0x2299, 0x29BC, 0x0153,
+    0x29BF, 0x1D52C, 0x02DB, 0x00F2, 0x29C1, 0x29B5, 0x03A9, 0x222E, 0x21BA, 0x29BE,
+    0x29BB, 0x203E, 0x29C0, 0x014D, 0x03C9, 0x03BF, 0x29B6, 0x2296, 0x1D560, 0x29B7,
+    0x29B9, 0x2295, 0x2228, 0x21BB, 0x2A5D, 0x2134, 0x2134, 0x00AA, 0x00BA, 0x22B6,
+    0x2A56, 0x2A57, 0x2A5B, 0x2134, 0x00F8, 0x2298, 0x00F5, 0x2297, 0x2A36, 0x00F6,
+    0x233D, 0x2225, 0x00B6, 0x2225, 0x2AF3, 0x2AFD, 0x2202, 0x043F, 0x0025, 0x002E,
+    0x2030, 0x22A5, 0x2031, 0x1D52D, 0x03C6, 0x03D5, 0x2133, 0x260E, 0x03C0, 0x22D4,
+    0x03D6, 0x210F, 0x210E, 0x210F, 0x002B, 0x2A23, 0x229E, 0x2A22, 0x2214, 0x2A25,
+    0x2A72, 0x00B1, 0x2A26, 0x2A27, 0x00B1, 0x2A15, 0x1D561, 0x00A3, 0x227A, 0x2AB3,
+    0x2AB7, 0x227C, 0x2AAF, 0x227A, 0x2AB7, 0x227C, 0x2AAF, 0x2AB9, 0x2AB5, 0x22E8,
+    0x227E, 0x2032, 0x2119, 0x2AB5, 0x2AB9, 0x22E8, 0x220F, 0x232E, 0x2312, 0x2313,
+    0x221D, 0x221D, 0x227E, 0x22B0, 0x1D4C5, 0x03C8, 0x2008, 0x1D52E, 0x2A0C, 0x1D562,
+    0x2057, 0x1D4C6, 0x210D, 0x2A16, 0x003F, 0x225F, 0x0022, 0x21DB, 0x21D2, 0x291C,
+    0x290F, 0x2964, 0x223D, 0x0155, 0x221A, 0x29B3, 0x27E9, 0x2992, 0x29A5, 0x27E9,
+    0x00BB, 0x2192, 0x2975, 0x21E5, 0x2920, 0x2933, 0x291E, 0x21AA, 0x21AC, 0x2945,
+    0x2974, 0x21A3, 0x219D, 0x291A, 0x2236, 0x211A, 0x290D, 0x2773, 0x007D, 0x005D,
+    0x298C, 0x298E, 0x2990, 0x0159, 0x0157, 0x2309, 0x007D, 0x0440, 0x2937, 0x2969,
+    0x201D, 0x201D, 0x21B3, 0x211C, 0x211B, 0x211C, 0x211D, 0x25AD, 0x00AE, 0x297D,
+    0x230B, 0x1D52F, 0x21C1, 0x21C0, 0x296C, 0x03C1, 0x03F1, 0x2192, 0x21A3, 0x21C1,
+    0x21C0, 0x21C4, 0x21CC, 0x21C9, 0x219D, 0x22CC, 0x02DA, 0x2253, 0x21C4, 0x21CC,
+    0x200F, 0x23B1, 0x23B1, 0x2AEE, 0x27ED, 0x21FE, 0x27E7, 0x2986, 0x1D563, 0x2A2E,
+    0x2A35, 0x0029, 0x2994, 0x2A12, 0x21C9, 0x203A, 0x1D4C7, 0x21B1, 0x005D, 0x2019,
+    0x2019, 0x22CC, 0x22CA, 0x25B9, 0x22B5, 0x25B8, 0x29CE, 0x2968, 0x211E, 0x015B,
+    0x201A, 0x227B, 0x2AB4, 0x2AB8, 0x0161, 0x227D, 0x2AB0, 0x015F, 0x015D, 0x2AB6,
+    0x2ABA, 0x22E9, 0x2A13, 0x227F, 0x0441, 0x22C5, 0x22A1, 0x2A66, 0x21D8, 0x2925,
+    0x2198, 0x2198, 0x00A7, 0x003B, 0x2929, 0x2216, 0x2216, 0x2736, 0x1D530, 0x2322,
+    0x266F, 0x0449, 0x0448, 0x2223, 0x2225, 0x00AD, 0x03C3, 0x03C2, 0x03C2, 0x223C,
+    0x2A6A, 0x2243, 0x2243, 0x2A9E, 0x2AA0, 0x2A9D, 0x2A9F, 0x2246, 0x2A24, 0x2972,
+    0x2190, 0x2216, 0x2A33, 0x29E4, 0x2223, 0x2323, 0x2AAA, 0x2AAC, 0x2AAC, 0x044C,
+    0x002F, 0x29C4, 0x233F, 0x1D564, 0x2660, 0x2660, 0x2225, 0x2293, 0x2293, 0x2294,
+    0x2294, 0x228F, 0x2291, 0x228F, 0x2291, 0x2290, 0x2292, 0x2290, 0x2292, 0x25A1,
+    0x25A1, 0x25AA, 0x25AA, 0x2192, 0x1D4C8, 0x2216, 0x2323, 0x22C6, 0x2606, 0x2605,
+    0x03F5, 0x03D5, 0x00AF, 0x2282, 0x2AC5, 0x2ABD, 0x2286, 0x2AC3, 0x2AC1, 0x2ACB,
+    0x228A, 0x2ABF, 0x2979, 0x2282, 0x2286, 0x2AC5, 0x228A, 0x2ACB, 0x2AC7, 0x2AD5,
+    0x2AD3, 0x227B, 0x2AB8, 0x227D, 0x2AB0, 0x2ABA, 0x2AB6, 0x22E9, 0x227F, 0x2211,
+    0x266A, 0x2283, 0x00B9, 0x00B2, 0x00B3, 0x2AC6, 0x2ABE, 0x2AD8, 0x2287, 0x2AC4,
+    0x27C9, 0x2AD7, 0x297B, 0x2AC2, 0x2ACC, 0x228B, 0x2AC0, 0x2283, 0x2287, 0x2AC6,
+    0x228B, 0x2ACC, 0x2AC8, 0x2AD4, 0x2AD6, 0x21D9, 0x2926, 0x2199, 0x2199, 0x292A,
+    0x00DF, 0x2316, 0x03C4, 0x23B4, 0x0165, 0x0163, 0x0442, 0x20DB, 0x2315, 0x1D531,
+    0x2234, 0x2234, 0x03B8, 0x03D1, 0x03D1, 0x2248, 0x223C, 0x2009, 0x2248, 0x223C,
+    0x00FE, 0x02DC, 0x00D7, 0x22A0, 0x2A31, 0x2A30, 0x222D, 0x2928, 0x22A4, 0x2336,
+    0x2AF1, 0x1D565, 0x2ADA, 0x2929, 0x2034, 0x2122, 0x25B5, 0x25BF, 0x25C3, 0x22B4,
+    0x225C, 0x25B9, 0x22B5, 0x25EC, 0x225C, 0x2A3A, 0x2A39, 0x29CD, 0x2A3B, 0x23E2,
+    0x1D4C9, 0x0446, 0x045B, 0x0167, 0x226C, 0x219E, 0x21A0, 0x21D1, 0x2963, 0x00FA,
+    0x2191, 0x045E, 0x016D, 0x00FB, 0x0443, 0x21C5, 0x0171, 0x296E, 0x297E, 0x1D532,
+    0x00F9, 0x21BF, 0x21BE, 0x2580, 0x231C, 0x231C, 0x230F, 0x25F8, 0x016B, 0x00A8,
+    0x0173, 0x1D566, 0x2191, 0x2195, 0x21BF, 0x21BE, 0x228E, 0x03C5, 0x03D2, 0x03C5,
+    0x21C8, 0x231D, 0x231D, 0x230E, 0x016F, 0x25F9, 0x1D4CA, 0x22F0, 0x0169, 0x25B5,
+    0x25B4, 0x21C8, 0x00FC, 0x29A7, 0x21D5, 0x2AE8, 0x2AE9, 0x22A8, 0x299C, 0x03F5,
+    0x03F0, 0x2205, 0x03D5, 0x03D6, 0x221D, 0x2195, 0x03F1, 0x03C2, 0x228A, 0x2ACB,
+    0x228B, 0x2ACC, 0x03D1, 0x22B2, 0x22B3, 0x0432, 0x22A2, 0x2228, 0x22BB, 0x225A,
+    0x22EE, 0x007C, 0x007C, 0x1D533, 0x22B2, 0x2282, 0x2283, 0x1D567, 0x221D, 0x22B3,
+    0x1D4CB, 0x2ACB, 0x228A, 0x2ACC, 0x228B, 0x299A, 0x0175, 0x2A5F, 0x2227, 0x2259,
+    0x2118, 0x1D534, 0x1D568, 0x2118, 0x2240, 0x2240, 0x1D4CC, 0x22C2, 0x25EF, 0x22C3,
+    0x25BD, 0x1D535, 0x27FA, 0x27F7, 0x03BE, 0x27F8, 0x27F5, 0x27FC, 0x22FB, 0x2A00,
+    0x1D569, 0x2A01, 0x2A02, 0x27F9, 0x27F6, 0x1D4CD, 0x2A06, 0x2A04, 0x25B3, 0x22C1,
+    0x22C0, 0x00FD, 0x044F, 0x0177, 0x044B, 0x00A5, 0x1D536, 0x0457, 0x1D56A, 0x1D4CE,
+    0x044E, 0x00FF, 0x017A, 0x017E, 0x0437, 0x017C, 0x2128, 0x03B6, 0x1D537, 0x0436,
+    0x21DD, 0x1D56B, 0x1D4CF, 0x200D, 0x200C,
+};
+
+static const uint16_t html_entity_displacements[HTML_ENTITY_BUCKETS] = {
+    5, 1, 6, 1, 7, 20, 1, 11, 9, 2, 1, 2,
+    2, 18, 2, 3, 11, 10, 5, 7, 1, 0, 18, 2,
+    2, 3, 6, 1, 1, 1, 1, 1, 6, 2, 15, 2,
+    1, 2, 8, 5, 2, 8, 9, 6, 4, 9, 4, 5,
+    6, 6, 1, 2, 2, 7, 2, 1, 3, 1, 3, 1,
+    1, 3, 3, 3, 1, 2, 5, 16, 8, 0, 13, 4,
+    1, 4, 10, 4, 0, 5, 2, 7, 8, 16, 6, 1,
+    15, 2, 4, 16, 2, 2, 2, 4, 8, 4, 6, 4,
+    14, 1, 1, 1, 2, 2, 14, 8, 13, 2, 9, 1,
+    2, 1, 4, 3, 2, 2, 17, 4, 5, 8, 4, 1,
+    5, 0, 1, 5, 13, 6, 4, 15, 1, 1, 1, 1,
+    3, 3, 4, 2, 1, 1, 2, 32, 1, 9, 1, 15,
+    3, 5, 1, 0, 65, 2, 1, 4, 3, 1, 12, 6,
+    5, 1, 2, 9, 9, 5, 3, 17, 6, 8, 13, 6,
+    2, 6, 3, 2, 4, 2, 14, 6, 15, 1, 1, 4,
+    2, 4, 46, 2, 0, 1, 7, 3, 18, 3, 6, 6,
+    2, 3, 6, 1, 1, 3, 2, 4, 5, 11, 3, 16,
+    1, 2, 5, 19, 7, 3, 1, 4, 6, 2, 19, 5,
+    1, 0, 1, 4, 0, 2, 1, 1, 2, 11, 8, 0,
+    4, 5, 17, 2, 18, 1, 2, 17, 5, 4, 0, 5,
+    1, 16, 27, 4, 2, 32, 3, 12, 2, 1, 13, 3,
+    16, 1, 3, 13, 7, 1, 1, 3, 11, 0, 1, 19,
+    13, 1, 3, 0, 2, 2, 10, 1, 20, 12, 1, 0,
+    13, 3, 12, 5, 41, 14, 1, 6, 5, 9, 10, 1,
+    8, 5, 3, 9, 0, 1, 11, 3, 3, 1, 1, 8,
+    0, 2, 2, 1, 46, 7, 18, 1, 18, 18, 5, 0,
+    1, 15, 2, 4, 7, 7, 1, 2, 3, 0, 29, 4,
+    0, 5, 17, 4, 4, 1, 1, 23, 34, 11, 2, 13,
+    5, 7, 4, 9, 27, 1, 1, 1, 2, 6, 14, 4,
+    3, 10, 0, 1, 1, 2, 4, 3, 7, 2, 20, 24,
+    2, 3, 24, 6, 5, 11, 19, 3, 17, 21, 4, 0,
+    2, 6, 15, 17, 8, 4, 11, 12, 3, 11, 6, 1,
+    44, 36, 0, 2, 1, 2, 2, 5, 7, 7, 9, 2,
+    4, 4, 3, 5, 2, 20, 5, 7, 0, 17, 8, 4,
+    1, 1, 1, 0, 8, 0, 16, 3, 7, 3, 1, 5,
+    32, 0, 23, 0, 6, 2, 11, 1, 56, 13, 15, 18,
+    5, 7, 6, 13, 11, 1, 1, 3, 1, 18, 35, 5,
+    7, 1, 3, 1, 14, 2, 8, 25, 12, 2, 3, 25,
+    23, 20, 12, 14, 1, 3, 6, 1, 4, 5, 3, 1,
+    6, 1, 4, 1, 6, 8, 9, 1, 3, 2, 10, 12,
+    1, 1, 0, 8, 0, 21, 1, 4, 6, 33, 25, 2,
+    3, 4, 1, 14, 11, 6, 2, 0, 2, 1, 10, 15,
+    4, 5, 2, 19, 4, 2, 14, 20, 30, 18, 1, 2,
+    10, 0, 2, 3, 3, 4, 3, 20, 3, 4, 5, 6,
+    29, 13, 0, 4, 6, 14, 2, 16, 9, 1, 14, 5,
+    0, 8, 28, 1, 1, 10, 1, 4, 7, 9, 9, 3,
+    8, 3, 7, 1, 20, 54, 3, 21, 2, 4, 23, 5,
+    2, 10, 9, 1, 3, 2, 4, 1, 5, 3, 3, 4,
+    2, 10, 34, 23, 13, 0, 15, 12, 15, 12, 2, 29,
+    14, 14, 6, 2, 5, 1, 5, 12, 4, 48, 10, 3,
+    0, 5, 2, 7, 20, 0, 12, 4, 0, 1, 5, 1,
+    3, 5, 0, 23, 21, 2, 17, 5, 16, 1, 13, 1,
+    12, 12, 4, 31, 3, 12, 2, 10, 0, 46, 1, 1,
+    3, 4, 8, 17, 16, 9, 4, 8, 43, 13, 4, 6,
+    47, 1, 12, 68, 23, 3, 1, 3, 0, 16, 2, 0,
+    2, 7, 41, 1, 2, 1, 18, 23, 12, 4, 23, 1,
+    0, 43, 14, 7, 11, 18, 21, 2, 9, 10, 66, 29,
+    2, 3, 13, 2, 41, 5, 6, 4, 7, 0, 7, 58,
+    34, 5, 12, 12, 41, 4, 2, 9, 9, 1, 1, 12,
+    5,
+};
+
+static const uint16_t html_entity_slots[HTML_ENTITY_SLOTS] = {
+    0xFFFF, 966, 1612, 664, 502, 1084, 1655, 1547, 1888, 1845, 170, 1021,
+    0xFFFF, 0xFFFF, 109, 0xFFFF, 2018, 213, 0xFFFF, 1930, 176, 0xFFFF, 1258, 0xFFFF,
+    1675, 1773, 2034, 1068, 703, 1709, 889, 1985, 798, 789, 1518, 2016,
+    927, 1881, 198, 0xFFFF, 2071, 1580, 0xFFFF, 1079, 1207, 194, 1173, 2006,
+    1080, 874, 1901, 931, 0xFFFF, 864, 0xFFFF, 857, 601, 707, 0xFFFF, 0xFFFF,
+    0xFFFF, 574, 475, 1855, 1185, 63, 1621, 0xFFFF, 649, 1348, 2002, 487,
+    278, 0xFFFF, 1027, 1077, 2051, 1559, 1999, 1409, 1255, 1594, 552, 0xFFFF,
+    989, 1578, 581, 443, 1223, 1069, 2104, 0xFFFF, 947, 0xFFFF, 302, 755,
+    1795, 1432, 901, 0xFFFF, 0xFFFF, 866, 95, 1582, 0xFFFF, 0xFFFF, 1586, 784,
+    1520, 1826, 504, 958, 0xFFFF, 1553, 0xFFFF, 859, 0xFFFF, 0xFFFF, 506, 1684,
+    1460, 2123, 0xFFFF, 1736, 369, 1005, 0xFFFF, 698, 378, 1601, 1775, 1790,
+    715, 404, 0xFFFF, 314, 2094, 0xFFFF, 814, 1211, 1918, 705, 84, 1305,
+    0xFFFF, 2045, 0xFFFF, 1067, 654, 0xFFFF, 1497, 352, 0xFFFF, 0xFFFF, 164, 1010,
+    141, 765, 1234, 142, 494, 167, 961, 0xFFFF, 0xFFFF, 1203, 1030, 419,
+    268, 1454, 825, 1686, 0xFFFF, 963, 490, 0xFFFF, 482, 446, 0xFFFF, 0xFFFF,
+    1593, 1090, 0xFFFF, 85, 777, 1719, 1824, 1631, 493, 1050, 2038, 1813,
+    0xFFFF, 515, 0xFFFF, 2076, 0xFFFF, 1741, 739, 120, 0xFFFF, 1692, 1765, 1130,
+    2099, 1323, 514, 888, 661, 0xFFFF, 1007, 975, 145, 0xFFFF, 0xFFFF, 1626,
+    1962, 212, 0xFFFF, 82, 0xFFFF, 1738, 907, 1632, 1842, 0xFFFF, 1577, 1558,
+    1457, 452, 1964, 1279, 0xFFFF, 1846, 0xFFFF, 1687, 1254, 0xFFFF, 0xFFFF, 2111,
+    481, 204, 1902, 453, 810, 123, 2014, 1184, 1893, 0xFFFF, 232, 0xFFFF,
+    979, 0xFFFF, 957, 267, 1099, 576, 588, 1987, 858, 330, 1874, 1393,
+    696, 1921, 1236, 1023, 74, 1281, 1590, 1729, 1086, 1924, 0xFFFF, 0xFFFF,
+    836, 2030, 0xFFFF, 912, 1140, 1252, 1920, 172, 0xFFFF, 1412, 0xFFFF, 853,
+    1539, 236, 1597, 1896, 0xFFFF, 0xFFFF, 822, 587, 83, 459, 505, 1803,
+    575, 428, 0xFFFF, 0xFFFF, 1711, 880, 1139, 1723, 1957, 0xFFFF, 1121, 619,
+    0xFFFF, 730, 312, 1171, 273, 498, 1377, 1274, 1402, 579, 1268, 0xFFFF,
+    1427, 0xFFFF, 1161, 916, 127, 1616, 1020, 598, 1025, 1665, 718, 591,
+    321, 408, 0xFFFF, 699, 1690, 1043, 565, 1591, 1639, 1226, 646, 613,
+    54, 2064, 0xFFFF, 937, 668, 77, 1075, 0xFFFF, 941, 0xFFFF, 1796, 0xFFFF,
+    0xFFFF, 1390, 0xFFFF, 1087, 919, 2029, 1809, 0xFFFF, 1527, 1798, 0xFFFF, 456,
+    14, 171, 652, 0xFFFF, 1799, 700, 1882, 748, 0xFFFF, 154, 0xFFFF, 0xFFFF,
+    1972, 1154, 1818, 39, 465, 0xFFFF, 2056, 1083, 1052, 205, 2080, 1291,
+    969, 26, 0xFFFF, 1044, 1764, 0xFFFF, 983, 0xFFFF, 118, 1854, 1195, 1089,
+    1757, 1442, 121, 203, 1332, 543, 1277, 531, 751, 1119, 1434, 1834,
+    0xFFFF, 1490, 1339, 1061, 865, 0xFFFF, 665, 122, 365, 0xFFFF, 296, 1617,
+    347, 1202, 1531, 904, 1780, 1257, 1470, 0xFFFF, 66, 1589, 1217, 0xFFFF,
+    1310, 93, 1567, 0xFFFF, 1314, 1294, 0xFFFF, 0xFFFF, 364, 1327, 1534, 0xFFFF,
+    894, 1507, 1725, 1678, 399, 407, 1650, 611, 0xFFFF, 818, 1595, 651,
+    1715, 1031, 1922, 426, 1057, 179, 1476, 0xFFFF, 1977, 113, 710, 0xFFFF,
+    1515, 0xFFFF, 0xFFFF, 220, 1512, 610, 834, 111, 831, 1459, 389, 1703,
+    663, 200, 1283, 0xFFFF, 736, 1816, 0xFFFF, 224, 0xFFFF, 0xFFFF, 1047, 1587,
+    1221, 0xFFFF, 981, 1889, 1852, 0xFFFF, 192, 577, 97, 1688, 250, 146,
+    978, 133, 147, 1278, 1689, 1722, 685, 0xFFFF, 9, 674, 1028, 568,
+    1522, 238, 87, 264, 0xFFFF, 1333, 375, 1560, 1530, 1862, 1344, 1700,
+    1683, 106, 945, 1963, 1032, 1975, 1230, 0xFFFF, 387, 1638, 168, 277,
+    0xFFFF, 1637, 1419, 799, 1168, 1949, 508, 75, 2043, 787, 1243, 1768,
+    741, 0xFFFF, 0xFFFF, 1396, 492, 573, 450, 1760, 386, 129, 398, 535,
+    0xFFFF, 0xFFFF, 1908, 1429, 8, 1989, 734, 1695, 1040, 98, 189, 0xFFFF,
+    1209, 1345, 809, 909, 0xFFFF, 0xFFFF, 472, 355, 174, 1324, 0xFFFF, 461,
+    0xFFFF, 1480, 0xFFFF, 1420, 1674, 0xFFFF, 152, 0xFFFF, 110, 1059, 586, 0xFFFF,
+    1651, 985, 1496, 0xFFFF, 218, 1932, 392, 1317, 115, 516, 1188, 2097,
+    1009, 0xFFFF, 1489, 0xFFFF, 0xFFFF, 0xFFFF, 1456, 1966, 169, 0xFFFF, 1418, 2107,
+    227, 1375, 1246, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 1833, 0xFFFF, 405, 823, 2087,
+    1660, 1904, 500, 560, 1546, 474, 1561, 62, 1391, 0xFFFF, 670, 332,
+    788, 104, 2073, 1538, 1911, 0xFFFF, 0xFFFF, 1502, 199, 1267, 900, 1365,
+    0xFFFF, 166, 0xFFFF, 1543, 0xFFFF, 10, 0xFFFF, 0xFFFF, 732, 855, 0xFFFF, 0xFFFF,
+    2027, 1944, 972, 897, 1065, 414, 669, 1696, 1436, 0xFFFF, 1251, 1822,
+    942, 940, 195, 1125, 2078, 76, 1397, 1772, 660, 252, 2116, 0xFFFF,
+    0xFFFF, 782, 1201, 930, 325, 1148, 1463, 6, 17, 917, 1380, 1501,
+    0xFFFF, 2081, 1311, 1654, 291, 1778, 272, 230, 1693, 0xFFFF, 0xFFFF, 0xFFFF,
+    1588, 1486, 403, 417, 2120, 1070, 0xFFFF, 0xFFFF, 2004, 0xFFFF, 283, 1807,
+    11, 1519, 1618, 1540, 722, 1360, 1098, 0xFFFF, 37, 201, 1945, 1748,
+    795, 0xFFFF, 274, 1330, 42, 1441, 0xFFFF, 1505, 1940, 2048, 1204, 538,
+    1250, 1453, 2012, 923, 1996, 1992, 0xFFFF, 1931, 1471, 833, 0xFFFF, 1242,
+    1656, 558, 1517, 1468, 860, 1549, 697, 496, 1615, 1212, 0xFFFF, 1156,
+    673, 1916, 483, 45, 0xFFFF, 64, 0xFFFF, 892, 1245, 2021, 1424, 1359,
+    1081, 1325, 840, 868, 1357, 679, 786, 1620, 270, 1151, 1407, 1860,
+    0xFFFF, 1176, 1235, 771, 108, 758, 35, 801, 384, 503, 2000, 0xFFFF,
+    1535, 1451, 1222, 638, 1350, 361, 785, 609, 497, 0xFFFF, 778, 0xFFFF,
+    1110, 0xFFFF, 1569, 0xFFFF, 662, 1983, 1706, 781, 0xFFFF, 1734, 1206, 1392,
+    2083, 0xFFFF, 209, 965, 442, 555, 2100, 1229, 720, 1500, 323, 657,
+    116, 605, 1115, 1438, 430, 253, 1008, 246, 1779, 0xFFFF, 1017, 0xFFFF,
+    939, 275, 1381, 91, 0xFFFF, 1884, 913, 1282, 0xFFFF, 260, 340, 1898,
+    959, 527, 1307, 847, 2054, 1261, 0xFFFF, 202, 938, 391, 0xFFFF, 1634,
+    2044, 1707, 151, 0xFFFF, 294, 1514, 358, 259, 0xFFFF, 38, 2011, 1494,
+    1315, 346, 760, 520, 0xFFFF, 1233, 583, 816, 934, 457, 0xFFFF, 1740,
+    1219, 1413, 0xFFFF, 631, 1452, 990, 0xFFFF, 228, 1142, 0xFFFF, 0xFFFF, 1718,
+    1661, 808, 1716, 239, 1443, 0xFFFF, 0xFFFF, 334, 1953, 1035, 1241, 1763,
+    0xFFFF, 0xFFFF, 830, 0xFFFF, 21, 1521, 769, 838, 36, 435, 1933, 0xFFFF,
+    824, 0xFFFF, 149, 0xFFFF, 0xFFFF, 1761, 0xFFFF, 1352, 0xFFFF, 640, 425, 0xFFFF,
+    890, 1426, 1838, 1907, 1136, 1783, 0xFFFF, 308, 0xFFFF, 31, 0xFFFF, 973,
+    86, 114, 677, 0xFFFF, 1016, 329, 254, 180, 1976, 388, 331, 1568,
+    0xFFFF, 0xFFFF, 0xFFFF, 1592, 903, 0xFFFF, 561, 0xFFFF, 807, 1570, 0xFFFF, 0xFFFF,
+    0xFFFF, 88, 2052, 1334, 221, 647, 2103, 0xFFFF, 991, 1600, 2074, 704,
+    0xFFFF, 1297, 832, 1771, 1129, 0xFFFF, 1885, 257, 0xFFFF, 1717, 1284, 1220,
+    0xFFFF, 1701, 0xFFFF, 1998, 762, 464, 695, 1102, 1382, 1097, 976, 599,
+    0xFFFF, 597, 688, 843, 299, 0xFFFF, 653, 1596, 0xFFFF, 0xFFFF, 290, 620,
+    2040, 0xFFFF, 854, 1666, 1403, 723, 33, 1746, 420, 281, 1141, 1200,
+    2017, 380, 0xFFFF, 0xFFFF, 856, 1072, 967, 1240, 1744, 580, 187, 0xFFFF,
+    689, 48, 1095, 1346, 284, 578, 671, 2113, 954, 756, 0xFFFF, 1810,
+    96, 1608, 1821, 0xFFFF, 491, 804, 875, 1329, 895, 501, 0xFFFF, 600,
+    869, 184, 251, 2023, 0xFFFF, 157, 1633, 0xFFFF, 1579, 0xFFFF, 827, 1671,
+    1248, 1224, 196, 0xFFFF, 1980, 126, 721, 0xFFFF, 645, 567, 2096, 0xFFFF,
+    813, 1766, 0xFFFF, 1886, 1034, 1943, 412, 1408, 627, 1797, 1166, 1351,
+    682, 206, 863, 924, 0xFFFF, 1105, 1293, 1038, 648, 1073, 1870, 1648,
+    2122, 416, 582, 307, 0xFFFF, 1508, 1120, 1537, 1682, 867, 286, 1004,
+    362, 1769, 0xFFFF, 1439, 1433, 0xFFFF, 2035, 1910, 78, 753, 960, 1231,
+    797, 986, 1364, 1774, 1388, 0xFFFF, 1554, 2101, 1074, 406, 1239, 1611,
+    119, 525, 49, 1900, 1313, 551, 1303, 0xFFFF, 1015, 1011, 178, 943,
+    1132, 2060, 641, 886, 1776, 624, 1275, 1342, 0xFFFF, 1385, 1192, 413,
+    71, 1101, 1039, 743, 920, 1653, 393, 0xFFFF, 0xFFFF, 1747, 712, 100,
+    1523, 936, 1006, 616, 1445, 1270, 1096, 0xFFFF, 0xFFFF, 763, 1416, 0xFFFF,
+    0xFFFF, 0xFFFF, 1455, 2065, 1670, 690, 1981, 486, 1138, 1309, 249, 692,
+    1767, 0xFFFF, 0xFFFF, 34, 0xFFFF, 1215, 261, 887, 1108, 1135, 0xFFFF, 0xFFFF,
+    229, 549, 337, 0xFFFF, 1071, 2024, 0xFFFF, 0xFFFF, 0xFFFF, 1263, 4, 0xFFFF,
+    1936, 128, 1970, 711, 0xFFFF, 368, 445, 1762, 637, 1111, 0xFFFF, 0xFFFF,
+    1133, 0xFFFF, 2047, 1509, 1785, 0xFFFF, 770, 1369, 584, 0xFFFF, 1817, 536,
+    0xFFFF, 1642, 1858, 0xFFFF, 222, 1153, 0xFFFF, 1336, 0xFFFF, 2010, 1163, 1218,
+    1053, 1986, 1857, 0xFFFF, 225, 1269, 134, 1603, 0xFFFF, 1042, 2069, 451,
+    0xFFFF, 153, 0xFFFF, 537, 140, 826, 793, 1118, 30, 1830, 0xFFFF, 1137,
+    1189, 0xFFFF, 595, 1177, 1296, 592, 1198, 794, 0xFFFF, 1866, 512, 258,
+    1928, 0xFFFF, 1356, 622, 1699, 2015, 745, 594, 0xFFFF, 1302, 0xFFFF, 1328,
+    885, 0xFFFF, 0xFFFF, 1627, 522, 0xFFFF, 783, 1312, 1423, 1585, 1929, 28,
+    2039, 0xFFFF, 1759, 1532, 1835, 1647, 2041, 103, 0xFFFF, 0xFFFF, 0xFFFF, 1926,
+    0xFFFF, 1366, 1373, 1991, 1856, 667, 2003, 604, 1473, 0xFFFF, 181, 92,
+    0xFFFF, 0xFFFF, 0xFFFF, 1917, 2032, 1437, 289, 0xFFFF, 1887, 444, 1444, 1584,
+    1485, 101, 44, 1721, 300, 1897, 1362, 1018, 1755, 0xFFFF, 0xFFFF, 1641,
+    910, 0xFFFF, 476, 185, 1106, 1572, 918, 1082, 2061, 746, 1354, 15,
+    0xFFFF, 2075, 1493, 1526, 618, 735, 1843, 1622, 1951, 0xFFFF, 1368, 1574,
+    811, 1158, 1770, 2110, 1868, 0xFFFF, 1871, 0xFFFF, 946, 929, 1109, 1990,
+    102, 0xFFFF, 1777, 247, 877, 779, 0xFFFF, 0xFFFF, 1598, 2020, 1815, 837,
+    2009, 1208, 687, 1802, 0xFFFF, 1863, 772, 761, 1724, 2028, 585, 999,
+    2098, 1127, 144, 441, 7, 0xFFFF, 1973, 1562, 0xFFFF, 0xFFFF, 1465, 1474,
+    0xFFFF, 1552, 1150, 1545, 163, 1965, 1092, 1529, 376, 716, 0xFFFF, 303,
+    1640, 338, 955, 1483, 1906, 819, 0xFFFF, 1636, 1602, 1128, 0xFFFF, 1913,
+    1410, 402, 470, 19, 1214, 1014, 977, 523, 469, 0xFFFF, 0xFFFF, 0xFFFF,
+    324, 2108, 1806, 1131, 768, 211, 2085, 0xFFFF, 374, 0xFFFF, 301, 424,
+    1160, 1624, 377, 1995, 117, 0xFFFF, 1503, 51, 191, 1145, 1955, 517,
+    950, 982, 0xFFFF, 1374, 462, 1000, 615, 0, 0xFFFF, 357, 0xFFFF, 908,
+    0xFFFF, 1273, 0xFFFF, 570, 415, 988, 1542, 1415, 0xFFFF, 0xFFFF, 468, 1213,
+    1300, 1003, 1925, 1691, 1528, 1731, 0xFFFF, 0xFFFF, 775, 390, 1960, 0xFFFF,
+    1262, 1551, 607, 1422, 678, 0xFFFF, 58, 1478, 65, 434, 675, 1499,
+    0xFFFF, 1873, 1669, 1789, 948, 0xFFFF, 1947, 1458, 2062, 382, 964, 2082,
+    455, 1504, 911, 139, 1285, 1714, 1046, 0xFFFF, 1024, 0xFFFF, 1513, 845,
+    1730, 1289, 499, 1708, 519, 928, 878, 0xFFFF, 2025, 0xFFFF, 89, 1249,
+    418, 1566, 628, 27, 1227, 311, 1237, 1353, 1956, 1644, 0xFFFF, 0xFFFF,
+    372, 2088, 1658, 1878, 266, 2066, 1557, 20, 1506, 287, 0xFFFF, 1814,
+    0xFFFF, 0xFFFF, 29, 1467, 409, 805, 155, 1367, 1400, 0xFFFF, 596, 1937,
+    630, 248, 2001, 1673, 0xFFFF, 1664, 256, 234, 968, 2115, 0xFFFF, 974,
+    0xFFFF, 1571, 0xFFFF, 1411, 1383, 137, 1604, 0xFFFF, 1607, 1450, 488, 2095,
+    0xFFFF, 265, 0xFFFF, 1298, 2072, 1581, 806, 1276, 0xFFFF, 970, 2090, 0xFFFF,
+    2079, 1181, 439, 1668, 1247, 1462, 124, 1164, 0xFFFF, 1954, 1879, 1155,
+    2022, 1172, 0xFFFF, 242, 0xFFFF, 608, 0xFFFF, 371, 0xFFFF, 1013, 360, 0xFFFF,
+    22, 835, 0xFFFF, 1036, 1029, 394, 0xFFFF, 553, 1836, 0xFFFF, 898, 0xFFFF,
+    0xFFFF, 1946, 90, 0xFFFF, 162, 1859, 1347, 0xFFFF, 997, 639, 0xFFFF, 0xFFFF,
+    915, 255, 802, 1, 1170, 738, 460, 1447, 539, 1841, 2005, 617,
+    714, 0xFFFF, 94, 1623, 906, 541, 1116, 896, 0xFFFF, 914, 1801, 742,
+    1379, 873, 1758, 1753, 1326, 719, 60, 0xFFFF, 279, 633, 932, 0xFFFF,
+    0xFFFF, 188, 0xFFFF, 702, 0xFFFF, 1891, 744, 1179, 1430, 243, 262, 0xFFFF,
+    1152, 216, 231, 1260, 513, 1051, 944, 0xFFFF, 208, 0xFFFF, 2037, 1903,
+    396, 53, 156, 1041, 1341, 1652, 1805, 46, 2118, 1993, 566, 313,
+    0xFFFF, 1395, 1609, 635, 1162, 0xFFFF, 1613, 691, 841, 182, 1702, 0xFFFF,
+    1058, 0xFFFF, 1371, 1829, 1745, 1756, 571, 0xFFFF, 0xFFFF, 1389, 791, 1174,
+    0xFFFF, 1705, 1712, 223, 1093, 2089, 2049, 1343, 1094, 1850, 623, 1787,
+    557, 1942, 61, 626, 0xFFFF, 1355, 477, 1952, 1844, 1676, 542, 1550,
+    2055, 1225, 1840, 0xFFFF, 733, 1461, 1387, 1919, 1832, 1851, 1272, 0xFFFF,
+    0xFFFF, 43, 0xFFFF, 1849, 1228, 427, 2063, 870, 1754, 298, 750, 1978,
+    1511, 2046, 1680, 0xFFFF, 0xFFFF, 59, 1794, 373, 343, 0xFFFF, 1912, 1865,
+    726, 925, 0xFFFF, 359, 1193, 1100, 1899, 1060, 367, 285, 0xFFFF, 1340,
+    1890, 1823, 210, 381, 754, 644, 0xFFFF, 32, 159, 0xFFFF, 1867, 1481,
+    774, 2053, 727, 701, 2124, 1308, 529, 1406, 1146, 1037, 589, 548,
+    526, 1927, 2084, 2050, 1950, 606, 437, 1710, 1045, 345, 1811, 297,
+    0xFFFF, 1306, 1117, 694, 0xFFFF, 1573, 1446, 214, 351, 1048, 953, 893,
+    1583, 0xFFFF, 1961, 1643, 852, 521, 933, 0xFFFF, 839, 0xFFFF, 684, 1484,
+    996, 1934, 998, 1049, 1837, 1253, 1112, 676, 655, 1869, 1610, 422,
+    1564, 1536, 545, 0xFFFF, 0xFFFF, 431, 2042, 1238, 1782, 926, 603, 473,
+    0xFFFF, 876, 5, 764, 1318, 0xFFFF, 1720, 1205, 0xFFFF, 884, 1697, 2106,
+    69, 105, 790, 1516, 0xFFFF, 1199, 161, 849, 348, 1054, 1784, 1839,
+    2058, 872, 0xFFFF, 2117, 1685, 1876, 629, 0xFFFF, 511, 1114, 1384, 1667,
+    1477, 1997, 0xFFFF, 1625, 803, 737, 1979, 1732, 1321, 562, 342, 614,
+    0xFFFF, 643, 0xFFFF, 1055, 1605, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 992, 564, 1498,
+    642, 0xFFFF, 1941, 1280, 0xFFFF, 767, 0xFFFF, 130, 304, 0xFFFF, 1645, 2019,
+    12, 132, 0xFFFF, 165, 295, 1299, 2119, 215, 1301, 379, 0xFFFF, 1848,
+    0xFFFF, 0xFFFF, 138, 713, 344, 1337, 1431, 725, 233, 320, 271, 759,
+    905, 339, 1743, 550, 0xFFFF, 24, 421, 383, 1180, 193, 706, 1728,
+    544, 1033, 1026, 659, 995, 1358, 67, 602, 1076, 1271, 2105, 0xFFFF,
+    397, 0xFFFF, 0xFFFF, 423, 489, 447, 1196, 175, 0xFFFF, 0xFFFF, 81, 1210,
+    0xFFFF, 1265, 305, 1969, 0xFFFF, 1861, 1372, 25, 1244, 1915, 776, 1149,
+    1510, 1414, 0xFFFF, 47, 717, 681, 0xFFFF, 1104, 871, 1464, 269, 280,
+    0xFFFF, 158, 56, 2086, 0xFFFF, 510, 0xFFFF, 356, 1630, 226, 0xFFFF, 0xFFFF,
+    0xFFFF, 800, 1405, 0xFFFF, 1938, 0xFFFF, 432, 0xFFFF, 0xFFFF, 0xFFFF, 68, 454,
+    1939, 1565, 829, 0xFFFF, 1056, 217, 1880, 13, 1370, 0xFFFF, 2059, 1335,
+    449, 241, 0xFFFF, 1742, 1894, 1828, 0xFFFF, 1404, 2031, 1401, 190, 572,
+    1488, 1847, 951, 0xFFFF, 2013, 1974, 540, 0xFFFF, 724, 1378, 1749, 1883,
+    0xFFFF, 1544, 52, 1819, 846, 861, 1739, 0xFFFF, 322, 1417, 757, 0xFFFF,
+    1167, 1914, 80, 1376, 1548, 336, 1287, 237, 1002, 143, 0xFFFF, 533,
+    0xFFFF, 1078, 962, 485, 0xFFFF, 1159, 0xFFFF, 672, 949, 282, 1672, 478,
+    1232, 1994, 70, 547, 2, 766, 0xFFFF, 0xFFFF, 0xFFFF, 650, 433, 395,
+    1144, 41, 590, 0xFFFF, 850, 1472, 1786, 1713, 1635, 680, 1113, 0xFFFF,
+    150, 0xFFFF, 862, 197, 0xFFFF, 50, 563, 0xFFFF, 0xFFFF, 1022, 1492, 1435,
+    2121, 1126, 1266, 1791, 318, 438, 0xFFFF, 815, 882, 1735, 1905, 463,
+    0xFFFF, 1877, 0xFFFF, 1134, 621, 1178, 1524, 1428, 984, 1064, 1183, 636,
+    1398, 0xFFFF, 0xFFFF, 1122, 495, 148, 656, 658, 315, 316, 796, 1935,
+    1827, 23, 79, 0xFFFF, 593, 507, 0xFFFF, 1194, 0xFFFF, 0xFFFF, 2092, 1123,
+    317, 0xFFFF, 1575, 0xFFFF, 1143, 1649, 0xFFFF, 16, 851, 709, 1525, 1533,
+    0xFFFF, 993, 0xFFFF, 1563, 1751, 448, 902, 0xFFFF, 1800, 773, 844, 1681,
+    1295, 2036, 2057, 1264, 0xFFFF, 135, 1750, 2008, 207, 73, 0xFFFF, 1216,
+    0xFFFF, 524, 0xFFFF, 879, 0xFFFF, 0xFFFF, 263, 1781, 160, 1399, 1197, 1698,
+    1872, 288, 309, 612, 1788, 1320, 467, 1001, 728, 1875, 219, 1091,
+    2070, 559, 410, 183, 0xFFFF, 1909, 534, 922, 1085, 0xFFFF, 1088, 1831,
+    1984, 0xFFFF, 0xFFFF, 532, 0xFFFF, 0xFFFF, 245, 634, 921, 1191, 1657, 554,
+    1425, 1066, 1322, 0xFFFF, 1349, 1256, 848, 1304, 2068, 1421, 293, 327,
+    881, 57, 0xFFFF, 0xFFFF, 729, 891, 0xFFFF, 0xFFFF, 1726, 1988, 1319, 440,
+    0xFFFF, 1288, 935, 740, 683, 112, 1967, 341, 0xFFFF, 1555, 0xFFFF, 1614,
+    530, 1599, 276, 177, 1440, 528, 292, 1619, 2112, 480, 1628, 1491,
+    0xFFFF, 1448, 1292, 0xFFFF, 1804, 0xFFFF, 0xFFFF, 335, 366, 509, 186, 625,
+    1820, 1363, 1792, 1394, 747, 0xFFFF, 2093, 1948, 1646, 1694, 235, 1982,
+    1808, 1727, 1186, 1495, 401, 306, 349, 980, 0xFFFF, 1971, 693, 0xFFFF,
+    1479, 1182, 1663, 1286, 1733, 1793, 1629, 484, 731, 240, 1812, 1487,
+    471, 0xFFFF, 752, 1677, 556, 1958, 385, 411, 820, 0xFFFF, 458, 1662,
+    994, 1316, 883, 2007, 952, 0xFFFF, 370, 1165, 2077, 956, 1679, 354,
+    546, 2109, 1475, 1169, 363, 2067, 328, 1259, 0xFFFF, 0xFFFF, 0xFFFF, 99,
+    136, 1449, 899, 686, 1659, 666, 2091, 319, 1147, 0xFFFF, 466, 1361,
+    0xFFFF, 1737, 0xFFFF, 353, 0xFFFF, 107, 0xFFFF, 1063, 18, 1124, 1959, 1290,
+    1853, 0xFFFF, 1469, 1541, 2114, 1892, 326, 1338, 72, 0xFFFF, 1482, 821,
+    518, 350, 0xFFFF, 1187, 173, 400, 40, 0xFFFF, 780, 1107, 812, 1576,
+    817, 1386, 131, 987, 333, 971, 2033, 2102, 842, 0xFFFF, 1175, 828,
+    569, 125, 0xFFFF, 1825, 1895, 479, 0xFFFF, 0xFFFF, 1606, 1923, 2026, 1556,
+    310, 1157, 0xFFFF, 244, 0xFFFF, 1190, 1752, 1019, 708, 1012, 0xFFFF, 429,
+    1864, 1062, 1103, 0xFFFF, 1466, 3, 749, 632, 0xFFFF, 1331, 436, 0xFFFF,
+    1704, 792, 55, 0xFFFF, 1968,
+};
+
+#endif
@@ -0,0 +1,544 @@
+#ifndef SLUGIFY_LANGUAGES_H
+#define SLUGIFY_LANGUAGES_H
+
+/* Language profiles, included only by slugify.c. Each profile is the
+ * built-in transliteration_table with the overrides listed above it merged
+ * in, so it is a single sorted table like the built-in one and choosing it
+ * costs nothing per character. Generated from transliteration_table;
+ * regenerate whenever it or an override changes. LANGUAGE_BASE_COUNT is
+ * the number of built-in entries merged, which slugify.c checks. */
+
+#define LANGUAGE_BASE_COUNT 466
+
+/* German: C4 Ae, D6 Oe, DC Ue, E4 ae, F6 oe, FC ue, 1E9E SS */
+static const transliteration_entry_t language_german[] = {
+    {0x24, "dollar"}, {0x25, "percent"}, {0x26, "and"}, {0x3C, "less"}, {0x3E, "greater"},
+    {0x7C, "or"}, {0xA2, "cent"}, {0xA3, "pound"}, {0xA4, "currency"}, {0xA5, "yen"}, {0xA9, "(c)"},
+    {0xAA, "a"}, {0xAE, "(r)"}, {0xBA, "o"}, {0xC4, "Ae"}, {0xC6, "AE"}, {0xD0, "D"}, {0xD6, "Oe"},
+    {0xD8, "O"}, {0xDC, "Ue"}, {0xDE, "TH"}, {0xDF, "ss"}, {0xE4, "ae"}, {0xE6, "ae"}, {0xF0, "d"},
+    {0xF6, "oe"}, {0xF8, "o"}, {0xFC, "ue"}, {0xFE, "th"}, {0x110, "DJ"}, {0x111, "dj"},
+    {0x131, "i"}, {0x141, "L"}, {0x142, "l"}, {0x152, "OE"}, {0x153, "oe"}, {0x18F, "E"},
+    {0x192, "f"}, {0x1C8, "LJ"}, {0x1C9, "lj"}, {0x1CB, "NJ"}, {0x1CC, "nj"}, {0x259, "e"},
+    {0x2DA, "o"}, {0x391, "A"}, {0x392, "B"}, {0x393, "G"}, {0x394, "D"}, {0x395, "E"},
+    {0x396, "Z"}, {0x397, "H"}, {0x398, "8"}, {0x399, "I"}, {0x39A, "K"}, {0x39B, "L"},
+    {0x39C, "M"}, {0x39D, "N"}, {0x39E, "3"}, {0x39F, "O"}, {0x3A0, "P"}, {0x3A1, "R"},
+    {0x3A3, "S"}, {0x3A4, "T"}, {0x3A5, "Y"}, {0x3A6, "F"}, {0x3A7, "X"}, {0x3A8, "PS"},
+    {0x3A9, "W"}, {0x3B1, "a"}, {0x3B2, "b"}, {0x3B3, "g"}, {0x3B4, "d"}, {0x3B5, "e"},
+    {0x3B6, "z"}, {0x3B7, "h"}, {0x3B8, "8"}, {0x3B9, "i"}, {0x3BA, "k"}, {0x3BB, "l"},
+    {0x3BC, "m"}, {0x3BD, "n"}, {0x3BE, "3"}, {0x3BF, "o"}, {0x3C0, "p"}, {0x3C1, "r"},
+    {0x3C2, "s"}, {0x3C3, "s"}, {0x3C4, "t"}, {0x3C5, "y"}, {0x3C6, "f"}, {0x3C7, "x"},
+    {0x3C8, "ps"}, {0x3C9, "w"}, {0x401, "Yo"}, {0x402, "DJ"}, {0x404, "Ye"}, {0x406, "I"},
+    {0x407, "Yi"}, {0x408, "J"}, {0x409, "LJ"}, {0x40A, "NJ"}, {0x40B, "C"}, {0x40F, "DZ"},
+    {0x410, "A"}, {0x411, "B"}, {0x412, "V"}, {0x413, "G"}, {0x414, "D"}, {0x415, "E"},
+    {0x416, "Zh"}, {0x417, "Z"}, {0x418, "I"}, {0x419, "J"}, {0x41A, "K"}, {0x41B, "L"},
+    {0x41C, "M"}, {0x41D, "N"}, {0x41E, "O"}, {0x41F, "P"}, {0x420, "R"}, {0x421, "S"},
+    {0x422, "T"}, {0x423, "U"}, {0x424, "F"}, {0x425, "H"}, {0x426, "C"}, {0x427, "Ch"},
+    {0x428, "Sh"}, {0x429, "Sh"}, {0x42A, "U"}, {0x42B, "Y"}, {0x42C, ""}, {0x42D, "E"},
+    {0x42E, "Yu"}, {0x42F, "Ya"}, {0x430, "a"}, {0x431, "b"}, {0x432, "v"}, {0x433, "g"},
+    {0x434, "d"}, {0x435, "e"}, {0x436, "zh"}, {0x437, "z"}, {0x438, "i"}, {0x439, "j"},
+    {0x43A, "k"}, {0x43B, "l"}, {0x43C, "m"}, {0x43D, "n"}, {0x43E, "o"}, {0x43F, "p"},
+    {0x440, "r"}, {0x441, "s"}, {0x442, "t"}, {0x443, "u"}, {0x444, "f"}, {0x445, "h"},
+    {0x446, "c"}, {0x447, "ch"}, {0x448, "sh"}, {0x449, "sh"}, {0x44A, "u"}, {0x44B, "y"},
+    {0x44C, ""}, {0x44D, "e"}, {0x44E, "yu"}, {0x44F, "ya"}, {0x451, "yo"}, {0x452, "dj"},
+    {0x454, "ye"}, {0x456, "i"}, {0x457, "yi"}, {0x458, "j"}, {0x459, "lj"}, {0x45A, "nj"},
+    {0x45B, "c"}, {0x45D, "u"}, {0x45F, "dz"}, {0x490, "G"}, {0x491, "g"}, {0x492, "GH"},
+    {0x493, "gh"}, {0x49A, "KH"}, {0x49B, "kh"}, {0x4A2, "NG"}, {0x4A3, "ng"}, {0x4AE, "UE"},
+    {0x4AF, "ue"}, {0x4B0, "U"}, {0x4B1, "u"}, {0x4BA, "H"}, {0x4BB, "h"}, {0x4D8, "AE"},
+    {0x4D9, "ae"}, {0x4E8, "OE"}, {0x4E9, "oe"}, {0x531, "A"}, {0x532, "B"}, {0x533, "G"},
+    {0x534, "D"}, {0x535, "E"}, {0x536, "Z"}, {0x537, "E"}, {0x538, "Y"}, {0x539, "T"},
+    {0x53A, "ZH"}, {0x53B, "I"}, {0x53C, "L"}, {0x53D, "KH"}, {0x53E, "TS"}, {0x53F, "K"},
+    {0x540, "H"}, {0x541, "DZ"}, {0x542, "GH"}, {0x543, "CH"}, {0x544, "M"}, {0x545, "Y"},
+    {0x546, "N"}, {0x547, "SH"}, {0x548, "O"}, {0x549, "CH"}, {0x54A, "P"}, {0x54B, "J"},
+    {0x54C, "R"}, {0x54D, "S"}, {0x54E, "V"}, {0x54F, "T"}, {0x550, "R"}, {0x551, "TS"},
+    {0x552, "W"}, {0x553, "P"}, {0x554, "K"}, {0x555, "O"}, {0x556, "F"}, {0x561, "a"},
+    {0x562, "b"}, {0x563, "g"}, {0x564, "d"}, {0x565, "e"}, {0x566, "z"}, {0x567, "e"},
+    {0x568, "y"}, {0x569, "t"}, {0x56A, "zh"}, {0x56B, "i"}, {0x56C, "l"}, {0x56D, "kh"},
+    {0x56E, "ts"}, {0x56F, "k"}, {0x570, "h"}, {0x571, "dz"}, {0x572, "gh"}, {0x573, "ch"},
+    {0x574, "m"}, {0x575, "y"}, {0x576, "n"}, {0x577, "sh"}, {0x578, "o"}, {0x579, "ch"},
+    {0x57A, "p"}, {0x57B, "j"}, {0x57C, "r"}, {0x57D, "s"}, {0x57E, "v"}, {0x57F, "t"},
+    {0x580, "r"}, {0x581, "ts"}, {0x582, "w"}, {0x583, "p"}, {0x584, "k"}, {0x585, "o"},
+    {0x586, "f"}, {0x587, "ev"}, {0x5B1, "e"}, {0x5B2, "a"}, {0x5B3, "o"}, {0x5B4, "i"},
+    {0x5B5, "e"}, {0x5B6, "e"}, {0x5B7, "a"}, {0x5B8, "a"}, {0x5B9, "o"}, {0x5BA, "o"},
+    {0x5BB, "u"}, {0x5D0, ""}, {0x5D1, "b"}, {0x5D2, "g"}, {0x5D3, "d"}, {0x5D4, "h"}, {0x5D5, "v"},
+    {0x5D6, "z"}, {0x5D7, "kh"}, {0x5D8, "t"}, {0x5D9, "y"}, {0x5DA, "kh"}, {0x5DB, "k"},
+    {0x5DC, "l"}, {0x5DD, "m"}, {0x5DE, "m"}, {0x5DF, "n"}, {0x5E0, "n"}, {0x5E1, "s"}, {0x5E2, ""},
+    {0x5E3, "f"}, {0x5E4, "p"}, {0x5E5, "ts"}, {0x5E6, "ts"}, {0x5E7, "k"}, {0x5E8, "r"},
+    {0x5E9, "sh"}, {0x5EA, "t"}, {0x5F0, "v"}, {0x5F1, "oy"}, {0x5F2, "ay"}, {0x621, "a"},
+    {0x622, "aa"}, {0x623, "a"}, {0x624, "u"}, {0x625, "i"}, {0x626, "e"}, {0x627, "a"},
+    {0x628, "b"}, {0x629, "h"}, {0x62A, "t"}, {0x62B, "th"}, {0x62C, "j"}, {0x62D, "h"},
+    {0x62E, "kh"}, {0x62F, "d"}, {0x630, "th"}, {0x631, "r"}, {0x632, "z"}, {0x633, "s"},
+    {0x634, "sh"}, {0x635, "s"}, {0x636, "dh"}, {0x637, "t"}, {0x638, "z"}, {0x639, "a"},
+    {0x63A, "gh"}, {0x641, "f"}, {0x642, "q"}, {0x643, "k"}, {0x644, "l"}, {0x645, "m"},
+    {0x646, "n"}, {0x647, "h"}, {0x648, "w"}, {0x649, "a"}, {0x64A, "y"}, {0x64B, "an"},
+    {0x64C, "on"}, {0x64D, "en"}, {0x64E, "a"}, {0x64F, "u"}, {0x650, "e"}, {0x651, ""},
+    {0x660, "0"}, {0x661, "1"}, {0x662, "2"}, {0x663, "3"}, {0x664, "4"}, {0x665, "5"},
+    {0x666, "6"}, {0x667, "7"}, {0x668, "8"}, {0x669, "9"}, {0x67E, "p"}, {0x686, "ch"},
+    {0x698, "zh"}, {0x6A9, "k"}, {0x6AF, "g"}, {0x6CC, "y"}, {0x6F0, "0"}, {0x6F1, "1"},
+    {0x6F2, "2"}, {0x6F3, "3"}, {0x6F4, "4"}, {0x6F5, "5"}, {0x6F6, "6"}, {0x6F7, "7"},
+    {0x6F8, "8"}, {0x6F9, "9"}, {0x9CE, "t"}, {0xD7A, "n"}, {0xD7B, "n"}, {0xD7C, "r"},
+    {0xD7D, "l"}, {0xD7E, "l"}, {0xD7F, "k"}, {0x10D0, "a"}, {0x10D1, "b"}, {0x10D2, "g"},
+    {0x10D3, "d"}, {0x10D4, "e"}, {0x10D5, "v"}, {0x10D6, "z"}, {0x10D7, "t"}, {0x10D8, "i"},
+    {0x10D9, "k"}, {0x10DA, "l"}, {0x10DB, "m"}, {0x10DC, "n"}, {0x10DD, "o"}, {0x10DE, "p"},
+    {0x10DF, "zh"}, {0x10E0, "r"}, {0x10E1, "s"}, {0x10E2, "t"}, {0x10E3, "u"}, {0x10E4, "f"},
+    {0x10E5, "k"}, {0x10E6, "gh"}, {0x10E7, "q"}, {0x10E8, "sh"}, {0x10E9, "ch"}, {0x10EA, "ts"},
+    {0x10EB, "dz"}, {0x10EC, "ts"}, {0x10ED, "ch"}, {0x10EE, "kh"}, {0x10EF, "j"}, {0x10F0, "h"},
+    {0x1E9E, "SS"}, {0x2013, "-"}, {0x2018, "'"}, {0x2019, "'"}, {0x201C, "\""}, {0x201D, "\""},
+    {0x201E, "\""}, {0x2020, "+"}, {0x2022, "*"}, {0x2026, "..."}, {0x20A0, "ecu"},
+    {0x20A2, "cruzeiro"}, {0x20A3, "french franc"}, {0x20A4, "lira"}, {0x20A5, "mill"},
+    {0x20A6, "naira"}, {0x20A7, "peseta"}, {0x20A8, "rupee"}, {0x20A9, "won"},
+    {0x20AA, "new shequel"}, {0x20AB, "dong"}, {0x20AC, "euro"}, {0x20AD, "kip"},
+    {0x20AE, "tugrik"}, {0x20AF, "drachma"}, {0x20B0, "penny"}, {0x20B1, "peso"},
+    {0x20B2, "guarani"}, {0x20B3, "austral"}, {0x20B4, "hryvnia"}, {0x20B5, "cedi"},
+    {0x20B8, "kazakhstani tenge"}, {0x20B9, "indian rupee"}, {0x20BA, "turkish lira"},
+    {0x20BD, "russian ruble"}, {0x20BF, "bitcoin"}, {0x2120, "sm"}, {0x2122, "tm"}, {0x2202, "d"},
+    {0x2206, "delta"}, {0x2211, "sum"}, {0x221E, "infinity"}, {0x2665, "love"}, {0x5143, "yuan"},
+    {0x5186, "yen"}, {0xFDF5, "laa"}, {0xFDF7, "laa"}, {0xFDF9, "lai"}, {0xFDFB, "la"},
+    {0xFDFC, "rial"},
+};
+
+/* Danish and Norwegian: C4 Ae, C5 Aa, D6 Oe, D8 Oe, E4 ae, E5 aa, F6 oe,
+ * F8 oe */
+static const transliteration_entry_t language_scandinavian[] = {
+    {0x24, "dollar"}, {0x25, "percent"}, {0x26, "and"}, {0x3C, "less"}, {0x3E, "greater"},
+    {0x7C, "or"}, {0xA2, "cent"}, {0xA3, "pound"}, {0xA4, "currency"}, {0xA5, "yen"}, {0xA9, "(c)"},
+    {0xAA, "a"}, {0xAE, "(r)"}, {0xBA, "o"}, {0xC4, "Ae"}, {0xC5, "Aa"}, {0xC6, "AE"}, {0xD0, "D"},
+    {0xD6, "Oe"}, {0xD8, "Oe"}, {0xDE, "TH"}, {0xDF, "ss"}, {0xE4, "ae"}, {0xE5, "aa"},
+    {0xE6, "ae"}, {0xF0, "d"}, {0xF6, "oe"}, {0xF8, "oe"}, {0xFE, "th"}, {0x110, "DJ"},
+    {0x111, "dj"}, {0x131, "i"}, {0x141, "L"}, {0x142, "l"}, {0x152, "OE"}, {0x153, "oe"},
+    {0x18F, "E"}, {0x192, "f"}, {0x1C8, "LJ"}, {0x1C9, "lj"}, {0x1CB, "NJ"}, {0x1CC, "nj"},
+    {0x259, "e"}, {0x2DA, "o"}, {0x391, "A"}, {0x392, "B"}, {0x393, "G"}, {0x394, "D"},
+    {0x395, "E"}, {0x396, "Z"}, {0x397, "H"}, {0x398, "8"}, {0x399, "I"}, {0x39A, "K"},
+    {0x39B, "L"}, {0x39C, "M"}, {0x39D, "N"}, {0x39E, "3"}, {0x39F, "O"}, {0x3A0, "P"},
+    {0x3A1, "R"}, {0x3A3, "S"}, {0x3A4, "T"}, {0x3A5, "Y"}, {0x3A6, "F"}, {0x3A7, "X"},
+    {0x3A8, "PS"}, {0x3A9, "W"}, {0x3B1, "a"}, {0x3B2, "b"}, {0x3B3, "g"}, {0x3B4, "d"},
+    {0x3B5, "e"}, {0x3B6, "z"}, {0x3B7, "h"}, {0x3B8, "8"}, {0x3B9, "i"}, {0x3BA, "k"},
+    {0x3BB, "l"}, {0x3BC, "m"}, {0x3BD, "n"}, {0x3BE, "3"}, {0x3BF, "o"}, {0x3C0, "p"},
+    {0x3C1, "r"}, {0x3C2, "s"}, {0x3C3, "s"}, {0x3C4, "t"}, {0x3C5, "y"}, {0x3C6, "f"},
+    {0x3C7, "x"}, {0x3C8, "ps"}, {0x3C9, "w"}, {0x401, "Yo"}, {0x402, "DJ"}, {0x404, "Ye"},
+    {0x406, "I"}, {0x407, "Yi"}, {0x408, "J"}, {0x409, "LJ"}, {0x40A, "NJ"}, {0x40B, "C"},
+    {0x40F, "DZ"}, {0x410, "A"}, {0x411, "B"}, {0x412, "V"}, {0x413, "G"}, {0x414, "D"},
+    {0x415, "E"}, {0x416, "Zh"}, {0x417, "Z"}, {0x418, "I"}, {0x419, "J"}, {0x41A, "K"},
+    {0x41B, "L"}, {0x41C, "M"}, {0x41D, "N"}, {0x41E, "O"}, {0x41F, "P"}, {0x420, "R"},
+    {0x421, "S"}, {0x422, "T"}, {0x423, "U"}, {0x424, "F"}, {0x425, "H"}, {0x426, "C"},
+    {0x427, "Ch"}, {0x428, "Sh"}, {0x429, "Sh"}, {0x42A, "U"}, {0x42B, "Y"}, {0x42C, ""},
+    {0x42D, "E"}, {0x42E, "Yu"}, {0x42F, "Ya"}, {0x430, "a"}, {0x431, "b"}, {0x432, "v"},
+    {0x433, "g"}, {0x434, "d"}, {0x435, "e"}, {0x436, "zh"}, {0x437, "z"}, {0x438, "i"},
+    {0x439, "j"}, {0x43A, "k"}, {0x43B, "l"}, {0x43C, "m"}, {0x43D, "n"}, {0x43E, "o"},
+    {0x43F, "p"}, {0x440, "r"}, {0x441, "s"}, {0x442, "t"}, {0x443, "u"}, {0x444, "f"},
+    {0x445, "h"}, {0x446, "c"}, {0x447, "ch"}, {0x448, "sh"}, {0x449, "sh"}, {0x44A, "u"},
+    {0x44B, "y"}, {0x44C, ""}, {0x44D, "e"}, {0x44E, "yu"}, {0x44F, "ya"}, {0x451, "yo"},
+    {0x452, "dj"}, {0x454, "ye"}, {0x456, "i"}, {0x457, "yi"}, {0x458, "j"}, {0x459, "lj"},
+    {0x45A, "nj"}, {0x45B, "c"}, {0x45D, "u"}, {0x45F, "dz"}, {0x490, "G"}, {0x491, "g"},
+    {0x492, "GH"}, {0x493, "gh"}, {0x49A, "KH"}, {0x49B, "kh"}, {0x4A2, "NG"}, {0x4A3, "ng"},
+    {0x4AE, "UE"}, {0x4AF, "ue"}, {0x4B0, "U"}, {0x4B1, "u"}, {0x4BA, "H"}, {0x4BB, "h"},
+    {0x4D8, "AE"}, {0x4D9, "ae"}, {0x4E8, "OE"}, {0x4E9, "oe"}, {0x531, "A"}, {0x532, "B"},
+    {0x533, "G"}, {0x534, "D"}, {0x535, "E"}, {0x536, "Z"}, {0x537, "E"}, {0x538, "Y"},
+    {0x539, "T"}, {0x53A, "ZH"}, {0x53B, "I"}, {0x53C, "L"}, {0x53D, "KH"}, {0x53E, "TS"},
+    {0x53F, "K"}, {0x540, "H"}, {0x541, "DZ"}, {0x542, "GH"}, {0x543, "CH"}, {0x544, "M"},
+    {0x545, "Y"}, {0x546, "N"}, {0x547, "SH"}, {0x548, "O"}, {0x549, "CH"}, {0x54A, "P"},
+    {0x54B, "J"}, {0x54C, "R"}, {0x54D, "S"}, {0x54E, "V"}, {0x54F, "T"}, {0x550, "R"},
+    {0x551, "TS"}, {0x552, "W"}, {0x553, "P"}, {0x554, "K"}, {0x555, "O"}, {0x556, "F"},
+    {0x561, "a"}, {0x562, "b"}, {0x563, "g"}, {0x564, "d"}, {0x565, "e"}, {0x566, "z"},
+    {0x567, "e"}, {0x568, "y"}, {0x569, "t"}, {0x56A, "zh"}, {0x56B, "i"}, {0x56C, "l"},
+    {0x56D, "kh"}, {0x56E, "ts"}, {0x56F, "k"}, {0x570, "h"}, {0x571, "dz"}, {0x572, "gh"},
+    {0x573, "ch"}, {0x574, "m"}, {0x575, "y"}, {0x576, "n"}, {0x577, "sh"}, {0x578, "o"},
+    {0x579, "ch"}, {0x57A, "p"}, {0x57B, "j"}, {0x57C, "r"}, {0x57D, "s"}, {0x57E, "v"},
+    {0x57F, "t"}, {0x580, "r"}, {0x581, "ts"}, {0x582, "w"}, {0x583, "p"}, {0x584, "k"},
+    {0x585, "o"}, {0x586, "f"}, {0x587, "ev"}, {0x5B1, "e"}, {0x5B2, "a"}, {0x5B3, "o"},
+    {0x5B4, "i"}, {0x5B5, "e"}, {0x5B6, "e"}, {0x5B7, "a"}, {0x5B8, "a"}, {0x5B9, "o"},
+    {0x5BA, "o"}, {0x5BB, "u"}, {0x5D0, ""}, {0x5D1, "b"}, {0x5D2, "g"}, {0x5D3, "d"}, {0x5D4, "h"},
+    {0x5D5, "v"}, {0x5D6, "z"}, {0x5D7, "kh"}, {0x5D8, "t"}, {0x5D9, "y"}, {0x5DA, "kh"},
+    {0x5DB, "k"}, {0x5DC, "l"}, {0x5DD, "m"}, {0x5DE, "m"}, {0x5DF, "n"}, {0x5E0, "n"},
+    {0x5E1, "s"}, {0x5E2, ""}, {0x5E3, "f"}, {0x5E4, "p"}, {0x5E5, "ts"}, {0x5E6, "ts"},
+    {0x5E7, "k"}, {0x5E8, "r"}, {0x5E9, "sh"}, {0x5EA, "t"}, {0x5F0, "v"}, {0x5F1, "oy"},
+    {0x5F2, "ay"}, {0x621, "a"}, {0x622, "aa"}, {0x623, "a"}, {0x624, "u"}, {0x625, "i"},
+    {0x626, "e"}, {0x627, "a"}, {0x628, "b"}, {0x629, "h"}, {0x62A, "t"}, {0x62B, "th"},
+    {0x62C, "j"}, {0x62D, "h"}, {0x62E, "kh"}, {0x62F, "d"}, {0x630, "th"}, {0x631, "r"},
+    {0x632, "z"}, {0x633, "s"}, {0x634, "sh"}, {0x635, "s"}, {0x636, "dh"}, {0x637, "t"},
+    {0x638, "z"}, {0x639, "a"}, {0x63A, "gh"}, {0x641, "f"}, {0x642, "q"}, {0x643, "k"},
+    {0x644, "l"}, {0x645, "m"}, {0x646, "n"}, {0x647, "h"}, {0x648, "w"}, {0x649, "a"},
+    {0x64A, "y"}, {0x64B, "an"}, {0x64C, "on"}, {0x64D, "en"}, {0x64E, "a"}, {0x64F, "u"},
+    {0x650, "e"}, {0x651, ""}, {0x660, "0"}, {0x661, "1"}, {0x662, "2"}, {0x663, "3"}, {0x664, "4"},
+    {0x665, "5"}, {0x666, "6"}, {0x667, "7"}, {0x668, "8"}, {0x669, "9"}, {0x67E, "p"},
+    {0x686, "ch"}, {0x698, "zh"}, {0x6A9, "k"}, {0x6AF, "g"}, {0x6CC, "y"}, {0x6F0, "0"},
+    {0x6F1, "1"}, {0x6F2, "2"}, {0x6F3, "3"}, {0x6F4, "4"}, {0x6F5, "5"}, {0x6F6, "6"},
+    {0x6F7, "7"}, {0x6F8, "8"}, {0x6F9, "9"}, {0x9CE, "t"}, {0xD7A, "n"}, {0xD7B, "n"},
+    {0xD7C, "r"}, {0xD7D, "l"}, {0xD7E, "l"}, {0xD7F, "k"}, {0x10D0, "a"}, {0x10D1, "b"},
+    {0x10D2, "g"}, {0x10D3, "d"}, {0x10D4, "e"}, {0x10D5, "v"}, {0x10D6, "z"}, {0x10D7, "t"},
+    {0x10D8, "i"}, {0x10D9, "k"}, {0x10DA, "l"}, {0x10DB, "m"}, {0x10DC, "n"}, {0x10DD, "o"},
+    {0x10DE, "p"}, {0x10DF, "zh"}, {0x10E0, "r"}, {0x10E1, "s"}, {0x10E2, "t"}, {0x10E3, "u"},
+    {0x10E4, "f"}, {0x10E5, "k"}, {0x10E6, "gh"}, {0x10E7, "q"}, {0x10E8, "sh"}, {0x10E9, "ch"},
+    {0x10EA, "ts"}, {0x10EB, "dz"}, {0x10EC, "ts"}, {0x10ED, "ch"}, {0x10EE, "kh"}, {0x10EF, "j"},
+    {0x10F0, "h"}, {0x2013, "-"}, {0x2018, "'"}, {0x2019, "'"}, {0x201C, "\""}, {0x201D, "\""},
+    {0x201E, "\""}, {0x2020, "+"}, {0x2022, "*"}, {0x2026, "..."}, {0x20A0, "ecu"},
+    {0x20A2, "cruzeiro"}, {0x20A3, "french franc"}, {0x20A4, "lira"}, {0x20A5, "mill"},
+    {0x20A6, "naira"}, {0x20A7, "peseta"}, {0x20A8, "rupee"}, {0x20A9, "won"},
+    {0x20AA, "new shequel"}, {0x20AB, "dong"}, {0x20AC, "euro"}, {0x20AD, "kip"},
+    {0x20AE, "tugrik"}, {0x20AF, "drachma"}, {0x20B0, "penny"}, {0x20B1, "peso"},
+    {0x20B2, "guarani"}, {0x20B3, "austral"}, {0x20B4, "hryvnia"}, {0x20B5, "cedi"},
+    {0x20B8, "kazakhstani tenge"}, {0x20B9, "indian rupee"}, {0x20BA, "turkish lira"},
+    {0x20BD, "russian ruble"}, {0x20BF, "bitcoin"}, {0x2120, "sm"}, {0x2122, "tm"}, {0x2202, "d"},
+    {0x2206, "delta"}, {0x2211, "sum"}, {0x221E, "infinity"}, {0x2665, "love"}, {0x5143, "yuan"},
+    {0x5186, "yen"}, {0xFDF5, "laa"}, {0xFDF7, "laa"}, {0xFDF9, "lai"}, {0xFDFB, "la"},
+    {0xFDFC, "rial"},
+};
+
+/* Russian, BGN/PCGN 1947 without diacritics: 401 Yo, 419 Y, 425 Kh, 426 Ts,
+ * 429 Shch, 42A , 439 y, 445 kh, 446 ts, 449 shch, 44A , 451 yo */
+static const transliteration_entry_t language_russian_bgn[] = {
+    {0x24, "dollar"}, {0x25, "percent"}, {0x26, "and"}, {0x3C, "less"}, {0x3E, "greater"},
+    {0x7C, "or"}, {0xA2, "cent"}, {0xA3, "pound"}, {0xA4, "currency"}, {0xA5, "yen"}, {0xA9, "(c)"},
+    {0xAA, "a"}, {0xAE, "(r)"}, {0xBA, "o"}, {0xC6, "AE"}, {0xD0, "D"}, {0xD8, "O"}, {0xDE, "TH"},
+    {0xDF, "ss"}, {0xE6, "ae"}, {0xF0, "d"}, {0xF8, "o"}, {0xFE, "th"}, {0x110, "DJ"},
+    {0x111, "dj"}, {0x131, "i"}, {0x141, "L"}, {0x142, "l"}, {0x152, "OE"}, {0x153, "oe"},
+    {0x18F, "E"}, {0x192, "f"}, {0x1C8, "LJ"}, {0x1C9, "lj"}, {0x1CB, "NJ"}, {0x1CC, "nj"},
+    {0x259, "e"}, {0x2DA, "o"}, {0x391, "A"}, {0x392, "B"}, {0x393, "G"}, {0x394, "D"},
+    {0x395, "E"}, {0x396, "Z"}, {0x397, "H"}, {0x398, "8"}, {0x399, "I"}, {0x39A, "K"},
+    {0x39B, "L"}, {0x39C, "M"}, {0x39D, "N"}, {0x39E, "3"}, {0x39F, "O"}, {0x3A0, "P"},
+    {0x3A1, "R"}, {0x3A3, "S"}, {0x3A4, "T"}, {0x3A5, "Y"}, {0x3A6, "F"}, {0x3A7, "X"},
+    {0x3A8, "PS"}, {0x3A9, "W"}, {0x3B1, "a"}, {0x3B2, "b"}, {0x3B3, "g"}, {0x3B4, "d"},
+    {0x3B5, "e"}, {0x3B6, "z"}, {0x3B7, "h"}, {0x3B8, "8"}, {0x3B9, "i"}, {0x3BA, "k"},
+    {0x3BB, "l"}, {0x3BC, "m"}, {0x3BD, "n"}, {0x3BE, "3"}, {0x3BF, "o"}, {0x3C0, "p"},
+    {0x3C1, "r"}, {0x3C2, "s"}, {0x3C3, "s"}, {0x3C4, "t"}, {0x3C5, "y"}, {0x3C6, "f"},
+    {0x3C7, "x"}, {0x3C8, "ps"}, {0x3C9, "w"}, {0x401, "Yo"}, {0x402, "DJ"}, {0x404, "Ye"},
+    {0x406, "I"}, {0x407, "Yi"}, {0x408, "J"}, {0x409, "LJ"}, {0x40A, "NJ"}, {0x40B, "C"},
+    {0x40F, "DZ"}, {0x410, "A"}, {0x411, "B"}, {0x412, "V"}, {0x413, "G"}, {0x414, "D"},
+    {0x415, "E"}, {0x416, "Zh"}, {0x417, "Z"}, {0x418, "I"}, {0x419, "Y"}, {0x41A, "K"},
+    {0x41B, "L"}, {0x41C, "M"}, {0x41D, "N"}, {0x41E, "O"}, {0x41F, "P"}, {0x420, "R"},
+    {0x421, "S"}, {0x422, "T"}, {0x423, "U"}, {0x424, "F"}, {0x425, "Kh"}, {0x426, "Ts"},
+    {0x427, "Ch"}, {0x428, "Sh"}, {0x429, "Shch"}, {0x42A, ""}, {0x42B, "Y"}, {0x42C, ""},
+    {0x42D, "E"}, {0x42E, "Yu"}, {0x42F, "Ya"}, {0x430, "a"}, {0x431, "b"}, {0x432, "v"},
+    {0x433, "g"}, {0x434, "d"}, {0x435, "e"}, {0x436, "zh"}, {0x437, "z"}, {0x438, "i"},
+    {0x439, "y"}, {0x43A, "k"}, {0x43B, "l"}, {0x43C, "m"}, {0x43D, "n"}, {0x43E, "o"},
+    {0x43F, "p"}, {0x440, "r"}, {0x441, "s"}, {0x442, "t"}, {0x443, "u"}, {0x444, "f"},
+    {0x445, "kh"}, {0x446, "ts"}, {0x447, "ch"}, {0x448, "sh"}, {0x449, "shch"}, {0x44A, ""},
+    {0x44B, "y"}, {0x44C, ""}, {0x44D, "e"}, {0x44E, "yu"}, {0x44F, "ya"}, {0x451, "yo"},
+    {0x452, "dj"}, {0x454, "ye"}, {0x456, "i"}, {0x457, "yi"}, {0x458, "j"}, {0x459, "lj"},
+    {0x45A, "nj"}, {0x45B, "c"}, {0x45D, "u"}, {0x45F, "dz"}, {0x490, "G"}, {0x491, "g"},
+    {0x492, "GH"}, {0x493, "gh"}, {0x49A, "KH"}, {0x49B, "kh"}, {0x4A2, "NG"}, {0x4A3, "ng"},
+    {0x4AE, "UE"}, {0x4AF, "ue"}, {0x4B0, "U"}, {0x4B1, "u"}, {0x4BA, "H"}, {0x4BB, "h"},
+    {0x4D8, "AE"}, {0x4D9, "ae"}, {0x4E8, "OE"}, {0x4E9, "oe"}, {0x531, "A"}, {0x532, "B"},
+    {0x533, "G"}, {0x534, "D"}, {0x535, "E"}, {0x536, "Z"}, {0x537, "E"}, {0x538, "Y"},
+    {0x539, "T"}, {0x53A, "ZH"}, {0x53B, "I"}, {0x53C, "L"}, {0x53D, "KH"}, {0x53E, "TS"},
+    {0x53F, "K"}, {0x540, "H"}, {0x541, "DZ"}, {0x542, "GH"}, {0x543, "CH"}, {0x544, "M"},
+    {0x545, "Y"}, {0x546, "N"}, {0x547, "SH"}, {0x548, "O"}, {0x549, "CH"}, {0x54A, "P"},
+    {0x54B, "J"}, {0x54C, "R"}, {0x54D, "S"}, {0x54E, "V"}, {0x54F, "T"}, {0x550, "R"},
+    {0x551, "TS"}, {0x552, "W"}, {0x553, "P"}, {0x554, "K"}, {0x555, "O"}, {0x556, "F"},
+    {0x561, "a"}, {0x562, "b"}, {0x563, "g"}, {0x564, "d"}, {0x565, "e"}, {0x566, "z"},
+    {0x567, "e"}, {0x568, "y"}, {0x569, "t"}, {0x56A, "zh"}, {0x56B, "i"}, {0x56C, "l"},
+    {0x56D, "kh"}, {0x56E, "ts"}, {0x56F, "k"}, {0x570, "h"}, {0x571, "dz"}, {0x572, "gh"},
+    {0x573, "ch"}, {0x574, "m"}, {0x575, "y"}, {0x576, "n"}, {0x577, "sh"}, {0x578, "o"},
+    {0x579, "ch"}, {0x57A, "p"}, {0x57B, "j"}, {0x57C, "r"}, {0x57D, "s"}, {0x57E, "v"},
+    {0x57F, "t"}, {0x580, "r"}, {0x581, "ts"}, {0x582, "w"}, {0x583, "p"}, {0x584, "k"},
+    {0x585, "o"}, {0x586, "f"}, {0x587, "ev"}, {0x5B1, "e"}, {0x5B2, "a"}, {0x5B3, "o"},
+    {0x5B4, "i"}, {0x5B5, "e"}, {0x5B6, "e"}, {0x5B7, "a"}, {0x5B8, "a"}, {0x5B9, "o"},
+    {0x5BA, "o"}, {0x5BB, "u"}, {0x5D0, ""}, {0x5D1, "b"}, {0x5D2, "g"}, {0x5D3, "d"}, {0x5D4, "h"},
+    {0x5D5, "v"}, {0x5D6, "z"}, {0x5D7, "kh"}, {0x5D8, "t"}, {0x5D9, "y"}, {0x5DA, "kh"},
+    {0x5DB, "k"}, {0x5DC, "l"}, {0x5DD, "m"}, {0x5DE, "m"}, {0x5DF, "n"}, {0x5E0, "n"},
+    {0x5E1, "s"}, {0x5E2, ""}, {0x5E3, "f"}, {0x5E4, "p"}, {0x5E5, "ts"}, {0x5E6, "ts"},
+    {0x5E7, "k"}, {0x5E8, "r"}, {0x5E9, "sh"}, {0x5EA, "t"}, {0x5F0, "v"}, {0x5F1, "oy"},
+    {0x5F2, "ay"}, {0x621, "a"}, {0x622, "aa"}, {0x623, "a"}, {0x624, "u"}, {0x625, "i"},
+    {0x626, "e"}, {0x627, "a"}, {0x628, "b"}, {0x629, "h"}, {0x62A, "t"}, {0x62B, "th"},
+    {0x62C, "j"}, {0x62D, "h"}, {0x62E, "kh"}, {0x62F, "d"}, {0x630, "th"}, {0x631, "r"},
+    {0x632, "z"}, {0x633, "s"}, {0x634, "sh"}, {0x635, "s"}, {0x636, "dh"}, {0x637, "t"},
+    {0x638, "z"}, {0x639, "a"}, {0x63A, "gh"}, {0x641, "f"}, {0x642, "q"}, {0x643, "k"},
+    {0x644, "l"}, {0x645, "m"}, {0x646, "n"}, {0x647, "h"}, {0x648, "w"}, {0x649, "a"},
+    {0x64A, "y"}, {0x64B, "an"}, {0x64C, "on"}, {0x64D, "en"}, {0x64E, "a"}, {0x64F, "u"},
+    {0x650, "e"}, {0x651, ""}, {0x660, "0"}, {0x661, "1"}, {0x662, "2"}, {0x663, "3"}, {0x664, "4"},
+    {0x665, "5"}, {0x666, "6"}, {0x667, "7"}, {0x668, "8"}, {0x669, "9"}, {0x67E, "p"},
+    {0x686, "ch"}, {0x698, "zh"}, {0x6A9, "k"}, {0x6AF, "g"}, {0x6CC, "y"}, {0x6F0, "0"},
+    {0x6F1, "1"}, {0x6F2, "2"}, {0x6F3, "3"}, {0x6F4, "4"}, {0x6F5, "5"}, {0x6F6, "6"},
+    {0x6F7, "7"}, {0x6F8, "8"}, {0x6F9, "9"}, {0x9CE, "t"}, {0xD7A, "n"}, {0xD7B, "n"},
+    {0xD7C, "r"}, {0xD7D, "l"}, {0xD7E, "l"}, {0xD7F, "k"}, {0x10D0, "a"}, {0x10D1, "b"},
+    {0x10D2, "g"}, {0x10D3, "d"}, {0x10D4, "e"}, {0x10D5, "v"}, {0x10D6, "z"}, {0x10D7, "t"},
+    {0x10D8, "i"}, {0x10D9, "k"}, {0x10DA, "l"}, {0x10DB, "m"}, {0x10DC, "n"}, {0x10DD, "o"},
+    {0x10DE, "p"}, {0x10DF, "zh"}, {0x10E0, "r"}, {0x10E1, "s"}, {0x10E2, "t"}, {0x10E3, "u"},
+    {0x10E4, "f"}, {0x10E5, "k"}, {0x10E6, "gh"}, {0x10E7, "q"}, {0x10E8, "sh"}, {0x10E9, "ch"},
+    {0x10EA, "ts"}, {0x10EB, "dz"}, {0x10EC, "ts"}, {0x10ED, "ch"}, {0x10EE, "kh"}, {0x10EF, "j"},
+    {0x10F0, "h"}, {0x2013, "-"}, {0x2018, "'"}, {0x2019, "'"}, {0x201C, "\""}, {0x201D, "\""},
+    {0x201E, "\""}, {0x2020, "+"}, {0x2022, "*"}, {0x2026, "..."}, {0x20A0, "ecu"},
+    {0x20A2, "cruzeiro"}, {0x20A3, "french franc"}, {0x20A4, "lira"}, {0x20A5, "mill"},
+    {0x20A6, "naira"}, {0x20A7, "peseta"}, {0x20A8, "rupee"}, {0x20A9, "won"},
+    {0x20AA, "new shequel"}, {0x20AB, "dong"}, {0x20AC, "euro"}, {0x20AD, "kip"},
+    {0x20AE, "tugrik"}, {0x20AF, "drachma"}, {0x20B0, "penny"}, {0x20B1, "peso"},
+    {0x20B2, "guarani"}, {0x20B3, "austral"}, {0x20B4, "hryvnia"}, {0x20B5, "cedi"},
+    {0x20B8, "kazakhstani tenge"}, {0x20B9, "indian rupee"}, {0x20BA, "turkish lira"},
+    {0x20BD, "russian ruble"}, {0x20BF, "bitcoin"}, {0x2120, "sm"}, {0x2122, "tm"}, {0x2202, "d"},
+    {0x2206, "delta"}, {0x2211, "sum"}, {0x221E, "infinity"}, {0x2665, "love"}, {0x5143, "yuan"},
+    {0x5186, "yen"}, {0xFDF5, "laa"}, {0xFDF7, "laa"}, {0xFDF9, "lai"}, {0xFDFB, "la"},
+    {0xFDFC, "rial"},
+};
+
+/* Russian, GOST 7.79-2000 system B without apostrophes: 401 Yo, 419 J, 425 X,
+ * 426 Cz, 429 Shh, 42A , 439 j, 445 x, 446 cz, 449 shh, 44A , 451 yo */
+static const transliteration_entry_t language_russian_gost[] = {
+    {0x24, "dollar"}, {0x25, "percent"}, {0x26, "and"}, {0x3C, "less"}, {0x3E, "greater"},
+    {0x7C, "or"}, {0xA2, "cent"}, {0xA3, "pound"}, {0xA4, "currency"}, {0xA5, "yen"}, {0xA9, "(c)"},
+    {0xAA, "a"}, {0xAE, "(r)"}, {0xBA, "o"}, {0xC6, "AE"}, {0xD0, "D"}, {0xD8, "O"}, {0xDE, "TH"},
+    {0xDF, "ss"}, {0xE6, "ae"}, {0xF0, "d"}, {0xF8, "o"}, {0xFE, "th"}, {0x110, "DJ"},
+    {0x111, "dj"}, {0x131, "i"}, {0x141, "L"}, {0x142, "l"}, {0x152, "OE"}, {0x153, "oe"},
+    {0x18F, "E"}, {0x192, "f"}, {0x1C8, "LJ"}, {0x1C9, "lj"}, {0x1CB, "NJ"}, {0x1CC, "nj"},
+    {0x259, "e"}, {0x2DA, "o"}, {0x391, "A"}, {0x392, "B"}, {0x393, "G"}, {0x394, "D"},
+    {0x395, "E"}, {0x396, "Z"}, {0x397, "H"}, {0x398, "8"}, {0x399, "I"}, {0x39A, "K"},
+    {0x39B, "L"}, {0x39C, "M"}, {0x39D, "N"}, {0x39E, "3"}, {0x39F, "O"}, {0x3A0, "P"},
+    {0x3A1, "R"}, {0x3A3, "S"}, {0x3A4, "T"}, {0x3A5, "Y"}, {0x3A6, "F"}, {0x3A7, "X"},
+    {0x3A8, "PS"}, {0x3A9, "W"}, {0x3B1, "a"}, {0x3B2, "b"}, {0x3B3, "g"}, {0x3B4, "d"},
+    {0x3B5, "e"}, {0x3B6, "z"}, {0x3B7, "h"}, {0x3B8, "8"}, {0x3B9, "i"}, {0x3BA, "k"},
+    {0x3BB, "l"}, {0x3BC, "m"}, {0x3BD, "n"}, {0x3BE, "3"}, {0x3BF, "o"}, {0x3C0, "p"},
+    {0x3C1, "r"}, {0x3C2, "s"}, {0x3C3, "s"}, {0x3C4, "t"}, {0x3C5, "y"}, {0x3C6, "f"},
+    {0x3C7, "x"}, {0x3C8, "ps"}, {0x3C9, "w"}, {0x401, "Yo"}, {0x402, "DJ"}, {0x404, "Ye"},
+    {0x406, "I"}, {0x407, "Yi"}, {0x408, "J"}, {0x409, "LJ"}, {0x40A, "NJ"}, {0x40B, "C"},
+    {0x40F, "DZ"}, {0x410, "A"}, {0x411, "B"}, {0x412, "V"}, {0x413, "G"}, {0x414, "D"},
+    {0x415, "E"}, {0x416, "Zh"}, {0x417, "Z"}, {0x418, "I"}, {0x419, "J"}, {0x41A, "K"},
+    {0x41B, "L"}, {0x41C, "M"}, {0x41D, "N"}, {0x41E, "O"}, {0x41F, "P"}, {0x420, "R"},
+    {0x421, "S"}, {0x422, "T"}, {0x423, "U"}, {0x424, "F"}, {0x425, "X"}, {0x426, "Cz"},
+    {0x427, "Ch"}, {0x428, "Sh"}, {0x429, "Shh"}, {0x42A, ""}, {0x42B, "Y"}, {0x42C, ""},
+    {0x42D, "E"}, {0x42E, "Yu"}, {0x42F, "Ya"}, {0x430, "a"}, {0x431, "b"}, {0x432, "v"},
+    {0x433, "g"}, {0x434, "d"}, {0x435, "e"}, {0x436, "zh"}, {0x437, "z"}, {0x438, "i"},
+    {0x439, "j"}, {0x43A, "k"}, {0x43B, "l"}, {0x43C, "m"}, {0x43D, "n"}, {0x43E, "o"},
+    {0x43F, "p"}, {0x440, "r"}, {0x441, "s"}, {0x442, "t"}, {0x443, "u"}, {0x444, "f"},
+    {0x445, "x"}, {0x446, "cz"}, {0x447, "ch"}, {0x448, "sh"}, {0x449, "shh"}, {0x44A, ""},
+    {0x44B, "y"}, {0x44C, ""}, {0x44D, "e"}, {0x44E, "yu"}, {0x44F, "ya"}, {0x451, "yo"},
+    {0x452, "dj"}, {0x454, "ye"}, {0x456, "i"}, {0x457, "yi"}, {0x458, "j"}, {0x459, "lj"},
+    {0x45A, "nj"}, {0x45B, "c"}, {0x45D, "u"}, {0x45F, "dz"}, {0x490, "G"}, {0x491, "g"},
+    {0x492, "GH"}, {0x493, "gh"}, {0x49A, "KH"}, {0x49B, "kh"}, {0x4A2, "NG"}, {0x4A3, "ng"},
+    {0x4AE, "UE"}, {0x4AF, "ue"}, {0x4B0, "U"}, {0x4B1, "u"}, {0x4BA, "H"}, {0x4BB, "h"},
+    {0x4D8, "AE"}, {0x4D9, "ae"}, {0x4E8, "OE"}, {0x4E9, "oe"}, {0x531, "A"}, {0x532, "B"},
+    {0x533, "G"}, {0x534, "D"}, {0x535, "E"}, {0x536, "Z"}, {0x537, "E"}, {0x538, "Y"},
+    {0x539, "T"}, {0x53A, "ZH"}, {0x53B, "I"}, {0x53C, "L"}, {0x53D, "KH"}, {0x53E, "TS"},
+    {0x53F, "K"}, {0x540, "H"}, {0x541, "DZ"}, {0x542, "GH"}, {0x543, "CH"}, {0x544, "M"},
+    {0x545, "Y"}, {0x546, "N"}, {0x547, "SH"}, {0x548, "O"}, {0x549, "CH"}, {0x54A, "P"},
+    {0x54B, "J"}, {0x54C, "R"}, {0x54D, "S"}, {0x54E, "V"}, {0x54F, "T"}, {0x550, "R"},
+    {0x551, "TS"}, {0x552, "W"}, {0x553, "P"}, {0x554, "K"}, {0x555, "O"}, {0x556, "F"},
+    {0x561, "a"}, {0x562, "b"}, {0x563, "g"}, {0x564, "d"}, {0x565, "e"}, {0x566, "z"},
+    {0x567, "e"}, {0x568, "y"}, {0x569, "t"}, {0x56A, "zh"}, {0x56B, "i"}, {0x56C, "l"},
+    {0x56D, "kh"}, {0x56E, "ts"}, {0x56F, "k"}, {0x570, "h"}, {0x571, "dz"}, {0x572, "gh"},
+    {0x573, "ch"}, {0x574, "m"}, {0x575, "y"}, {0x576, "n"}, {0x577, "sh"}, {0x578, "o"},
+    {0x579, "ch"}, {0x57A, "p"}, {0x57B, "j"}, {0x57C, "r"}, {0x57D, "s"}, {0x57E, "v"},
+    {0x57F, "t"}, {0x580, "r"}, {0x581, "ts"}, {0x582, "w"}, {0x583, "p"}, {0x584, "k"},
+    {0x585, "o"}, {0x586, "f"}, {0x587, "ev"}, {0x5B1, "e"}, {0x5B2, "a"}, {0x5B3, "o"},
+    {0x5B4, "i"}, {0x5B5, "e"}, {0x5B6, "e"}, {0x5B7, "a"}, {0x5B8, "a"}, {0x5B9, "o"},
+    {0x5BA, "o"}, {0x5BB, "u"}, {0x5D0, ""}, {0x5D1, "b"}, {0x5D2, "g"}, {0x5D3, "d"}, {0x5D4, "h"},
+    {0x5D5, "v"}, {0x5D6, "z"}, {0x5D7, "kh"}, {0x5D8, "t"}, {0x5D9, "y"}, {0x5DA, "kh"},
+    {0x5DB, "k"}, {0x5DC, "l"}, {0x5DD, "m"}, {0x5DE, "m"}, {0x5DF, "n"}, {0x5E0, "n"},
+    {0x5E1, "s"}, {0x5E2, ""}, {0x5E3, "f"}, {0x5E4, "p"}, {0x5E5, "ts"}, {0x5E6, "ts"},
+    {0x5E7, "k"}, {0x5E8, "r"}, {0x5E9, "sh"}, {0x5EA, "t"}, {0x5F0, "v"}, {0x5F1, "oy"},
+    {0x5F2, "ay"}, {0x621, "a"}, {0x622, "aa"}, {0x623, "a"}, {0x624, "u"}, {0x625, "i"},
+    {0x626, "e"}, {0x627, "a"}, {0x628, "b"}, {0x629, "h"}, {0x62A, "t"}, {0x62B, "th"},
+    {0x62C, "j"}, {0x62D, "h"}, {0x62E, "kh"}, {0x62F, "d"}, {0x630, "th"}, {0x631, "r"},
+    {0x632, "z"}, {0x633, "s"}, {0x634, "sh"}, {0x635, "s"}, {0x636, "dh"}, {0x637, "t"},
+    {0x638, "z"}, {0x639, "a"}, {0x63A, "gh"}, {0x641, "f"}, {0x642, "q"}, {0x643, "k"},
+    {0x644, "l"}, {0x645, "m"}, {0x646, "n"}, {0x647, "h"}, {0x648, "w"}, {0x649, "a"},
+    {0x64A, "y"}, {0x64B, "an"}, {0x64C, "on"}, {0x64D, "en"}, {0x64E, "a"}, {0x64F, "u"},
+    {0x650, "e"}, {0x651, ""}, {0x660, "0"}, {0x661, "1"}, {0x662, "2"}, {0x663, "3"}, {0x664, "4"},
+    {0x665, "5"}, {0x666, "6"}, {0x667, "7"}, {0x668, "8"}, {0x669, "9"}, {0x67E, "p"},
+    {0x686, "ch"}, {0x698, "zh"}, {0x6A9, "k"}, {0x6AF, "g"}, {0x6CC, "y"}, {0x6F0, "0"},
+    {0x6F1, "1"}, {0x6F2, "2"}, {0x6F3, "3"}, {0x6F4, "4"}, {0x6F5, "5"}, {0x6F6, "6"},
+    {0x6F7, "7"}, {0x6F8, "8"}, {0x6F9, "9"}, {0x9CE, "t"}, {0xD7A, "n"}, {0xD7B, "n"},
+    {0xD7C, "r"}, {0xD7D, "l"}, {0xD7E, "l"}, {0xD7F, "k"}, {0x10D0, "a"}, {0x10D1, "b"},
+    {0x10D2, "g"}, {0x10D3, "d"}, {0x10D4, "e"}, {0x10D5, "v"}, {0x10D6, "z"}, {0x10D7, "t"},
+    {0x10D8, "i"}, {0x10D9, "k"}, {0x10DA, "l"}, {0x10DB, "m"}, {0x10DC, "n"}, {0x10DD, "o"},
+    {0x10DE, "p"}, {0x10DF, "zh"}, {0x10E0, "r"}, {0x10E1, "s"}, {0x10E2, "t"}, {0x10E3, "u"},
+    {0x10E4, "f"}, {0x10E5, "k"}, {0x10E6, "gh"}, {0x10E7, "q"}, {0x10E8, "sh"}, {0x10E9, "ch"},
+    {0x10EA, "ts"}, {0x10EB, "dz"}, {0x10EC, "ts"}, {0x10ED, "ch"}, {0x10EE, "kh"}, {0x10EF, "j"},
+    {0x10F0, "h"}, {0x2013, "-"}, {0x2018, "'"}, {0x2019, "'"}, {0x201C, "\""}, {0x201D, "\""},
+    {0x201E, "\""}, {0x2020, "+"}, {0x2022, "*"}, {0x2026, "..."}, {0x20A0, "ecu"},
+    {0x20A2, "cruzeiro"}, {0x20A3, "french franc"}, {0x20A4, "lira"}, {0x20A5, "mill"},
+    {0x20A6, "naira"}, {0x20A7, "peseta"}, {0x20A8, "rupee"}, {0x20A9, "won"},
+    {0x20AA, "new shequel"}, {0x20AB, "dong"}, {0x20AC, "euro"}, {0x20AD, "kip"},
+    {0x20AE, "tugrik"}, {0x20AF, "drachma"}, {0x20B0, "penny"}, {0x20B1, "peso"},
+    {0x20B2, "guarani"}, {0x20B3, "austral"}, {0x20B4, "hryvnia"}, {0x20B5, "cedi"},
+    {0x20B8, "kazakhstani tenge"}, {0x20B9, "indian rupee"}, {0x20BA, "turkish lira"},
+    {0x20BD, "russian ruble"}, {0x20BF, "bitcoin"}, {0x2120, "sm"}, {0x2122, "tm"}, {0x2202, "d"},
+    {0x2206, "delta"}, {0x2211, "sum"}, {0x221E, "infinity"}, {0x2665, "love"}, {0x5143, "yuan"},
+    {0x5186, "yen"}, {0xFDF5, "laa"}, {0xFDF7, "laa"}, {0xFDF9, "lai"}, {0xFDFB, "la"},
+    {0xFDFC, "rial"},
+};
+
+/* Russian, ICAO Doc 9303 as in machine-readable passports: 401 E, 419 I,
+ * 425 Kh, 426 Ts, 429 Shch, 42A Ie, 42E Iu, 42F Ia, 439 i, 445 kh, 446 ts,
+ * 449 shch, 44A ie, 44E iu, 44F ia, 451 e */
+static const transliteration_entry_t language_russian_icao[] = {
+    {0x24, "dollar"}, {0x25, "percent"}, {0x26, "and"}, {0x3C, "less"}, {0x3E, "greater"},
+    {0x7C, "or"}, {0xA2, "cent"}, {0xA3, "pound"}, {0xA4, "currency"}, {0xA5, "yen"}, {0xA9, "(c)"},
+    {0xAA, "a"}, {0xAE, "(r)"}, {0xBA, "o"}, {0xC6, "AE"}, {0xD0, "D"}, {0xD8, "O"}, {0xDE, "TH"},
+    {0xDF, "ss"}, {0xE6, "ae"}, {0xF0, "d"}, {0xF8, "o"}, {0xFE, "th"}, {0x110, "DJ"},
+    {0x111, "dj"}, {0x131, "i"}, {0x141, "L"}, {0x142, "l"}, {0x152, "OE"}, {0x153, "oe"},
+    {0x18F, "E"}, {0x192, "f"}, {0x1C8, "LJ"}, {0x1C9, "lj"}, {0x1CB, "NJ"}, {0x1CC, "nj"},
+    {0x259, "e"}, {0x2DA, "o"}, {0x391, "A"}, {0x392, "B"}, {0x393, "G"}, {0x394, "D"},
+    {0x395, "E"}, {0x396, "Z"}, {0x397, "H"}, {0x398, "8"}, {0x399, "I"}, {0x39A, "K"},
+    {0x39B, "L"}, {0x39C, "M"}, {0x39D, "N"}, {0x39E, "3"}, {0x39F, "O"}, {0x3A0, "P"},
+    {0x3A1, "R"}, {0x3A3, "S"}, {0x3A4, "T"}, {0x3A5, "Y"}, {0x3A6, "F"}, {0x3A7, "X"},
+    {0x3A8, "PS"}, {0x3A9, "W"}, {0x3B1, "a"}, {0x3B2, "b"}, {0x3B3, "g"}, {0x3B4, "d"},
+    {0x3B5, "e"}, {0x3B6, "z"}, {0x3B7, "h"}, {0x3B8, "8"}, {0x3B9, "i"}, {0x3BA, "k"},
+    {0x3BB, "l"}, {0x3BC, "m"}, {0x3BD, "n"}, {0x3BE, "3"}, {0x3BF, "o"}, {0x3C0, "p"},
+    {0x3C1, "r"}, {0x3C2, "s"}, {0x3C3, "s"}, {0x3C4, "t"}, {0x3C5, "y"}, {0x3C6, "f"},
+    {0x3C7, "x"}, {0x3C8, "ps"}, {0x3C9, "w"}, {0x401, "E"}, {0x402, "DJ"}, {0x404, "Ye"},
+    {0x406, "I"}, {0x407, "Yi"}, {0x408, "J"}, {0x409, "LJ"}, {0x40A, "NJ"}, {0x40B, "C"},
+    {0x40F, "DZ"}, {0x410, "A"}, {0x411, "B"}, {0x412, "V"}, {0x413, "G"}, {0x414, "D"},
+    {0x415, "E"}, {0x416, "Zh"}, {0x417, "Z"}, {0x418, "I"}, {0x419, "I"}, {0x41A, "K"},
+    {0x41B, "L"}, {0x41C, "M"}, {0x41D, "N"}, {0x41E, "O"}, {0x41F, "P"}, {0x420, "R"},
+    {0x421, "S"}, {0x422, "T"}, {0x423, "U"}, {0x424, "F"}, {0x425, "Kh"}, {0x426, "Ts"},
+    {0x427, "Ch"}, {0x428, "Sh"}, {0x429, "Shch"}, {0x42A, "Ie"}, {0x42B, "Y"}, {0x42C, ""},
+    {0x42D, "E"}, {0x42E, "Iu"}, {0x42F, "Ia"}, {0x430, "a"}, {0x431, "b"}, {0x432, "v"},
+    {0x433, "g"}, {0x434, "d"}, {0x435, "e"}, {0x436, "zh"}, {0x437, "z"}, {0x438, "i"},
+    {0x439, "i"}, {0x43A, "k"}, {0x43B, "l"}, {0x43C, "m"}, {0x43D, "n"}, {0x43E, "o"},
+    {0x43F, "p"}, {0x440, "r"}, {0x441, "s"}, {0x442, "t"}, {0x443, "u"}, {0x444, "f"},
+    {0x445, "kh"}, {0x446, "ts"}, {0x447, "ch"}, {0x448, "sh"}, {0x449, "shch"}, {0x44A, "ie"},
+    {0x44B, "y"}, {0x44C, ""}, {0x44D, "e"}, {0x44E, "iu"}, {0x44F, "ia"}, {0x451, "e"},
+    {0x452, "dj"}, {0x454, "ye"}, {0x456, "i"}, {0x457, "yi"}, {0x458, "j"}, {0x459, "lj"},
+    {0x45A, "nj"}, {0x45B, "c"}, {0x45D, "u"}, {0x45F, "dz"}, {0x490, "G"}, {0x491, "g"},
+    {0x492, "GH"}, {0x493, "gh"}, {0x49A, "KH"}, {0x49B, "kh"}, {0x4A2, "NG"}, {0x4A3, "ng"},
+    {0x4AE, "UE"}, {0x4AF, "ue"}, {0x4B0, "U"}, {0x4B1, "u"}, {0x4BA, "H"}, {0x4BB, "h"},
+    {0x4D8, "AE"}, {0x4D9, "ae"}, {0x4E8, "OE"}, {0x4E9, "oe"}, {0x531, "A"}, {0x532, "B"},
+    {0x533, "G"}, {0x534, "D"}, {0x535, "E"}, {0x536, "Z"}, {0x537, "E"}, {0x538, "Y"},
+    {0x539, "T"}, {0x53A, "ZH"}, {0x53B, "I"}, {0x53C, "L"}, {0x53D, "KH"}, {0x53E, "TS"},
+    {0x53F, "K"}, {0x540, "H"}, {0x541, "DZ"}, {0x542, "GH"}, {0x543, "CH"}, {0x544, "M"},
+    {0x545, "Y"}, {0x546, "N"}, {0x547, "SH"}, {0x548, "O"}, {0x549, "CH"}, {0x54A, "P"},
+    {0x54B, "J"}, {0x54C, "R"}, {0x54D, "S"}, {0x54E, "V"}, {0x54F, "T"}, {0x550, "R"},
+    {0x551, "TS"}, {0x552, "W"}, {0x553, "P"}, {0x554, "K"}, {0x555, "O"}, {0x556, "F"},
+    {0x561, "a"}, {0x562, "b"}, {0x563, "g"}, {0x564, "d"}, {0x565, "e"}, {0x566, "z"},
+    {0x567, "e"}, {0x568, "y"}, {0x569, "t"}, {0x56A, "zh"}, {0x56B, "i"}, {0x56C, "l"},
+    {0x56D, "kh"}, {0x56E, "ts"}, {0x56F, "k"}, {0x570, "h"}, {0x571, "dz"}, {0x572, "gh"},
+    {0x573, "ch"}, {0x574, "m"}, {0x575, "y"}, {0x576, "n"}, {0x577, "sh"}, {0x578, "o"},
+    {0x579, "ch"}, {0x57A, "p"}, {0x57B, "j"}, {0x57C, "r"}, {0x57D, "s"}, {0x57E, "v"},
+    {0x57F, "t"}, {0x580, "r"}, {0x581, "ts"}, {0x582, "w"}, {0x583, "p"}, {0x584, "k"},
+    {0x585, "o"}, {0x586, "f"}, {0x587, "ev"}, {0x5B1, "e"}, {0x5B2, "a"}, {0x5B3, "o"},
+    {0x5B4, "i"}, {0x5B5, "e"}, {0x5B6, "e"}, {0x5B7, "a"}, {0x5B8, "a"}, {0x5B9, "o"},
+    {0x5BA, "o"}, {0x5BB, "u"}, {0x5D0, ""}, {0x5D1, "b"}, {0x5D2, "g"}, {0x5D3, "d"}, {0x5D4, "h"},
+    {0x5D5, "v"}, {0x5D6, "z"}, {0x5D7, "kh"}, {0x5D8, "t"}, {0x5D9, "y"}, {0x5DA, "kh"},
+    {0x5DB, "k"}, {0x5DC, "l"}, {0x5DD, "m"}, {0x5DE, "m"}, {0x5DF, "n"}, {0x5E0, "n"},
+    {0x5E1, "s"}, {0x5E2, ""}, {0x5E3, "f"}, {0x5E4, "p"}, {0x5E5, "ts"}, {0x5E6, "ts"},
+    {0x5E7, "k"}, {0x5E8, "r"}, {0x5E9, "sh"}, {0x5EA, "t"}, {0x5F0, "v"}, {0x5F1, "oy"},
+    {0x5F2, "ay"}, {0x621, "a"}, {0x622, "aa"}, {0x623, "a"}, {0x624, "u"}, {0x625, "i"},
+    {0x626, "e"}, {0x627, "a"}, {0x628, "b"}, {0x629, "h"}, {0x62A, "t"}, {0x62B, "th"},
+    {0x62C, "j"}, {0x62D, "h"}, {0x62E, "kh"}, {0x62F, "d"}, {0x630, "th"}, {0x631, "r"},
+    {0x632, "z"}, {0x633, "s"}, {0x634, "sh"}, {0x635, "s"}, {0x636, "dh"}, {0x637, "t"},
+    {0x638, "z"}, {0x639, "a"}, {0x63A, "gh"}, {0x641, "f"}, {0x642, "q"}, {0x643, "k"},
+    {0x644, "l"}, {0x645, "m"}, {0x646, "n"}, {0x647, "h"}, {0x648, "w"}, {0x649, "a"},
+    {0x64A, "y"}, {0x64B, "an"}, {0x64C, "on"}, {0x64D, "en"}, {0x64E, "a"}, {0x64F, "u"},
+    {0x650, "e"}, {0x651, ""}, {0x660, "0"}, {0x661, "1"}, {0x662, "2"}, {0x663, "3"}, {0x664, "4"},
+    {0x665, "5"}, {0x666, "6"}, {0x667, "7"}, {0x668, "8"}, {0x669, "9"}, {0x67E, "p"},
+    {0x686, "ch"}, {0x698, "zh"}, {0x6A9, "k"}, {0x6AF, "g"}, {0x6CC, "y"}, {0x6F0, "0"},
+    {0x6F1, "1"}, {0x6F2, "2"}, {0x6F3, "3"}, {0x6F4, "4"}, {0x6F5, "5"}, {0x6F6, "6"},
+    {0x6F7, "7"}, {0x6F8, "8"}, {0x6F9, "9"}, {0x9CE, "t"}, {0xD7A, "n"}, {0xD7B, "n"},
+    {0xD7C, "r"}, {0xD7D, "l"}, {0xD7E, "l"}, {0xD7F, "k"}, {0x10D0, "a"}, {0x10D1, "b"},
+    {0x10D2, "g"}, {0x10D3, "d"}, {0x10D4, "e"}, {0x10D5, "v"}, {0x10D6, "z"}, {0x10D7, "t"},
+    {0x10D8, "i"}, {0x10D9, "k"}, {0x10DA, "l"}, {0x10DB, "m"}, {0x10DC, "n"}, {0x10DD, "o"},
+    {0x10DE, "p"}, {0x10DF, "zh"}, {0x10E0, "r"}, {0x10E1, "s"}, {0x10E2, "t"}, {0x10E3, "u"},
+    {0x10E4, "f"}, {0x10E5, "k"}, {0x10E6, "gh"}, {0x10E7, "q"}, {0x10E8, "sh"}, {0x10E9, "ch"},
+    {0x10EA, "ts"}, {0x10EB, "dz"}, {0x10EC, "ts"}, {0x10ED, "ch"}, {0x10EE, "kh"}, {0x10EF, "j"},
+    {0x10F0, "h"}, {0x2013, "-"}, {0x2018, "'"}, {0x2019, "'"}, {0x201C, "\""}, {0x201D, "\""},
+    {0x201E, "\""}, {0x2020, "+"}, {0x2022, "*"}, {0x2026, "..."}, {0x20A0, "ecu"},
+    {0x20A2, "cruzeiro"}, {0x20A3, "french franc"}, {0x20A4, "lira"}, {0x20A5, "mill"},
+    {0x20A6, "naira"}, {0x20A7, "peseta"}, {0x20A8, "rupee"}, {0x20A9, "won"},
+    {0x20AA, "new shequel"}, {0x20AB, "dong"}, {0x20AC, "euro"}, {0x20AD, "kip"},
+    {0x20AE, "tugrik"}, {0x20AF, "drachma"}, {0x20B0, "penny"}, {0x20B1, "peso"},
+    {0x20B2, "guarani"}, {0x20B3, "austral"}, {0x20B4, "hryvnia"}, {0x20B5, "cedi"},
+    {0x20B8, "kazakhstani tenge"}, {0x20B9, "indian rupee"}, {0x20BA, "turkish lira"},
+    {0x20BD, "russian ruble"}, {0x20BF, "bitcoin"}, {0x2120, "sm"}, {0x2122, "tm"}, {0x2202, "d"},
+    {0x2206, "delta"}, {0x2211, "sum"}, {0x221E, "infinity"}, {0x2665, "love"}, {0x5143, "yuan"},
+    {0x5186, "yen"}, {0xFDF5, "laa"}, {0xFDF7, "laa"}, {0xFDF9, "lai"}, {0xFDFB, "la"},
+    {0xFDFC, "rial"},
+};
+
+/* Ukrainian national system (2010), word-initial forms: 404 Ye, 407 Yi,
+ * 413 H, 418 Y, 419 Y, 425 Kh, 426 Ts, 429 Shch, 433 h, 438 y, 439 y, 445 kh,
+ * 446 ts, 449 shch, 454 ye, 457 yi, 2BC , 2019  */
+static const transliteration_entry_t language_ukrainian[] = {
+    {0x24, "dollar"}, {0x25, "percent"}, {0x26, "and"}, {0x3C, "less"}, {0x3E, "greater"},
+    {0x7C, "or"}, {0xA2, "cent"}, {0xA3, "pound"}, {0xA4, "currency"}, {0xA5, "yen"}, {0xA9, "(c)"},
+    {0xAA, "a"}, {0xAE, "(r)"}, {0xBA, "o"}, {0xC6, "AE"}, {0xD0, "D"}, {0xD8, "O"}, {0xDE, "TH"},
+    {0xDF, "ss"}, {0xE6, "ae"}, {0xF0, "d"}, {0xF8, "o"}, {0xFE, "th"}, {0x110, "DJ"},
+    {0x111, "dj"}, {0x131, "i"}, {0x141, "L"}, {0x142, "l"}, {0x152, "OE"}, {0x153, "oe"},
+    {0x18F, "E"}, {0x192, "f"}, {0x1C8, "LJ"}, {0x1C9, "lj"}, {0x1CB, "NJ"}, {0x1CC, "nj"},
+    {0x259, "e"}, {0x2BC, ""}, {0x2DA, "o"}, {0x391, "A"}, {0x392, "B"}, {0x393, "G"}, {0x394, "D"},
+    {0x395, "E"}, {0x396, "Z"}, {0x397, "H"}, {0x398, "8"}, {0x399, "I"}, {0x39A, "K"},
+    {0x39B, "L"}, {0x39C, "M"}, {0x39D, "N"}, {0x39E, "3"}, {0x39F, "O"}, {0x3A0, "P"},
+    {0x3A1, "R"}, {0x3A3, "S"}, {0x3A4, "T"}, {0x3A5, "Y"}, {0x3A6, "F"}, {0x3A7, "X"},
+    {0x3A8, "PS"}, {0x3A9, "W"}, {0x3B1, "a"}, {0x3B2, "b"}, {0x3B3, "g"}, {0x3B4, "d"},
+    {0x3B5, "e"}, {0x3B6, "z"}, {0x3B7, "h"}, {0x3B8, "8"}, {0x3B9, "i"}, {0x3BA, "k"},
+    {0x3BB, "l"}, {0x3BC, "m"}, {0x3BD, "n"}, {0x3BE, "3"}, {0x3BF, "o"}, {0x3C0, "p"},
+    {0x3C1, "r"}, {0x3C2, "s"}, {0x3C3, "s"}, {0x3C4, "t"}, {0x3C5, "y"}, {0x3C6, "f"},
+    {0x3C7, "x"}, {0x3C8, "ps"}, {0x3C9, "w"}, {0x401, "Yo"}, {0x402, "DJ"}, {0x404, "Ye"},
+    {0x406, "I"}, {0x407, "Yi"}, {0x408, "J"}, {0x409, "LJ"}, {0x40A, "NJ"}, {0x40B, "C"},
+    {0x40F, "DZ"}, {0x410, "A"}, {0x411, "B"}, {0x412, "V"}, {0x413, "H"}, {0x414, "D"},
+    {0x415, "E"}, {0x416, "Zh"}, {0x417, "Z"}, {0x418, "Y"}, {0x419, "Y"}, {0x41A, "K"},
+    {0x41B, "L"}, {0x41C, "M"}, {0x41D, "N"}, {0x41E, "O"}, {0x41F, "P"}, {0x420, "R"},
+    {0x421, "S"}, {0x422, "T"}, {0x423, "U"}, {0x424, "F"}, {0x425, "Kh"}, {0x426, "Ts"},
+    {0x427, "Ch"}, {0x428, "Sh"}, {0x429, "Shch"}, {0x42A, "U"}, {0x42B, "Y"}, {0x42C, ""},
+    {0x42D, "E"}, {0x42E, "Yu"}, {0x42F, "Ya"}, {0x430, "a"}, {0x431, "b"}, {0x432, "v"},
+    {0x433, "h"}, {0x434, "d"}, {0x435, "e"}, {0x436, "zh"}, {0x437, "z"}, {0x438, "y"},
+    {0x439, "y"}, {0x43A, "k"}, {0x43B, "l"}, {0x43C, "m"}, {0x43D, "n"}, {0x43E, "o"},
+    {0x43F, "p"}, {0x440, "r"}, {0x441, "s"}, {0x442, "t"}, {0x443, "u"}, {0x444, "f"},
+    {0x445, "kh"}, {0x446, "ts"}, {0x447, "ch"}, {0x448, "sh"}, {0x449, "shch"}, {0x44A, "u"},
+    {0x44B, "y"}, {0x44C, ""}, {0x44D, "e"}, {0x44E, "yu"}, {0x44F, "ya"}, {0x451, "yo"},
+    {0x452, "dj"}, {0x454, "ye"}, {0x456, "i"}, {0x457, "yi"}, {0x458, "j"}, {0x459, "lj"},
+    {0x45A, "nj"}, {0x45B, "c"}, {0x45D, "u"}, {0x45F, "dz"}, {0x490, "G"}, {0x491, "g"},
+    {0x492, "GH"}, {0x493, "gh"}, {0x49A, "KH"}, {0x49B, "kh"}, {0x4A2, "NG"}, {0x4A3, "ng"},
+    {0x4AE, "UE"}, {0x4AF, "ue"}, {0x4B0, "U"}, {0x4B1, "u"}, {0x4BA, "H"}, {0x4BB, "h"},
+    {0x4D8, "AE"}, {0x4D9, "ae"}, {0x4E8, "OE"}, {0x4E9, "oe"}, {0x531, "A"}, {0x532, "B"},
+    {0x533, "G"}, {0x534, "D"}, {0x535, "E"}, {0x536, "Z"}, {0x537, "E"}, {0x538, "Y"},
+    {0x539, "T"}, {0x53A, "ZH"}, {0x53B, "I"}, {0x53C, "L"}, {0x53D, "KH"}, {0x53E, "TS"},
+    {0x53F, "K"}, {0x540, "H"}, {0x541, "DZ"}, {0x542, "GH"}, {0x543, "CH"}, {0x544, "M"},
+    {0x545, "Y"}, {0x546, "N"}, {0x547, "SH"}, {0x548, "O"}, {0x549, "CH"}, {0x54A, "P"},
+    {0x54B, "J"}, {0x54C, "R"}, {0x54D, "S"}, {0x54E, "V"}, {0x54F, "T"}, {0x550, "R"},
+    {0x551, "TS"}, {0x552, "W"}, {0x553, "P"}, {0x554, "K"}, {0x555, "O"}, {0x556, "F"},
+    {0x561, "a"}, {0x562, "b"}, {0x563, "g"}, {0x564, "d"}, {0x565, "e"}, {0x566, "z"},
+    {0x567, "e"}, {0x568, "y"}, {0x569, "t"}, {0x56A, "zh"}, {0x56B, "i"}, {0x56C, "l"},
+    {0x56D, "kh"}, {0x56E, "ts"}, {0x56F, "k"}, {0x570, "h"}, {0x571, "dz"}, {0x572, "gh"},
+    {0x573, "ch"}, {0x574, "m"}, {0x575, "y"}, {0x576, "n"}, {0x577, "sh"}, {0x578, "o"},
+    {0x579, "ch"}, {0x57A, "p"}, {0x57B, "j"}, {0x57C, "r"}, {0x57D, "s"}, {0x57E, "v"},
+    {0x57F, "t"}, {0x580, "r"}, {0x581, "ts"}, {0x582, "w"}, {0x583, "p"}, {0x584, "k"},
+    {0x585, "o"}, {0x586, "f"}, {0x587, "ev"}, {0x5B1, "e"}, {0x5B2, "a"}, {0x5B3, "o"},
+    {0x5B4, "i"}, {0x5B5, "e"}, {0x5B6, "e"}, {0x5B7, "a"}, {0x5B8, "a"}, {0x5B9, "o"},
+    {0x5BA, "o"}, {0x5BB, "u"}, {0x5D0, ""}, {0x5D1, "b"}, {0x5D2, "g"}, {0x5D3, "d"}, {0x5D4, "h"},
+    {0x5D5, "v"}, {0x5D6, "z"}, {0x5D7, "kh"}, {0x5D8, "t"}, {0x5D9, "y"}, {0x5DA, "kh"},
+    {0x5DB, "k"}, {0x5DC, "l"}, {0x5DD, "m"}, {0x5DE, "m"}, {0x5DF, "n"}, {0x5E0, "n"},
+    {0x5E1, "s"}, {0x5E2, ""}, {0x5E3, "f"}, {0x5E4, "p"}, {0x5E5, "ts"}, {0x5E6, "ts"},
+    {0x5E7, "k"}, {0x5E8, "r"}, {0x5E9, "sh"}, {0x5EA, "t"}, {0x5F0, "v"}, {0x5F1, "oy"},
+    {0x5F2, "ay"}, {0x621, "a"}, {0x622, "aa"}, {0x623, "a"}, {0x624, "u"}, {0x625, "i"},
+    {0x626, "e"}, {0x627, "a"}, {0x628, "b"}, {0x629, "h"}, {0x62A, "t"}, {0x62B, "th"},
+    {0x62C, "j"}, {0x62D, "h"}, {0x62E, "kh"}, {0x62F, "d"}, {0x630, "th"}, {0x631, "r"},
+    {0x632, "z"}, {0x633, "s"}, {0x634, "sh"}, {0x635, "s"}, {0x636, "dh"}, {0x637, "t"},
+    {0x638, "z"}, {0x639, "a"}, {0x63A, "gh"}, {0x641, "f"}, {0x642, "q"}, {0x643, "k"},
+    {0x644, "l"}, {0x645, "m"}, {0x646, "n"}, {0x647, "h"}, {0x648, "w"}, {0x649, "a"},
+    {0x64A, "y"}, {0x64B, "an"}, {0x64C, "on"}, {0x64D, "en"}, {0x64E, "a"}, {0x64F, "u"},
+    {0x650, "e"}, {0x651, ""}, {0x660, "0"}, {0x661, "1"}, {0x662, "2"}, {0x663, "3"}, {0x664, "4"},
+    {0x665, "5"}, {0x666, "6"}, {0x667, "7"}, {0x668, "8"}, {0x669, "9"}, {0x67E, "p"},
+    {0x686, "ch"}, {0x698, "zh"}, {0x6A9, "k"}, {0x6AF, "g"}, {0x6CC, "y"}, {0x6F0, "0"},
+    {0x6F1, "1"}, {0x6F2, "2"}, {0x6F3, "3"}, {0x6F4, "4"}, {0x6F5, "5"}, {0x6F6, "6"},
+    {0x6F7, "7"}, {0x6F8, "8"}, {0x6F9, "9"}, {0x9CE, "t"}, {0xD7A, "n"}, {0xD7B, "n"},
+    {0xD7C, "r"}, {0xD7D, "l"}, {0xD7E, "l"}, {0xD7F, "k"}, {0x10D0, "a"}, {0x10D1, "b"},
+    {0x10D2, "g"}, {0x10D3, "d"}, {0x10D4, "e"}, {0x10D5, "v"}, {0x10D6, "z"}, {0x10D7, "t"},
+    {0x10D8, "i"}, {0x10D9, "k"}, {0x10DA, "l"}, {0x10DB, "m"}, {0x10DC, "n"}, {0x10DD, "o"},
+    {0x10DE, "p"}, {0x10DF, "zh"}, {0x10E0, "r"}, {0x10E1, "s"}, {0x10E2, "t"}, {0x10E3, "u"},
+    {0x10E4, "f"}, {0x10E5, "k"}, {0x10E6, "gh"}, {0x10E7, "q"}, {0x10E8, "sh"}, {0x10E9, "ch"},
+    {0x10EA, "ts"}, {0x10EB, "dz"}, {0x10EC, "ts"}, {0x10ED, "ch"}, {0x10EE, "kh"}, {0x10EF, "j"},
+    {0x10F0, "h"}, {0x2013, "-"}, {0x2018, "'"}, {0x2019, ""}, {0x201C, "\""}, {0x201D, "\""},
+    {0x201E, "\""}, {0x2020, "+"}, {0x2022, "*"}, {0x2026, "..."}, {0x20A0, "ecu"},
+    {0x20A2, "cruzeiro"}, {0x20A3, "french franc"}, {0x20A4, "lira"}, {0x20A5, "mill"},
+    {0x20A6, "naira"}, {0x20A7, "peseta"}, {0x20A8, "rupee"}, {0x20A9, "won"},
+    {0x20AA, "new shequel"}, {0x20AB, "dong"}, {0x20AC, "euro"}, {0x20AD, "kip"},
+    {0x20AE, "tugrik"}, {0x20AF, "drachma"}, {0x20B0, "penny"}, {0x20B1, "peso"},
+    {0x20B2, "guarani"}, {0x20B3, "austral"}, {0x20B4, "hryvnia"}, {0x20B5, "cedi"},
+    {0x20B8, "kazakhstani tenge"}, {0x20B9, "indian rupee"}, {0x20BA, "turkish lira"},
+    {0x20BD, "russian ruble"}, {0x20BF, "bitcoin"}, {0x2120, "sm"}, {0x2122, "tm"}, {0x2202, "d"},
+    {0x2206, "delta"}, {0x2211, "sum"}, {0x221E, "infinity"}, {0x2665, "love"}, {0x5143, "yuan"},
+    {0x5186, "yen"}, {0xFDF5, "laa"}, {0xFDF7, "laa"}, {0xFDF9, "lai"}, {0xFDFB, "la"},
+    {0xFDFC, "rial"},
+};
+
+#define LANGUAGE_TABLE(entries) {entries, sizeof(entries) / sizeof(entries[0]), NULL, 0}
+
+static const slugify_table_t language_tables[SLUGIFY_LANG_COUNT] = {
+    [SLUGIFY_LANG_GERMAN] = LANGUAGE_TABLE(language_german),
+    [SLUGIFY_LANG_DANISH] = LANGUAGE_TABLE(language_scandinavian),
+    [SLUGIFY_LANG_NORWEGIAN] = LANGUAGE_TABLE(language_scandinavian),
+    [SLUGIFY_LANG_RUSSIAN_BGN] = LANGUAGE_TABLE(language_russian_bgn),
+    [SLUGIFY_LANG_RUSSIAN_GOST] = LANGUAGE_TABLE(language_russian_gost),
+    [SLUGIFY_LANG_RUSSIAN_ICAO] = LANGUAGE_TABLE(language_russian_icao),
+    [SLUGIFY_LANG_UKRAINIAN] = LANGUAGE_TABLE(language_ukrainian),
+};
+
+#endif
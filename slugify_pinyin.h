@@ -0,0 +1,2091 @@
+#ifndef SLUGIFY_PINYIN_H
+#define SLUGIFY_PINYIN_H
+
+/* Toneless Hanyu Pinyin for the BMP Han ideograph blocks, included only by
+ * slugify.c. Generated with the ICU "Han-Latin; Latin-ASCII" transform.
+ *
+ * Each ideograph stores a 9-bit index into pinyin_syllables (0 = unknown).
+ * The code points of a range are cut into blocks of 64. Blocks with no
+ * reading are left out of pinyin_blocks; pinyin_directory maps a block
+ * number to its packed data, or to PINYIN_NO_BLOCK.
+ * 27144 ideographs, 410 syllables, 31609 bytes of packed data. */
+
+#define PINYIN_NO_BLOCK 0xFFFF
+#define PINYIN_BITS 9
+
+static const char pinyin_syllables[410][7] = {
+    "a", "ai", "an", "ang", "ao", "ba", "bai", "ban", "bang", "bao",
+    "bei", "ben", "beng", "bi", "bian", "biao", "bie", "bin", "bing", "bo",
+    "bu", "ca", "cai", "can", "cang", "cao", "ce", "cen", "ceng", "cha",
+    "chai", "chan", "chang", "chao", "che", "chen", "cheng", "chi", "chong", "chou",
+    "chu", "chua", "chuai", "chuan", "chuang", "chui", "chun", "chuo", "ci", "cong",
+    "cou", "cu", "cuan", "cui", "cun", "cuo", "da", "dai", "dan", "dang",
+    "dao", "de", "den", "deng", "di", "dian", "diao", "die", "ding", "diu",
+    "dong", "dou", "du", "duan", "dui", "dun", "duo", "e", "ei", "en",
+    "eng", "er", "fa", "fan", "fang", "fei", "fen", "feng", "fiao", "fo",
+    "fou", "fu", "ga", "gai", "gan", "gang", "gao", "ge", "gei", "gen",
+    "geng", "gong", "gou", "gu", "gua", "guai", "guan", "guang", "gui", "gun",
+    "guo", "ha", "hai", "han", "hang", "hao", "he", "hei", "hen", "heng",
+    "hm", "hong", "hou", "hu", "hua", "huai", "huan", "huang", "hui", "hun",
+    "huo", "ji", "jia", "jian", "jiang", "jiao", "jie", "jin", "jing", "jiong",
+    "jiu", "ju", "juan", "jue", "jun", "ka", "kai", "kan", "kang", "kao",
+    "ke", "kei", "ken", "keng", "kong", "kou", "ku", "kua", "kuai", "kuan",
+    "kuang", "kui", "kun", "kuo", "la", "lai", "lan", "lang", "lao", "le",
+    "lei", "leng", "li", "lia", "lian", "liang", "liao", "lie", "lin", "ling",
+    "liu", "lo", "long", "lou", "lu", "luan", "lue", "lun", "luo", "m",
+    "ma", "mai", "man", "mang", "mao", "me", "mei", "men", "meng", "mi",
+    "mian", "miao", "mie", "min", "ming", "miu", "mo", "mou", "mu", "n",
+    "na", "nai", "nan", "nang", "nao", "ne", "nei", "nen", "neng", "ni",
+    "nian", "niang", "niao", "nie", "nin", "ning", "niu", "nong", "nou", "nu",
+    "nuan", "nue", "nun", "nuo", "o", "ou", "pa", "pai", "pan", "pang",
+    "pao", "pei", "pen", "peng", "pi", "pian", "piao", "pie", "pin", "ping",
+    "po", "pou", "pu", "qi", "qia", "qian", "qiang", "qiao", "qie", "qin",
+    "qing", "qiong", "qiu", "qu", "quan", "que", "qun", "ran", "rang", "rao",
+    "re", "ren", "reng", "ri", "rong", "rou", "ru", "rua", "ruan", "rui",
+    "run", "ruo", "sa", "sai", "san", "sang", "sao", "se", "sen", "seng",
+    "sha", "shai", "shan", "shang", "shao", "she", "shei", "shen", "sheng", "shi",
+    "shou", "shu", "shua", "shuai", "shuan", "shuang", "shui", "shun", "shuo", "si",
+    "song", "sou", "su", "suan", "sui", "sun", "suo", "ta", "tai", "tan",
+    "tang", "tao", "te", "teng", "ti", "tian", "tiao", "tie", "ting", "tong",
+    "tou", "tu", "tuan", "tui", "tun", "tuo", "wa", "wai", "wan", "wang",
+    "wei", "wen", "weng", "wo", "wu", "xi", "xia", "xian", "xiang", "xiao",
+    "xie", "xin", "xing", "xiong", "xiu", "xu", "xuan", "xue", "xun", "ya",
+    "yan", "yang", "yao", "ye", "yi", "yin", "ying", "yo", "yong", "you",
+    "yu", "yuan", "yue", "yun", "za", "zai", "zan", "zang", "zao", "ze",
+    "zei", "zen", "zeng", "zha", "zhai", "zhan", "zhang", "zhao", "zhe", "zhen",
+    "zheng", "zhi", "zhong", "zhou", "zhu", "zhua", "zhuai", "zhuan", "zhuang", "zhui",
+    "zhun", "zhuo", "zi", "zong", "zou", "zu", "zuan", "zui", "zun", "zuo",
+};
+
+static const struct
+{
+    uint32_t first;
+    uint32_t last;
+    uint16_t directory; /* First pinyin_directory entry of the range */
+} pinyin_ranges[] = {
+    {0x3400, 0x4DBF, 0}, /* CJK Unified Ideographs Extension A */
+    {0x4E00, 0x9FFF, 103}, /* CJK Unified Ideographs */
+    {0xF900, 0xFAFF, 431}, /* CJK Compatibility Ideographs */
+};
+
+static const uint16_t pinyin_directory[439] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B,
+    0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+    0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023,
+    0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B,
+    0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053,
+    0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B,
+    0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+    0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083,
+    0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B,
+    0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+    0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3,
+    0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+    0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB,
+    0x00CC, 0x00CD, 0x00CE, 0x00CF, 0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7,
+    0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF, 0x00E0, 0x00E1, 0x00E2, 0x00E3,
+    0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+    0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB,
+    0x00FC, 0x00FD, 0x00FE, 0x00FF, 0x0100, 0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0107,
+    0x0108, 0x0109, 0x010A, 0x010B, 0x010C, 0x010D, 0x010E, 0x010F, 0x0110, 0x0111, 0x0112, 0x0113,
+    0x0114, 0x0115, 0x0116, 0x0117, 0x0118, 0x0119, 0x011A, 0x011B, 0x011C, 0x011D, 0x011E, 0x011F,
+    0x0120, 0x0121, 0x0122, 0x0123, 0x0124, 0x0125, 0x0126, 0x0127, 0x0128, 0x0129, 0x012A, 0x012B,
+    0x012C, 0x012D, 0x012E, 0x012F, 0x0130, 0x0131, 0x0132, 0x0133, 0x0134, 0x0135, 0x0136, 0x0137,
+    0x0138, 0x0139, 0x013A, 0x013B, 0x013C, 0x013D, 0x013E, 0x013F, 0x0140, 0x0141, 0x0142, 0x0143,
+    0x0144, 0x0145, 0x0146, 0x0147, 0x0148, 0x0149, 0x014A, 0x014B, 0x014C, 0x014D, 0x014E, 0x014F,
+    0x0150, 0x0151, 0x0152, 0x0153, 0x0154, 0x0155, 0x0156, 0x0157, 0x0158, 0x0159, 0x015A, 0x015B,
+    0x015C, 0x015D, 0x015E, 0x015F, 0x0160, 0x0161, 0x0162, 0x0163, 0x0164, 0x0165, 0x0166, 0x0167,
+    0x0168, 0x0169, 0x016A, 0x016B, 0x016C, 0x016D, 0x016E, 0x016F, 0x0170, 0x0171, 0x0172, 0x0173,
+    0x0174, 0x0175, 0x0176, 0x0177, 0x0178, 0x0179, 0x017A, 0x017B, 0x017C, 0x017D, 0x017E, 0x017F,
+    0x0180, 0x0181, 0x0182, 0x0183, 0x0184, 0x0185, 0x0186, 0x0187, 0x0188, 0x0189, 0x018A, 0x018B,
+    0x018C, 0x018D, 0x018E, 0x018F, 0x0190, 0x0191, 0x0192, 0x0193, 0x0194, 0x0195, 0x0196, 0x0197,
+    0x0198, 0x0199, 0x019A, 0x019B, 0x019C, 0x019D, 0x019E, 0x019F, 0x01A0, 0x01A1, 0x01A2, 0x01A3,
+    0x01A4, 0x01A5, 0x01A6, 0x01A7, 0x01A8, 0x01A9, 0x01AA, 0x01AB, 0x01AC, 0x01AD, 0x01AE, 0x01AF,
+    0x01B0, 0x01B1, 0x01B2, 0x01B3, 0x01B4, 0x01B5, 0x01B6,
+};
+
+/* One trailing byte of padding keeps the 16-bit read of the last value in bounds */
+static const uint8_t pinyin_blocks[31609] = {
+    0x07, 0x8D, 0x02, 0x00, 0xE0, 0x29, 0xAB, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x16, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x01, 0x00, 0xB0, 0x03, 0x00, 0x00, 0x00, 0x64, 0xC3, 0x02,
+    0x10, 0x5B, 0x6B, 0x56, 0xD7, 0xB8, 0x60, 0x0D, 0xEB, 0xC8, 0xFA, 0xAE, 0x22, 0x80, 0x5F, 0x00,
+    0xDB, 0xBA, 0xCD, 0x56, 0x02, 0x0B, 0x00, 0x00, 0x00, 0x24, 0x57, 0x29, 0x90, 0x55, 0x33, 0x00,
+    0xC5, 0x47, 0x72, 0xB6, 0x35, 0x18, 0x6A, 0xD5, 0xB5, 0xC5, 0x2E, 0x01, 0x00, 0x00, 0x40, 0x16,
+    0x00, 0x00, 0x95, 0x89, 0x88, 0xA8, 0xCB, 0xD9, 0xF6, 0xD6, 0xDB, 0x06, 0x00, 0x00, 0x00, 0x38,
+    0xA5, 0xAC, 0x6D, 0x2B, 0x42, 0x73, 0x7B, 0x7D, 0x00, 0x00, 0x00, 0x80, 0x20, 0xB2, 0x81, 0x1C,
+    0x02, 0x50, 0x0C, 0x40, 0x8E, 0xD6, 0x9F, 0x6B, 0x03, 0x45, 0xFA, 0xB5, 0x2B, 0xE8, 0x5A, 0xC2,
+    0x81, 0xE7, 0x4A, 0x96, 0xC2, 0xD0, 0x9F, 0x89, 0xAC, 0x72, 0x82, 0x82, 0xB4, 0x69, 0x70, 0xD5,
+    0x46, 0x00, 0x00, 0x44, 0xF5, 0xF3, 0xE9, 0x52, 0x2D, 0xBB, 0x9F, 0x00, 0x92, 0xB9, 0x1D, 0x32,
+    0x77, 0x59, 0xA4, 0x6F, 0x5F, 0xE5, 0x02, 0x00, 0x30, 0x02, 0xCB, 0xAA, 0x56, 0x00, 0x7A, 0x01,
+    0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x5C, 0x80, 0x85, 0x66, 0x18, 0x80, 0x34, 0x3B,
+    0x01, 0x00, 0x18, 0x16, 0x2C, 0x21, 0xCB, 0x56, 0x00, 0xA8, 0x72, 0x4A, 0x62, 0x38, 0x29, 0x00,
+    0x00, 0x13, 0x06, 0x1D, 0x31, 0x53, 0x02, 0x00, 0x41, 0x46, 0xB9, 0xC2, 0x02, 0xA8, 0xF6, 0x15,
+    0x80, 0x83, 0x44, 0x39, 0x01, 0x98, 0x01, 0x20, 0x37, 0xEC, 0xBF, 0x7A, 0x42, 0xB8, 0xF4, 0xFA,
+    0xF7, 0x2F, 0xE8, 0x81, 0x2F, 0x31, 0xCA, 0xA2, 0x02, 0x00, 0x00, 0xE5, 0x90, 0x56, 0x7D, 0x96,
+    0xDA, 0x0B, 0x72, 0xD1, 0xC9, 0xC0, 0xB6, 0x92, 0x31, 0x1A, 0x02, 0x60, 0xE2, 0x84, 0x56, 0x00,
+    0xBB, 0x80, 0xCC, 0x82, 0x94, 0xD3, 0x6B, 0x5E, 0x00, 0x00, 0x16, 0x0B, 0x36, 0x54, 0x59, 0xC5,
+    0xD7, 0x56, 0x00, 0x4C, 0x68, 0x35, 0x04, 0x80, 0x10, 0x00, 0x2B, 0x29, 0x1A, 0x24, 0x02, 0x60,
+    0x00, 0xD6, 0x27, 0x00, 0x5B, 0x23, 0x40, 0x5A, 0x05, 0xF6, 0x80, 0xDA, 0x5C, 0x0B, 0x9C, 0xE4,
+    0x02, 0x00, 0x60, 0x84, 0xBA, 0xB2, 0x78, 0xE6, 0x02, 0x68, 0xD3, 0xB6, 0xAC, 0x19, 0x5C, 0x45,
+    0x55, 0xB1, 0x04, 0xC0, 0x73, 0x2D, 0xD7, 0xCA, 0x00, 0x14, 0xBA, 0xD5, 0x8A, 0xB8, 0x10, 0x9F,
+    0x52, 0x6D, 0x2F, 0x71, 0x21, 0x28, 0x00, 0xC0, 0xA5, 0x14, 0x5F, 0x53, 0x54, 0x05, 0x00, 0xE0,
+    0x4F, 0x4E, 0xB9, 0x00, 0x22, 0x11, 0x26, 0xCB, 0x12, 0xC0, 0x4B, 0x51, 0x32, 0xEB, 0x78, 0x49,
+    0x7B, 0x50, 0x65, 0x1F, 0xAD, 0x54, 0xE0, 0xED, 0xA8, 0x62, 0xA6, 0x00, 0x17, 0x6C, 0x66, 0xE5,
+    0xF6, 0x01, 0x40, 0xE2, 0x8D, 0xB4, 0x3E, 0xAD, 0xA6, 0x78, 0xE5, 0x07, 0xC0, 0x26, 0x00, 0x00,
+    0xAA, 0x66, 0xB5, 0xDD, 0x03, 0x80, 0x2C, 0x42, 0x29, 0x00, 0x00, 0x9C, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0x55, 0xBF, 0x16, 0xD5, 0xF3, 0x14, 0x1C, 0x38, 0xB7, 0x86, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xD4, 0x96, 0xEA, 0xD8, 0xFA, 0x5B, 0x2A, 0x27, 0xD2, 0x11, 0x41, 0xB9, 0x1C, 0x0D,
+    0xA2, 0x05, 0xC0, 0x28, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x4C, 0x5A, 0x96, 0x66,
+    0xE7, 0xBD, 0x18, 0xD7, 0x84, 0xAF, 0x93, 0xAF, 0x72, 0x9D, 0xAC, 0xB4, 0xDA, 0x89, 0x8F, 0x98,
+    0xAD, 0xC1, 0x76, 0x11, 0xDA, 0x83, 0x18, 0x00, 0x00, 0xA9, 0x00, 0x0E, 0x08, 0x80, 0x0C, 0xF0,
+    0xCC, 0x8E, 0x05, 0x14, 0x52, 0xB4, 0xF2, 0x3A, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x29,
+    0x4A, 0x83, 0x54, 0x2A, 0xC4, 0x5F, 0xB5, 0x02, 0x18, 0x08, 0x58, 0x2B, 0x00, 0x00, 0x32, 0x08,
+    0x0D, 0xF2, 0x99, 0x96, 0xEC, 0x3E, 0x8E, 0x00, 0x00, 0x00, 0x78, 0xC3, 0xB6, 0xAB, 0xD9, 0x3A,
+    0x9A, 0xDB, 0xC6, 0x00, 0xC0, 0x8A, 0xEB, 0xCF, 0x89, 0x6D, 0x11, 0x6B, 0xE5, 0xEA, 0x88, 0x90,
+    0x1C, 0x00, 0xF1, 0x5A, 0x01, 0x38, 0xC5, 0x51, 0x4E, 0x5A, 0x84, 0x00, 0xD2, 0xCA, 0xA1, 0x64,
+    0x02, 0xDC, 0x20, 0x00, 0x0E, 0xB6, 0x5E, 0x2D, 0x3B, 0x55, 0x2E, 0x41, 0xB2, 0xE0, 0x1C, 0xD0,
+    0x59, 0x54, 0xA0, 0x00, 0x00, 0x00, 0x86, 0x81, 0x3A, 0x02, 0xA0, 0xB9, 0x42, 0x22, 0x01, 0x7A,
+    0x63, 0x4C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x70, 0xB5, 0x8A, 0x2D, 0x49, 0xE0, 0x40, 0x01, 0x80,
+    0x14, 0x5B, 0x8D, 0x86, 0x00, 0x00, 0xA0, 0x49, 0x55, 0x2E, 0x4D, 0xE6, 0xB2, 0x15, 0x55, 0xF5,
+    0x13, 0x80, 0xAA, 0x6B, 0x6F, 0x85, 0xAD, 0x60, 0xE2, 0x2B, 0x38, 0x54, 0x6D, 0x29, 0x07, 0x1B,
+    0xBC, 0xD5, 0xCD, 0x57, 0x00, 0x84, 0x62, 0xB5, 0x25, 0xE4, 0x16, 0x40, 0x8E, 0xB6, 0x5F, 0xE9,
+    0xC4, 0xA5, 0x04, 0xE2, 0x67, 0x50, 0xC4, 0x0A, 0x8E, 0x89, 0x02, 0xB1, 0x0A, 0x80, 0x56, 0x00,
+    0x5A, 0x05, 0x5A, 0xB3, 0x0B, 0xE0, 0x16, 0x17, 0xCA, 0x00, 0xD0, 0x4C, 0x1A, 0xD2, 0x47, 0x14,
+    0x80, 0x30, 0x42, 0x01, 0x94, 0x34, 0x05, 0x8E, 0x4B, 0x98, 0x81, 0x08, 0x0A, 0x6D, 0xD2, 0x3A,
+    0x17, 0xB2, 0x4A, 0x18, 0x5E, 0x09, 0x99, 0xF3, 0xDA, 0x76, 0x6E, 0xDB, 0xB4, 0x2A, 0x19, 0xD2,
+    0xD9, 0x18, 0x49, 0x2E, 0x00, 0xB0, 0xF2, 0x0E, 0x82, 0x00, 0x50, 0xE1, 0x88, 0x4D, 0x29, 0x00,
+    0x86, 0xD9, 0x25, 0x04, 0x40, 0xA0, 0xD8, 0x78, 0x29, 0xE8, 0xA9, 0x4B, 0xD4, 0x56, 0x4A, 0x13,
+    0x00, 0x00, 0x00, 0x34, 0x01, 0x00, 0x60, 0x60, 0xAE, 0x83, 0x38, 0x31, 0x20, 0xD1, 0x8A, 0xA5,
+    0x6D, 0xCF, 0x81, 0xFB, 0xC0, 0x2A, 0x05, 0x2B, 0x77, 0xC1, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xB0,
+    0xDB, 0xCA, 0xE7, 0xA9, 0x60, 0x01, 0x15, 0xA7, 0xD5, 0x9A, 0x4B, 0xEB, 0x47, 0x2A, 0x00, 0xAA,
+    0x4E, 0x69, 0x7B, 0xAD, 0x04, 0x50, 0x42, 0x2E, 0xED, 0x0D, 0xF0, 0xE4, 0x01, 0x00, 0x57, 0xC4,
+    0x00, 0x00, 0x60, 0x79, 0x75, 0x96, 0x2C, 0xB2, 0x40, 0xD1, 0xE2, 0x0A, 0x6E, 0x5B, 0x2E, 0xA8,
+    0x56, 0xBB, 0x2E, 0xB9, 0xB4, 0xCD, 0x01, 0xE0, 0x95, 0x06, 0x0C, 0x8E, 0x72, 0xE5, 0xD4, 0x56,
+    0x60, 0x00, 0x40, 0x00, 0x36, 0x64, 0x00, 0x60, 0xD8, 0x0D, 0x18, 0xD8, 0xBA, 0xD4, 0x0A, 0xA8,
+    0xFC, 0x05, 0x00, 0xC0, 0x29, 0xAD, 0x75, 0x11, 0x5F, 0xF5, 0x73, 0xEC, 0xDB, 0x54, 0x64, 0xE0,
+    0x10, 0xE6, 0x7D, 0x85, 0x78, 0x72, 0x1C, 0xB2, 0x74, 0xCA, 0x22, 0x4E, 0xF6, 0xE2, 0x0C, 0x80,
+    0x17, 0xBA, 0x16, 0xB7, 0x8C, 0xD5, 0xE8, 0x6B, 0x91, 0x44, 0x13, 0x85, 0x01, 0xB8, 0xB4, 0x56,
+    0x5C, 0x5B, 0x54, 0x71, 0xDD, 0xA6, 0xCD, 0x09, 0x60, 0x16, 0xDA, 0x61, 0xCD, 0x30, 0xCF, 0x6D,
+    0x7B, 0x06, 0x59, 0x24, 0xAB, 0x00, 0x2A, 0x09, 0xB9, 0x05, 0x20, 0xAC, 0x0D, 0x81, 0xC9, 0x8E,
+    0x11, 0x04, 0x30, 0xD5, 0x87, 0x00, 0x00, 0x0F, 0xCA, 0xBD, 0x52, 0x34, 0xD7, 0x85, 0x66, 0x0A,
+    0x81, 0xD6, 0x3A, 0x25, 0x34, 0xA0, 0x17, 0xA1, 0xAA, 0x14, 0xEE, 0x92, 0xED, 0x66, 0x17, 0x80,
+    0x81, 0xC2, 0x8E, 0xAA, 0x7E, 0xF5, 0xD7, 0xF6, 0x6B, 0x8C, 0x83, 0x49, 0xBE, 0xF9, 0x23, 0xE4,
+    0x14, 0xC0, 0x4D, 0x21, 0xA9, 0x04, 0x03, 0x00, 0xE0, 0x96, 0x03, 0xA1, 0x40, 0x93, 0x4F, 0x5D,
+    0x73, 0x44, 0x50, 0x07, 0x80, 0x44, 0x64, 0x65, 0xC4, 0x45, 0x62, 0x02, 0x00, 0x33, 0x40, 0x3B,
+    0x2F, 0x59, 0xA6, 0x53, 0xC2, 0x2C, 0x37, 0x13, 0xAF, 0x06, 0x44, 0xB3, 0xD9, 0x55, 0x6D, 0x1F,
+    0x1C, 0x07, 0x53, 0x71, 0x59, 0x22, 0x0C, 0x15, 0x54, 0x39, 0xC2, 0x28, 0x2C, 0xF4, 0x27, 0x07,
+    0xC0, 0x2D, 0x09, 0x47, 0xF9, 0xFA, 0xCB, 0x8B, 0x4C, 0x9E, 0xE0, 0xAE, 0x60, 0x00, 0xF8, 0x03,
+    0x90, 0x8B, 0x83, 0x5D, 0x27, 0x4A, 0x98, 0x55, 0x4D, 0x88, 0x93, 0x19, 0x53, 0x00, 0xCD, 0xD6,
+    0x42, 0x6A, 0xF5, 0x09, 0x0C, 0xDD, 0x1C, 0x00, 0x52, 0xE1, 0x02, 0x58, 0x00, 0x42, 0x5C, 0x61,
+    0x3D, 0x00, 0x14, 0x00, 0xA0, 0x95, 0xCB, 0x8E, 0x46, 0x19, 0x95, 0x22, 0x74, 0xE2, 0x8F, 0x10,
+    0xA1, 0x3E, 0x88, 0x30, 0x43, 0x38, 0x76, 0xA0, 0x6A, 0xDB, 0x02, 0x73, 0xE9, 0x2C, 0xC1, 0xCA,
+    0xAD, 0x06, 0x80, 0x56, 0xB9, 0xBE, 0xF9, 0x69, 0x05, 0x20, 0x17, 0x16, 0x64, 0x73, 0x01, 0x38,
+    0x02, 0x00, 0x40, 0x30, 0xBD, 0xB6, 0x00, 0x08, 0x39, 0x00, 0x00, 0x11, 0x10, 0x15, 0x31, 0x9D,
+    0x12, 0x8D, 0x04, 0x60, 0x53, 0x29, 0xDD, 0xC9, 0x0E, 0x3C, 0xB5, 0x02, 0x74, 0x56, 0x1D, 0x80,
+    0xC2, 0x56, 0xB9, 0xFE, 0x63, 0x3B, 0x0C, 0x40, 0x49, 0x97, 0x00, 0x04, 0x46, 0x1E, 0x95, 0xF5,
+    0x6D, 0x8B, 0xA2, 0xAF, 0x1C, 0x9C, 0x11, 0xF6, 0x15, 0x0B, 0xAE, 0xBD, 0x87, 0x53, 0x04, 0xBB,
+    0x05, 0xC0, 0x6D, 0xBE, 0xC3, 0x86, 0x74, 0x81, 0x6B, 0x0B, 0x80, 0x10, 0xA1, 0xC0, 0x73, 0x1B,
+    0xFD, 0x41, 0x5C, 0x8A, 0x16, 0x62, 0x06, 0x80, 0x1D, 0xED, 0x88, 0xD5, 0x96, 0x30, 0x57, 0x13,
+    0x31, 0x4C, 0xA4, 0x45, 0x85, 0xE4, 0x16, 0x08, 0x00, 0x4E, 0x3D, 0x08, 0x30, 0x01, 0xE0, 0x6D,
+    0xE1, 0xA5, 0x00, 0x9C, 0x7A, 0x58, 0x4B, 0x19, 0xC0, 0x3B, 0x81, 0xAF, 0x08, 0xE6, 0x4A, 0x5B,
+    0x29, 0x67, 0x5B, 0x10, 0x8C, 0x0E, 0x01, 0x58, 0x04, 0xE0, 0x08, 0x80, 0x47, 0x72, 0x82, 0x00,
+    0x00, 0xA0, 0x07, 0x80, 0x89, 0x21, 0x0E, 0x00, 0x9C, 0xCD, 0x05, 0xE0, 0xAB, 0x03, 0x00, 0x0E,
+    0x00, 0x70, 0xC5, 0x18, 0x41, 0xCA, 0x23, 0x00, 0x86, 0x17, 0x38, 0x99, 0x8B, 0x30, 0x2F, 0xB2,
+    0xB6, 0x36, 0x01, 0x00, 0x00, 0x50, 0xF2, 0x67, 0xB4, 0x45, 0x0F, 0x26, 0x76, 0xC0, 0x50, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x82, 0x28, 0xF5, 0x19, 0xF6, 0x66, 0x13, 0xAD, 0x42, 0x01, 0x14, 0x2D,
+    0x69, 0x08, 0x71, 0x55, 0xB7, 0x00, 0x00, 0xFC, 0x49, 0xEC, 0x8F, 0x32, 0x80, 0xAF, 0x5F, 0xF9,
+    0x56, 0x05, 0x00, 0xC0, 0xA7, 0x60, 0x71, 0x00, 0x00, 0x80, 0x6D, 0x0B, 0xD1, 0xA5, 0x07, 0xC9,
+    0x00, 0x92, 0x11, 0xAA, 0x22, 0x4F, 0x00, 0x95, 0x02, 0x04, 0xFF, 0x79, 0xBD, 0xF2, 0x45, 0xA0,
+    0x18, 0xA5, 0x20, 0xE4, 0x86, 0x61, 0xC0, 0x25, 0xC5, 0x62, 0x00, 0x8A, 0x01, 0xCC, 0x09, 0x07,
+    0xE9, 0x84, 0x87, 0x4D, 0xB2, 0x5A, 0xCD, 0x05, 0x30, 0x37, 0x4E, 0xAB, 0x3D, 0x66, 0x2E, 0xD1,
+    0xF5, 0x11, 0x08, 0x11, 0x1B, 0x46, 0x9A, 0xB9, 0x0C, 0x5C, 0x30, 0x22, 0x86, 0x30, 0x39, 0x5A,
+    0x0F, 0x02, 0x02, 0x00, 0x00, 0x45, 0xC7, 0xB4, 0x88, 0x7D, 0x0C, 0x35, 0x46, 0xAB, 0xA5, 0x53,
+    0x0C, 0x44, 0x46, 0xD0, 0x6B, 0xEB, 0x88, 0x90, 0x29, 0xA3, 0x74, 0x01, 0x5C, 0xF0, 0x37, 0xF7,
+    0x95, 0x0C, 0x00, 0x00, 0x00, 0xCC, 0x25, 0x54, 0x15, 0xD9, 0xCE, 0xAF, 0x64, 0x4D, 0x1C, 0x0C,
+    0x04, 0x60, 0xEE, 0x40, 0x9A, 0x33, 0x9B, 0xE0, 0x02, 0x00, 0xEF, 0xA7, 0x62, 0xB7, 0x1F, 0xAD,
+    0x90, 0xA0, 0xDB, 0x56, 0x10, 0x48, 0xB6, 0xCC, 0xAE, 0xD4, 0x01, 0xE0, 0x76, 0x03, 0xB7, 0x02,
+    0x58, 0x5E, 0x85, 0x00, 0xF1, 0x8B, 0x08, 0x9F, 0x5C, 0x02, 0xDA, 0xF6, 0x01, 0xCC, 0xC7, 0xC9,
+    0x20, 0x9E, 0xDC, 0xB8, 0xB6, 0xE2, 0x9A, 0xF6, 0x96, 0x31, 0x45, 0x84, 0x00, 0x3C, 0x98, 0x3B,
+    0x48, 0x19, 0x0A, 0x60, 0x00, 0x54, 0x25, 0xAA, 0xDA, 0xB6, 0xAC, 0x56, 0x0C, 0xA7, 0xDC, 0x7E,
+    0xBD, 0xDB, 0x8B, 0x16, 0xC0, 0x41, 0x86, 0xB0, 0x02, 0x00, 0x20, 0x66, 0x31, 0x91, 0xB8, 0x84,
+    0xD4, 0x56, 0xD4, 0x2A, 0x73, 0x6E, 0x5B, 0x80, 0x84, 0x10, 0x1A, 0x6D, 0x09, 0x30, 0x9A, 0xA2,
+    0x61, 0x6E, 0xBD, 0xEC, 0x2B, 0x3B, 0xAC, 0x0A, 0x5A, 0x30, 0x37, 0x03, 0xCD, 0x4D, 0xA3, 0xA6,
+    0x96, 0x93, 0xC9, 0x93, 0x1D, 0x44, 0x3D, 0x25, 0x0B, 0x00, 0x80, 0x4F, 0x00, 0xE2, 0xB8, 0x5D,
+    0x7C, 0x82, 0x6B, 0x59, 0x00, 0x07, 0xE5, 0xB5, 0x91, 0x62, 0xC6, 0x20, 0x9F, 0x54, 0xAD, 0x48,
+    0x74, 0x94, 0x8C, 0x95, 0x9F, 0xA6, 0xA7, 0xF4, 0x86, 0xFA, 0x94, 0x0C, 0x01, 0x0D, 0x1F, 0x00,
+    0x13, 0x10, 0x1F, 0x59, 0xA2, 0x38, 0xDB, 0xAC, 0x7D, 0x84, 0x98, 0x55, 0x1D, 0x71, 0x26, 0x41,
+    0x45, 0xA0, 0x15, 0x28, 0x8B, 0x4A, 0x25, 0xE7, 0x2D, 0xE2, 0x44, 0x61, 0xBF, 0x9E, 0x2D, 0x09,
+    0xF0, 0x6B, 0xCE, 0x38, 0xC8, 0x04, 0xD5, 0x03, 0x10, 0x68, 0xDA, 0x4D, 0x06, 0x28, 0x12, 0x01,
+    0x3A, 0x05, 0x80, 0x0F, 0x92, 0x41, 0x6E, 0xD6, 0x6E, 0x68, 0x63, 0xC8, 0x50, 0x0F, 0x45, 0xBF,
+    0x02, 0x25, 0xC3, 0xB0, 0xAB, 0x9E, 0x5A, 0x47, 0x8E, 0x14, 0x02, 0x00, 0x48, 0x12, 0x40, 0xA3,
+    0x41, 0x76, 0x73, 0x94, 0xF5, 0x6A, 0x65, 0x03, 0x5B, 0x00, 0x3F, 0x00, 0x10, 0x0C, 0xF4, 0x14,
+    0x40, 0x40, 0xAD, 0xDC, 0x38, 0x1E, 0x6B, 0x7A, 0x8A, 0x4E, 0x8C, 0xC0, 0x05, 0x7A, 0x2D, 0x03,
+    0xC0, 0x05, 0xC0, 0x57, 0x0A, 0x81, 0x0A, 0x7E, 0x05, 0x00, 0x80, 0x02, 0xC0, 0x7D, 0x88, 0x20,
+    0x8D, 0xBA, 0xE9, 0xC8, 0x09, 0x38, 0x80, 0x44, 0x88, 0x00, 0xF0, 0x87, 0xD8, 0x1F, 0xE4, 0x4E,
+    0x73, 0x09, 0x76, 0xAA, 0xC3, 0xA5, 0x4C, 0x10, 0xAE, 0x6D, 0xEA, 0x2C, 0x94, 0xA3, 0x94, 0x42,
+    0x49, 0x07, 0xB9, 0xD8, 0x72, 0x5B, 0xD1, 0x71, 0x48, 0xAE, 0xA5, 0xAF, 0x2E, 0x75, 0x34, 0xBC,
+    0xE2, 0xD5, 0x30, 0x00, 0x00, 0x27, 0x9D, 0xF4, 0xEA, 0x00, 0xB0, 0x5B, 0xAD, 0x25, 0x73, 0x6E,
+    0xC4, 0x08, 0x23, 0x17, 0x2D, 0x0F, 0x00, 0xFE, 0x00, 0x00, 0x50, 0x08, 0x01, 0x1F, 0x24, 0x00,
+    0x70, 0x39, 0x7A, 0x74, 0xA9, 0x67, 0xAF, 0xC2, 0x45, 0x94, 0x2C, 0x4E, 0x0B, 0xCF, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0xB4, 0x05, 0x00, 0x40, 0x6E, 0xA0, 0xB5, 0x6B, 0x11, 0x9B, 0xF1, 0x47, 0x06,
+    0x00, 0x80, 0x3D, 0xC8, 0xB8, 0xF0, 0x61, 0x03, 0x34, 0x08, 0x80, 0xB4, 0x00, 0x00, 0x20, 0x04,
+    0x10, 0xA2, 0x99, 0x50, 0x05, 0x03, 0x00, 0x00, 0xE0, 0x0A, 0x00, 0x00, 0x80, 0x61, 0xA8, 0xAA,
+    0x2D, 0x20, 0x01, 0xC0, 0x8A, 0x62, 0x42, 0x89, 0x5C, 0x02, 0x18, 0x45, 0x24, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0xCC, 0xFD, 0x09, 0x22, 0x18, 0xB3, 0x3F, 0x56, 0xCF, 0xFD, 0xD9, 0xB3, 0x88, 0x02,
+    0xD7, 0x56, 0x8A, 0x00, 0x08, 0xBB, 0x47, 0x47, 0x2D, 0x00, 0xAE, 0x39, 0xAB, 0x8E, 0xD0, 0xAA,
+    0xA8, 0x43, 0x9D, 0x2B, 0x24, 0x69, 0x01, 0x58, 0xE2, 0xAF, 0x5F, 0x5D, 0x0A, 0x00, 0x02, 0x11,
+    0x49, 0xEB, 0x08, 0x51, 0x35, 0x59, 0x73, 0x8B, 0x1A, 0xCD, 0xAA, 0xC7, 0x2B, 0x1D, 0x00, 0x47,
+    0x0F, 0x03, 0x00, 0xC4, 0x05, 0x00, 0x80, 0xA7, 0x00, 0x22, 0x22, 0x02, 0x00, 0x16, 0x00, 0x00,
+    0xBA, 0x90, 0xFA, 0x00, 0x48, 0x00, 0x0D, 0x00, 0x98, 0xAA, 0x00, 0x8A, 0xD9, 0x7C, 0x90, 0x0B,
+    0x21, 0x00, 0x00, 0x62, 0x0A, 0xE7, 0x72, 0x37, 0xF1, 0xA0, 0x2C, 0x33, 0x5C, 0xB5, 0x82, 0x05,
+    0xF0, 0x0D, 0x00, 0x00, 0x00, 0x5F, 0x65, 0x71, 0xC1, 0x21, 0xD9, 0x80, 0xE6, 0xC2, 0x98, 0xEB,
+    0x10, 0x02, 0x60, 0x08, 0x00, 0x00, 0x00, 0x4C, 0xB9, 0xA6, 0x0D, 0xEA, 0x33, 0x08, 0x24, 0x02,
+    0x72, 0xBC, 0x3A, 0xAA, 0x9A, 0x00, 0x32, 0x38, 0xA3, 0xD4, 0x00, 0x00, 0x90, 0x9B, 0x0C, 0x00,
+    0x00, 0x6A, 0x2B, 0x3D, 0xA4, 0x25, 0x73, 0xE2, 0x62, 0x21, 0x82, 0xC3, 0x9C, 0xB4, 0x32, 0xA1,
+    0xB7, 0x4E, 0xA2, 0x6E, 0x00, 0xD6, 0xEC, 0xF1, 0x02, 0x80, 0x41, 0xCF, 0xAC, 0x84, 0xB4, 0x1A,
+    0xAC, 0x73, 0x95, 0x6B, 0x22, 0x41, 0xF5, 0x54, 0xA2, 0x30, 0x0C, 0x40, 0x70, 0x4D, 0x42, 0x37,
+    0x11, 0x33, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x07, 0x65, 0xE5, 0xE9, 0xF0, 0x87, 0xB8, 0x1E, 0x08,
+    0x07, 0x39, 0x07, 0xDD, 0x61, 0xC4, 0xE2, 0x90, 0x36, 0x34, 0x55, 0x00, 0x00, 0xF0, 0x69, 0x43,
+    0xAB, 0x0F, 0xAE, 0xA0, 0x0A, 0xFB, 0xE4, 0x63, 0x23, 0xD7, 0xA3, 0x5C, 0x00, 0xE3, 0x19, 0x06,
+    0xD0, 0x4A, 0x83, 0x3F, 0x00, 0x00, 0x8A, 0xD2, 0x42, 0xF8, 0x2A, 0x97, 0x4B, 0x33, 0x85, 0xE3,
+    0x29, 0x2A, 0x08, 0x00, 0x00, 0xE5, 0x7E, 0x8A, 0x20, 0x18, 0x72, 0x03, 0x40, 0xC2, 0x5E, 0x59,
+    0xAD, 0x7A, 0xA9, 0x4C, 0x66, 0x28, 0xC8, 0x02, 0x00, 0xAF, 0x00, 0x70, 0xCD, 0xA7, 0xF0, 0x16,
+    0x66, 0x00, 0x90, 0x4A, 0x9A, 0x05, 0xF0, 0x15, 0xC0, 0x29, 0x7F, 0x6D, 0xD5, 0xB5, 0xAA, 0x0B,
+    0xA0, 0xAD, 0x09, 0x42, 0x73, 0xBE, 0x6A, 0x9A, 0x5C, 0x47, 0x2B, 0xC2, 0x38, 0x5B, 0xE3, 0xB4,
+    0x01, 0x71, 0x96, 0xAC, 0x4A, 0x4E, 0x5B, 0x47, 0xCE, 0x45, 0xCB, 0xCF, 0xB2, 0xDC, 0xC9, 0xAF,
+    0xB8, 0x6E, 0x6D, 0x3B, 0x32, 0x2D, 0x22, 0xAD, 0x26, 0x58, 0x56, 0x72, 0x6B, 0xA7, 0xAD, 0x56,
+    0x90, 0x8A, 0xD8, 0xCA, 0x55, 0xC8, 0x56, 0xD7, 0xA8, 0xC3, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x15,
+    0x80, 0x8D, 0xB1, 0x03, 0xC6, 0x62, 0x60, 0x01, 0x18, 0x40, 0xDB, 0x7A, 0x9D, 0x56, 0xA2, 0x72,
+    0xAA, 0x95, 0x96, 0x3F, 0xAC, 0xAF, 0x92, 0x18, 0x3B, 0x55, 0x55, 0xC9, 0x27, 0x01, 0x78, 0x03,
+    0xB5, 0x7D, 0x36, 0xF9, 0x0A, 0x3D, 0x00, 0x0E, 0x5A, 0xE5, 0xEA, 0x15, 0xC7, 0xB0, 0x17, 0x85,
+    0x86, 0x37, 0x95, 0x68, 0x04, 0x89, 0x10, 0x2D, 0x00, 0x27, 0x15, 0x62, 0x84, 0xB1, 0x0D, 0x31,
+    0xAE, 0x78, 0x00, 0x00, 0x28, 0x98, 0xC8, 0x75, 0x95, 0x57, 0x2E, 0x08, 0x01, 0x8C, 0x44, 0x0C,
+    0x74, 0x62, 0xCE, 0xB7, 0xC3, 0xA8, 0x3D, 0x00, 0x00, 0x33, 0xA8, 0x9C, 0x8F, 0x13, 0x01, 0x00,
+    0xE9, 0x87, 0x08, 0x28, 0x00, 0x86, 0xE2, 0x64, 0x11, 0x21, 0x92, 0x18, 0x40, 0xAE, 0x1D, 0x5A,
+    0xDB, 0x10, 0xE2, 0xD6, 0xB6, 0xDB, 0x5C, 0xAA, 0x6F, 0xF8, 0xA6, 0xB5, 0xC1, 0x15, 0xD1, 0x52,
+    0x2E, 0xF2, 0x00, 0xC8, 0x3D, 0x88, 0xB6, 0xC2, 0x03, 0x96, 0x80, 0xDB, 0x3E, 0x00, 0xB0, 0xE4,
+    0x54, 0xDB, 0x0F, 0x27, 0xCA, 0x92, 0x9D, 0x3B, 0x16, 0x00, 0x00, 0x00, 0x3E, 0xDF, 0x00, 0x00,
+    0x00, 0xE0, 0xD6, 0xD7, 0x11, 0x86, 0x80, 0xD6, 0xCB, 0x5B, 0x96, 0xEB, 0x37, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x8C, 0x50, 0x39, 0x3E, 0x7D, 0xA8, 0xCA, 0xE5, 0xEB, 0x00, 0x59, 0xC0, 0xAF,
+    0x54, 0xDA, 0x02, 0x5D, 0x15, 0x17, 0x80, 0x22, 0x94, 0x6E, 0x09, 0x01, 0xC8, 0x09, 0x00, 0x00,
+    0x35, 0xAA, 0xC9, 0x72, 0xB6, 0x25, 0xA9, 0x95, 0x50, 0x2F, 0xB9, 0xC3, 0x00, 0xEF, 0x44, 0xFC,
+    0xA0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xE0, 0x1A, 0xAD, 0x86, 0xE3, 0x82,
+    0x8B, 0xF4, 0x75, 0xED, 0x57, 0xC4, 0xDB, 0x00, 0xD8, 0xBC, 0x45, 0x02, 0x99, 0xC2, 0x1D, 0x25,
+    0x01, 0x00, 0x00, 0x90, 0xF3, 0x2B, 0x85, 0x22, 0x96, 0x01, 0xB8, 0x44, 0x29, 0x07, 0x68, 0x18,
+    0x00, 0x00, 0x00, 0x4C, 0x43, 0x76, 0xD6, 0x98, 0x21, 0x1B, 0x90, 0xEA, 0x58, 0x61, 0x39, 0x42,
+    0xA5, 0x39, 0x7D, 0xC1, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x2D, 0x0A, 0x00, 0x9D, 0x14, 0xAC, 0xBA,
+    0x34, 0xD2, 0xC1, 0x4E, 0x31, 0xF5, 0xDA, 0x72, 0xE5, 0xF6, 0x76, 0xF1, 0x0B, 0x2C, 0x64, 0xEF,
+    0x65, 0x8D, 0x95, 0xA1, 0xB2, 0xE6, 0x07, 0x6B, 0xFF, 0xB8, 0x1B, 0x0B, 0x60, 0x55, 0x41, 0xAF,
+    0x88, 0xDE, 0x00, 0x00, 0x90, 0xD6, 0xEC, 0x62, 0x3C, 0x6F, 0xB5, 0x02, 0x00, 0xF0, 0x8A, 0xEB,
+    0x1F, 0xB7, 0x00, 0x5E, 0x95, 0xCC, 0xB0, 0xC0, 0x90, 0x4B, 0x2A, 0x42, 0x00, 0x18, 0x98, 0x0B,
+    0x00, 0x80, 0xB5, 0x55, 0x6D, 0x75, 0x00, 0x00, 0x21, 0xE2, 0x8B, 0x22, 0x6D, 0x00, 0x00, 0x00,
+    0x88, 0xF5, 0x4C, 0x2E, 0x80, 0x5A, 0x72, 0x00, 0xC4, 0x55, 0x64, 0x02, 0x22, 0x39, 0x00, 0x00,
+    0xF4, 0x18, 0x05, 0x20, 0x20, 0x0D, 0x04, 0x0A, 0x06, 0x01, 0xB8, 0x74, 0x11, 0x48, 0x04, 0x97,
+    0x40, 0x4E, 0xAA, 0x5E, 0x01, 0x0A, 0x80, 0x57, 0x9D, 0xB8, 0x81, 0x00, 0xCC, 0xA5, 0x9C, 0xF6,
+    0x20, 0x61, 0x46, 0x3F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0xB3, 0x18, 0x01, 0x0E,
+    0xCB, 0x07, 0x00, 0x59, 0x00, 0x00, 0x00, 0xD8, 0x28, 0xF8, 0x0C, 0xC0, 0xDE, 0x06, 0x26, 0x00,
+    0x00, 0x48, 0x2B, 0xE6, 0xD9, 0x82, 0x47, 0x44, 0x08, 0x03, 0xC8, 0x9A, 0x16, 0x00, 0x24, 0xAE,
+    0x3F, 0xE5, 0x00, 0x10, 0x42, 0x28, 0x91, 0xA5, 0xCB, 0x00, 0xBE, 0x9A, 0xA2, 0x32, 0x48, 0x2B,
+    0x38, 0x64, 0x0C, 0x6B, 0xB8, 0x45, 0x06, 0x00, 0x12, 0x42, 0xA5, 0x53, 0x0B, 0xB7, 0x3A, 0xB9,
+    0x89, 0x6B, 0x61, 0xC4, 0x47, 0x5D, 0x2E, 0x60, 0x6B, 0x0F, 0x04, 0x9F, 0x4C, 0x8D, 0x06, 0xBC,
+    0x00, 0xB8, 0xC0, 0xC0, 0x95, 0x4B, 0x50, 0xA1, 0x6A, 0xA6, 0x05, 0xA0, 0x4D, 0x5A, 0x96, 0x7B,
+    0x64, 0x8D, 0xB4, 0x09, 0x60, 0x01, 0xC4, 0x24, 0x14, 0x60, 0x01, 0xB4, 0x42, 0x88, 0x72, 0xA0,
+    0x3A, 0xAD, 0xE8, 0xD6, 0x1D, 0x0B, 0x22, 0xC8, 0x2A, 0x45, 0x27, 0x6C, 0xF6, 0x5B, 0x7B, 0xE8,
+    0xCF, 0x1F, 0xA1, 0x15, 0xAF, 0xBE, 0x75, 0xE8, 0x96, 0xA5, 0x5B, 0x48, 0x4F, 0xCB, 0x16, 0x4A,
+    0x3C, 0x70, 0xF1, 0x10, 0x00, 0x72, 0x01, 0x00, 0x68, 0xCB, 0xB2, 0xED, 0x33, 0x00, 0x00, 0x14,
+    0x7A, 0xCD, 0x5A, 0xE6, 0x6D, 0x52, 0x96, 0xDC, 0xCA, 0xF8, 0xC4, 0xEA, 0x08, 0xC4, 0x3D, 0xC9,
+    0x7C, 0xAE, 0xA5, 0x3D, 0x33, 0x77, 0x0F, 0x00, 0x9B, 0x26, 0xF8, 0xA8, 0xBD, 0xCA, 0x35, 0xDF,
+    0x44, 0x5C, 0xA9, 0x4A, 0x7A, 0xE5, 0x1B, 0x87, 0x8A, 0x1C, 0x10, 0x82, 0x01, 0xF8, 0x5C, 0x4C,
+    0x4E, 0xCE, 0x5C, 0xC9, 0x72, 0x5B, 0x0D, 0xD2, 0xCA, 0x15, 0xC4, 0x2B, 0x00, 0x36, 0x1B, 0xF5,
+    0x3B, 0x68, 0x66, 0xF2, 0x5C, 0x00, 0x00, 0x22, 0x8E, 0x2B, 0x66, 0xA0, 0x11, 0x00, 0xB2, 0xFA,
+    0x1E, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x80, 0xB6, 0x73, 0x01, 0xE8, 0x43, 0xA8, 0x20, 0x10, 0x00,
+    0x00, 0x00, 0x2A, 0x08, 0x2B, 0xC5, 0x34, 0x6B, 0x2B, 0x5A, 0x00, 0x08, 0x45, 0xAA, 0xDC, 0x04,
+    0x92, 0x8E, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x94, 0x84, 0x9D, 0x4C, 0xCD, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x26, 0x00, 0x00, 0xEC, 0x74, 0xC0, 0x14, 0x24, 0x06, 0xA6, 0xC9, 0x14,
+    0xE5, 0x02, 0x00, 0x40, 0xB0, 0x03, 0x42, 0x7E, 0xCB, 0xB6, 0x02, 0x00, 0x60, 0x67, 0x5C, 0x97,
+    0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x00, 0x00, 0x83, 0xBD, 0x0C, 0x3F, 0x45, 0x33, 0x77, 0x15,
+    0x85, 0x6C, 0xF6, 0x5E, 0x05, 0x7D, 0x65, 0x95, 0x47, 0xAB, 0xA4, 0x51, 0x15, 0x83, 0x09, 0x4B,
+    0x80, 0x0A, 0x3D, 0x0A, 0x50, 0x5D, 0xB6, 0xA5, 0x30, 0x70, 0xA9, 0x19, 0xA5, 0x72, 0x4A, 0x24,
+    0xFA, 0x13, 0x56, 0xC8, 0x87, 0x23, 0xF5, 0x2E, 0xCA, 0x5A, 0xC9, 0x2E, 0xC8, 0x5C, 0x16, 0x13,
+    0x2B, 0x05, 0x95, 0x71, 0xAF, 0x45, 0x2E, 0xA5, 0x87, 0x5B, 0x6D, 0x7C, 0x67, 0x13, 0x00, 0x0F,
+    0x3E, 0x6D, 0xB9, 0x7E, 0xED, 0x55, 0x0B, 0x00, 0xD0, 0x2F, 0x00, 0x80, 0x02, 0x00, 0x00, 0x40,
+    0x6E, 0x35, 0x00, 0x60, 0x22, 0x99, 0x38, 0x33, 0xB5, 0x55, 0x2D, 0x59, 0x5B, 0x17, 0x0C, 0x98,
+    0xEB, 0x88, 0xE2, 0xD9, 0xC9, 0x38, 0x30, 0xFC, 0x8D, 0xCB, 0xE5, 0x22, 0x00, 0xAD, 0x2E, 0x11,
+    0x21, 0x22, 0x3B, 0x18, 0x00, 0x80, 0x99, 0x24, 0xA8, 0x10, 0x42, 0x0C, 0x00, 0x4D, 0x56, 0x00,
+    0x03, 0x5D, 0xC6, 0x81, 0x9A, 0x64, 0x32, 0xC3, 0x68, 0x5C, 0x68, 0x11, 0x1A, 0x5B, 0x96, 0x1A,
+    0xDA, 0x44, 0xAD, 0x72, 0x54, 0xA4, 0x9B, 0x4B, 0x65, 0x2B, 0x58, 0x65, 0xC0, 0x7E, 0x25, 0x38,
+    0x70, 0x84, 0xDC, 0x0A, 0xA1, 0x14, 0x0A, 0x20, 0x18, 0x30, 0x85, 0x3C, 0x52, 0x6D, 0xD5, 0xAC,
+    0xB4, 0x07, 0x40, 0x31, 0xA0, 0x40, 0x7C, 0x16, 0x00, 0x00, 0x00, 0x98, 0x10, 0x1A, 0xAD, 0x61,
+    0x3E, 0xFC, 0x5A, 0xEC, 0x14, 0x32, 0x57, 0x54, 0x00, 0x00, 0x00, 0x40, 0x2C, 0x80, 0xEB, 0x1B,
+    0xAD, 0x00, 0x9C, 0x62, 0xF8, 0xC8, 0x35, 0xD1, 0x95, 0x85, 0x00, 0xD6, 0xF6, 0x28, 0xB4, 0x2A,
+    0x6D, 0x2E, 0xA7, 0x6F, 0xEB, 0xF5, 0x6A, 0x15, 0x01, 0xC0, 0xB0, 0x03, 0x80, 0x00, 0xAC, 0xAD,
+    0xF3, 0xA2, 0x8E, 0x38, 0x14, 0xAD, 0x82, 0xFE, 0x71, 0x60, 0x60, 0x84, 0xDA, 0x1C, 0x05, 0xCC,
+    0x02, 0x98, 0x9C, 0x83, 0x61, 0x02, 0x1C, 0x53, 0x7D, 0x2A, 0xF8, 0x92, 0x56, 0xEB, 0x62, 0xB4,
+    0x54, 0xE4, 0x0E, 0x70, 0x7A, 0x0C, 0xA5, 0x22, 0x34, 0x84, 0x04, 0x22, 0x4A, 0xAB, 0x95, 0x52,
+    0xB2, 0xB2, 0x25, 0xB1, 0x02, 0xFC, 0x03, 0xD1, 0xB0, 0x51, 0x48, 0x5F, 0xFD, 0x11, 0x28, 0x86,
+    0x06, 0x80, 0x50, 0x2A, 0x8E, 0x40, 0xD0, 0x74, 0x30, 0xAC, 0x26, 0x1A, 0x3D, 0x7D, 0x7A, 0xCD,
+    0x29, 0x94, 0xD0, 0x0B, 0xA0, 0x0A, 0x68, 0xB0, 0x44, 0x13, 0xF0, 0x96, 0x26, 0xAC, 0x44, 0x26,
+    0x12, 0xA1, 0xD0, 0x47, 0x22, 0x6D, 0x92, 0x20, 0x00, 0x60, 0x71, 0x85, 0x10, 0xF6, 0x18, 0x5B,
+    0x64, 0xFE, 0xFC, 0x61, 0xFD, 0x3A, 0xF7, 0x5F, 0x89, 0xB5, 0x6F, 0xD5, 0x12, 0xA2, 0x5C, 0x96,
+    0x19, 0xAE, 0x49, 0x6B, 0xD3, 0xF2, 0x6C, 0x03, 0xE8, 0xED, 0x4A, 0x0F, 0xAF, 0x00, 0x94, 0x65,
+    0x31, 0x82, 0x1B, 0x42, 0x65, 0x83, 0xE6, 0x0A, 0xE6, 0xD3, 0x01, 0x02, 0x40, 0xAD, 0x87, 0x38,
+    0x01, 0x13, 0x26, 0xF8, 0x01, 0x21, 0x48, 0xD6, 0x1C, 0xB0, 0xAC, 0xF9, 0x4C, 0xD6, 0xB2, 0x67,
+    0x5A, 0x41, 0x20, 0x44, 0x34, 0x88, 0x2B, 0xD9, 0x71, 0x4A, 0xF7, 0xCC, 0x05, 0x70, 0x82, 0xC2,
+    0xE5, 0x21, 0x92, 0x09, 0xFD, 0x03, 0x10, 0x36, 0x10, 0xCB, 0x4E, 0x00, 0x96, 0xAC, 0x9D, 0x9B,
+    0x20, 0x51, 0xE1, 0x42, 0x2C, 0x83, 0x1C, 0x89, 0xC1, 0x85, 0x99, 0x61, 0xC3, 0x00, 0xD2, 0x0A,
+    0x9C, 0x63, 0x46, 0xE0, 0x2E, 0x35, 0xA5, 0x30, 0x4E, 0xC1, 0x91, 0xD6, 0x4C, 0x22, 0x35, 0x6F,
+    0x7A, 0x62, 0x3D, 0x0C, 0x6E, 0x88, 0x29, 0x9F, 0x36, 0xD0, 0xBA, 0x01, 0x00, 0x20, 0x08, 0x80,
+    0x64, 0x89, 0x98, 0x39, 0x9A, 0x6B, 0x98, 0x30, 0xE0, 0xB0, 0x00, 0x10, 0xD4, 0x39, 0xA3, 0x27,
+    0x55, 0x56, 0x0A, 0x9A, 0x72, 0xD1, 0x78, 0xD5, 0x56, 0xA0, 0x4B, 0x00, 0x65, 0x15, 0x11, 0x0C,
+    0x94, 0xB3, 0x05, 0x93, 0x5B, 0x00, 0xAE, 0x01, 0xDD, 0x51, 0xF5, 0x4B, 0x8E, 0x56, 0x16, 0xB8,
+    0xBE, 0x2B, 0xB5, 0xF8, 0x9B, 0x9F, 0xB7, 0x5C, 0x4F, 0x3D, 0x33, 0x00, 0xA0, 0x8D, 0x03, 0x2E,
+    0x83, 0xDA, 0xD6, 0x52, 0xEB, 0xF6, 0xD1, 0xA0, 0x12, 0x48, 0x9C, 0x00, 0x48, 0x0B, 0x19, 0xB0,
+    0xBF, 0xB9, 0x09, 0x07, 0x81, 0x03, 0xE4, 0x08, 0x25, 0x00, 0x00, 0xF4, 0x9A, 0x69, 0xC0, 0xD5,
+    0xAA, 0x05, 0x00, 0x1B, 0x25, 0x77, 0xF8, 0x03, 0x60, 0x8A, 0x56, 0xAC, 0x88, 0x73, 0xDB, 0x0E,
+    0xF1, 0xD7, 0xB6, 0x1B, 0x17, 0x43, 0x68, 0xAB, 0x60, 0xE4, 0x0A, 0x00, 0x80, 0x03, 0x96, 0xFB,
+    0xBA, 0x21, 0x16, 0x6A, 0xD4, 0x68, 0xC5, 0xB6, 0xB2, 0x06, 0xD4, 0x31, 0xD8, 0xAA, 0xCD, 0xE4,
+    0x9C, 0x74, 0xD1, 0x7A, 0x98, 0xFA, 0x28, 0xA9, 0xDC, 0x40, 0x86, 0x30, 0x0A, 0x73, 0x34, 0xD9,
+    0xD1, 0x80, 0x9D, 0xA6, 0x04, 0x25, 0x0C, 0xD1, 0x64, 0x13, 0x36, 0x0C, 0x45, 0xC9, 0x36, 0x02,
+    0xE4, 0x2F, 0xD1, 0xB0, 0xB4, 0x00, 0x10, 0x3B, 0x05, 0x20, 0x00, 0x5E, 0x86, 0xA0, 0x50, 0x04,
+    0xF9, 0x4B, 0xD1, 0x53, 0x72, 0x39, 0xA6, 0x2A, 0x71, 0x41, 0x68, 0x15, 0x0C, 0x2C, 0x07, 0x40,
+    0xC5, 0xC2, 0xBC, 0xEA, 0x21, 0x78, 0x32, 0x00, 0x00, 0x88, 0x0D, 0xD8, 0x38, 0x08, 0xE0, 0x16,
+    0x57, 0x2B, 0x6F, 0x4A, 0x34, 0x72, 0x72, 0xA2, 0xAE, 0x9E, 0xB5, 0x68, 0xD7, 0x2A, 0x05, 0x2C,
+    0xD7, 0xEC, 0xDA, 0x4B, 0x7F, 0x50, 0xD5, 0x25, 0x01, 0x00, 0x80, 0x4A, 0x00, 0xE2, 0x9A, 0xE9,
+    0x69, 0x61, 0xB7, 0xAC, 0x22, 0xC9, 0x73, 0x81, 0x56, 0x32, 0x08, 0xA0, 0x44, 0x23, 0xB3, 0x87,
+    0x4F, 0xBC, 0x13, 0x08, 0x00, 0xE1, 0xA9, 0xB6, 0x13, 0x6D, 0x02, 0xB4, 0x09, 0x60, 0x0A, 0x80,
+    0x63, 0x7D, 0x00, 0x00, 0x88, 0x23, 0x30, 0x85, 0xC2, 0x25, 0xAD, 0x0C, 0x24, 0x22, 0xDB, 0x0B,
+    0x80, 0xDD, 0xC4, 0x7C, 0xDC, 0xEE, 0x43, 0x0C, 0x10, 0xC0, 0x17, 0x43, 0x8B, 0x17, 0x77, 0x02,
+    0x87, 0x91, 0x2F, 0x01, 0xC4, 0x66, 0xDA, 0x9A, 0x20, 0xB4, 0x38, 0x15, 0xC4, 0x89, 0x87, 0xA7,
+    0x6D, 0x00, 0x00, 0xA0, 0x2D, 0xA4, 0x08, 0x25, 0x22, 0x21, 0xA9, 0xDA, 0xB6, 0x70, 0x5A, 0x00,
+    0x1D, 0x79, 0xE9, 0x23, 0x2C, 0x67, 0xAE, 0x0E, 0xC2, 0x56, 0x46, 0xD2, 0xF2, 0x89, 0x50, 0x18,
+    0x5B, 0x05, 0x6D, 0xD2, 0x54, 0x13, 0x03, 0x80, 0xE5, 0xA5, 0x9E, 0x31, 0x14, 0xFF, 0xFC, 0x44,
+    0x90, 0x6C, 0x92, 0x0D, 0x7F, 0x64, 0x70, 0x3C, 0x0C, 0x50, 0x11, 0xE5, 0xAA, 0x00, 0x00, 0x68,
+    0x9D, 0xD6, 0x0F, 0xA7, 0x23, 0xC3, 0x27, 0x85, 0x22, 0xF0, 0x09, 0xF0, 0xEA, 0xC4, 0x5E, 0x7C,
+    0x70, 0x26, 0xEE, 0xB7, 0x4C, 0xD1, 0x49, 0x64, 0x2E, 0x69, 0xAD, 0x3A, 0xC4, 0x0A, 0xF1, 0x10,
+    0x00, 0x1D, 0xD1, 0x50, 0x29, 0xB6, 0xD3, 0x50, 0xD0, 0xAF, 0x9D, 0xB2, 0x52, 0xE9, 0x85, 0xA1,
+    0x03, 0xAD, 0xB6, 0x32, 0xEC, 0x1E, 0x9B, 0x8B, 0xB8, 0xED, 0x8E, 0x41, 0x55, 0x81, 0x82, 0xFC,
+    0x8A, 0xF3, 0x26, 0xC0, 0x5A, 0x6D, 0x01, 0xAC, 0x6A, 0x65, 0x45, 0xD6, 0x2C, 0xAE, 0x5E, 0xD9,
+    0x21, 0xE3, 0xDA, 0xD0, 0xB1, 0xCC, 0xB4, 0x0F, 0x68, 0xE9, 0xF1, 0x17, 0x0B, 0x81, 0x03, 0x3E,
+    0x7C, 0x00, 0x6C, 0x90, 0x67, 0xB0, 0x59, 0xA3, 0x0A, 0xC5, 0x3A, 0x56, 0x05, 0x00, 0xA0, 0x55,
+    0x42, 0x00, 0x82, 0xBA, 0x02, 0x60, 0xF9, 0x16, 0x40, 0x35, 0x40, 0x8D, 0xD2, 0x02, 0xD8, 0xD8,
+    0xF4, 0x6B, 0x61, 0x63, 0x5A, 0x83, 0x01, 0x00, 0x04, 0xD4, 0x2B, 0x5B, 0x07, 0xBD, 0xA8, 0xB4,
+    0xB2, 0xA1, 0xA2, 0x47, 0x90, 0x50, 0x29, 0xB8, 0x82, 0x40, 0x06, 0xF0, 0xA0, 0x61, 0x00, 0x00,
+    0x00, 0xF0, 0xF9, 0x62, 0x42, 0x4D, 0x34, 0x0A, 0x7D, 0xCA, 0xAC, 0x1D, 0x46, 0x15, 0x00, 0x00,
+    0x00, 0x15, 0xCD, 0x1E, 0x66, 0x76, 0x08, 0x80, 0x60, 0xCD, 0x75, 0x65, 0x01, 0x50, 0xEC, 0x00,
+    0xE2, 0x5C, 0x00, 0x30, 0xA4, 0xB4, 0x45, 0x56, 0x10, 0x00, 0x55, 0x42, 0x15, 0x00, 0x44, 0xA0,
+    0x52, 0xB7, 0x15, 0x15, 0x84, 0x5C, 0xA4, 0x38, 0x39, 0x6C, 0x74, 0xAE, 0x22, 0x7F, 0x8E, 0x4C,
+    0x8D, 0x58, 0x30, 0xAE, 0x2D, 0x59, 0x68, 0x67, 0xB9, 0x00, 0x08, 0x97, 0xB4, 0x01, 0xE0, 0xAA,
+    0x97, 0xD6, 0xB2, 0xF3, 0x5A, 0x26, 0x68, 0x9B, 0x40, 0x3E, 0x01, 0xAC, 0xCD, 0xE1, 0x4F, 0xD1,
+    0x2E, 0x64, 0xC8, 0x0C, 0xE5, 0xA2, 0xC2, 0x0E, 0x59, 0x22, 0x2E, 0x11, 0x00, 0xE5, 0x5C, 0x0B,
+    0x4E, 0xD1, 0x2B, 0x0A, 0x86, 0x8A, 0xD2, 0xBA, 0xCC, 0xD2, 0x6D, 0x0F, 0x14, 0x16, 0x96, 0xA5,
+    0x3D, 0x75, 0x02, 0x91, 0xCC, 0x84, 0xE0, 0x7A, 0x01, 0x60, 0xD9, 0x6B, 0x31, 0x00, 0x14, 0x8F,
+    0x18, 0x49, 0x69, 0x8B, 0xF1, 0x02, 0x44, 0x2E, 0xA7, 0x76, 0xCE, 0x95, 0x2B, 0x84, 0xD6, 0x62,
+    0x9F, 0xFA, 0x02, 0x23, 0x72, 0x51, 0x81, 0xD3, 0x0D, 0x00, 0x72, 0xE4, 0x40, 0xE3, 0x63, 0x26,
+    0x08, 0x97, 0xB2, 0xC8, 0x8A, 0xA1, 0x42, 0x43, 0xD8, 0xE7, 0x5C, 0xCA, 0xAD, 0x72, 0x65, 0x5D,
+    0x45, 0xA8, 0x55, 0x2B, 0x00, 0xFB, 0xD4, 0x46, 0x85, 0x4A, 0x0F, 0x00, 0xE1, 0x36, 0x00, 0xC8,
+    0x52, 0x53, 0x58, 0xF5, 0xF0, 0x91, 0xAA, 0x14, 0x00, 0xFC, 0x29, 0x9B, 0xB7, 0x55, 0x5A, 0x40,
+    0x66, 0xF9, 0x28, 0x60, 0xE8, 0x75, 0x5F, 0x2C, 0xC5, 0x6D, 0xC9, 0xF6, 0xB2, 0x94, 0x02, 0xC0,
+    0x34, 0x39, 0x22, 0x72, 0x09, 0xF6, 0xC9, 0x45, 0xCF, 0x5F, 0x81, 0x39, 0xF3, 0xAD, 0x01, 0x20,
+    0x28, 0x05, 0x00, 0x29, 0x52, 0x2E, 0xFA, 0xB3, 0xE9, 0x08, 0x40, 0xDA, 0x04, 0x6C, 0x27, 0x63,
+    0x6B, 0x61, 0x40, 0x43, 0x51, 0x39, 0x9A, 0x0D, 0x14, 0x8E, 0x5A, 0xC6, 0x81, 0x94, 0xC5, 0x59,
+    0xAD, 0x22, 0x56, 0x9C, 0xCB, 0xAA, 0x9B, 0x83, 0xA5, 0xF0, 0xE2, 0x4C, 0x16, 0xC4, 0x9F, 0x86,
+    0x7B, 0xAF, 0x58, 0xDE, 0xCA, 0xE9, 0x8F, 0x2E, 0x16, 0xB2, 0x90, 0x82, 0xD8, 0x5B, 0x33, 0x0E,
+    0xA2, 0x61, 0x2F, 0xF5, 0x80, 0x8A, 0x78, 0x51, 0xC7, 0xF1, 0xB3, 0x08, 0xFE, 0x58, 0x3A, 0x80,
+    0x64, 0x13, 0x40, 0x9A, 0x69, 0x81, 0xB4, 0x4A, 0x19, 0x0B, 0x0D, 0x80, 0x56, 0xC4, 0x19, 0x1D,
+    0x11, 0x29, 0x7C, 0xF2, 0x98, 0x03, 0x39, 0x73, 0xB9, 0xC2, 0xDB, 0x86, 0xA1, 0x02, 0x00, 0x7F,
+    0x84, 0x24, 0xE7, 0x8A, 0xC4, 0x55, 0xEB, 0x05, 0xAB, 0x88, 0x27, 0x8F, 0x92, 0x61, 0x34, 0x45,
+    0x90, 0x17, 0x07, 0x0B, 0x03, 0xA6, 0x28, 0x81, 0x90, 0xD6, 0xC5, 0x90, 0xC4, 0x10, 0xCA, 0x41,
+    0xA2, 0xA7, 0xC6, 0xAE, 0x80, 0xFC, 0x2D, 0xE6, 0xF9, 0xE1, 0xEA, 0x25, 0x4B, 0x68, 0xBC, 0x50,
+    0x91, 0xA1, 0x01, 0x31, 0x88, 0x55, 0x63, 0x03, 0x17, 0x9E, 0xDB, 0xC6, 0x4C, 0xDE, 0x1D, 0x83,
+    0x70, 0x02, 0x45, 0xA3, 0x35, 0x58, 0x93, 0x02, 0xF5, 0xB2, 0x0A, 0x38, 0x56, 0xEF, 0x98, 0x5A,
+    0xC4, 0x14, 0xDE, 0x56, 0x6D, 0x78, 0x2A, 0x2D, 0x88, 0x84, 0x86, 0xFB, 0x01, 0xF8, 0x69, 0xC5,
+    0x25, 0x00, 0x1E, 0x38, 0x80, 0x1A, 0x35, 0xE1, 0xB3, 0x10, 0x4D, 0x40, 0xB1, 0x00, 0x00, 0x20,
+    0xA1, 0xC8, 0xC9, 0x19, 0x2E, 0x4D, 0x00, 0x38, 0x69, 0x20, 0x34, 0x08, 0x80, 0x20, 0x15, 0xA6,
+    0x12, 0xE6, 0xE5, 0x2F, 0x1A, 0x40, 0x00, 0x94, 0x71, 0x02, 0x90, 0xAB, 0xD8, 0x27, 0x80, 0x9C,
+    0x15, 0xB4, 0x1E, 0xD2, 0xC0, 0x85, 0xE8, 0x08, 0x2E, 0x56, 0xB2, 0x6A, 0x55, 0xDB, 0x0C, 0x9E,
+    0x30, 0x91, 0xC7, 0x34, 0x1C, 0x9D, 0x74, 0xC0, 0x2B, 0x58, 0x7F, 0x00, 0x00, 0x9C, 0xFC, 0x33,
+    0xCE, 0x2B, 0x89, 0x1D, 0x58, 0xDC, 0x12, 0x60, 0x28, 0x31, 0x18, 0x15, 0x84, 0x2C, 0xEB, 0x3C,
+    0xD0, 0xF1, 0x0C, 0x08, 0x00, 0x00, 0xA1, 0x00, 0x78, 0x68, 0x22, 0x97, 0x0E, 0x80, 0x34, 0x66,
+    0x57, 0x29, 0xF2, 0x87, 0x90, 0x6A, 0xDB, 0x58, 0x00, 0x00, 0xA4, 0x6D, 0xEB, 0xD6, 0x5F, 0x61,
+    0xAD, 0x6D, 0xD9, 0x66, 0x45, 0x8C, 0x58, 0x0E, 0x0C, 0x2E, 0x2F, 0xF4, 0x7D, 0x42, 0x01, 0x00,
+    0xAA, 0x41, 0x19, 0x61, 0x3C, 0x21, 0x44, 0x88, 0xF8, 0x58, 0x2B, 0xC5, 0x3E, 0x11, 0xA3, 0x81,
+    0xC5, 0xA7, 0x94, 0x90, 0x18, 0x6F, 0x01, 0x00, 0xF0, 0x27, 0xD9, 0xC3, 0xB0, 0x24, 0x6E, 0x3F,
+    0x60, 0xBC, 0x73, 0x91, 0x8B, 0xA9, 0xB0, 0x86, 0xDA, 0x16, 0x03, 0x20, 0x8C, 0x50, 0x4F, 0x39,
+    0x00, 0x5A, 0x4D, 0xB6, 0xBC, 0x56, 0x4C, 0x2B, 0x7F, 0x66, 0x5A, 0x4D, 0xE8, 0x09, 0x00, 0x40,
+    0x4E, 0x14, 0x86, 0xBE, 0x2E, 0x20, 0xBB, 0xA8, 0x1F, 0xAD, 0xAE, 0x9A, 0x87, 0xBC, 0x28, 0x58,
+    0x2D, 0x70, 0xAE, 0xB6, 0x27, 0xE7, 0xF6, 0x69, 0xD5, 0x0E, 0x00, 0x80, 0x56, 0x00, 0x00, 0xC8,
+    0x04, 0xD0, 0x56, 0x9C, 0xCD, 0x4E, 0x5C, 0xDA, 0x02, 0x61, 0xB8, 0x01, 0x40, 0x51, 0x82, 0x10,
+    0x76, 0x56, 0x65, 0x02, 0x52, 0x80, 0xBF, 0xCC, 0xA0, 0xAC, 0x00, 0x70, 0x0B, 0xE0, 0x23, 0x92,
+    0x40, 0x5F, 0xF9, 0x02, 0x0D, 0x8A, 0xB8, 0x2D, 0x17, 0x27, 0x00, 0x22, 0x15, 0xF2, 0xC0, 0x35,
+    0x18, 0x00, 0x07, 0xB4, 0x12, 0x89, 0x2A, 0x04, 0xA0, 0x04, 0xAA, 0xB0, 0x56, 0x72, 0x01, 0xAE,
+    0x43, 0x88, 0xDB, 0x5B, 0xAF, 0x44, 0x53, 0xF1, 0x15, 0x05, 0x00, 0xA0, 0xA3, 0x7B, 0x54, 0x96,
+    0xCE, 0x42, 0x26, 0xF9, 0x2B, 0x1F, 0x64, 0x89, 0xEE, 0xCA, 0x68, 0xC5, 0x70, 0xB1, 0x5B, 0x39,
+    0x00, 0xDA, 0xEA, 0xAA, 0xCB, 0x90, 0x96, 0xB7, 0xB9, 0xE8, 0x00, 0xB4, 0x45, 0xD7, 0x16, 0xE0,
+    0xD6, 0x14, 0x6E, 0x91, 0x69, 0x9D, 0x46, 0xC9, 0xF2, 0xD6, 0xB4, 0x4C, 0x8B, 0x66, 0xED, 0xE9,
+    0xF6, 0x84, 0x62, 0x61, 0x74, 0xCD, 0x29, 0xDB, 0x3B, 0xB5, 0x15, 0xC2, 0x69, 0x2C, 0x1D, 0x4C,
+    0x4E, 0x00, 0xE0, 0x51, 0x57, 0x51, 0xEE, 0x42, 0x9D, 0x05, 0xBC, 0x76, 0x54, 0x20, 0xAD, 0x4E,
+    0xD4, 0x1E, 0x95, 0x0B, 0xA9, 0x15, 0x80, 0x56, 0x25, 0x08, 0xF1, 0x11, 0xCC, 0x25, 0xC4, 0x1A,
+    0x47, 0xC7, 0x42, 0x00, 0x85, 0x16, 0xB6, 0x55, 0x5A, 0x9C, 0x2C, 0xDB, 0x4E, 0x90, 0xB1, 0x67,
+    0x6A, 0x10, 0x42, 0x62, 0xE4, 0x50, 0x18, 0x5B, 0x0B, 0x03, 0x86, 0xB6, 0x65, 0xD3, 0xEE, 0x95,
+    0x13, 0x97, 0x32, 0x80, 0x4A, 0x73, 0xFD, 0x15, 0xFE, 0x05, 0x00, 0x80, 0x4C, 0x45, 0x6B, 0xFA,
+    0xCD, 0x02, 0x90, 0xF4, 0x50, 0xA9, 0xB6, 0x71, 0x63, 0xA4, 0x4D, 0x74, 0xB6, 0x2A, 0x57, 0x71,
+    0x5C, 0xC4, 0x00, 0x78, 0xB6, 0x98, 0x1A, 0x57, 0xAB, 0xAD, 0x30, 0x2C, 0x33, 0xC4, 0xED, 0xC3,
+    0x54, 0xB2, 0xE6, 0x80, 0x61, 0xA6, 0x24, 0x69, 0x0E, 0x00, 0x00, 0x73, 0xAB, 0x2E, 0x06, 0x00,
+    0xA0, 0x2D, 0x80, 0x21, 0x5C, 0x1C, 0x2C, 0x9E, 0xEC, 0x72, 0x2B, 0x37, 0x00, 0x88, 0xCE, 0x9E,
+    0x28, 0x37, 0x11, 0xB1, 0x47, 0x00, 0x25, 0xE7, 0x02, 0x50, 0x04, 0x20, 0x97, 0x9C, 0x08, 0x6D,
+    0x31, 0x0B, 0x9E, 0x3B, 0x95, 0xDB, 0x1A, 0x48, 0x0D, 0x30, 0x00, 0x68, 0xE2, 0x6F, 0xAD, 0xA8,
+    0x8B, 0x7B, 0xCE, 0x7E, 0x05, 0x20, 0x0A, 0xC0, 0x57, 0x0A, 0x97, 0x6C, 0x90, 0x3D, 0xC0, 0x8E,
+    0x32, 0x80, 0xA2, 0x29, 0x4C, 0x7C, 0x5B, 0x83, 0xE5, 0x2B, 0x90, 0xAA, 0x90, 0x44, 0xFD, 0xDD,
+    0xD8, 0x84, 0xD6, 0x31, 0x00, 0x6F, 0x8E, 0xDD, 0x02, 0xF0, 0x16, 0xC0, 0x1A, 0x1A, 0xAD, 0x92,
+    0x00, 0x80, 0x00, 0x50, 0x2B, 0x00, 0x1F, 0x3E, 0xB8, 0xBE, 0x02, 0x70, 0xF2, 0x2B, 0xCB, 0xAA,
+    0x00, 0x00, 0xD4, 0x91, 0x9B, 0xCB, 0xD4, 0xDB, 0x95, 0x8F, 0xFC, 0x19, 0xB2, 0x0B, 0xC0, 0x1F,
+    0x80, 0x59, 0x84, 0x80, 0xB5, 0xE8, 0x26, 0xA1, 0x15, 0x2D, 0x30, 0x25, 0xCA, 0x72, 0xE5, 0xE3,
+    0xC0, 0xB2, 0x0E, 0x1D, 0x82, 0x38, 0x8E, 0x28, 0x0A, 0x40, 0x1D, 0xE2, 0x5A, 0x56, 0x10, 0xAD,
+    0xD1, 0x3A, 0xAB, 0x6C, 0x44, 0xA1, 0xF5, 0xC0, 0x96, 0x44, 0x1C, 0x75, 0xA9, 0xD1, 0xB6, 0x5F,
+    0xEB, 0xAD, 0x5D, 0x6B, 0x8E, 0x4E, 0x38, 0xB7, 0x54, 0xAA, 0xAD, 0x9D, 0x4A, 0x77, 0xAB, 0x62,
+    0xBA, 0x2C, 0x93, 0x69, 0x25, 0x24, 0xD4, 0x8A, 0x59, 0x6E, 0x31, 0x90, 0x3D, 0x30, 0x34, 0x6D,
+    0xAE, 0x13, 0xC4, 0x10, 0xC9, 0xEE, 0x0A, 0x74, 0xF6, 0x9A, 0x9C, 0x42, 0x48, 0xFA, 0x30, 0xD5,
+    0x47, 0x43, 0xEB, 0x4D, 0x64, 0x60, 0xB3, 0x1A, 0x1C, 0x2C, 0x34, 0x6C, 0x23, 0x47, 0x82, 0x8A,
+    0x06, 0x4B, 0x4B, 0xA8, 0xE5, 0xAA, 0xA9, 0x23, 0x30, 0x24, 0x92, 0x1B, 0x08, 0x70, 0x4E, 0x31,
+    0xD7, 0xB4, 0x02, 0x58, 0x62, 0xA2, 0x6A, 0x61, 0x37, 0x22, 0x4C, 0xEC, 0x0D, 0xA4, 0x2B, 0x56,
+    0x2A, 0xA8, 0x81, 0xB2, 0x16, 0x40, 0xB9, 0x13, 0x18, 0x50, 0xB0, 0x8B, 0x06, 0xF8, 0x04, 0x51,
+    0xB5, 0x29, 0x21, 0x12, 0x23, 0xE6, 0x72, 0x05, 0x0B, 0x00, 0x00, 0x80, 0x6B, 0x00, 0xD2, 0x1E,
+    0x3C, 0x74, 0x33, 0x52, 0x2C, 0x47, 0x00, 0x82, 0xC9, 0x02, 0x90, 0xC2, 0x44, 0x57, 0x82, 0xC5,
+    0x5C, 0x7E, 0x30, 0x81, 0x66, 0xAE, 0x5B, 0x00, 0xB5, 0x52, 0xB9, 0x2C, 0x2C, 0x33, 0x10, 0x00,
+    0x00, 0x4E, 0x00, 0x8C, 0xA4, 0x0C, 0x29, 0x52, 0x53, 0x5C, 0x55, 0x4F, 0x2C, 0x96, 0x05, 0xA0,
+    0x30, 0x61, 0x00, 0x6D, 0x53, 0x70, 0xA3, 0xA0, 0xB3, 0x2D, 0x1D, 0xB4, 0x7F, 0x82, 0x05, 0x43,
+    0x98, 0x8A, 0x4E, 0x62, 0x66, 0x5C, 0x0D, 0xBB, 0xD4, 0xBC, 0xF8, 0x4C, 0xD9, 0xB6, 0x88, 0xBF,
+    0x2A, 0xC2, 0x00, 0xA0, 0x02, 0x2C, 0xC4, 0x84, 0xA6, 0xAE, 0x71, 0xB4, 0x48, 0x00, 0x97, 0x36,
+    0x7B, 0xD2, 0x5E, 0x44, 0x0C, 0xA1, 0x6D, 0x4F, 0x22, 0x6D, 0x56, 0x9E, 0x25, 0x81, 0xB2, 0x20,
+    0x00, 0x00, 0x2F, 0xF4, 0x1C, 0x29, 0x51, 0xB5, 0xA2, 0xCB, 0x0B, 0x84, 0xEE, 0xFA, 0x4B, 0xCB,
+    0x65, 0x2E, 0x97, 0x7D, 0x88, 0x81, 0x6A, 0x1E, 0x81, 0x50, 0x6E, 0x9D, 0x3D, 0x6D, 0x9C, 0x1C,
+    0xB2, 0xBB, 0xF4, 0x06, 0x53, 0x2E, 0x9A, 0xF9, 0x00, 0xA0, 0x40, 0x18, 0x52, 0x50, 0x48, 0x5C,
+    0x00, 0xBD, 0x88, 0xEB, 0xA2, 0xA7, 0x09, 0x80, 0x17, 0xBC, 0x06, 0xC3, 0xE0, 0xCF, 0x90, 0x03,
+    0x42, 0x88, 0x17, 0x23, 0x14, 0x4C, 0xE8, 0x01, 0x80, 0x56, 0xAD, 0xEA, 0x26, 0x2C, 0xC1, 0xC5,
+    0x43, 0x50, 0x96, 0x73, 0x06, 0xFA, 0xA3, 0x30, 0x6D, 0x69, 0x0A, 0x1A, 0x75, 0x11, 0x93, 0x48,
+    0xE1, 0xE0, 0x98, 0x01, 0xA3, 0xCC, 0x64, 0x61, 0x29, 0x71, 0xF0, 0x28, 0x17, 0x52, 0x86, 0x00,
+    0x00, 0x00, 0x60, 0xF8, 0xA0, 0x66, 0x13, 0xA2, 0x64, 0x2D, 0x48, 0x92, 0x15, 0x80, 0xE4, 0x5C,
+    0x41, 0x01, 0xA4, 0x80, 0x65, 0x74, 0x54, 0x08, 0x48, 0x4C, 0xFF, 0x58, 0x71, 0x00, 0x60, 0x2B,
+    0x56, 0x42, 0x08, 0x45, 0xF1, 0x39, 0xB8, 0xF3, 0x02, 0x80, 0x83, 0xF5, 0xE0, 0x45, 0x5D, 0x3B,
+    0xF1, 0x2C, 0x0D, 0x22, 0x26, 0x70, 0x1C, 0x2B, 0xDB, 0x24, 0x42, 0xE1, 0x14, 0x20, 0xDA, 0x28,
+    0xA9, 0x0C, 0xC4, 0x14, 0xD1, 0xBA, 0x09, 0x17, 0xD3, 0x22, 0x61, 0x98, 0x0B, 0xCA, 0xA3, 0x9E,
+    0x04, 0x00, 0x30, 0xE8, 0x32, 0x4E, 0x49, 0xA9, 0x82, 0x6F, 0x35, 0x6A, 0x05, 0xE0, 0xC5, 0xC4,
+    0xBA, 0x90, 0x2A, 0x51, 0xF1, 0xA7, 0x87, 0x4B, 0x2E, 0x3D, 0x50, 0x99, 0x19, 0x7D, 0xE4, 0xEF,
+    0x70, 0x41, 0x33, 0x46, 0x51, 0x0D, 0x73, 0x9B, 0x8B, 0xAE, 0xA3, 0x7A, 0x00, 0xBE, 0x3E, 0x10,
+    0xB4, 0x78, 0xA2, 0xC7, 0xAC, 0x1E, 0x34, 0x95, 0xA4, 0x17, 0x6C, 0x2C, 0x00, 0x19, 0x9A, 0x1C,
+    0x83, 0xB0, 0x79, 0x62, 0xE7, 0x82, 0x49, 0x00, 0x10, 0x57, 0x65, 0x46, 0xEB, 0x32, 0x38, 0x5A,
+    0xFE, 0xEA, 0x02, 0x68, 0xAB, 0x95, 0x04, 0x80, 0x89, 0x24, 0xC8, 0xC9, 0x25, 0x44, 0xA1, 0x0A,
+    0x00, 0x00, 0x34, 0x82, 0x20, 0x9A, 0x5B, 0x87, 0xEC, 0x5C, 0x84, 0x00, 0x0E, 0x94, 0x61, 0x04,
+    0x00, 0xAD, 0x4B, 0xB9, 0x37, 0xD9, 0x66, 0x58, 0xEB, 0x32, 0x2D, 0xCC, 0x58, 0x32, 0xE6, 0x52,
+    0xD8, 0x09, 0x20, 0xED, 0xAA, 0x59, 0x45, 0x93, 0xD4, 0x25, 0x04, 0xC0, 0x2E, 0x00, 0x00, 0x8E,
+    0x1C, 0xA5, 0x20, 0x61, 0xA6, 0x2B, 0xD7, 0x01, 0x6D, 0xE6, 0xAE, 0x02, 0xC0, 0x94, 0x44, 0xD8,
+    0x83, 0x73, 0x00, 0xF0, 0xB8, 0x10, 0x24, 0xED, 0x64, 0x00, 0x6F, 0x41, 0x00, 0x68, 0xD5, 0xF3,
+    0xD7, 0x2F, 0x00, 0x41, 0xE5, 0xE1, 0xF2, 0x87, 0x83, 0xA9, 0x13, 0x0C, 0x89, 0xDA, 0x12, 0xE2,
+    0x01, 0xC9, 0xC1, 0xAA, 0xB6, 0x2F, 0x5E, 0xEC, 0x6B, 0x85, 0xF7, 0xE7, 0x3E, 0x1A, 0x8E, 0xC8,
+    0x52, 0x01, 0x40, 0x56, 0xCA, 0xA0, 0xC5, 0x0C, 0xA7, 0x3C, 0x92, 0x03, 0x0B, 0x31, 0xB2, 0xB9,
+    0x00, 0x38, 0x14, 0x73, 0x9B, 0x8C, 0xA9, 0x28, 0x00, 0x00, 0x90, 0x4D, 0x9C, 0x1B, 0x10, 0x99,
+    0xA3, 0x7A, 0x8A, 0xA8, 0x12, 0x3A, 0x66, 0xC8, 0xAC, 0x82, 0x2F, 0x20, 0x5A, 0xB5, 0x3A, 0xC8,
+    0xE4, 0xAD, 0x5D, 0x12, 0x88, 0x19, 0x02, 0xD8, 0x35, 0xA9, 0x4D, 0xDD, 0x40, 0xF5, 0x3C, 0x34,
+    0x01, 0x31, 0x92, 0x25, 0xCA, 0xB0, 0x6F, 0x59, 0x9A, 0x60, 0x2B, 0xC7, 0x0A, 0xDB, 0xB4, 0x97,
+    0x71, 0x2A, 0x6A, 0xC2, 0x75, 0x8D, 0xD0, 0x81, 0x20, 0xE4, 0x1C, 0xAB, 0x4B, 0x03, 0xA0, 0xA2,
+    0x92, 0xD1, 0xE8, 0x02, 0xA0, 0x77, 0x18, 0xF1, 0x8B, 0xB9, 0xD0, 0xA6, 0x1E, 0xF2, 0x97, 0x13,
+    0x9F, 0x51, 0x50, 0x34, 0x76, 0x02, 0x48, 0x64, 0xA8, 0x00, 0x22, 0xB6, 0x00, 0xD8, 0xDE, 0xDA,
+    0xAB, 0xE0, 0x15, 0x80, 0x3F, 0xB9, 0xAA, 0x72, 0x45, 0x4A, 0xE1, 0xF0, 0xE2, 0x05, 0xC7, 0xBE,
+    0xB2, 0x93, 0x0B, 0xC0, 0x6B, 0x2B, 0xC0, 0xC8, 0x00, 0xB0, 0x05, 0x00, 0x60, 0xDF, 0x57, 0x00,
+    0x00, 0x00, 0x94, 0x94, 0x0C, 0xA0, 0x24, 0x24, 0x42, 0x89, 0x00, 0x7C, 0x2B, 0x90, 0x22, 0xEB,
+    0x9A, 0xAF, 0x49, 0xCD, 0xF2, 0x10, 0x0C, 0x94, 0xDE, 0x57, 0xB2, 0x5C, 0x6D, 0x7A, 0x3A, 0x9C,
+    0x75, 0x50, 0x46, 0xAB, 0x49, 0xFE, 0x90, 0xE2, 0xB2, 0x82, 0x2B, 0xC1, 0x81, 0xA7, 0x00, 0xA0,
+    0x7D, 0xAB, 0x70, 0xCE, 0x0B, 0xC4, 0x00, 0xAA, 0xA6, 0xED, 0xDA, 0x96, 0xDB, 0xE1, 0x15, 0x00,
+    0x58, 0x16, 0x99, 0x0C, 0x89, 0x2C, 0x5D, 0x00, 0x00, 0xC8, 0xF6, 0x30, 0x2A, 0xA6, 0xAD, 0x9E,
+    0xB6, 0x00, 0x5A, 0x75, 0xE2, 0xBA, 0x53, 0x6B, 0x59, 0x00, 0x00, 0x82, 0x98, 0x52, 0xDC, 0xAD,
+    0x84, 0x21, 0x07, 0x8E, 0x69, 0xD1, 0x49, 0x10, 0xD4, 0xC4, 0x2F, 0xAE, 0x31, 0xE3, 0x22, 0x04,
+    0xD0, 0x2F, 0x50, 0xD5, 0xB6, 0x6C, 0x01, 0x8C, 0xA0, 0x23, 0x01, 0x00, 0x57, 0x10, 0x82, 0x00,
+    0xC8, 0x89, 0x81, 0xD8, 0x9F, 0x28, 0x8A, 0x00, 0xDE, 0x8A, 0x05, 0xC0, 0xC7, 0x06, 0x00, 0x85,
+    0x41, 0xB2, 0x1E, 0x04, 0x90, 0x36, 0x96, 0x03, 0x00, 0x12, 0x00, 0xD0, 0x45, 0xA7, 0xE0, 0xAD,
+    0x9E, 0x18, 0xFF, 0x8A, 0xCE, 0x5D, 0xA5, 0x00, 0x00, 0x21, 0x2E, 0x5C, 0x39, 0xF0, 0x01, 0xD9,
+    0xA0, 0xE0, 0xDC, 0xA8, 0x02, 0xE4, 0xEC, 0x10, 0x13, 0x64, 0x10, 0x3C, 0x00, 0x90, 0x69, 0x01,
+    0x03, 0xF6, 0xCA, 0xAB, 0x59, 0xC3, 0xFB, 0xB8, 0x94, 0xD3, 0xBA, 0x64, 0x87, 0x5D, 0xAE, 0x6E,
+    0x5D, 0x2E, 0x69, 0xC0, 0xC7, 0x8A, 0x95, 0xBB, 0x0B, 0xAC, 0x70, 0x65, 0x99, 0x4C, 0xB0, 0x60,
+    0xC1, 0x81, 0xB8, 0x4C, 0x7D, 0x26, 0x30, 0x16, 0x80, 0x65, 0x7C, 0xF4, 0xCC, 0xF5, 0xD7, 0x84,
+    0x00, 0x00, 0x03, 0x41, 0xCA, 0x06, 0x71, 0xA0, 0x38, 0x1E, 0xD2, 0xB6, 0x00, 0x0A, 0x21, 0x66,
+    0xFA, 0x75, 0xC7, 0xD1, 0xAF, 0x21, 0xE8, 0xAE, 0x81, 0xD5, 0x00, 0x40, 0x2E, 0x42, 0x65, 0x5D,
+    0x26, 0xC1, 0xC9, 0xC7, 0x2E, 0x88, 0x04, 0x13, 0x9D, 0x5C, 0x35, 0x80, 0x65, 0x6E, 0xE1, 0x2B,
+    0x6B, 0x2A, 0x88, 0x61, 0x02, 0x28, 0x49, 0x51, 0x0A, 0x00, 0x65, 0xDD, 0xAA, 0x2A, 0xF8, 0xD4,
+    0xCE, 0x69, 0x0E, 0xA0, 0x2E, 0x26, 0x52, 0xC1, 0xD1, 0xBE, 0xAD, 0x55, 0xF7, 0xE5, 0xA0, 0x02,
+    0x82, 0xCF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xE5, 0xAB, 0x1E, 0x13, 0x0A, 0xDC, 0x02,
+    0x58, 0x44, 0xE1, 0x22, 0x8A, 0xB7, 0x6D, 0xBD, 0x8C, 0xB2, 0x6B, 0x18, 0xAD, 0xA3, 0x3D, 0xCC,
+    0x0E, 0x88, 0x79, 0x20, 0x99, 0x8E, 0xE1, 0x95, 0x64, 0x1C, 0x34, 0x79, 0xA1, 0xA2, 0x63, 0x09,
+    0x86, 0x24, 0x86, 0xC9, 0xAB, 0x5A, 0x8F, 0x8B, 0x64, 0x7F, 0xB3, 0xDA, 0x1A, 0xCB, 0xEA, 0x8F,
+    0x08, 0x89, 0xAD, 0x75, 0x3C, 0xA6, 0xD9, 0x53, 0x80, 0x8B, 0x40, 0x41, 0xF5, 0xD2, 0xDA, 0xD4,
+    0xDA, 0x4C, 0x94, 0x18, 0x00, 0x05, 0x3A, 0xCA, 0xC4, 0x65, 0x38, 0x10, 0x08, 0x00, 0xB3, 0xA6,
+    0xC9, 0x49, 0xA2, 0x28, 0x19, 0x15, 0x27, 0x22, 0xF4, 0xE8, 0x99, 0x6B, 0x36, 0x9E, 0x03, 0x11,
+    0x72, 0xDB, 0x9A, 0xDD, 0x48, 0xB6, 0x55, 0x2B, 0xBA, 0x4B, 0x06, 0x8D, 0x64, 0xC5, 0x8F, 0xCF,
+    0x9B, 0x0A, 0x18, 0xAB, 0xE2, 0x1C, 0x30, 0xB7, 0x2B, 0x1E, 0xB5, 0x5E, 0xD7, 0x02, 0x70, 0x00,
+    0x00, 0x8F, 0xD0, 0x5A, 0x00, 0x16, 0x03, 0xD0, 0x9A, 0xB7, 0x2D, 0x12, 0xBA, 0x8D, 0x00, 0x50,
+    0x28, 0xFA, 0x16, 0x40, 0xDB, 0x6E, 0x27, 0x19, 0x9C, 0x41, 0xF0, 0xCC, 0x0B, 0x14, 0x94, 0x00,
+    0x10, 0xAB, 0x35, 0x44, 0x77, 0x66, 0xD1, 0xAA, 0x67, 0x11, 0xB7, 0x85, 0xC8, 0x92, 0x0F, 0x36,
+    0xB6, 0x86, 0x76, 0xBE, 0x55, 0xC0, 0x87, 0x0F, 0x5B, 0x00, 0x6A, 0x5F, 0x69, 0x85, 0xB2, 0x24,
+    0xEF, 0xE2, 0xB7, 0x6F, 0x15, 0xB5, 0xD8, 0x01, 0xE0, 0x53, 0x5B, 0xB6, 0x86, 0xA0, 0x88, 0x8B,
+    0x01, 0xD0, 0x2C, 0x05, 0x64, 0x33, 0x9F, 0xC1, 0xF2, 0xE7, 0xAF, 0x25, 0x17, 0x0A, 0x0D, 0x22,
+    0xB4, 0xAD, 0xFA, 0x87, 0x8A, 0xBF, 0x61, 0x5C, 0x08, 0x10, 0xE0, 0xE2, 0x6F, 0x21, 0xD4, 0xB6,
+    0x14, 0xEC, 0x19, 0x00, 0x50, 0x16, 0x00, 0x80, 0xB9, 0x26, 0x72, 0xB5, 0x6D, 0x05, 0xE0, 0x9B,
+    0xD6, 0xAC, 0x00, 0x56, 0xF5, 0x93, 0x8C, 0x59, 0x72, 0x88, 0x01, 0x52, 0xE6, 0xB2, 0xE2, 0x02,
+    0x58, 0xD0, 0x0B, 0x9C, 0x0E, 0x1C, 0x00, 0x06, 0x50, 0xA7, 0x15, 0x00, 0x39, 0x78, 0xD1, 0x94,
+    0xC0, 0xF5, 0x0C, 0x19, 0xB0, 0x02, 0x85, 0x17, 0x03, 0xA2, 0x02, 0x44, 0x29, 0x80, 0x24, 0x58,
+    0xAB, 0x12, 0x32, 0x31, 0x0B, 0xC2, 0x2D, 0x43, 0xE0, 0x7A, 0xA9, 0x04, 0x90, 0x06, 0x5C, 0xDB,
+    0x4E, 0x53, 0xA3, 0xFE, 0xA3, 0x60, 0x89, 0xD6, 0x97, 0x34, 0x71, 0x42, 0xE1, 0x11, 0xC5, 0x37,
+    0x29, 0x2A, 0x07, 0x7F, 0xF6, 0xAD, 0x9D, 0x5A, 0x74, 0xA7, 0xA7, 0x25, 0x05, 0x0C, 0x3D, 0x13,
+    0xF5, 0x69, 0xC0, 0xAF, 0x82, 0x02, 0x01, 0x58, 0xA2, 0xD3, 0x84, 0x2B, 0xB5, 0x9E, 0x89, 0xEA,
+    0xB5, 0xBB, 0x19, 0x02, 0x5C, 0xB0, 0x9B, 0x31, 0xB8, 0x92, 0x02, 0x10, 0x84, 0xDF, 0x51, 0xCB,
+    0x58, 0xAD, 0x5C, 0xA0, 0xC7, 0x11, 0x00, 0x45, 0x7F, 0x38, 0xDE, 0x51, 0x08, 0x46, 0x39, 0x86,
+    0x28, 0x42, 0xA7, 0x00, 0x1C, 0x4B, 0xF6, 0x2E, 0xD7, 0xE5, 0x46, 0xB5, 0xDA, 0x5A, 0x6D, 0xD5,
+    0xEA, 0xEF, 0x62, 0x41, 0x2A, 0x4D, 0x84, 0xA5, 0x7A, 0x64, 0x50, 0x3D, 0x3E, 0xC5, 0x46, 0x14,
+    0x13, 0xE1, 0xA8, 0x1C, 0x80, 0xB6, 0x15, 0x69, 0xA1, 0x05, 0xE0, 0x6F, 0x32, 0x80, 0x04, 0x66,
+    0xF8, 0x26, 0x9A, 0x4B, 0x70, 0x81, 0x01, 0xA8, 0x6A, 0x05, 0xCA, 0x45, 0x9C, 0xE8, 0xD9, 0xCA,
+    0x92, 0xFE, 0x4A, 0x22, 0x33, 0xD3, 0xB6, 0x4C, 0x99, 0xA5, 0x5C, 0xCC, 0xB2, 0x4D, 0x7A, 0x14,
+    0x5A, 0x2D, 0x0C, 0xAD, 0x5C, 0xE6, 0x1A, 0x84, 0xC3, 0x5D, 0x2D, 0x47, 0x82, 0x1D, 0x1D, 0xB6,
+    0xCC, 0x15, 0x31, 0x00, 0x00, 0xA5, 0x00, 0x00, 0x28, 0x45, 0xB6, 0x8C, 0x93, 0x68, 0x89, 0x8B,
+    0xD2, 0x15, 0x5C, 0xE6, 0x2A, 0xAA, 0xB9, 0x38, 0x01, 0xC7, 0xE9, 0x23, 0x38, 0x04, 0x2E, 0x10,
+    0x88, 0xAB, 0x96, 0xDD, 0xCB, 0xAC, 0x4D, 0x4E, 0x00, 0x00, 0x6C, 0x36, 0xE1, 0x00, 0x8A, 0x68,
+    0xB6, 0x54, 0xB9, 0xDA, 0x7E, 0x4D, 0x5B, 0xB0, 0x1F, 0x0A, 0xAE, 0x6B, 0x12, 0x99, 0x3A, 0xC6,
+    0x36, 0x44, 0x2B, 0xB7, 0x2F, 0x0E, 0x12, 0x9D, 0x0B, 0x00, 0x80, 0x8E, 0x24, 0x7A, 0x00, 0x68,
+    0x05, 0xE0, 0x0F, 0x00, 0x5D, 0x42, 0x76, 0xAB, 0x98, 0x99, 0x63, 0x58, 0x21, 0x00, 0x00, 0x89,
+    0xEA, 0x7D, 0x29, 0xBB, 0x92, 0xA5, 0xC0, 0x18, 0x44, 0x28, 0x0C, 0x99, 0x1A, 0x03, 0xF1, 0x81,
+    0xAC, 0x0A, 0x76, 0x18, 0x50, 0x0A, 0xC0, 0x4C, 0xA3, 0x36, 0x31, 0xE4, 0xD2, 0x4D, 0xE5, 0x88,
+    0x0B, 0x38, 0x27, 0x4E, 0xC2, 0x52, 0x4A, 0xCB, 0x94, 0x5F, 0x83, 0x66, 0x33, 0xD3, 0xFA, 0xA3,
+    0x1B, 0x01, 0x40, 0xD9, 0x3D, 0x80, 0xD6, 0x3E, 0x12, 0xE5, 0x84, 0xD0, 0xB3, 0x13, 0x0A, 0xB2,
+    0x1A, 0x26, 0xEB, 0xD3, 0x84, 0x56, 0x19, 0xBF, 0x38, 0xA5, 0xC5, 0x00, 0xA0, 0x0E, 0x10, 0x86,
+    0x4A, 0xE7, 0x76, 0xBD, 0x46, 0xF3, 0x4A, 0x3F, 0x5A, 0x05, 0xFE, 0xB4, 0xFD, 0x73, 0xEC, 0xED,
+    0xAA, 0xB4, 0x0A, 0x88, 0xD0, 0x62, 0x89, 0x48, 0xD6, 0x22, 0x47, 0x45, 0xEB, 0x81, 0xF1, 0x2A,
+    0x75, 0x45, 0x90, 0x3F, 0x6B, 0x5B, 0x21, 0xE3, 0xB3, 0xB2, 0x90, 0xDB, 0xAA, 0x00, 0xEE, 0xE5,
+    0xA2, 0xD5, 0xF6, 0x42, 0x49, 0x3E, 0x2E, 0xA1, 0x3E, 0xEB, 0x83, 0x74, 0x02, 0x3D, 0x41, 0x5C,
+    0xDE, 0x54, 0x68, 0x05, 0xA2, 0x1E, 0x8E, 0x63, 0x3D, 0x03, 0x22, 0x0E, 0xE5, 0xA0, 0xC0, 0x31,
+    0xAE, 0x9D, 0x96, 0x36, 0xAD, 0xCA, 0x15, 0x40, 0xD3, 0x54, 0x20, 0xB8, 0x71, 0x6B, 0x75, 0xC4,
+    0x11, 0x40, 0x0A, 0x24, 0x01, 0x0B, 0x05, 0x48, 0xAE, 0xED, 0xA2, 0x2F, 0x41, 0x0C, 0x15, 0xCB,
+    0x61, 0x68, 0xEE, 0x57, 0xBC, 0xC2, 0x5A, 0xB9, 0x39, 0xEB, 0xB3, 0xB0, 0xDA, 0xA6, 0x26, 0xB5,
+    0x0A, 0xAC, 0xFA, 0x56, 0x05, 0xC2, 0xA8, 0x00, 0x10, 0x27, 0x45, 0x63, 0xD2, 0x02, 0x17, 0xA4,
+    0x3E, 0x7D, 0x4A, 0x96, 0xA3, 0xAF, 0x0E, 0x64, 0xC5, 0x14, 0x6A, 0x99, 0xD3, 0x1A, 0x2F, 0x48,
+    0x9D, 0xA2, 0x52, 0x8B, 0xFA, 0x23, 0x64, 0xC2, 0x80, 0xA2, 0x4B, 0xAD, 0x1C, 0x21, 0x2C, 0x85,
+    0xE6, 0x9F, 0x3F, 0xAE, 0x86, 0x58, 0x1A, 0x12, 0xD0, 0x07, 0x30, 0xDF, 0xB5, 0x82, 0x09, 0x79,
+    0x48, 0x6B, 0x08, 0x40, 0x5A, 0x00, 0x88, 0x94, 0x56, 0xAB, 0x0B, 0xC0, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x8B, 0x58, 0xF2, 0x67, 0x72, 0xAB, 0x9C,
+    0xA9, 0x83, 0x3B, 0x9A, 0xDC, 0x4A, 0xA8, 0xC2, 0xDC, 0x64, 0x5E, 0x50, 0xA0, 0x70, 0x3C, 0xB0,
+    0x1E, 0x4B, 0x96, 0x07, 0x27, 0xB0, 0x95, 0x71, 0xC4, 0x66, 0x09, 0x23, 0x07, 0x61, 0x19, 0x91,
+    0x0B, 0x2B, 0xED, 0x04, 0x8F, 0x6E, 0x1A, 0x89, 0x41, 0x1B, 0x30, 0x31, 0xA1, 0x44, 0x58, 0xD6,
+    0xB0, 0x00, 0x31, 0x4B, 0xF2, 0x62, 0x03, 0x53, 0x77, 0x54, 0x5D, 0xBC, 0xA8, 0x95, 0x23, 0x7C,
+    0x5C, 0xDA, 0xB6, 0xA5, 0x96, 0xB5, 0x51, 0x23, 0xA8, 0xC4, 0xDA, 0xB6, 0x45, 0x9C, 0x15, 0x30,
+    0x9F, 0x29, 0xAA, 0xDC, 0xEA, 0x83, 0x27, 0x90, 0x8F, 0x9A, 0x12, 0x25, 0xDA, 0xBA, 0x45, 0xBB,
+    0xAC, 0x91, 0x3F, 0xB6, 0x5A, 0xBB, 0x7A, 0x69, 0xB4, 0x95, 0x8F, 0x4B, 0x24, 0x2C, 0x09, 0x59,
+    0x2B, 0xE4, 0x88, 0xE5, 0x30, 0x3E, 0xC0, 0x74, 0x4D, 0xAE, 0x68, 0x36, 0x2D, 0x97, 0x91, 0xD3,
+    0xBE, 0xF4, 0x9C, 0x6B, 0xA3, 0x30, 0x40, 0xC4, 0x6D, 0xBE, 0xE8, 0x9A, 0xD5, 0x16, 0x92, 0xAA,
+    0x5F, 0x73, 0x0F, 0xB3, 0x64, 0x29, 0x25, 0xC5, 0x5C, 0x51, 0x73, 0xED, 0xF2, 0xF1, 0x97, 0x75,
+    0x91, 0xCD, 0x9D, 0x64, 0xC8, 0xA0, 0xFD, 0x8A, 0xD6, 0x1F, 0x5A, 0x42, 0x4B, 0xA9, 0x56, 0xCA,
+    0x81, 0x28, 0x4E, 0x5B, 0x10, 0x78, 0xA2, 0xB1, 0xED, 0xBA, 0x28, 0x29, 0xAC, 0xAE, 0x8B, 0xD8,
+    0x12, 0xA4, 0x20, 0xF7, 0xEB, 0x8E, 0x57, 0x4D, 0x8C, 0x41, 0x84, 0x48, 0x88, 0x10, 0xD5, 0xB6,
+    0x2A, 0x21, 0xAA, 0x2A, 0xC2, 0x57, 0x51, 0x3F, 0x14, 0x06, 0x06, 0x2B, 0x4A, 0x34, 0x21, 0xA2,
+    0x0C, 0x2D, 0x1D, 0x79, 0x4D, 0xC8, 0x30, 0x99, 0xA5, 0xCF, 0xC1, 0x5C, 0xB8, 0x72, 0x85, 0xAA,
+    0x47, 0x29, 0x44, 0x80, 0x5F, 0xC4, 0x50, 0xD0, 0x41, 0xAB, 0xAD, 0x88, 0x10, 0x1B, 0x43, 0xB4,
+    0x8D, 0x66, 0x0C, 0x22, 0x15, 0x11, 0x6A, 0x01, 0x26, 0xAE, 0x87, 0x35, 0xAB, 0xA1, 0x42, 0x6B,
+    0xB1, 0x64, 0x80, 0x48, 0xF5, 0x4A, 0x90, 0x2A, 0x89, 0xFD, 0xC9, 0x9B, 0x3B, 0x84, 0x49, 0xD6,
+    0xB6, 0x60, 0x2B, 0xB5, 0x25, 0x24, 0x20, 0x2B, 0x21, 0x2E, 0x53, 0xC6, 0x2A, 0xAA, 0xB7, 0x83,
+    0x4B, 0xD0, 0xC4, 0x72, 0x07, 0x05, 0x9A, 0x6B, 0xC3, 0x6E, 0xC7, 0xAA, 0x2C, 0x46, 0xA0, 0xE5,
+    0x6A, 0x32, 0x04, 0xAF, 0x0C, 0x67, 0xC1, 0x56, 0x5D, 0xCC, 0x97, 0xAB, 0x39, 0x0A, 0x68, 0xB8,
+    0x71, 0xFB, 0x8A, 0x80, 0x2C, 0x2D, 0xC5, 0x2A, 0x11, 0xC6, 0x68, 0xC0, 0xB2, 0x50, 0xBD, 0xB6,
+    0x36, 0xDB, 0x1E, 0x16, 0x22, 0x07, 0xD8, 0x8E, 0xC5, 0x15, 0x10, 0x3A, 0x20, 0x1C, 0xA3, 0x6A,
+    0x90, 0xC5, 0x9A, 0xE5, 0xAA, 0x2D, 0x2A, 0xB8, 0x8E, 0x03, 0xA8, 0x28, 0xE7, 0xB6, 0xE5, 0xA2,
+    0xF9, 0x8C, 0x38, 0xA5, 0xDC, 0xB8, 0x22, 0x8C, 0x1B, 0x15, 0x20, 0x4B, 0x49, 0x0A, 0xE4, 0x05,
+    0xAA, 0x93, 0xAA, 0xAB, 0x18, 0xB5, 0x07, 0xA6, 0x34, 0x2B, 0x24, 0x65, 0x02, 0xA1, 0x3B, 0x83,
+    0xDA, 0x24, 0x3C, 0x8A, 0x28, 0x46, 0x5B, 0x96, 0x61, 0x55, 0x42, 0xA5, 0x84, 0xD8, 0x8B, 0xA9,
+    0xB6, 0x26, 0x3C, 0xB1, 0x69, 0xE5, 0x96, 0x25, 0xB2, 0xC5, 0x64, 0xE5, 0x0E, 0xC8, 0x05, 0x4D,
+    0x0A, 0xAF, 0x23, 0x1E, 0x4C, 0x9C, 0x35, 0xA3, 0xB8, 0x6D, 0xC5, 0x1B, 0x5B, 0x6D, 0xEA, 0xC8,
+    0xE5, 0x13, 0x91, 0xE1, 0x0D, 0x02, 0x3F, 0x7D, 0x10, 0x47, 0x4E, 0x51, 0xD6, 0x3D, 0x8C, 0x4A,
+    0x18, 0xD6, 0x8C, 0x82, 0x60, 0x2E, 0x47, 0x2E, 0x93, 0xAA, 0x74, 0x4A, 0xA1, 0x9A, 0xD7, 0x07,
+    0x4E, 0xE7, 0x6A, 0xA5, 0xE1, 0xE4, 0x20, 0x59, 0x36, 0x9D, 0xB2, 0x46, 0x6A, 0xCB, 0x05, 0x96,
+    0x65, 0x81, 0xAD, 0xE2, 0x0A, 0x5A, 0x04, 0xB0, 0xA3, 0xBC, 0x9C, 0x5C, 0xB4, 0xB6, 0xE2, 0xA2,
+    0x4F, 0xC1, 0x5C, 0x7F, 0x5B, 0xC1, 0x8E, 0x9D, 0x1B, 0x64, 0x04, 0x0A, 0xC4, 0x69, 0x5D, 0xB5,
+    0x32, 0x65, 0xD3, 0xD0, 0x58, 0x2E, 0x83, 0x1C, 0x79, 0x75, 0x67, 0x08, 0x42, 0x0A, 0x2B, 0x58,
+    0xD0, 0x0E, 0x58, 0x30, 0x17, 0xAC, 0x03, 0x3E, 0x21, 0x10, 0x4F, 0x68, 0xB4, 0xD6, 0x86, 0xAB,
+    0xA9, 0xA6, 0x32, 0x50, 0x16, 0xB3, 0x66, 0x81, 0x51, 0x97, 0x2E, 0x8D, 0xF5, 0x00, 0x0A, 0xC9,
+    0x45, 0x58, 0x7A, 0x41, 0xF7, 0xB4, 0xF5, 0x57, 0xF4, 0xCB, 0xA2, 0x44, 0x3B, 0x43, 0x24, 0xAA,
+    0x82, 0x78, 0xD3, 0x23, 0xCA, 0x8E, 0x00, 0x72, 0xE3, 0x25, 0x19, 0x6B, 0xAF, 0x9B, 0xAC, 0x04,
+    0x1D, 0x99, 0xCC, 0x20, 0xAB, 0x23, 0x6A, 0x17, 0x0C, 0x05, 0x66, 0x8B, 0x78, 0x64, 0x41, 0x71,
+    0x6F, 0x4B, 0x00, 0x4C, 0x7B, 0x31, 0xF1, 0x8B, 0x42, 0x84, 0xAA, 0xCE, 0x9D, 0xA0, 0xB1, 0x68,
+    0x55, 0x7B, 0x69, 0xB1, 0x04, 0xC5, 0xEA, 0xE4, 0xEB, 0x88, 0x95, 0x94, 0x82, 0x68, 0xF6, 0x90,
+    0x74, 0xC1, 0x57, 0x40, 0x6B, 0x05, 0xA3, 0x48, 0x2B, 0xD7, 0x10, 0x59, 0xC0, 0x31, 0xB8, 0x38,
+    0x40, 0x4C, 0x39, 0x19, 0xA1, 0xB6, 0x5F, 0xCF, 0x5E, 0x50, 0xB2, 0xC1, 0x30, 0xBB, 0xA5, 0x4B,
+    0x17, 0xDC, 0xC5, 0x95, 0xA8, 0xEA, 0x95, 0x10, 0x6D, 0x70, 0x22, 0xCE, 0xB9, 0x95, 0x0B, 0xDD,
+    0x89, 0xAD, 0xCC, 0xD9, 0x3D, 0xF4, 0x2B, 0x81, 0x90, 0xA0, 0x74, 0x12, 0x69, 0x2D, 0x09, 0x10,
+    0x52, 0x86, 0x14, 0x1D, 0x17, 0x78, 0x8D, 0xBB, 0x16, 0x68, 0x4F, 0xB5, 0x53, 0x26, 0x14, 0xD2,
+    0x81, 0x37, 0x28, 0x1A, 0x09, 0x29, 0xD4, 0x61, 0x58, 0x65, 0x23, 0xEE, 0x5E, 0xCA, 0x0D, 0x6E,
+    0x16, 0x60, 0x31, 0x37, 0xB0, 0x65, 0x93, 0x2D, 0x16, 0x99, 0x18, 0x29, 0x67, 0x70, 0xC1, 0xB4,
+    0x41, 0xBE, 0xE2, 0x5A, 0x70, 0x4F, 0xD1, 0xAB, 0x5C, 0xC1, 0x00, 0x72, 0x05, 0xFA, 0xF6, 0x88,
+    0xE3, 0xAE, 0x25, 0x05, 0x32, 0x72, 0x9A, 0xB9, 0x9F, 0xD6, 0x54, 0x21, 0xD8, 0xC4, 0xF2, 0x57,
+    0x02, 0x44, 0x55, 0x42, 0x14, 0x02, 0xB1, 0x40, 0xBA, 0x03, 0x51, 0x23, 0x91, 0x57, 0xB8, 0x3A,
+    0x72, 0x82, 0xC8, 0x90, 0xD2, 0x59, 0x14, 0xD0, 0x70, 0xCD, 0xC9, 0xF5, 0x10, 0x33, 0xB6, 0x8A,
+    0x0A, 0x09, 0xAC, 0x87, 0x45, 0xB1, 0x00, 0x8E, 0x6D, 0x23, 0x91, 0x03, 0xD1, 0x96, 0xC7, 0xA2,
+    0xB2, 0x9F, 0x0C, 0xA5, 0xD8, 0x81, 0x68, 0x24, 0x5E, 0x0C, 0x12, 0x06, 0x54, 0xFC, 0x89, 0xE2,
+    0xC3, 0x29, 0x6E, 0x8A, 0x00, 0x1E, 0xCB, 0x2A, 0xCE, 0x20, 0xB7, 0x10, 0xB2, 0x56, 0xE5, 0x0A,
+    0xA5, 0x60, 0x2E, 0x84, 0xBC, 0x88, 0x6D, 0xCA, 0xA5, 0x53, 0x90, 0x44, 0x2B, 0xA2, 0x55, 0x6F,
+    0xA5, 0x00, 0xD1, 0xD0, 0x65, 0xA0, 0x56, 0xBD, 0xF2, 0xAA, 0x0B, 0x9A, 0x76, 0x95, 0x35, 0x29,
+    0x59, 0xED, 0xE6, 0xA5, 0x2B, 0xF6, 0x04, 0x61, 0xB1, 0x5C, 0xD9, 0x2C, 0xB9, 0xB4, 0x24, 0x19,
+    0xD3, 0x10, 0x52, 0x96, 0x48, 0x51, 0xC4, 0xD4, 0x66, 0xDA, 0xB4, 0x2C, 0x01, 0xF0, 0x00, 0x88,
+    0xE4, 0xCA, 0x30, 0x95, 0x48, 0x00, 0x2C, 0x6A, 0x05, 0xA8, 0x22, 0xD5, 0x6C, 0x09, 0x61, 0xCD,
+    0x35, 0x60, 0xA6, 0x96, 0x56, 0x39, 0xA7, 0xCC, 0x18, 0x5D, 0x13, 0x76, 0x82, 0x3F, 0x47, 0x42,
+    0x26, 0x5F, 0x51, 0x6B, 0xA8, 0x25, 0xA1, 0xB6, 0x84, 0x40, 0x30, 0x1A, 0xC6, 0x30, 0x1B, 0xDD,
+    0x61, 0x60, 0x18, 0x6E, 0x60, 0xB4, 0x01, 0x6F, 0x1A, 0x46, 0xC3, 0x14, 0x0F, 0x3B, 0x43, 0x36,
+    0x19, 0xB2, 0x89, 0x6E, 0xBF, 0x52, 0x8A, 0x44, 0xAE, 0x2D, 0x32, 0x96, 0x6B, 0x8E, 0x25, 0x76,
+    0x44, 0xB7, 0x19, 0xA7, 0x59, 0x5C, 0xBE, 0x22, 0x9B, 0x70, 0xE4, 0x27, 0x18, 0x2C, 0x13, 0xF8,
+    0x9C, 0x80, 0xC4, 0x27, 0x14, 0x5B, 0x56, 0xEF, 0xB8, 0x30, 0x3B, 0xC2, 0x55, 0xD6, 0x3F, 0x43,
+    0x8B, 0x70, 0x16, 0x63, 0xEA, 0x0F, 0x4D, 0xE4, 0x9B, 0x8B, 0x60, 0x15, 0x1C, 0x42, 0xEB, 0xC8,
+    0x17, 0x43, 0x6E, 0x67, 0x08, 0x68, 0xD5, 0xA2, 0x59, 0x64, 0x1B, 0x36, 0x9B, 0x28, 0x9A, 0x35,
+    0x4B, 0x9C, 0xD6, 0x24, 0x84, 0xA8, 0x50, 0xA1, 0x82, 0xC5, 0x51, 0x8A, 0xC3, 0x58, 0xA2, 0x21,
+    0xE6, 0x82, 0x45, 0x1F, 0x96, 0x49, 0x80, 0x26, 0x7D, 0x01, 0xA2, 0x0F, 0xA0, 0xD8, 0x4F, 0x4C,
+    0x0B, 0xA4, 0x20, 0xC4, 0x43, 0x8E, 0x9C, 0xBD, 0x3D, 0x86, 0xF4, 0x80, 0x08, 0xB1, 0xC5, 0x95,
+    0x81, 0x6D, 0x09, 0x51, 0x02, 0x78, 0x23, 0x85, 0x55, 0x42, 0x3B, 0xC2, 0xF6, 0x99, 0x0A, 0xA9,
+    0x55, 0x5D, 0x59, 0xB5, 0xF8, 0x82, 0x69, 0xC1, 0x25, 0x05, 0xC2, 0x21, 0x25, 0x99, 0xD1, 0x4A,
+    0xFC, 0x2E, 0x42, 0xA2, 0x44, 0xF1, 0x5A, 0x95, 0x8C, 0x00, 0x62, 0x51, 0x9A, 0x32, 0x3D, 0x5A,
+    0x88, 0xEA, 0xD4, 0x44, 0x0A, 0xE2, 0x97, 0x09, 0x47, 0xC6, 0xB8, 0x94, 0xA8, 0x4D, 0x8C, 0x36,
+    0x93, 0x9A, 0x10, 0x2A, 0xBA, 0x08, 0x57, 0x2F, 0xBE, 0x74, 0x71, 0x98, 0xC5, 0x54, 0x0A, 0xE0,
+    0xC8, 0x16, 0x69, 0x0C, 0xE1, 0x68, 0x55, 0xD4, 0x0A, 0x3F, 0x10, 0xFE, 0x5A, 0x4C, 0x06, 0x33,
+    0x95, 0x02, 0xA1, 0x26, 0x05, 0x4B, 0x26, 0x31, 0x44, 0x88, 0x42, 0x5A, 0x47, 0x83, 0x56, 0x1A,
+    0x6A, 0xA2, 0x24, 0x6B, 0x1A, 0x2E, 0x2B, 0x0D, 0x89, 0xC9, 0x31, 0xA9, 0x05, 0x0B, 0x10, 0x4D,
+    0x73, 0xB5, 0xA2, 0x57, 0xF2, 0x1E, 0x27, 0x44, 0x69, 0x04, 0x42, 0xEA, 0x03, 0x58, 0xF2, 0x2B,
+    0x47, 0xF5, 0x6A, 0xB5, 0x41, 0xD4, 0xC6, 0x90, 0xA1, 0xA0, 0x83, 0x08, 0x19, 0x6A, 0x6B, 0x08,
+    0x31, 0x08, 0x43, 0xCF, 0x5A, 0x2D, 0x6E, 0x85, 0x36, 0x21, 0x02, 0x33, 0x85, 0xB2, 0x02, 0x93,
+    0xA5, 0x48, 0xD3, 0x57, 0xC4, 0x47, 0x16, 0x9B, 0x4B, 0x84, 0xF0, 0x64, 0xDB, 0xC5, 0xCF, 0x5A,
+    0x29, 0x4A, 0x95, 0xEA, 0x11, 0x27, 0xB5, 0x51, 0xBD, 0x42, 0x0B, 0x95, 0x48, 0x56, 0x1D, 0x96,
+    0x97, 0x14, 0x85, 0xA1, 0xC0, 0xCC, 0x04, 0xAA, 0xB8, 0x71, 0x93, 0x5D, 0x3A, 0xFB, 0xA8, 0x60,
+    0xAE, 0x0A, 0xC7, 0x4C, 0xAC, 0x9A, 0x94, 0xEC, 0x08, 0x59, 0xB2, 0x94, 0xB2, 0xB6, 0x3D, 0x7B,
+    0x75, 0x65, 0xAA, 0x68, 0xB9, 0xEE, 0xB1, 0x24, 0x44, 0xF0, 0x90, 0x88, 0x84, 0x5D, 0xDB, 0x42,
+    0xA2, 0xF2, 0x48, 0xA9, 0xA3, 0x1D, 0x5F, 0x81, 0x9D, 0x3D, 0x9B, 0xAB, 0xD5, 0x88, 0x86, 0x09,
+    0x15, 0x9C, 0xB4, 0xDB, 0x48, 0xC1, 0x99, 0xAC, 0x76, 0xAD, 0x8A, 0xF5, 0xE2, 0x45, 0x81, 0x8C,
+    0xB6, 0x62, 0xE9, 0x39, 0x12, 0x2A, 0xA6, 0x9F, 0x93, 0x78, 0x5C, 0xCC, 0xE4, 0x68, 0x64, 0xC6,
+    0x41, 0x9F, 0x05, 0xD7, 0x58, 0x56, 0x69, 0xD4, 0xF6, 0xEE, 0xA1, 0x4A, 0x87, 0x42, 0xF1, 0xD9,
+    0x8A, 0x90, 0x4A, 0x9B, 0x81, 0x7A, 0x43, 0x59, 0xE1, 0x33, 0xB7, 0x8D, 0xA8, 0x40, 0x3B, 0xDA,
+    0xBC, 0x7A, 0xA5, 0x33, 0x49, 0x23, 0x48, 0x5A, 0xEB, 0x21, 0x6C, 0x7B, 0x29, 0xED, 0x03, 0x6E,
+    0x08, 0x59, 0x9E, 0x05, 0xD8, 0x6D, 0xA3, 0xE5, 0x95, 0x59, 0x03, 0x21, 0x60, 0xA9, 0x75, 0x6A,
+    0x9F, 0xAF, 0x53, 0x17, 0x58, 0x96, 0xFC, 0x75, 0x07, 0xB0, 0x6A, 0x3B, 0x08, 0x51, 0x80, 0x49,
+    0x21, 0xD4, 0x83, 0x0A, 0x82, 0x25, 0xE5, 0x92, 0x9B, 0x4B, 0x6B, 0x1A, 0xAC, 0x5F, 0x13, 0x25,
+    0xAA, 0x4A, 0xC0, 0x20, 0xE2, 0x61, 0x6E, 0xAB, 0x9E, 0x24, 0xA4, 0x50, 0x97, 0x89, 0x47, 0x5F,
+    0xC9, 0x2A, 0x52, 0x98, 0x95, 0x90, 0x93, 0x82, 0x5A, 0x3B, 0x86, 0xA8, 0xEA, 0x24, 0x69, 0xAB,
+    0xC2, 0x72, 0x5A, 0xA1, 0x45, 0x9B, 0x16, 0x65, 0x10, 0xC0, 0xF0, 0xD0, 0x0E, 0x44, 0x8B, 0x78,
+    0x03, 0xBC, 0xA2, 0xAD, 0x50, 0xEE, 0x49, 0x8A, 0x19, 0x87, 0x15, 0xBA, 0x1B, 0xE8, 0x76, 0x4D,
+    0xDB, 0x0A, 0xD2, 0x48, 0x21, 0x29, 0x1A, 0x29, 0x2A, 0xD0, 0x26, 0xAD, 0xCD, 0x56, 0x21, 0x4E,
+    0xB5, 0x4A, 0x9B, 0x96, 0xAE, 0x4D, 0x33, 0xB3, 0x28, 0x22, 0x44, 0x28, 0x65, 0x55, 0x12, 0xAE,
+    0x8E, 0x3B, 0x62, 0xC0, 0x80, 0x01, 0x83, 0x00, 0x1D, 0x72, 0x3D, 0x10, 0x92, 0x2B, 0x93, 0x4A,
+    0x4B, 0x35, 0x06, 0xA6, 0x68, 0x64, 0xE9, 0x52, 0x32, 0xC2, 0x96, 0x0F, 0xC8, 0x6E, 0x7D, 0x87,
+    0x93, 0x50, 0x55, 0x9C, 0x44, 0x30, 0xCA, 0xE0, 0x84, 0xC6, 0x11, 0xAD, 0x34, 0x3D, 0x38, 0x21,
+    0x46, 0x44, 0xD8, 0x40, 0x91, 0x4B, 0x3F, 0x4D, 0xB0, 0x94, 0x7B, 0x70, 0x1F, 0x5B, 0x3A, 0x36,
+    0x81, 0x9A, 0x50, 0x35, 0x84, 0x50, 0x2C, 0x3D, 0xCB, 0xC8, 0x0A, 0x33, 0x21, 0xA6, 0xEC, 0xDA,
+    0xC9, 0x75, 0x08, 0x0D, 0xB9, 0xA1, 0xB4, 0xD9, 0x9E, 0x56, 0x4C, 0xBB, 0x02, 0xDE, 0xCA, 0x36,
+    0x17, 0xDA, 0x5F, 0xEC, 0x06, 0xB5, 0x8D, 0x84, 0x62, 0xD6, 0x53, 0xB7, 0x56, 0x1C, 0x10, 0x24,
+    0x98, 0xA8, 0xC2, 0x16, 0x03, 0x4C, 0xAE, 0x38, 0x91, 0x93, 0x54, 0x13, 0x4D, 0x7F, 0x7A, 0x10,
+    0xBB, 0xCD, 0x9A, 0x55, 0xC4, 0x34, 0xB3, 0x5A, 0x5D, 0x20, 0xB1, 0xBA, 0x47, 0x4F, 0xD6, 0x30,
+    0x68, 0x23, 0xE5, 0x72, 0x22, 0xA6, 0x98, 0x0E, 0x7F, 0x25, 0xB2, 0x86, 0xE1, 0x82, 0x48, 0x8F,
+    0x89, 0x95, 0xD3, 0x9E, 0x72, 0x69, 0xAB, 0x83, 0x5D, 0xAB, 0x05, 0x74, 0xDF, 0x58, 0x0D, 0x98,
+    0xD5, 0x09, 0xCB, 0x47, 0xF3, 0xAC, 0x62, 0xF3, 0x45, 0x8B, 0xA1, 0xDC, 0x20, 0x8A, 0x59, 0x2A,
+    0x46, 0xAA, 0xB5, 0xAD, 0x3F, 0x7D, 0x93, 0xD1, 0xC4, 0xA8, 0x4A, 0xB6, 0xCE, 0xB5, 0x2E, 0xF2,
+    0xDA, 0x7A, 0x55, 0xC9, 0xA7, 0x59, 0x0E, 0x84, 0x8E, 0xE4, 0xDC, 0x85, 0xDA, 0x84, 0x5F, 0xBC,
+    0x08, 0x5C, 0xD4, 0xD6, 0xB9, 0x5B, 0x27, 0x4E, 0xA3, 0xB8, 0x5C, 0x72, 0x28, 0x8E, 0x2A, 0x09,
+    0x8D, 0x24, 0xCD, 0x15, 0x6E, 0x1D, 0x11, 0xE7, 0xD3, 0x26, 0xD7, 0x41, 0xFE, 0xA4, 0x38, 0x61,
+    0x03, 0x58, 0x6B, 0x5B, 0x59, 0x93, 0x97, 0x21, 0x43, 0xBC, 0x96, 0x90, 0x62, 0x31, 0x2E, 0xF3,
+    0x7A, 0x8D, 0x13, 0xC8, 0x93, 0x1F, 0xA1, 0x5C, 0x9D, 0x94, 0x1D, 0xFB, 0x26, 0x6D, 0xAA, 0xB6,
+    0x02, 0xF2, 0xA9, 0x54, 0xAA, 0x47, 0x6C, 0x93, 0xA8, 0x70, 0xF0, 0xCA, 0x25, 0xE2, 0xAE, 0xAB,
+    0x00, 0x32, 0xA1, 0xD0, 0xE6, 0xF0, 0xEA, 0x20, 0x50, 0xB7, 0x3E, 0x61, 0x3F, 0x35, 0xB9, 0x42,
+    0x88, 0x1C, 0x34, 0xB8, 0x74, 0xE8, 0xDE, 0xE2, 0x27, 0x4C, 0xCC, 0x3A, 0x13, 0x27, 0x5B, 0x4D,
+    0xB3, 0x5C, 0xA7, 0x93, 0x57, 0xAE, 0xA9, 0x28, 0x14, 0x06, 0x0C, 0xCB, 0xC0, 0x32, 0x59, 0x3B,
+    0xB9, 0x54, 0x90, 0x83, 0xA7, 0x4C, 0x4D, 0x31, 0x72, 0xD3, 0xA2, 0x41, 0xB3, 0x40, 0x4E, 0xCF,
+    0x17, 0x6D, 0x05, 0x14, 0x62, 0xCA, 0x75, 0x6A, 0x2B, 0xAD, 0x41, 0x35, 0x1F, 0x1C, 0x91, 0x75,
+    0x2F, 0x5A, 0x24, 0xFE, 0x82, 0x10, 0xFC, 0xF5, 0xCC, 0x0C, 0x12, 0x84, 0xA9, 0x60, 0xF5, 0xDC,
+    0xFB, 0x07, 0xD5, 0x48, 0x42, 0x96, 0xB1, 0x62, 0x51, 0xC4, 0xC7, 0x5F, 0xCB, 0xAA, 0x2F, 0x43,
+    0x48, 0x69, 0x15, 0x70, 0x00, 0x5F, 0xB8, 0xDD, 0xE6, 0x1A, 0x35, 0x35, 0x52, 0x2B, 0x54, 0x3E,
+    0x02, 0x08, 0x97, 0xCB, 0x24, 0x59, 0xB2, 0xC9, 0x20, 0x78, 0x66, 0x05, 0xB8, 0xD0, 0xF5, 0x69,
+    0x56, 0xAB, 0x36, 0x46, 0xA2, 0xF1, 0xE7, 0x4F, 0xE8, 0x8E, 0x1D, 0x6C, 0x27, 0x3B, 0xB0, 0xB1,
+    0xA2, 0x0E, 0x5A, 0x7F, 0x85, 0xAD, 0xC0, 0xE2, 0x5A, 0x6F, 0x64, 0x29, 0xBE, 0x6F, 0xD3, 0xB4,
+    0x2B, 0x0C, 0xD2, 0x31, 0xB8, 0x37, 0xBD, 0xD2, 0x06, 0x49, 0x08, 0x82, 0x42, 0x11, 0x54, 0x5E,
+    0x1D, 0x05, 0x35, 0x51, 0x74, 0x40, 0xA3, 0x1D, 0x92, 0xE2, 0x56, 0xAD, 0x56, 0x72, 0x6E, 0xE1,
+    0x52, 0x89, 0xF6, 0xC8, 0x21, 0xA2, 0xF8, 0x83, 0x54, 0x75, 0x73, 0xDD, 0xDE, 0x5D, 0xBB, 0x2E,
+    0x19, 0x1F, 0xBB, 0x2C, 0x02, 0xFD, 0xF9, 0xA3, 0xB5, 0x0E, 0x21, 0x51, 0x89, 0xAB, 0x8E, 0x24,
+    0x0B, 0xA8, 0x09, 0xB8, 0xB2, 0xB0, 0xE6, 0x7A, 0x34, 0x21, 0x30, 0xED, 0x8E, 0x79, 0x18, 0x5A,
+    0xC1, 0x05, 0x5C, 0x55, 0xD9, 0xDB, 0x79, 0x15, 0x44, 0x69, 0x9D, 0x9B, 0x08, 0x57, 0xA7, 0xBD,
+    0x7C, 0x8A, 0xAE, 0xAD, 0x13, 0x60, 0x6C, 0x40, 0x90, 0x71, 0x73, 0xEA, 0xF9, 0x2A, 0xA0, 0xE7,
+    0x2F, 0x0F, 0x71, 0x2E, 0xE5, 0xF0, 0x48, 0xA2, 0x22, 0xCE, 0xA8, 0x84, 0xE0, 0x65, 0x05, 0xC8,
+    0x52, 0xCC, 0xE4, 0x44, 0xA9, 0xAE, 0x46, 0xB5, 0x69, 0x82, 0x4E, 0x4F, 0x00, 0x71, 0x7A, 0x12,
+    0x04, 0x57, 0x07, 0x31, 0x47, 0x69, 0x62, 0xA6, 0x11, 0x11, 0x10, 0x50, 0xA9, 0x83, 0x02, 0x05,
+    0x5E, 0x61, 0x2E, 0xFC, 0x0C, 0x27, 0x4E, 0xA0, 0x41, 0xFC, 0x21, 0x3A, 0x81, 0x68, 0x12, 0xD0,
+    0x92, 0x1A, 0x0A, 0x09, 0xF0, 0x7A, 0x0F, 0x57, 0x17, 0x34, 0x5E, 0xF9, 0x04, 0x7A, 0xC3, 0x8E,
+    0x2B, 0xDF, 0x10, 0x64, 0xF7, 0xF9, 0xF8, 0xF5, 0x8B, 0xCF, 0xAA, 0x24, 0x5D, 0x82, 0xB2, 0x6D,
+    0xF0, 0x96, 0x23, 0x22, 0x64, 0x5E, 0xFB, 0x00, 0x63, 0xB8, 0x82, 0x5E, 0x2A, 0xAF, 0x84, 0x16,
+    0x8B, 0x10, 0x85, 0xD9, 0xAB, 0x4D, 0x3A, 0x5C, 0x62, 0x09, 0xD4, 0x9A, 0x02, 0xC4, 0x0E, 0x3B,
+    0x67, 0x9D, 0x64, 0xA6, 0x62, 0x22, 0x50, 0xDE, 0x16, 0x34, 0x76, 0xCC, 0x7D, 0xDA, 0x01, 0x11,
+    0x5B, 0xAD, 0xFE, 0xE8, 0xBC, 0x22, 0x0B, 0x24, 0x90, 0xDB, 0x7E, 0x90, 0x08, 0x9E, 0x05, 0x97,
+    0xCB, 0x66, 0xDA, 0xB7, 0x39, 0x04, 0xAF, 0x53, 0xAC, 0x88, 0x5C, 0xA0, 0xAF, 0xFE, 0x9C, 0xEC,
+    0x6D, 0xCB, 0x12, 0x11, 0x5D, 0x01, 0x71, 0x21, 0x7D, 0x9A, 0x3B, 0xAF, 0x47, 0x97, 0x3C, 0x4C,
+    0x78, 0x80, 0xE5, 0x58, 0xAF, 0x9E, 0x5B, 0xCC, 0xE2, 0x82, 0x9C, 0xF2, 0x39, 0xA8, 0x22, 0x9D,
+    0xAD, 0x6C, 0x9B, 0xD4, 0x43, 0x41, 0x48, 0x11, 0x9D, 0xA2, 0x21, 0xCE, 0x12, 0xB3, 0x50, 0x34,
+    0x57, 0x20, 0x0A, 0x72, 0xC1, 0xB9, 0xE5, 0x43, 0x4C, 0x4F, 0xE1, 0x56, 0xB5, 0xE2, 0x58, 0xF3,
+    0xFA, 0x2C, 0x6D, 0xAB, 0x5C, 0xB7, 0x9E, 0xED, 0x20, 0x91, 0xAF, 0x5E, 0xD7, 0x41, 0xCF, 0xB4,
+    0x36, 0xE9, 0x94, 0x16, 0xC4, 0xDB, 0x86, 0x42, 0x4A, 0xF9, 0xF4, 0x0A, 0x09, 0xC6, 0x9F, 0x41,
+    0x8E, 0xC1, 0x79, 0xB5, 0xD0, 0x0A, 0xC4, 0x87, 0x56, 0x6D, 0x7B, 0x59, 0xBB, 0x9B, 0x53, 0xAB,
+    0x5F, 0x43, 0x77, 0x17, 0x9F, 0x02, 0x67, 0xED, 0x94, 0xAD, 0xAA, 0x81, 0xDC, 0x1E, 0xB4, 0x19,
+    0xCE, 0x50, 0x20, 0xB0, 0x6E, 0xAB, 0x35, 0x6D, 0xCA, 0xA4, 0x12, 0x5D, 0x46, 0xF6, 0xEC, 0xCA,
+    0xE0, 0x13, 0x88, 0xAE, 0x93, 0x37, 0xA3, 0x64, 0x28, 0x65, 0x5A, 0x95, 0xD7, 0x9B, 0x85, 0x12,
+    0x69, 0xA1, 0x79, 0xF3, 0xF3, 0x0D, 0x53, 0xB9, 0x6F, 0xDC, 0x0A, 0xEA, 0x37, 0x57, 0x0E, 0x5D,
+    0x5E, 0x09, 0xE7, 0x16, 0x7C, 0xC3, 0xA2, 0x2A, 0xDD, 0x84, 0x9D, 0xFA, 0xD1, 0xA5, 0x8B, 0x96,
+    0x29, 0x53, 0xA6, 0x4D, 0x77, 0x05, 0x6A, 0xFB, 0x47, 0x97, 0x2E, 0xA6, 0x68, 0x99, 0x26, 0x5D,
+    0xD9, 0x2F, 0xD7, 0x27, 0xB4, 0x78, 0xAB, 0x8A, 0x99, 0x9B, 0xB5, 0x4D, 0xBD, 0xB6, 0x3E, 0x00,
+    0x02, 0x34, 0x2C, 0x99, 0xC7, 0xBF, 0xAD, 0x25, 0x43, 0x85, 0xF0, 0x07, 0xEE, 0x19, 0xA1, 0x42,
+    0x88, 0x11, 0x23, 0x38, 0xDB, 0x96, 0x60, 0xB1, 0x48, 0x13, 0x9F, 0x56, 0x61, 0xC0, 0x00, 0x28,
+    0x25, 0x3F, 0x9A, 0x35, 0x39, 0x58, 0x14, 0x64, 0x11, 0xA1, 0x4F, 0x41, 0x16, 0x19, 0x02, 0xDA,
+    0xCA, 0x40, 0xD6, 0x2B, 0x90, 0xF7, 0x21, 0x08, 0x3A, 0x0A, 0x21, 0x50, 0xC4, 0x50, 0xBF, 0xE8,
+    0x13, 0x92, 0x86, 0xDB, 0xCF, 0x7A, 0x8C, 0xD4, 0x6A, 0x29, 0x90, 0xEB, 0x60, 0xB4, 0x4B, 0x67,
+    0xCC, 0x1A, 0x30, 0x31, 0x82, 0xD6, 0x62, 0x2E, 0x7C, 0x10, 0xBB, 0x28, 0x75, 0xEB, 0x56, 0xAE,
+    0x02, 0x3A, 0xE2, 0x31, 0x0B, 0x7B, 0x84, 0x50, 0x9D, 0x5C, 0x31, 0x4C, 0xAC, 0xF2, 0xE2, 0x76,
+    0xCF, 0x12, 0xC2, 0x5C, 0xD8, 0xAC, 0x6D, 0xD2, 0xA4, 0x8D, 0x07, 0xB5, 0x6E, 0xA7, 0x9C, 0xA1,
+    0x4B, 0xE4, 0x6B, 0x26, 0x93, 0x2D, 0x9D, 0x4C, 0x10, 0xA2, 0x07, 0xAD, 0xA7, 0x1C, 0x92, 0x78,
+    0x4C, 0x9A, 0x73, 0x6D, 0x40, 0x58, 0xAE, 0x74, 0x13, 0x70, 0x31, 0xD0, 0xD6, 0xAD, 0x1C, 0xB2,
+    0x2E, 0x08, 0x96, 0x11, 0xD0, 0xA0, 0x8A, 0xC2, 0xB8, 0x91, 0x0A, 0x05, 0x01, 0x86, 0xEA, 0x51,
+    0x89, 0x92, 0x8A, 0x0A, 0xCB, 0x92, 0x55, 0xA1, 0x44, 0x9F, 0x0A, 0x2C, 0xCF, 0xBE, 0x61, 0xC4,
+    0xB6, 0x5B, 0x90, 0xB9, 0x15, 0xD0, 0x26, 0xDC, 0x59, 0xAF, 0xE0, 0x54, 0x47, 0xBC, 0x0E, 0x6F,
+    0x3A, 0x71, 0x44, 0x07, 0xD0, 0x01, 0x17, 0x52, 0x34, 0xA0, 0x84, 0xB8, 0x49, 0x5B, 0xC4, 0x6D,
+    0xE5, 0x11, 0x8A, 0xEC, 0xEF, 0xA3, 0x23, 0x6E, 0x9D, 0x2E, 0x05, 0x1D, 0xC5, 0xCD, 0xD0, 0x12,
+    0x45, 0x60, 0xE6, 0x3A, 0xA1, 0x87, 0x86, 0x29, 0xAB, 0x2A, 0x68, 0x01, 0x8E, 0x1A, 0xA0, 0xB2,
+    0xC9, 0x35, 0xA6, 0x25, 0xDC, 0x0A, 0x72, 0xF0, 0xEA, 0x0D, 0x11, 0xC7, 0x7B, 0x14, 0x28, 0x98,
+    0x1B, 0x64, 0x58, 0xA2, 0x8B, 0x6C, 0xCB, 0x50, 0xA2, 0x3C, 0x17, 0x90, 0x93, 0xB5, 0x69, 0x15,
+    0xC4, 0x28, 0x16, 0x22, 0x09, 0x54, 0xB7, 0x58, 0x12, 0x27, 0x52, 0x84, 0x07, 0xCC, 0x0B, 0x43,
+    0xFA, 0x56, 0x75, 0x05, 0xC4, 0x4A, 0xC9, 0xD4, 0xB2, 0x84, 0x08, 0x7D, 0x7A, 0xEB, 0xB3, 0x44,
+    0xDC, 0x49, 0x39, 0x73, 0xB2, 0x44, 0xE6, 0xF3, 0x6A, 0x09, 0xA6, 0x41, 0x15, 0x26, 0x6E, 0x95,
+    0x38, 0x01, 0x47, 0xBD, 0x4B, 0x8C, 0x66, 0x3D, 0x7C, 0x56, 0x8C, 0x61, 0x01, 0x66, 0xD2, 0x52,
+    0x32, 0x4A, 0xD7, 0xEA, 0xD7, 0x5A, 0x71, 0x50, 0x85, 0xA0, 0xD7, 0x80, 0x44, 0xAE, 0x5C, 0xEC,
+    0x00, 0x16, 0x7B, 0xE6, 0x58, 0xA6, 0x4B, 0x5C, 0x26, 0x82, 0x41, 0x58, 0xB4, 0xC1, 0x25, 0xE2,
+    0xC1, 0x94, 0xE2, 0x0A, 0x21, 0x81, 0x58, 0xEB, 0x9B, 0x80, 0x8A, 0x82, 0x98, 0x8C, 0x66, 0x23,
+    0xAD, 0xCF, 0xBF, 0x00, 0x03, 0xC2, 0xAA, 0x0A, 0x59, 0xE0, 0x5F, 0xB2, 0x25, 0x4B, 0x1A, 0xE8,
+    0xF7, 0xE9, 0x08, 0x15, 0x85, 0xCF, 0x98, 0x30, 0xC9, 0x1C, 0x64, 0x65, 0x93, 0x26, 0x40, 0x81,
+    0x44, 0xBB, 0x02, 0x08, 0x68, 0x0E, 0xB6, 0x8B, 0x0D, 0x15, 0x08, 0x48, 0x48, 0x60, 0xA6, 0xB6,
+    0xF5, 0x1C, 0x08, 0x39, 0xC4, 0x36, 0xAE, 0x59, 0xA0, 0xA7, 0x1C, 0xF9, 0xE1, 0xD1, 0x10, 0xE0,
+    0x59, 0xAE, 0x5A, 0xEB, 0x08, 0x40, 0xDB, 0x83, 0xCE, 0x45, 0x45, 0xAB, 0x42, 0xE5, 0x4A, 0x0B,
+    0xB4, 0xAA, 0x9F, 0x5B, 0xB7, 0x30, 0xB6, 0x9A, 0xD5, 0x10, 0xC4, 0xD9, 0xB4, 0xAB, 0x0C, 0x4C,
+    0x65, 0x09, 0xB1, 0xE3, 0xE3, 0xC7, 0x2B, 0xDB, 0x02, 0xBB, 0xB4, 0xF8, 0x31, 0x1F, 0x3E, 0xA3,
+    0xDA, 0xF2, 0x21, 0x3B, 0xAA, 0xA5, 0xB0, 0xCC, 0x2D, 0xDB, 0x22, 0x46, 0x93, 0xE2, 0x10, 0x96,
+    0x05, 0x81, 0x1F, 0xEC, 0x5C, 0x48, 0x8B, 0x0B, 0x8E, 0xAD, 0x62, 0xBF, 0x5E, 0xDB, 0x2A, 0x4A,
+    0xAB, 0x54, 0xBA, 0xC3, 0x72, 0x36, 0x69, 0xC2, 0xB6, 0xA0, 0xD4, 0x33, 0x67, 0xFC, 0x1D, 0x3B,
+    0xE6, 0x76, 0x10, 0x89, 0x1C, 0x7C, 0x8D, 0xFE, 0xE4, 0xA2, 0x66, 0xAD, 0xDA, 0x39, 0x61, 0x58,
+    0x0A, 0xFD, 0xB9, 0x34, 0xAD, 0x83, 0xB6, 0x9E, 0x0A, 0x35, 0xE9, 0x13, 0xCA, 0x6E, 0x21, 0x03,
+    0x50, 0x5E, 0xFD, 0x09, 0x92, 0x36, 0xDE, 0x23, 0x7F, 0xD4, 0xB0, 0x7C, 0xBD, 0x22, 0x24, 0xA1,
+    0xA8, 0xCA, 0x7F, 0xFC, 0x4D, 0x02, 0xCC, 0xA0, 0xED, 0x21, 0xA1, 0x7A, 0x19, 0x68, 0x05, 0x64,
+    0x65, 0xC8, 0xD9, 0x06, 0x42, 0x0A, 0xA0, 0xBC, 0x0A, 0xA7, 0x40, 0xD6, 0x02, 0x87, 0x5E, 0x35,
+    0xB1, 0x7B, 0x88, 0xE5, 0x95, 0x41, 0x0E, 0x74, 0x35, 0x31, 0x67, 0xAE, 0x08, 0x35, 0x80, 0x86,
+    0x7C, 0x36, 0x3A, 0xE7, 0x81, 0x0E, 0x57, 0x2A, 0x84, 0x6A, 0x56, 0xB4, 0x42, 0x55, 0xCF, 0x63,
+    0x2E, 0xBF, 0x76, 0x40, 0xE4, 0xB2, 0x28, 0x6D, 0x1C, 0xAB, 0x89, 0xDB, 0x25, 0x21, 0xA4, 0x29,
+    0xF1, 0x5A, 0x45, 0x76, 0x95, 0x6D, 0x31, 0x51, 0xF7, 0xF1, 0xB8, 0xB4, 0xD3, 0xC0, 0x5E, 0x71,
+    0x30, 0x17, 0x2A, 0x96, 0xA9, 0x55, 0xB2, 0xCE, 0x6D, 0x93, 0xC4, 0x00, 0x37, 0xC5, 0x92, 0x09,
+    0xE7, 0xA0, 0x46, 0x77, 0x29, 0x57, 0xC4, 0x4E, 0x8A, 0x3D, 0xF3, 0xE7, 0x40, 0xE5, 0x40, 0x27,
+    0x75, 0xC8, 0x4E, 0x39, 0xCC, 0x0C, 0x41, 0x34, 0x2E, 0xB4, 0x26, 0x4F, 0x66, 0xC9, 0xB0, 0xA4,
+    0xDA, 0x60, 0x89, 0xD0, 0xD8, 0x0C, 0x5B, 0x75, 0xB2, 0xA3, 0x92, 0xF9, 0x20, 0xAE, 0x3D, 0x72,
+    0xC8, 0x25, 0x21, 0x2F, 0x5D, 0xFB, 0x3C, 0x42, 0x74, 0x26, 0x95, 0x21, 0x43, 0x6D, 0xBB, 0x21,
+    0x26, 0x44, 0x88, 0x2B, 0x1E, 0x36, 0x91, 0x3C, 0xA5, 0x6D, 0x26, 0x4B, 0x9E, 0x13, 0xB9, 0x69,
+    0x3D, 0xA8, 0x74, 0xCB, 0xB2, 0x4D, 0xC2, 0xC9, 0x37, 0xAB, 0xEA, 0x89, 0x8A, 0x0B, 0xAD, 0x43,
+    0x44, 0xBA, 0xF4, 0x71, 0x3D, 0xD9, 0xAA, 0xC4, 0x57, 0x61, 0x5C, 0x7A, 0x16, 0xAB, 0x7A, 0x09,
+    0x06, 0x8C, 0xA4, 0xDE, 0xC2, 0x56, 0x9B, 0x3B, 0x8D, 0x5F, 0xB6, 0x47, 0x2A, 0x11, 0xCB, 0x09,
+    0xF2, 0xD8, 0x49, 0x3E, 0xA7, 0x5C, 0x93, 0x65, 0x4D, 0x9B, 0x55, 0x40, 0xDA, 0xB9, 0x36, 0xE7,
+    0x46, 0x6D, 0xC5, 0xD5, 0x11, 0x42, 0xC8, 0xFE, 0xB8, 0x4A, 0x3E, 0x12, 0x22, 0x97, 0x00, 0x27,
+    0x4E, 0x70, 0x25, 0x93, 0xC1, 0xCF, 0xD1, 0xBE, 0x0B, 0xB4, 0xA6, 0x42, 0xF0, 0xEA, 0xD2, 0x5F,
+    0x20, 0x2A, 0x58, 0x31, 0x02, 0xB5, 0x62, 0x25, 0x91, 0x51, 0x6E, 0x09, 0x17, 0x09, 0x5A, 0x04,
+    0x50, 0x48, 0x58, 0x3E, 0x53, 0x4D, 0x39, 0x70, 0x8B, 0xE2, 0x1A, 0x97, 0x45, 0xBC, 0x06, 0x9C,
+    0x1A, 0xE5, 0x16, 0xAD, 0xA3, 0x56, 0x42, 0xB8, 0xF6, 0xE9, 0xF3, 0x16, 0x84, 0xCA, 0xA4, 0x3C,
+    0xD6, 0x66, 0xAD, 0x06, 0xA3, 0xD0, 0x52, 0xB2, 0x73, 0xAB, 0x06, 0xA1, 0x58, 0x6C, 0xC7, 0x45,
+    0x82, 0x81, 0xB0, 0x02, 0x7C, 0xA1, 0x8C, 0x4B, 0x22, 0x25, 0x6D, 0x13, 0x17, 0x03, 0x94, 0x6C,
+    0xC0, 0xDB, 0xB2, 0x89, 0xAA, 0x16, 0xA3, 0x7B, 0xF8, 0x20, 0xCB, 0xAF, 0x50, 0x5F, 0x0D, 0x63,
+    0x68, 0xD3, 0x5E, 0xD5, 0xA8, 0x34, 0xF8, 0x14, 0x48, 0xA4, 0x80, 0xEC, 0xD2, 0x36, 0x29, 0xD6,
+    0xD6, 0xD3, 0x4A, 0xF7, 0xED, 0xC4, 0x8A, 0x26, 0x6A, 0x15, 0x7B, 0x57, 0xE0, 0xD7, 0x19, 0x51,
+    0x04, 0x0B, 0x7D, 0x34, 0x4C, 0x37, 0xD1, 0xC4, 0x66, 0x6F, 0x09, 0xE5, 0xFC, 0xC6, 0x55, 0x28,
+    0x3C, 0x54, 0xD7, 0x14, 0x08, 0xA8, 0x97, 0xAF, 0xED, 0xBD, 0xB9, 0xAB, 0xCA, 0x06, 0x6B, 0x3B,
+    0xB8, 0x52, 0x5C, 0x6E, 0xAD, 0x82, 0xB4, 0x49, 0xAB, 0xC8, 0x71, 0x08, 0xBE, 0x72, 0xB4, 0xA5,
+    0x7A, 0x56, 0x98, 0x0F, 0x9F, 0x02, 0xDA, 0x02, 0xFE, 0xC2, 0x87, 0x26, 0xAB, 0x40, 0xA8, 0x82,
+    0x95, 0x71, 0xE5, 0xFA, 0x2C, 0xD6, 0xAB, 0x3E, 0x6D, 0x80, 0x20, 0x26, 0xDB, 0xB6, 0x8F, 0x56,
+    0x51, 0x0E, 0xB5, 0xA6, 0x05, 0x81, 0xA8, 0x18, 0x15, 0x2A, 0x5C, 0xDB, 0x06, 0x42, 0xC4, 0x85,
+    0xA5, 0x83, 0x92, 0x3B, 0x03, 0xBE, 0xFA, 0x03, 0xF6, 0xDB, 0x91, 0xB6, 0x18, 0x04, 0x78, 0x13,
+    0xF7, 0xEB, 0x28, 0x0A, 0x45, 0x31, 0xE6, 0xE6, 0x9B, 0x58, 0x91, 0x5A, 0xDA, 0x9F, 0x6F, 0x01,
+    0x7E, 0xAB, 0xFB, 0x36, 0x99, 0x83, 0x5F, 0x2A, 0xC3, 0x72, 0x4B, 0x52, 0x8B, 0xEE, 0xA9, 0xB4,
+    0x32, 0x69, 0x21, 0xF2, 0x76, 0x0A, 0xE0, 0x5B, 0x99, 0x81, 0x12, 0x22, 0x6B, 0xA5, 0x2B, 0xED,
+    0xE2, 0x53, 0x93, 0x13, 0x41, 0x82, 0xB4, 0xC9, 0xEE, 0xAF, 0xC9, 0x37, 0x78, 0x72, 0x59, 0x30,
+    0xD9, 0x2B, 0xD8, 0x63, 0x36, 0x7F, 0x2A, 0x20, 0x84, 0xC6, 0x9C, 0x59, 0xB9, 0x8E, 0xE3, 0xE8,
+    0xE2, 0x79, 0x6D, 0x99, 0x0C, 0x80, 0x2E, 0x31, 0xA0, 0x9D, 0xCC, 0x8D, 0xCB, 0xE4, 0x56, 0x66,
+    0x29, 0x54, 0xA4, 0x06, 0x0E, 0xDC, 0x5B, 0x5D, 0xC9, 0xC4, 0x4D, 0xF4, 0xD9, 0x26, 0xB0, 0xC1,
+    0xB9, 0x2D, 0x07, 0x30, 0xBD, 0x39, 0x95, 0xE2, 0x5A, 0x3D, 0x6D, 0x17, 0x45, 0x46, 0xB6, 0x98,
+    0x87, 0x1E, 0xCA, 0x6B, 0x14, 0x17, 0x99, 0xDA, 0x56, 0x01, 0x4B, 0x96, 0x27, 0x54, 0x5E, 0x2A,
+    0xCB, 0x52, 0xEE, 0x9F, 0xB6, 0x47, 0x59, 0x72, 0x35, 0x53, 0x62, 0xA1, 0x19, 0xAF, 0x78, 0x01,
+    0x2B, 0x88, 0x93, 0xD6, 0x6B, 0x21, 0x95, 0x24, 0x26, 0x02, 0x42, 0xC6, 0x09, 0x94, 0x84, 0x9C,
+    0x17, 0xF2, 0x12, 0xA2, 0x4B, 0xC8, 0x2D, 0x32, 0x4E, 0x05, 0xEB, 0x18, 0x36, 0xC4, 0x45, 0xDC,
+    0x84, 0x3F, 0xC5, 0x08, 0xCA, 0x99, 0xCB, 0x52, 0x9C, 0x22, 0x71, 0x88, 0xE7, 0x2A, 0x00, 0x25,
+    0x8E, 0xE0, 0x33, 0x0F, 0x8E, 0xD2, 0x10, 0xE4, 0x93, 0x35, 0x16, 0x4B, 0x71, 0x81, 0x55, 0x56,
+    0xFD, 0x0A, 0x2A, 0x50, 0xAC, 0x48, 0x7F, 0xDA, 0xB6, 0x55, 0x40, 0xF0, 0x84, 0x02, 0x2C, 0x37,
+    0x96, 0xD8, 0x3C, 0xDB, 0x23, 0xD7, 0x92, 0x96, 0xFB, 0xB0, 0x38, 0xE6, 0x82, 0xF2, 0xD2, 0xA1,
+    0x43, 0x8E, 0xAB, 0x66, 0x3E, 0xEB, 0x72, 0x49, 0x0F, 0xAF, 0x89, 0x4E, 0x4A, 0x91, 0x22, 0xA5,
+    0x8B, 0x21, 0x97, 0x24, 0x4C, 0x9A, 0x7C, 0xD6, 0x25, 0x44, 0x2C, 0xAE, 0x5C, 0x47, 0xC9, 0xA5,
+    0x2A, 0x37, 0x56, 0xAC, 0xB5, 0xC2, 0xA8, 0x52, 0xA5, 0xDA, 0x65, 0x6D, 0x13, 0x51, 0x89, 0x1B,
+    0x7D, 0x41, 0xF3, 0xC5, 0xE9, 0x97, 0x2F, 0x2C, 0xDD, 0x9A, 0xB0, 0xC4, 0x4D, 0x51, 0xD5, 0x6F,
+    0x8E, 0xEA, 0x75, 0xD0, 0xEA, 0xC0, 0x51, 0x22, 0xA3, 0x08, 0x8B, 0x26, 0xCA, 0x3A, 0x84, 0x25,
+    0x4B, 0x7D, 0x84, 0xBE, 0x1A, 0xFE, 0xCA, 0x4D, 0xB0, 0xD6, 0xAA, 0xC1, 0x9C, 0xE0, 0xD2, 0x57,
+    0xD4, 0x8A, 0xCB, 0xAF, 0x4C, 0x73, 0xE5, 0xD2, 0xDA, 0x21, 0x97, 0xA3, 0xAF, 0x8E, 0x20, 0xC5,
+    0x82, 0xE4, 0x52, 0xEB, 0x88, 0xA7, 0xDC, 0x4A, 0x46, 0xE5, 0xDA, 0xCA, 0x49, 0xA0, 0x40, 0xB7,
+    0xDA, 0xFA, 0x83, 0x98, 0x55, 0x8E, 0xCA, 0xB9, 0x29, 0x76, 0xFA, 0x83, 0x58, 0x17, 0xC1, 0x5A,
+    0x02, 0x68, 0xB3, 0x26, 0x72, 0x42, 0x08, 0xE0, 0x95, 0xA9, 0xFE, 0x38, 0x00, 0xF4, 0xE7, 0x21,
+    0x11, 0x42, 0x30, 0x5C, 0x0B, 0x9C, 0xEA, 0x61, 0x40, 0xB3, 0x66, 0xB5, 0x8E, 0xC0, 0x5C, 0x3A,
+    0x63, 0x76, 0x5F, 0xAB, 0xA3, 0x08, 0xD3, 0x72, 0x19, 0x5B, 0x88, 0x16, 0xD4, 0x7A, 0x05, 0x74,
+    0x84, 0xAA, 0x8B, 0x90, 0xCF, 0x3E, 0x66, 0x03, 0x8E, 0xD2, 0x32, 0xA1, 0xEF, 0x88, 0x1C, 0x51,
+    0x63, 0x87, 0x29, 0x35, 0xDB, 0xF6, 0x41, 0x1D, 0x03, 0xBD, 0x9C, 0x70, 0x39, 0x4B, 0x24, 0x17,
+    0x14, 0x29, 0x5E, 0x12, 0x1E, 0x69, 0x1B, 0x8D, 0xE5, 0x80, 0xAA, 0x7F, 0x10, 0x23, 0x6B, 0x45,
+    0x48, 0x69, 0x55, 0xB9, 0xFF, 0xB6, 0xB6, 0x5A, 0x8B, 0xE8, 0xB0, 0x2E, 0x44, 0x4E, 0x9C, 0xCC,
+    0xFD, 0x5A, 0x41, 0xE0, 0x42, 0x2C, 0x58, 0xAE, 0xB5, 0x92, 0xCB, 0x75, 0x62, 0x0F, 0x95, 0x25,
+    0x98, 0x96, 0x89, 0x14, 0x66, 0xAB, 0xDB, 0xB9, 0xA8, 0x28, 0xA5, 0x32, 0xC5, 0x55, 0xE1, 0xA6,
+    0x13, 0x27, 0x7C, 0xCE, 0xEA, 0xE3, 0xC8, 0x94, 0x3F, 0x66, 0xA3, 0x46, 0x59, 0x46, 0x63, 0x03,
+    0x2D, 0x5A, 0x30, 0xBC, 0x78, 0xB1, 0x82, 0xD4, 0xE4, 0xF0, 0x1B, 0xB7, 0x47, 0xE4, 0x1C, 0xAE,
+    0xEA, 0xB5, 0x5E, 0xDA, 0x9B, 0x89, 0x1A, 0x58, 0xEE, 0x74, 0x44, 0x30, 0x1A, 0xB7, 0x93, 0xF9,
+    0x02, 0x9A, 0x2B, 0x55, 0x2D, 0x96, 0x83, 0x6A, 0x8B, 0xB6, 0x45, 0xCC, 0x12, 0xEF, 0x5A, 0x27,
+    0x8B, 0x29, 0xE5, 0x4A, 0x5B, 0x4C, 0x0E, 0x21, 0x42, 0x7F, 0x92, 0xAE, 0x2C, 0x06, 0x30, 0xEB,
+    0x5C, 0xCA, 0xA7, 0x2E, 0xA5, 0x4D, 0x5B, 0x95, 0xB2, 0x87, 0x9D, 0x13, 0x2F, 0x11, 0x9C, 0xEB,
+    0x0F, 0x17, 0xD3, 0x25, 0x5A, 0xAF, 0x66, 0xE0, 0x31, 0x31, 0xD1, 0xA4, 0x5A, 0x59, 0x6F, 0x0A,
+    0x9C, 0x5C, 0xB5, 0x81, 0x10, 0x1C, 0x00, 0xE3, 0x82, 0xC3, 0x41, 0x88, 0xA5, 0xC6, 0x9B, 0x94,
+    0x0F, 0xC5, 0xAA, 0x04, 0x82, 0x08, 0x87, 0x22, 0x4C, 0x71, 0x0D, 0x16, 0x2C, 0xB8, 0x80, 0x06,
+    0x84, 0x01, 0x6D, 0x60, 0xEE, 0xD1, 0x43, 0xEB, 0x5C, 0x79, 0xB7, 0xBA, 0x76, 0xA0, 0x40, 0x10,
+    0x51, 0xDA, 0x54, 0x82, 0x67, 0xC5, 0x8A, 0xA5, 0x08, 0x48, 0x93, 0xCC, 0x88, 0xDA, 0xAC, 0x45,
+    0xB4, 0x16, 0x92, 0xE0, 0xB6, 0x66, 0xAF, 0xB1, 0x65, 0xDB, 0x16, 0x1C, 0x57, 0x42, 0x5F, 0x2F,
+    0x69, 0x0D, 0x52, 0x00, 0x73, 0xD5, 0xB6, 0x13, 0x7B, 0xD0, 0x4A, 0x34, 0xB7, 0xAE, 0xDB, 0x8A,
+    0x89, 0x5A, 0xB5, 0xB9, 0x75, 0x4B, 0xC8, 0x44, 0xAD, 0x8E, 0x40, 0xBC, 0x15, 0x95, 0xB6, 0xEA,
+    0xB5, 0x84, 0x22, 0x6A, 0xE8, 0x12, 0x22, 0x04, 0x5C, 0xDA, 0xB4, 0x69, 0x45, 0xA5, 0x65, 0xF1,
+    0x89, 0x85, 0x62, 0x40, 0x8B, 0xCE, 0x8A, 0x10, 0x21, 0xCB, 0x8C, 0x66, 0x81, 0x8E, 0xCC, 0x38,
+    0xCA, 0xDA, 0xAF, 0x9F, 0x87, 0x83, 0x07, 0x09, 0xB5, 0xB5, 0x69, 0x00, 0x31, 0xE1, 0xAE, 0x6D,
+    0x15, 0x9D, 0x7D, 0x64, 0xE0, 0xAC, 0x22, 0x2E, 0x77, 0x1D, 0xB0, 0xAC, 0x50, 0x04, 0x26, 0x15,
+    0x70, 0x2C, 0xAF, 0xB4, 0x43, 0xAC, 0x95, 0xCF, 0x8E, 0xAA, 0x83, 0x83, 0xEA, 0x78, 0x26, 0xAF,
+    0x1D, 0x52, 0x0A, 0xAF, 0x10, 0x2B, 0xA6, 0x80, 0x38, 0xC8, 0xB3, 0xB6, 0x6D, 0xF5, 0xFD, 0x7B,
+    0x54, 0x11, 0xA6, 0x8E, 0xC3, 0x33, 0x05, 0x1A, 0x66, 0xB9, 0x50, 0x6B, 0x02, 0x1D, 0x6D, 0x50,
+    0xE8, 0x1B, 0xDC, 0x71, 0xAA, 0x8E, 0xAA, 0x21, 0x46, 0xFA, 0xE3, 0xFB, 0x66, 0x58, 0x92, 0x3D,
+    0x87, 0xC9, 0x22, 0xAB, 0x8A, 0x95, 0x4B, 0xDB, 0x04, 0xFA, 0x88, 0x98, 0x79, 0x07, 0x48, 0x28,
+    0xB2, 0x42, 0x44, 0x03, 0x25, 0x2E, 0x19, 0x2C, 0x1A, 0x84, 0x37, 0x7C, 0xA3, 0x25, 0x18, 0xBC,
+    0x08, 0x04, 0x17, 0xC4, 0x7C, 0xA8, 0xB4, 0x70, 0xE0, 0x60, 0x30, 0x32, 0x81, 0x20, 0xAE, 0x1C,
+    0x4B, 0x80, 0x62, 0x59, 0x8A, 0x44, 0x5C, 0x4F, 0x7D, 0xD1, 0xD7, 0xCD, 0xD0, 0x84, 0x09, 0x61,
+    0xBF, 0xAC, 0xFD, 0x23, 0x57, 0x2E, 0x21, 0x36, 0xF5, 0x92, 0xF2, 0x65, 0xF3, 0xF8, 0x59, 0x41,
+    0x07, 0x04, 0x99, 0xB4, 0x68, 0x83, 0xF6, 0x40, 0x22, 0xB2, 0xB9, 0xB2, 0x3E, 0xEE, 0xF4, 0x36,
+    0x48, 0x3C, 0x21, 0x68, 0x95, 0x95, 0x89, 0xC1, 0x45, 0x29, 0x3C, 0x2B, 0x5D, 0xDB, 0x22, 0x3E,
+    0x8A, 0x78, 0x6C, 0x12, 0xCD, 0x5E, 0x99, 0xB6, 0xE9, 0x24, 0x2C, 0xA9, 0xDC, 0x0A, 0x13, 0x4A,
+    0x98, 0x72, 0x40, 0x68, 0x80, 0xCB, 0x4A, 0x71, 0xA1, 0xDE, 0x74, 0x59, 0x70, 0xEE, 0x5C, 0x65,
+    0x38, 0x37, 0x74, 0xB5, 0xD2, 0xC8, 0x49, 0x9B, 0x5A, 0x23, 0x5F, 0xA1, 0xC2, 0x89, 0xB8, 0x42,
+    0xC1, 0x46, 0x8D, 0x14, 0x15, 0x20, 0x85, 0xCB, 0x6D, 0x2C, 0x1D, 0xB9, 0xDA, 0xA6, 0x00, 0xC1,
+    0xD4, 0x26, 0x58, 0x65, 0x21, 0xB2, 0x5A, 0x61, 0xD3, 0xE9, 0x93, 0x83, 0x80, 0x5F, 0x67, 0xCD,
+    0x8A, 0x95, 0x8B, 0xD0, 0x5B, 0xAE, 0x49, 0xE3, 0xB6, 0x4A, 0xEA, 0xF6, 0x6C, 0xDA, 0xA4, 0x41,
+    0xDC, 0x19, 0x0A, 0x44, 0x2D, 0x90, 0x99, 0x6E, 0x93, 0x1E, 0xB4, 0xF5, 0x47, 0xEE, 0x8A, 0xA3,
+    0xB4, 0x6D, 0xF5, 0x3A, 0x68, 0xDB, 0x56, 0x4A, 0x47, 0x96, 0x52, 0x58, 0xB2, 0x34, 0x33, 0xC4,
+    0x2D, 0x1F, 0x2E, 0x7A, 0xB2, 0x3A, 0x35, 0x71, 0xC8, 0x80, 0xCA, 0x20, 0x83, 0x21, 0x09, 0xE5,
+    0x12, 0x04, 0x19, 0x57, 0x3E, 0x22, 0xCC, 0x2D, 0x32, 0xDC, 0x16, 0x59, 0xC2, 0xA9, 0x27, 0x35,
+    0x96, 0x5D, 0x34, 0x64, 0xF0, 0xA1, 0x80, 0xF4, 0x76, 0x04, 0x74, 0xE0, 0x00, 0xE5, 0x0E, 0x43,
+    0x67, 0xC4, 0x4C, 0x71, 0xC0, 0xC9, 0x50, 0x04, 0xAF, 0x3B, 0xDE, 0x1C, 0xD2, 0x83, 0xEC, 0xCD,
+    0x54, 0x48, 0x84, 0x08, 0xB5, 0xE1, 0x91, 0x2B, 0x57, 0xD3, 0x40, 0x88, 0x03, 0x05, 0x6A, 0xDB,
+    0xB6, 0x6D, 0xDB, 0xBA, 0x75, 0x4B, 0x86, 0xB5, 0xAA, 0x34, 0x6D, 0xDA, 0xB9, 0x26, 0x2E, 0x40,
+    0x18, 0x22, 0x81, 0x5E, 0xDC, 0x7B, 0x83, 0xDF, 0x9A, 0x30, 0x21, 0x19, 0x2A, 0xA1, 0x2A, 0x89,
+    0xDB, 0x52, 0x1D, 0xE1, 0x20, 0x08, 0x2D, 0x2E, 0x54, 0x0F, 0xD3, 0xA0, 0xBA, 0x48, 0x87, 0xD6,
+    0xB3, 0x77, 0xD4, 0xFA, 0xC9, 0xB5, 0x87, 0x6A, 0x09, 0xC4, 0x64, 0x17, 0x31, 0x95, 0x81, 0xD8,
+    0x94, 0x0C, 0x1F, 0xEE, 0xB4, 0x1E, 0x21, 0x14, 0x02, 0xB1, 0x0C, 0xC5, 0xA6, 0xE6, 0x7E, 0x4D,
+    0x64, 0x88, 0x65, 0xA1, 0x07, 0x80, 0xB8, 0x9C, 0xAD, 0x0A, 0x6F, 0x6D, 0x55, 0xAD, 0x87, 0xEF,
+    0x15, 0xF5, 0x71, 0x18, 0x71, 0x04, 0x1F, 0x27, 0x46, 0x20, 0x0A, 0x84, 0x28, 0x50, 0xB1, 0x5B,
+    0x5D, 0x15, 0x20, 0x04, 0x0B, 0xD6, 0x41, 0x5B, 0x55, 0x10, 0x7B, 0x14, 0xF1, 0x42, 0x08, 0x22,
+    0x44, 0x10, 0x40, 0x87, 0x0E, 0xFD, 0xE2, 0x8F, 0xE5, 0x0D, 0xC4, 0x54, 0x85, 0x69, 0xA5, 0xF2,
+    0xD6, 0x28, 0x33, 0xAB, 0x89, 0x4F, 0x64, 0x25, 0x94, 0x55, 0x6B, 0x21, 0xB9, 0x53, 0x65, 0xDC,
+    0xFC, 0x34, 0xF7, 0x01, 0x62, 0x7F, 0x36, 0x48, 0xFC, 0x7C, 0x0A, 0xB0, 0x9B, 0x20, 0xB1, 0xE3,
+    0x42, 0x71, 0x05, 0x5B, 0x89, 0xCF, 0xA4, 0x2B, 0x7E, 0x7E, 0xDE, 0xCC, 0xCA, 0x2E, 0x44, 0x0B,
+    0x47, 0x6D, 0x15, 0x88, 0x60, 0x26, 0x4F, 0xB3, 0x5F, 0xB5, 0x8E, 0x10, 0x98, 0xBB, 0x76, 0xB8,
+    0x5D, 0x05, 0xA4, 0x7C, 0xF8, 0x38, 0xCA, 0xF1, 0xCA, 0x26, 0x8A, 0x20, 0x3A, 0xDA, 0x32, 0x95,
+    0xCB, 0x85, 0x10, 0xBD, 0xB0, 0x74, 0xB9, 0xA9, 0xE1, 0xA2, 0xD5, 0x81, 0xDC, 0x81, 0x65, 0x65,
+    0x4C, 0x00, 0x44, 0x36, 0x85, 0x03, 0x97, 0x5A, 0x81, 0xC6, 0xA5, 0xBC, 0xE4, 0x19, 0xE2, 0xB6,
+    0x2C, 0xB5, 0x9D, 0x65, 0xA9, 0x35, 0x15, 0x9E, 0x50, 0xD0, 0x10, 0x7F, 0x7D, 0x75, 0x14, 0x10,
+    0x11, 0x3A, 0x9B, 0xDA, 0xE0, 0xD1, 0x8A, 0xC8, 0xA5, 0x4D, 0x3E, 0x07, 0xD5, 0x06, 0x0A, 0x64,
+    0xA2, 0x50, 0x5B, 0xB1, 0x6A, 0x66, 0x05, 0x9A, 0x4C, 0xD6, 0x84, 0x49, 0x73, 0x77, 0xA0, 0x5C,
+    0x3A, 0x62, 0xD4, 0x4C, 0x42, 0xAD, 0xFF, 0xEA, 0xD2, 0xCB, 0xE4, 0x23, 0x90, 0x13, 0xAF, 0x4A,
+    0xD3, 0x4E, 0xDA, 0x70, 0xCD, 0xAE, 0xB0, 0xB8, 0x71, 0xE9, 0xD6, 0x1B, 0x25, 0xB0, 0xEE, 0x5C,
+    0xA6, 0x89, 0xB4, 0x16, 0x9E, 0x55, 0x54, 0x0E, 0x9D, 0x81, 0x45, 0x2B, 0xB4, 0x05, 0x18, 0x48,
+    0xEB, 0x82, 0x60, 0x6D, 0xF1, 0xDC, 0x4C, 0x58, 0x42, 0x54, 0xD6, 0xAC, 0x72, 0x5B, 0xC1, 0xFA,
+    0x23, 0xA3, 0x6D, 0xDD, 0x56, 0xE1, 0xAE, 0x39, 0x51, 0x58, 0x16, 0x60, 0x56, 0x66, 0x32, 0xAC,
+    0x2C, 0xF0, 0x61, 0x23, 0x84, 0xB1, 0x56, 0x84, 0xD6, 0xAC, 0x09, 0xDB, 0xC3, 0xDF, 0x26, 0xA3,
+    0xBC, 0xB4, 0x52, 0x72, 0xC3, 0xAD, 0x20, 0x0A, 0x26, 0x6F, 0x04, 0x2F, 0x9A, 0x4A, 0x57, 0x11,
+    0xA1, 0x53, 0x73, 0x07, 0xD5, 0x49, 0x08, 0xB4, 0x68, 0x51, 0x70, 0x54, 0x61, 0xF0, 0x11, 0xA4,
+    0x35, 0x04, 0xD8, 0xAA, 0x81, 0x9C, 0xF4, 0xA4, 0x6C, 0x28, 0xAE, 0x10, 0x47, 0x18, 0x4A, 0xF8,
+    0x58, 0x30, 0x10, 0xC3, 0x8E, 0x35, 0x4D, 0xAE, 0xD9, 0xED, 0x0A, 0x99, 0x08, 0xA0, 0x17, 0x06,
+    0x1F, 0x86, 0xDD, 0xF0, 0x80, 0x19, 0xE5, 0xA2, 0x02, 0x51, 0x2C, 0x28, 0x5B, 0x55, 0x0C, 0xC0,
+    0xAA, 0x73, 0xE7, 0x3A, 0x28, 0xFB, 0x87, 0x99, 0x83, 0xB6, 0xC9, 0xE2, 0x4E, 0xE2, 0xE1, 0xD6,
+    0x09, 0x89, 0x61, 0xFF, 0x2E, 0xCD, 0x15, 0x30, 0x30, 0xAD, 0xBA, 0x2F, 0x76, 0x29, 0x73, 0x64,
+    0x75, 0xE5, 0xAD, 0x28, 0x51, 0x0A, 0xCD, 0xD8, 0xCD, 0x99, 0xD3, 0xDF, 0xDA, 0x9B, 0x80, 0x08,
+    0xA1, 0x71, 0xD4, 0x82, 0xDB, 0xD7, 0x49, 0x87, 0xE3, 0x6A, 0x38, 0xAB, 0x92, 0xC2, 0x24, 0xBA,
+    0x5A, 0x05, 0xC5, 0x55, 0xDB, 0xEA, 0xA3, 0x50, 0xB7, 0x31, 0xC8, 0x02, 0xFC, 0x09, 0xC8, 0xAE,
+    0xCA, 0x66, 0x66, 0x50, 0xCA, 0xB8, 0x17, 0x2D, 0xDA, 0x1B, 0x13, 0x18, 0x30, 0x60, 0xB0, 0xC1,
+    0x6C, 0xE8, 0x60, 0xA5, 0x05, 0x64, 0x06, 0x5B, 0xA3, 0x70, 0x6F, 0xA3, 0x40, 0x93, 0x5E, 0xB1,
+    0xBB, 0x49, 0xD0, 0x6D, 0x2E, 0x93, 0x55, 0x9B, 0x06, 0x03, 0x88, 0x32, 0x6E, 0xC1, 0x4A, 0x41,
+    0x10, 0xE3, 0x7A, 0xE4, 0xCF, 0xDF, 0x5C, 0x7D, 0xB1, 0x64, 0xC8, 0x3D, 0x81, 0x58, 0x69, 0x09,
+    0x7F, 0x08, 0xE9, 0x2D, 0x88, 0x60, 0x10, 0xD1, 0x5F, 0x13, 0xAF, 0xF4, 0x89, 0x0A, 0x24, 0xB0,
+    0x84, 0x5B, 0xB7, 0x5A, 0xB5, 0xEE, 0x00, 0xDA, 0x64, 0xC9, 0x92, 0x9C, 0x90, 0x36, 0x78, 0xA5,
+    0x72, 0x25, 0x55, 0xAA, 0x13, 0x72, 0xFC, 0x71, 0x65, 0xB6, 0x28, 0x56, 0x56, 0x0C, 0x90, 0x68,
+    0x70, 0x05, 0xBA, 0xB2, 0x5E, 0xDB, 0x14, 0x5C, 0xAF, 0xED, 0x00, 0xBA, 0xE8, 0xA6, 0x1C, 0x44,
+    0x55, 0xCB, 0x1E, 0x21, 0x48, 0xD0, 0x91, 0x86, 0x4C, 0x5F, 0xDF, 0x16, 0x18, 0xD6, 0x76, 0x16,
+    0xC8, 0x48, 0x7E, 0x8C, 0x9D, 0x12, 0x30, 0x2B, 0x2D, 0xA9, 0xAD, 0x26, 0xE6, 0xBA, 0xD5, 0x71,
+    0x4C, 0xC0, 0xB1, 0x25, 0xFE, 0x9E, 0x9D, 0x32, 0x86, 0x02, 0xB1, 0x3A, 0x75, 0x69, 0xD5, 0x52,
+    0x40, 0x1C, 0x2A, 0x94, 0x5C, 0x2E, 0xB5, 0x96, 0x95, 0x08, 0x04, 0xE2, 0xD8, 0x29, 0x3F, 0x65,
+    0x1B, 0x82, 0x20, 0xE4, 0xE8, 0x0F, 0xCA, 0xB6, 0xAF, 0xAA, 0x21, 0x0B, 0x0A, 0x09, 0x0C, 0x98,
+    0xC7, 0x62, 0xEA, 0x66, 0x35, 0x44, 0xD6, 0xE5, 0x44, 0xAD, 0x25, 0xB0, 0x26, 0x12, 0x63, 0x28,
+    0xE0, 0xA0, 0x80, 0x82, 0x8F, 0xF8, 0x2B, 0x44, 0xA4, 0x6F, 0x21, 0x42, 0x88, 0x29, 0x11, 0x12,
+    0xE5, 0x05, 0x88, 0xE0, 0x80, 0x62, 0x0C, 0x25, 0x9A, 0x6B, 0x28, 0x6D, 0x2E, 0x3E, 0x82, 0xB5,
+    0x6A, 0x85, 0xA1, 0x03, 0x21, 0x1F, 0x3E, 0x7C, 0x9C, 0xB0, 0x2C, 0x3A, 0x8C, 0x4F, 0xAB, 0x2A,
+    0x3D, 0x1F, 0x08, 0x61, 0x64, 0xB2, 0x6D, 0xDB, 0x92, 0x7C, 0xAC, 0xA4, 0x6D, 0xD9, 0xF2, 0x02,
+    0xE0, 0x83, 0xAA, 0xFA, 0x19, 0xC8, 0x11, 0x91, 0x4A, 0x45, 0xBC, 0x50, 0x07, 0x0F, 0xA9, 0x34,
+    0xB7, 0xD3, 0x17, 0x95, 0x1E, 0xA0, 0xA2, 0xE1, 0x94, 0xF5, 0x07, 0x40, 0xC4, 0x10, 0x49, 0x19,
+    0xFB, 0xA8, 0x76, 0x1C, 0x82, 0x11, 0x0E, 0xB5, 0x02, 0x44, 0x50, 0x68, 0x2E, 0x97, 0x02, 0x5A,
+    0xEB, 0x21, 0x46, 0xEC, 0xE4, 0x07, 0xE1, 0x12, 0x84, 0xD2, 0x86, 0x7A, 0x20, 0xC2, 0x91, 0x55,
+    0x3E, 0x75, 0x21, 0x19, 0x20, 0xB8, 0xE3, 0xB0, 0xDD, 0xA9, 0xD8, 0xDA, 0xBA, 0x64, 0xCC, 0x6F,
+    0x29, 0x92, 0x4A, 0x85, 0xF9, 0x71, 0x89, 0x67, 0xA0, 0x00, 0xDF, 0xA6, 0x9C, 0x78, 0x05, 0xB4,
+    0xCB, 0x47, 0xC1, 0x04, 0xC4, 0xF4, 0xAA, 0x55, 0xA8, 0xF7, 0x73, 0xAD, 0x61, 0xC0, 0x6A, 0x15,
+    0xD4, 0xE1, 0xC6, 0x36, 0x88, 0x89, 0x7A, 0x85, 0x9E, 0x15, 0x23, 0x81, 0x16, 0x05, 0x42, 0x66,
+    0x29, 0x0A, 0x71, 0x01, 0xBC, 0x78, 0xC7, 0x87, 0x68, 0xDD, 0x4A, 0x71, 0x89, 0x87, 0xC0, 0xDD,
+    0xAC, 0x69, 0x6A, 0x00, 0x3A, 0xF2, 0x69, 0x00, 0x2A, 0xD4, 0x02, 0x8E, 0x24, 0xBF, 0x23, 0x7C,
+    0xE0, 0x40, 0x10, 0x6E, 0x8E, 0x48, 0xDD, 0x32, 0xF4, 0x2F, 0xEE, 0x29, 0x71, 0x14, 0xF8, 0x02,
+    0xBC, 0x43, 0x8A, 0x65, 0xA2, 0xC3, 0xE1, 0xCC, 0x98, 0x49, 0x18, 0xF3, 0xC6, 0x5D, 0x4B, 0x6D,
+    0xBF, 0x6E, 0x08, 0x94, 0xAF, 0x31, 0xCB, 0x69, 0x07, 0x4C, 0xA4, 0x41, 0x4C, 0xAA, 0x49, 0x13,
+    0xC4, 0x03, 0x07, 0x90, 0x33, 0x2C, 0x06, 0x91, 0xA7, 0x23, 0xD3, 0x8E, 0xCA, 0x02, 0x9C, 0x8B,
+    0x48, 0x54, 0x48, 0xB2, 0x1C, 0x21, 0xD6, 0x85, 0x16, 0xAB, 0xCF, 0xAF, 0xD7, 0x78, 0x20, 0x3A,
+    0x4C, 0x28, 0x10, 0xD7, 0xB9, 0x02, 0xA0, 0xAA, 0xC3, 0x41, 0xA1, 0x4C, 0x51, 0xC3, 0x25, 0x36,
+    0x6E, 0xD4, 0x54, 0x8C, 0x9C, 0x23, 0x7A, 0x86, 0xDA, 0x26, 0x2D, 0x69, 0x71, 0xEA, 0x57, 0x0F,
+    0x58, 0x10, 0x65, 0x8D, 0xD4, 0x48, 0xE9, 0xA8, 0x41, 0x4C, 0x25, 0xF3, 0xCB, 0x65, 0x40, 0xCE,
+    0x49, 0x70, 0x8F, 0xF8, 0xBA, 0x64, 0x0B, 0xA9, 0xC2, 0xD4, 0x0A, 0x99, 0xD9, 0x06, 0xCE, 0x85,
+    0x13, 0x6A, 0x2A, 0x9E, 0x09, 0x0C, 0xFD, 0xE9, 0x51, 0x75, 0x2A, 0x41, 0x7A, 0x28, 0x65, 0x31,
+    0x33, 0xC6, 0xE5, 0x80, 0xA3, 0x1E, 0x58, 0x05, 0x3C, 0xAA, 0x4B, 0x99, 0x84, 0x8B, 0x44, 0x4C,
+    0x19, 0x4C, 0xEB, 0xA6, 0x51, 0x33, 0x56, 0x7F, 0x5C, 0x4B, 0x08, 0xF9, 0xC8, 0xAB, 0x20, 0x98,
+    0x26, 0x2D, 0x87, 0xF0, 0x0B, 0x32, 0x58, 0x10, 0x21, 0xA1, 0xFF, 0xFC, 0xB9, 0x73, 0x09, 0x90,
+    0x16, 0x5B, 0xB4, 0x90, 0x0E, 0xC3, 0x4A, 0xD3, 0x76, 0x50, 0xC9, 0xC3, 0xBB, 0x2E, 0x00, 0x1D,
+    0x31, 0x21, 0x51, 0xD1, 0x4D, 0x4E, 0xD3, 0xE2, 0x50, 0xEC, 0xC8, 0x28, 0xC0, 0x4C, 0x07, 0xDA,
+    0x25, 0xCA, 0xA5, 0xA6, 0x59, 0x22, 0xC4, 0x3B, 0x8E, 0x61, 0xF8, 0xB8, 0x86, 0x1E, 0x5D, 0x75,
+    0x86, 0x0E, 0x37, 0x32, 0x34, 0x37, 0xAD, 0xA8, 0x6A, 0x7A, 0x28, 0xD6, 0xAB, 0xCA, 0xB1, 0x72,
+    0x59, 0x65, 0x45, 0xC1, 0x79, 0x60, 0x49, 0xD9, 0x70, 0xDB, 0xB3, 0x71, 0x1F, 0xA8, 0xFD, 0x93,
+    0x36, 0xEF, 0x00, 0xB2, 0x68, 0xB1, 0x5E, 0x5A, 0x41, 0xA8, 0x68, 0xA9, 0x52, 0x24, 0x26, 0x35,
+    0x6A, 0xC4, 0x34, 0x51, 0x20, 0x32, 0x27, 0xBC, 0x12, 0xF9, 0x4A, 0x17, 0x20, 0x5B, 0x0F, 0x80,
+    0x17, 0xAC, 0xAD, 0xDA, 0xE0, 0x94, 0x55, 0x82, 0x20, 0xC4, 0xE0, 0xA2, 0x4C, 0x06, 0xD1, 0x19,
+    0x82, 0x13, 0x15, 0xA2, 0x58, 0x21, 0x98, 0x27, 0x4F, 0x0A, 0x29, 0x26, 0x26, 0xC0, 0xF1, 0xF1,
+    0xD2, 0xDA, 0x1E, 0x88, 0xCD, 0x95, 0x32, 0x84, 0xF3, 0x60, 0x18, 0xAE, 0x35, 0x3D, 0x2A, 0x5A,
+    0xE6, 0xC4, 0x85, 0xBA, 0x92, 0x3E, 0x01, 0x07, 0x7D, 0x87, 0x20, 0x47, 0x2B, 0xA1, 0x7C, 0x10,
+    0x47, 0xED, 0x03, 0xD0, 0x6A, 0x40, 0xA3, 0x86, 0x9D, 0x7C, 0x55, 0x97, 0xD0, 0x03, 0x60, 0x31,
+    0x59, 0xA1, 0xA0, 0xAC, 0x84, 0xD2, 0xE5, 0x81, 0xB5, 0x12, 0x70, 0x02, 0xDD, 0x08, 0xA2, 0x67,
+    0xA3, 0x13, 0x2D, 0xD4, 0x4C, 0xC0, 0x02, 0x33, 0x88, 0x3F, 0x9C, 0x81, 0x5F, 0x95, 0x30, 0xB1,
+    0x26, 0x57, 0x2F, 0x5C, 0x94, 0xBD, 0xF0, 0x01, 0xDC, 0x22, 0x68, 0x1F, 0x1B, 0xD4, 0x9E, 0x1D,
+    0x6A, 0xF3, 0x16, 0x71, 0x01, 0xC4, 0xE0, 0x82, 0x81, 0xE0, 0x94, 0x02, 0x65, 0x53, 0x44, 0xCF,
+    0x9E, 0x15, 0xC6, 0xA0, 0x09, 0xC2, 0xA1, 0xB5, 0x67, 0x00, 0xC6, 0x22, 0xF4, 0x16, 0x12, 0x3E,
+    0x7C, 0xA9, 0x98, 0x70, 0xBD, 0xD8, 0x26, 0x6F, 0x5B, 0xAE, 0x25, 0x4A, 0x6C, 0xBC, 0xA6, 0xC7,
+    0xA6, 0x1C, 0x36, 0x39, 0x32, 0x77, 0x9B, 0x75, 0x38, 0xD0, 0x63, 0x44, 0x84, 0x34, 0xEC, 0xD8,
+    0x31, 0x82, 0xC2, 0x08, 0x48, 0x5C, 0x62, 0x31, 0xE0, 0x22, 0x90, 0x02, 0x0E, 0xC9, 0x8E, 0xAB,
+    0xF6, 0x23, 0xC8, 0xA4, 0x5B, 0x9F, 0xAF, 0xB9, 0x10, 0xD5, 0xF0, 0x29, 0x47, 0x20, 0x56, 0x43,
+    0x5F, 0xE2, 0xAE, 0xB2, 0x96, 0xAB, 0xA4, 0x64, 0xBE, 0xFD, 0x60, 0x10, 0xE2, 0x01, 0x52, 0x43,
+    0xC1, 0x82, 0x7F, 0x12, 0x11, 0xFC, 0xB4, 0xE3, 0xAB, 0xA4, 0x7A, 0x07, 0x0A, 0x38, 0x62, 0xEB,
+    0xE4, 0x18, 0x4E, 0x64, 0x84, 0x7E, 0x4A, 0xEE, 0x11, 0xF6, 0x94, 0x05, 0x47, 0x6C, 0x2B, 0xB2,
+    0x65, 0xCB, 0x0D, 0x6B, 0x22, 0x09, 0xE2, 0xC4, 0x20, 0x46, 0x4C, 0xEA, 0x99, 0xA1, 0xAF, 0xB2,
+    0x80, 0x1E, 0xC0, 0x99, 0x6B, 0x97, 0xC3, 0xA2, 0xEF, 0xD4, 0xAE, 0xB2, 0xE0, 0x32, 0x6F, 0x37,
+    0xAE, 0x91, 0x06, 0xB5, 0x2A, 0xF5, 0xE7, 0x6D, 0xAE, 0x5B, 0x00, 0x01, 0xE6, 0x05, 0x78, 0x8A,
+    0xEB, 0xDB, 0x62, 0x0D, 0x41, 0x5C, 0xAD, 0xF1, 0x15, 0x65, 0xAF, 0x48, 0xC8, 0x4C, 0xE4, 0xD5,
+    0x05, 0xF4, 0x72, 0x2B, 0x21, 0x51, 0x79, 0x20, 0x82, 0x74, 0xAA, 0x95, 0x35, 0xC4, 0x6D, 0xDA,
+    0xF8, 0x3B, 0xDB, 0xAF, 0x5F, 0x4B, 0x4B, 0x72, 0xBD, 0xB4, 0x35, 0xF3, 0x05, 0x41, 0x95, 0xC3,
+    0xFB, 0x84, 0x70, 0x62, 0x96, 0x15, 0x4D, 0x9D, 0x0D, 0x5E, 0x91, 0xA5, 0x10, 0x13, 0x84, 0x2C,
+    0x22, 0x66, 0x24, 0x1A, 0xA9, 0x6C, 0x32, 0xD7, 0x44, 0x81, 0x03, 0x64, 0x11, 0x35, 0x79, 0x05,
+    0xCE, 0x41, 0x08, 0x21, 0x4D, 0xDA, 0x7E, 0xE9, 0x78, 0x29, 0x2D, 0x13, 0x42, 0x4B, 0xBD, 0x36,
+    0x41, 0xB4, 0x48, 0xED, 0x56, 0x66, 0x2E, 0x05, 0x08, 0x14, 0x70, 0x38, 0x88, 0x61, 0x2E, 0x2E,
+    0x63, 0x21, 0x14, 0xDB, 0x16, 0x51, 0x49, 0x44, 0x92, 0xDB, 0xBE, 0x72, 0xD0, 0xCA, 0xAB, 0x57,
+    0xAB, 0x66, 0xFD, 0xF9, 0x0B, 0x2C, 0x01, 0x52, 0x60, 0x54, 0x56, 0x10, 0x20, 0x38, 0x35, 0xF7,
+    0x54, 0x55, 0x24, 0x2B, 0x63, 0x15, 0xE2, 0xF3, 0xB5, 0xD0, 0x5C, 0xC3, 0x88, 0xB0, 0x1E, 0x45,
+    0xA2, 0xC8, 0x84, 0x5B, 0x2E, 0x01, 0x05, 0x23, 0x94, 0x2C, 0x58, 0x09, 0x0E, 0x9B, 0x60, 0x25,
+    0x4B, 0x26, 0x38, 0x4B, 0x72, 0x0A, 0x25, 0x8B, 0xAB, 0x80, 0x98, 0x33, 0x97, 0xA5, 0x3C, 0xB9,
+    0xC5, 0xE0, 0xF9, 0x13, 0x3C, 0x2C, 0x97, 0xBC, 0x7A, 0xB5, 0xB8, 0x54, 0x29, 0xBB, 0x68, 0x11,
+    0x37, 0xCB, 0x84, 0xDB, 0xD6, 0x3A, 0x69, 0x68, 0x6E, 0x5B, 0x7F, 0x88, 0xA9, 0xDC, 0xA3, 0x22,
+    0xF8, 0xD3, 0xCE, 0xB9, 0x59, 0x09, 0x11, 0x22, 0x34, 0x48, 0xE2, 0x8E, 0x46, 0x88, 0xF7, 0x7E,
+    0x3D, 0x7A, 0x96, 0x6C, 0x97, 0x52, 0x5F, 0xE4, 0xFC, 0x0C, 0x42, 0x16, 0x04, 0xCB, 0x50, 0x6A,
+    0x59, 0x52, 0x65, 0xC6, 0xEC, 0xE9, 0x8B, 0xAC, 0x76, 0x17, 0x10, 0xE0, 0x8B, 0x20, 0xD1, 0xA8,
+    0x95, 0x7C, 0xAA, 0xD0, 0x69, 0x13, 0xA2, 0x6C, 0x33, 0x41, 0x57, 0x08, 0xF2, 0x69, 0xAB, 0x15,
+    0x6C, 0x5A, 0xBE, 0x55, 0x80, 0xAA, 0x74, 0xA4, 0x36, 0xEF, 0x84, 0xB0, 0x6F, 0xCB, 0xEE, 0x33,
+    0x4C, 0xEB, 0x05, 0x9D, 0x62, 0x9A, 0x9F, 0x3D, 0x20, 0x2B, 0x88, 0x30, 0x65, 0x96, 0x2C, 0xE7,
+    0x5A, 0x21, 0x32, 0x8C, 0x5B, 0x08, 0xAB, 0x47, 0x04, 0x4C, 0x20, 0xA0, 0xF8, 0x16, 0xD7, 0x50,
+    0x47, 0x45, 0xB0, 0x04, 0x04, 0xA8, 0xAC, 0x28, 0xB2, 0x88, 0x14, 0x21, 0x56, 0x64, 0x52, 0xA9,
+    0x9E, 0xB4, 0x5E, 0xBA, 0x92, 0xF4, 0xCA, 0xD6, 0x6E, 0x20, 0x39, 0x72, 0x22, 0x4D, 0xE5, 0x3A,
+    0x4A, 0xB1, 0xD6, 0x12, 0x2B, 0x2B, 0x14, 0x2E, 0x9C, 0x75, 0x6A, 0x20, 0x3A, 0x24, 0xA6, 0x1A,
+    0x95, 0x8C, 0x59, 0x71, 0xBF, 0x45, 0x5A, 0x4B, 0x72, 0xD3, 0x5A, 0xD0, 0xDF, 0xA2, 0x36, 0x87,
+    0xDB, 0x22, 0x1E, 0x30, 0x75, 0x16, 0xAC, 0x10, 0x54, 0xBD, 0xE6, 0xB5, 0x52, 0xB6, 0x4C, 0xDB,
+    0xAD, 0x76, 0x03, 0x91, 0x65, 0x26, 0x8A, 0xED, 0x5B, 0x97, 0x55, 0x5D, 0x16, 0x1C, 0x56, 0xCD,
+    0xD0, 0xB9, 0x01, 0x6A, 0x5F, 0xAC, 0xED, 0xD9, 0xAF, 0x19, 0xA2, 0x49, 0x61, 0xAE, 0x86, 0xF0,
+    0x47, 0x27, 0x6D, 0x2B, 0x01, 0x84, 0x08, 0x19, 0xCB, 0xFB, 0x95, 0x4E, 0xB4, 0x67, 0x32, 0xB8,
+    0x0D, 0x0E, 0xA4, 0x40, 0x4E, 0x59, 0x16, 0xB1, 0xB8, 0x02, 0x5D, 0x84, 0x6F, 0xD6, 0x53, 0xAD,
+    0x6D, 0x09, 0x01, 0xD2, 0xC1, 0x96, 0x6D, 0x2B, 0xA0, 0x4A, 0xBD, 0x5A, 0x51, 0x49, 0x98, 0x4E,
+    0xDB, 0xAE, 0x61, 0x55, 0x22, 0x52, 0xB0, 0x28, 0xAD, 0x00, 0xB6, 0x15, 0x5D, 0x1E, 0x3B, 0xBB,
+    0xB6, 0x5F, 0x2B, 0x12, 0xA1, 0x88, 0xC4, 0x4A, 0x3B, 0x28, 0x97, 0xD6, 0x89, 0xB7, 0xAC, 0xF5,
+    0xD2, 0x45, 0x32, 0x68, 0xDA, 0xC5, 0x75, 0xEB, 0x22, 0x64, 0x5B, 0x86, 0x2D, 0x9F, 0x3A, 0x2E,
+    0x35, 0x68, 0x58, 0x19, 0xAC, 0x43, 0x87, 0xA2, 0x98, 0x31, 0x90, 0x0D, 0xE4, 0x76, 0xE0, 0x95,
+    0x7A, 0x75, 0xE5, 0x5E, 0xA4, 0x77, 0x85, 0x0B, 0x2D, 0x2B, 0x08, 0x8B, 0x9A, 0x3B, 0x5A, 0xD3,
+    0x30, 0x2A, 0x54, 0x98, 0x9B, 0x01, 0xA2, 0xFA, 0x54, 0x04, 0x21, 0x7F, 0x6F, 0x29, 0x53, 0x55,
+    0x8A, 0x2A, 0xD5, 0xB1, 0x5B, 0xD1, 0x80, 0x54, 0x7D, 0xC6, 0x00, 0xB0, 0x4B, 0x97, 0xD1, 0x16,
+    0x43, 0x34, 0xD0, 0xAF, 0x49, 0x93, 0x1E, 0xAD, 0xDA, 0x10, 0x6A, 0xE4, 0x60, 0x6C, 0x89, 0x18,
+    0x23, 0x2B, 0xDE, 0x4D, 0x08, 0x70, 0xEE, 0x97, 0xAC, 0x1E, 0x4A, 0x9E, 0xA5, 0x92, 0x75, 0x72,
+    0xAB, 0xB0, 0x17, 0x6E, 0x40, 0x84, 0x00, 0x35, 0xC8, 0x60, 0x61, 0x26, 0xDA, 0x7A, 0x31, 0x93,
+    0xA4, 0x95, 0x3F, 0x97, 0x60, 0x8E, 0x1E, 0x4A, 0x36, 0xD5, 0x54, 0x23, 0x61, 0x6A, 0x7F, 0x29,
+    0xB3, 0x49, 0x77, 0x8E, 0x95, 0x05, 0x89, 0x8E, 0x84, 0x59, 0xCB, 0x35, 0xC5, 0x8B, 0x76, 0x2E,
+    0xFB, 0x80, 0x45, 0xB1, 0x18, 0xC5, 0x4D, 0x04, 0x37, 0x09, 0x61, 0x55, 0x74, 0x86, 0xD0, 0xB0,
+    0x7A, 0x0E, 0xA8, 0x12, 0xA8, 0x72, 0xA5, 0x2D, 0x97, 0x6A, 0x5A, 0xF9, 0xA0, 0x45, 0x02, 0xD6,
+    0xF0, 0xDA, 0x59, 0x18, 0x9D, 0x14, 0x23, 0xFC, 0x06, 0xB1, 0x0C, 0xBB, 0x98, 0x57, 0xBA, 0xDC,
+    0x1B, 0xA4, 0x55, 0x2E, 0x43, 0x25, 0x6E, 0x06, 0xC4, 0x22, 0xD8, 0x2B, 0xD7, 0x4E, 0xFA, 0x7E,
+    0x6A, 0x45, 0xAC, 0xC6, 0x6B, 0xA1, 0x42, 0x67, 0x14, 0x3C, 0x6B, 0xCB, 0x96, 0x2D, 0x4B, 0x70,
+    0x0E, 0x9A, 0xB4, 0xA5, 0x35, 0x81, 0x5B, 0xA9, 0x3A, 0x08, 0xA8, 0x24, 0xD6, 0x11, 0x43, 0x2D,
+    0x97, 0x03, 0xD0, 0xBE, 0xF8, 0x63, 0x48, 0x71, 0xD8, 0xC9, 0x9B, 0x85, 0xB7, 0xCA, 0x55, 0xD9,
+    0x06, 0x2A, 0xE0, 0x6A, 0xE2, 0xE2, 0x06, 0x41, 0x0C, 0xD8, 0xC3, 0x0E, 0x34, 0x15, 0x1A, 0x15,
+    0xE0, 0x62, 0xC8, 0x40, 0x93, 0x4B, 0xD4, 0x16, 0x3B, 0xA8, 0xF5, 0xA1, 0xA4, 0xCD, 0x14, 0xF2,
+    0x58, 0xAA, 0x01, 0xBC, 0xB6, 0x44, 0x23, 0x96, 0x88, 0x6B, 0x15, 0x6B, 0x35, 0x11, 0xF0, 0x5E,
+    0x08, 0x82, 0x11, 0xDF, 0x3A, 0x92, 0x6B, 0x65, 0xAB, 0x53, 0x71, 0x5D, 0x9E, 0x8D, 0xE9, 0xCF,
+    0xB0, 0xBF, 0x56, 0x6D, 0xBB, 0x1A, 0x6E, 0x05, 0x32, 0x0D, 0x25, 0x06, 0x10, 0xBD, 0x1E, 0x80,
+    0x38, 0x61, 0x32, 0x8A, 0xB6, 0x31, 0xC8, 0x2E, 0x36, 0x84, 0x59, 0x8A, 0x14, 0xB9, 0x53, 0xCC,
+    0x58, 0x4A, 0x25, 0x58, 0x96, 0x5B, 0xB5, 0x75, 0xC8, 0xB4, 0x65, 0x29, 0x06, 0xAF, 0x2E, 0x2E,
+    0x89, 0xF0, 0xB4, 0x11, 0xCA, 0xA6, 0x6A, 0xA8, 0x8A, 0x03, 0x06, 0x3C, 0x6A, 0x2B, 0xB9, 0x13,
+    0x62, 0x83, 0x4A, 0x3D, 0x7A, 0xFC, 0xE3, 0xA8, 0x91, 0xD9, 0x26, 0x90, 0xE7, 0xE6, 0x05, 0xF0,
+    0x36, 0x51, 0x2D, 0xC1, 0x68, 0x1D, 0x1A, 0xE6, 0xE1, 0x4F, 0x60, 0x9F, 0x36, 0x87, 0x1E, 0x9F,
+    0xED, 0x39, 0xD2, 0xF0, 0x82, 0xA4, 0xA4, 0x16, 0xED, 0x63, 0xC0, 0x05, 0xA3, 0x52, 0x48, 0x5A,
+    0x51, 0xD5, 0xC2, 0xE2, 0xCF, 0x6A, 0xA4, 0x2F, 0x39, 0x61, 0x1D, 0x4C, 0x2A, 0xB7, 0x58, 0x82,
+    0x5B, 0xF4, 0x1E, 0x07, 0x29, 0xCB, 0x74, 0x6F, 0x01, 0x34, 0x0E, 0x82, 0xC8, 0x99, 0x8C, 0x18,
+    0xE2, 0x82, 0x32, 0x86, 0xFE, 0x4C, 0x55, 0x57, 0xE8, 0x28, 0x21, 0xAF, 0xB9, 0x04, 0x9D, 0xE4,
+    0x70, 0xE5, 0xE6, 0xB1, 0xAC, 0xAD, 0x5A, 0x21, 0x21, 0xF8, 0xB6, 0xA7, 0xA3, 0xA2, 0x5F, 0x47,
+    0x49, 0x76, 0x09, 0x82, 0x4A, 0xD5, 0x45, 0xAD, 0x24, 0x6C, 0xD5, 0x22, 0x14, 0xB1, 0xA9, 0x57,
+    0x86, 0x24, 0xD3, 0x6A, 0xE5, 0x6F, 0x02, 0x2F, 0x19, 0x00, 0x93, 0xF9, 0xF3, 0x77, 0xC1, 0x0D,
+    0x08, 0x1F, 0x56, 0xDC, 0x25, 0x48, 0x20, 0x88, 0x72, 0x89, 0xBD, 0x84, 0x5A, 0xD1, 0x9B, 0x3B,
+    0x17, 0x4D, 0xA4, 0x23, 0x41, 0xC1, 0x50, 0x0D, 0x82, 0x83, 0x4A, 0x09, 0xC1, 0xFE, 0xE8, 0xA6,
+    0x9D, 0x9B, 0xB0, 0x6D, 0x48, 0x88, 0x2E, 0x58, 0xF9, 0x93, 0xCC, 0xE5, 0x92, 0xA9, 0xCA, 0x95,
+    0x09, 0xAF, 0xB9, 0x72, 0x45, 0x65, 0x41, 0x6E, 0x53, 0xDF, 0xE4, 0xA2, 0x93, 0xA8, 0x2D, 0x0A,
+    0x47, 0x8E, 0x4A, 0x68, 0x86, 0x15, 0x10, 0xB1, 0x0B, 0xB4, 0x8E, 0x16, 0x20, 0x92, 0x3C, 0x59,
+    0x02, 0xBD, 0x22, 0x29, 0x42, 0x18, 0xEB, 0x63, 0xA8, 0x8D, 0xD6, 0x24, 0x00, 0x7B, 0xB4, 0x11,
+    0xD2, 0x0B, 0x71, 0xC2, 0x66, 0x5C, 0xCA, 0xD0, 0x2B, 0xD9, 0x16, 0x6A, 0xC8, 0x26, 0x6C, 0xB9,
+    0x54, 0xAD, 0xAA, 0xA4, 0x10, 0x65, 0x43, 0x6D, 0x55, 0x6A, 0x4D, 0x9B, 0x96, 0x85, 0xA1, 0x17,
+    0x73, 0xEB, 0x00, 0xC6, 0x6A, 0xCF, 0xC1, 0xDA, 0x41, 0x64, 0x35, 0xAA, 0x2D, 0x95, 0x96, 0x41,
+    0x20, 0x51, 0x89, 0x44, 0xD9, 0xC4, 0xF2, 0x15, 0x2A, 0x62, 0x43, 0xD1, 0x86, 0xA5, 0xE0, 0xC3,
+    0xE7, 0x15, 0xAB, 0xA4, 0xD5, 0xE6, 0xCA, 0x2D, 0x76, 0xB3, 0x6C, 0x59, 0xB5, 0x86, 0xED, 0xB1,
+    0x25, 0x94, 0x88, 0x6D, 0x0A, 0x26, 0x73, 0x2B, 0x57, 0x2D, 0x56, 0x94, 0x50, 0xA2, 0x49, 0x07,
+    0xDF, 0x52, 0x04, 0x84, 0x4B, 0x55, 0xC2, 0xAE, 0xF9, 0x58, 0x7A, 0x01, 0x7A, 0xCA, 0xEA, 0x5C,
+    0x12, 0xB9, 0x1C, 0xA9, 0x4C, 0xE1, 0xE0, 0x6B, 0xA1, 0xB6, 0x82, 0xB9, 0xA8, 0x43, 0x86, 0x6A,
+    0x22, 0x1A, 0x43, 0x8E, 0x7C, 0xAE, 0x35, 0x9C, 0x60, 0x24, 0xDD, 0xC9, 0xCD, 0x72, 0x16, 0x5A,
+    0x9B, 0x08, 0xD0, 0x17, 0x2B, 0x80, 0x01, 0xFE, 0xE2, 0x49, 0xF7, 0xEB, 0x44, 0x96, 0x88, 0x6D,
+    0x58, 0x4D, 0x5A, 0x6B, 0x62, 0x50, 0x85, 0x81, 0x6D, 0xAE, 0xF4, 0x79, 0x49, 0x2B, 0x1A, 0x7F,
+    0x61, 0xC2, 0xF0, 0x7C, 0x27, 0x54, 0xCC, 0x0B, 0x21, 0xE5, 0x08, 0xD5, 0x3C, 0xE3, 0x22, 0xA0,
+    0x07, 0x80, 0x7E, 0x8A, 0x91, 0x05, 0x13, 0x46, 0x32, 0x54, 0x81, 0x6A, 0x85, 0x14, 0xA2, 0x84,
+    0xB9, 0xC7, 0x2D, 0x09, 0x8B, 0x3D, 0x6A, 0x25, 0xF4, 0x2A, 0x50, 0x5C, 0x80, 0x6F, 0xBC, 0x78,
+    0x69, 0xDA, 0xC7, 0x5F, 0x48, 0x1B, 0xF4, 0xE4, 0xF2, 0x39, 0xC4, 0xE7, 0x4F, 0x1B, 0x70, 0x6D,
+    0xC3, 0x54, 0x6A, 0xD3, 0x46, 0x43, 0x30, 0x45, 0x41, 0x1E, 0xAB, 0x42, 0x45, 0x42, 0x46, 0xAB,
+    0xB1, 0x05, 0x65, 0x52, 0x51, 0xBA, 0x86, 0x6F, 0xCE, 0x55, 0xB9, 0x60, 0x21, 0xC3, 0x25, 0x22,
+    0xE7, 0xA5, 0x14, 0x41, 0x21, 0xE4, 0x6A, 0x54, 0x18, 0xB0, 0xCB, 0xC1, 0xC1, 0x9E, 0x7D, 0x53,
+    0x7B, 0x94, 0xDE, 0xE2, 0x91, 0x5A, 0x13, 0xE2, 0x31, 0x24, 0x83, 0x50, 0xDA, 0x80, 0x66, 0xDF,
+    0x4A, 0x39, 0x8B, 0x58, 0x20, 0x66, 0x19, 0xFD, 0x5C, 0xF6, 0x11, 0x65, 0x38, 0x73, 0xDD, 0x92,
+    0x5A, 0x5F, 0x08, 0x99, 0xF2, 0xE5, 0x59, 0x56, 0x81, 0x0E, 0x67, 0xD5, 0x12, 0xC8, 0x35, 0x23,
+    0x15, 0xC1, 0x50, 0x53, 0xD9, 0xA5, 0xC9, 0xA4, 0x44, 0xD0, 0x63, 0x8E, 0x4A, 0xE4, 0x84, 0x04,
+    0x49, 0x48, 0x20, 0x42, 0xEA, 0xBA, 0x42, 0x15, 0x87, 0x71, 0xB1, 0xD2, 0xBF, 0x57, 0x0C, 0x32,
+    0xC4, 0x03, 0x10, 0x4D, 0xAD, 0x54, 0x61, 0x52, 0x68, 0x5D, 0x39, 0xB9, 0x23, 0x21, 0x24, 0x8B,
+    0x72, 0x19, 0x4A, 0x41, 0xD7, 0xA7, 0xCB, 0x43, 0x40, 0x67, 0x91, 0x73, 0xAB, 0x35, 0x50, 0x49,
+    0xCC, 0x65, 0x4B, 0x7C, 0x71, 0x84, 0xB9, 0x2D, 0xC1, 0x7E, 0x69, 0x57, 0x61, 0x09, 0xC4, 0x83,
+    0xD0, 0x4E, 0x0A, 0xFA, 0x4A, 0xA4, 0x60, 0xDC, 0x86, 0x50, 0xA2, 0x42, 0x05, 0x03, 0x1B, 0x0A,
+    0xD8, 0xA3, 0x2D, 0x84, 0x9B, 0x28, 0x67, 0xB5, 0xF2, 0x70, 0xCC, 0xAD, 0xD0, 0x9F, 0xC9, 0xFC,
+    0x35, 0x95, 0x30, 0x88, 0x10, 0x40, 0x6E, 0xE2, 0xDA, 0x86, 0xA1, 0xE4, 0xB6, 0x5C, 0xC1, 0xB4,
+    0xFE, 0x90, 0x11, 0x6E, 0xF3, 0x82, 0x90, 0xA8, 0x7D, 0x40, 0x52, 0x88, 0x49, 0x26, 0x17, 0x31,
+    0x20, 0x80, 0xAB, 0x56, 0x6D, 0xCC, 0xD5, 0xAA, 0x46, 0xAE, 0x65, 0x81, 0xD8, 0xE5, 0x42, 0x1C,
+    0x26, 0x09, 0xDD, 0x56, 0x56, 0x24, 0xE3, 0x7C, 0x75, 0x28, 0x45, 0xC1, 0xC5, 0xB9, 0xD2, 0xB6,
+    0x5A, 0x4C, 0x22, 0x91, 0x93, 0x9C, 0x7E, 0xC0, 0xCD, 0xBD, 0x65, 0x0A, 0x11, 0xD7, 0x36, 0x8E,
+    0xBC, 0xD2, 0x7A, 0x6B, 0xC8, 0xAD, 0xDC, 0xB7, 0x5D, 0xC9, 0x51, 0x00, 0x71, 0xCA, 0x91, 0x4C,
+    0x94, 0x55, 0x65, 0x24, 0x44, 0x98, 0xA1, 0xD1, 0xDC, 0x5E, 0xAD, 0x6A, 0xE8, 0xE2, 0x01, 0x29,
+    0xED, 0xA9, 0x53, 0x8B, 0x57, 0xB5, 0x32, 0x60, 0x6D, 0x2E, 0x2D, 0x36, 0x00, 0x63, 0xFC, 0x01,
+    0x3B, 0xB7, 0x2D, 0x40, 0x76, 0x64, 0x45, 0xA4, 0xF0, 0x37, 0xA9, 0x2D, 0x24, 0xAD, 0x64, 0xEB,
+    0xCC, 0x15, 0x85, 0x0A, 0x54, 0x4D, 0xAD, 0x02, 0xDA, 0xFA, 0x53, 0x61, 0x82, 0x20, 0x28, 0x4A,
+    0xA0, 0x28, 0xB1, 0x18, 0x99, 0xC6, 0x2D, 0xD8, 0xAF, 0x73, 0x01, 0x7A, 0x65, 0x2B, 0x26, 0x2B,
+    0x50, 0x45, 0xEC, 0xF8, 0x14, 0xFD, 0x43, 0x76, 0x9E, 0x56, 0xAF, 0x2A, 0x50, 0x96, 0x94, 0x93,
+    0xA2, 0xAD, 0x93, 0xB9, 0x30, 0xFE, 0x20, 0x3E, 0x1C, 0xA3, 0x42, 0x56, 0x7F, 0x15, 0x2A, 0x48,
+    0x75, 0x04, 0xD0, 0x04, 0x48, 0x13, 0x20, 0x13, 0xEF, 0xDC, 0xD9, 0x8A, 0xEF, 0xDC, 0x56, 0x6D,
+    0x74, 0x38, 0xB1, 0x69, 0xA8, 0xF0, 0xB3, 0x67, 0x6B, 0x9F, 0xD1, 0x50, 0x6B, 0x74, 0xA5, 0x0E,
+    0x93, 0x64, 0xCF, 0xBA, 0xC4, 0x00, 0xE9, 0xDE, 0xBF, 0x83, 0x39, 0x0B, 0xDA, 0x7D, 0xD5, 0x76,
+    0x0B, 0x62, 0xB6, 0x18, 0x04, 0xED, 0x20, 0x44, 0xC4, 0xB0, 0x5D, 0xAB, 0x28, 0x24, 0x14, 0x55,
+    0x64, 0xD2, 0xED, 0x90, 0x46, 0x81, 0x6A, 0xB4, 0xDD, 0x91, 0xE4, 0xD0, 0x2B, 0x09, 0x49, 0x0C,
+    0x19, 0x72, 0xC9, 0x4E, 0xC9, 0x62, 0xB7, 0x05, 0xDB, 0x8E, 0x14, 0x78, 0xC9, 0xEB, 0x59, 0x21,
+    0x81, 0x02, 0xA1, 0x11, 0x48, 0xA8, 0x2D, 0xBB, 0x40, 0x4A, 0xDA, 0x7A, 0xCD, 0xBA, 0x26, 0x5A,
+    0xB1, 0x62, 0x02, 0x12, 0x25, 0x99, 0xEB, 0xC0, 0x81, 0x83, 0x7A, 0xF5, 0x1C, 0x80, 0x18, 0x46,
+    0xE7, 0x42, 0x3D, 0x59, 0x85, 0x04, 0x73, 0x8C, 0x06, 0xF5, 0xAC, 0x94, 0x89, 0x5C, 0x1D, 0x45,
+    0xA3, 0x73, 0x10, 0xC9, 0x48, 0xA0, 0xF2, 0x1C, 0x35, 0xB1, 0xE1, 0xA0, 0x63, 0xC7, 0x61, 0x1C,
+    0x5D, 0xBA, 0x84, 0x5A, 0xC7, 0x90, 0xCF, 0x8E, 0xB9, 0xA2, 0x0D, 0x53, 0x3A, 0x31, 0x44, 0xBF,
+    0x5C, 0x82, 0x3F, 0x0A, 0x3E, 0x96, 0x0B, 0x21, 0x11, 0x96, 0x41, 0x98, 0x41, 0x12, 0xE6, 0x0F,
+    0x1F, 0x35, 0x7F, 0x3D, 0xB8, 0xB2, 0xB8, 0xA2, 0x36, 0x9B, 0x04, 0x2E, 0x2A, 0x8F, 0x14, 0xF4,
+    0xE7, 0x56, 0x6B, 0x1C, 0xB5, 0x03, 0xD0, 0x5E, 0x2A, 0x88, 0xF6, 0xC8, 0x8E, 0x5C, 0x05, 0xD5,
+    0xDA, 0xB5, 0x3B, 0x73, 0xE6, 0xE1, 0x09, 0x71, 0x79, 0xCC, 0x54, 0xC5, 0xED, 0x29, 0x95, 0x36,
+    0x49, 0x11, 0x1F, 0x94, 0xC0, 0x37, 0x59, 0x8D, 0x40, 0x43, 0xE4, 0x78, 0x90, 0xCC, 0x62, 0x2A,
+    0x95, 0x1C, 0x5A, 0xA1, 0x0A, 0x3B, 0xE8, 0xAF, 0x64, 0x3E, 0x39, 0x00, 0xB3, 0x66, 0x3D, 0x6B,
+    0xB3, 0xA2, 0x99, 0x43, 0x26, 0xB2, 0x32, 0x6D, 0x14, 0x14, 0x31, 0x62, 0x80, 0xC8, 0xD0, 0x50,
+    0x5D, 0xB4, 0x08, 0x63, 0x24, 0x3D, 0x3F, 0x13, 0x12, 0x7A, 0xF0, 0xE0, 0x8B, 0xD5, 0xC4, 0x55,
+    0xC4, 0x42, 0xE2, 0x33, 0xCE, 0xDF, 0x15, 0xB2, 0x64, 0x09, 0xB6, 0xC5, 0x6A, 0x97, 0xEE, 0x9C,
+    0xB4, 0x2A, 0x49, 0xEC, 0x90, 0xCB, 0x84, 0xCF, 0x20, 0x7F, 0xD1, 0xCC, 0x15, 0xCB, 0x91, 0x0C,
+    0xD9, 0x09, 0x78, 0x0E, 0x46, 0x22, 0x96, 0xF7, 0x0E, 0xF2, 0xDD, 0x33, 0xB5, 0x8A, 0xF1, 0xC5,
+    0xC2, 0xAE, 0x15, 0xAF, 0x0C, 0x58, 0xAA, 0xF2, 0x79, 0x56, 0xCC, 0xA5, 0xA3, 0xBB, 0x50, 0xA1,
+    0x42, 0xAD, 0xD3, 0x0A, 0x59, 0xDB, 0x29, 0x56, 0xE4, 0x1A, 0x45, 0x4C, 0x18, 0x8D, 0xE0, 0xB4,
+    0x36, 0x43, 0x31, 0x72, 0xF4, 0xF5, 0x60, 0xDB, 0x42, 0x89, 0x13, 0xEE, 0x0B, 0x84, 0x8C, 0x01,
+    0xDF, 0xC5, 0xAA, 0xE4, 0xA2, 0xD1, 0xF3, 0x65, 0xCA, 0x30, 0x9B, 0x7C, 0xF4, 0xC5, 0xA0, 0x82,
+    0x38, 0xA7, 0xB8, 0x12, 0xB4, 0xE2, 0x51, 0xF0, 0x67, 0x93, 0x9B, 0xA3, 0x8D, 0x8B, 0x57, 0xAE,
+    0x2A, 0x0B, 0x89, 0xCB, 0x3B, 0x66, 0x3F, 0xD5, 0x12, 0x8A, 0xBB, 0xA6, 0x81, 0xD9, 0x5B, 0xB9,
+    0x76, 0xF4, 0xFA, 0xBA, 0x8F, 0xEF, 0x22, 0xB7, 0xEF, 0x12, 0xB1, 0x0D, 0x14, 0x08, 0x6F, 0x09,
+    0xB7, 0x55, 0xF7, 0x18, 0x52, 0x2B, 0xCB, 0x26, 0x21, 0x29, 0x61, 0xB9, 0x6C, 0x04, 0x89, 0xD8,
+    0x6D, 0x56, 0xAD, 0x96, 0x16, 0x1F, 0xEA, 0xD5, 0x6B, 0xC0, 0x91, 0xA2, 0xD0, 0x56, 0xB5, 0x45,
+    0x96, 0x50, 0xD1, 0xBE, 0xAA, 0x5E, 0xBF, 0xEA, 0x21, 0x9B, 0x33, 0x94, 0xD0, 0x81, 0x8E, 0xA4,
+    0x28, 0xAE, 0xA8, 0xEF, 0xAC, 0x58, 0xC4, 0x6C, 0xFE, 0x34, 0x1B, 0x14, 0xF5, 0x9F, 0xBB, 0xAC,
+    0x08, 0x6B, 0xB5, 0x2D, 0xB4, 0x08, 0xE0, 0x21, 0x44, 0x86, 0x59, 0x4A, 0xDE, 0x30, 0x25, 0x10,
+    0xA1, 0x5A, 0x20, 0x04, 0xF1, 0x21, 0x77, 0x56, 0x91, 0xAC, 0x83, 0x55, 0x0B, 0x47, 0x92, 0x93,
+    0x40, 0x98, 0x64, 0xB9, 0x5A, 0x29, 0x20, 0xF9, 0xA3, 0xA7, 0x6D, 0xBF, 0xB7, 0xA7, 0xE8, 0xA0,
+    0x92, 0xD3, 0xAA, 0x0C, 0x97, 0xAC, 0xAF, 0x5E, 0x60, 0x69, 0x3B, 0x57, 0x69, 0xAA, 0x38, 0x8A,
+    0x0A, 0x9D, 0x60, 0x54, 0x6C, 0x67, 0x09, 0x79, 0x5C, 0x55, 0x32, 0x1D, 0xA5, 0x0F, 0x9C, 0x9C,
+    0x45, 0x5E, 0x51, 0x76, 0x63, 0x1A, 0xD7, 0x2B, 0xD7, 0xA4, 0x4E, 0x72, 0x3E, 0x7D, 0xC4, 0xA1,
+    0x68, 0xAB, 0x99, 0x36, 0x57, 0xCD, 0x14, 0x9A, 0x24, 0x95, 0xA9, 0x57, 0x55, 0xB1, 0xDA, 0xFD,
+    0x13, 0x04, 0x4F, 0x46, 0x43, 0x83, 0x41, 0x72, 0x59, 0x13, 0xB6, 0x65, 0x4C, 0xB4, 0x30, 0x06,
+    0xB3, 0xDD, 0x84, 0x55, 0x0E, 0xD4, 0x23, 0x75, 0xB0, 0x3A, 0x42, 0x09, 0x4B, 0x90, 0x4F, 0xC9,
+    0x42, 0x06, 0xFA, 0x78, 0x34, 0x59, 0xAB, 0x57, 0x7F, 0x68, 0xDE, 0xA4, 0x9D, 0x15, 0x54, 0x31,
+    0x3D, 0x3A, 0x21, 0x5C, 0xFA, 0xAB, 0x82, 0x38, 0xD7, 0x35, 0x47, 0x42, 0x65, 0xAC, 0x2A, 0xAC,
+    0xCF, 0xCA, 0x4D, 0xA3, 0xF5, 0x76, 0xCC, 0xE5, 0x36, 0x37, 0xD7, 0x17, 0x64, 0x8B, 0x68, 0xF1,
+    0x72, 0x6B, 0x03, 0xA1, 0x9F, 0xB9, 0xDD, 0x54, 0x42, 0x78, 0xC1, 0x87, 0xAE, 0x29, 0x41, 0x05,
+    0xD3, 0x02, 0x34, 0xAA, 0x0C, 0xB1, 0x5B, 0x0A, 0x0C, 0xE8, 0x5A, 0xD5, 0x68, 0xA5, 0x20, 0xDD,
+    0x4B, 0x84, 0x50, 0xD2, 0x05, 0x99, 0x6B, 0x72, 0x92, 0xB6, 0x86, 0x92, 0xB9, 0xD3, 0x3A, 0x97,
+    0xAE, 0x4A, 0x95, 0x14, 0xFF, 0x2C, 0x36, 0x74, 0x6E, 0xEE, 0xC1, 0xA4, 0x08, 0x93, 0x50, 0x01,
+    0x4C, 0x01, 0x2B, 0xD6, 0x20, 0x55, 0xAD, 0x56, 0xFC, 0xBA, 0xA1, 0x6A, 0x1D, 0x30, 0x69, 0xF5,
+    0x94, 0x45, 0x76, 0x69, 0xD8, 0xDB, 0xB4, 0x72, 0xF5, 0x28, 0x5B, 0x59, 0x0C, 0xAF, 0x20, 0x6A,
+    0x6D, 0x4C, 0x38, 0x71, 0x57, 0xEC, 0x95, 0x3F, 0x7F, 0xC5, 0x8C, 0xCE, 0xA8, 0x8A, 0xA1, 0x69,
+    0xB2, 0x40, 0xCF, 0xC8, 0x12, 0x9A, 0x67, 0xC8, 0x10, 0x1F, 0x2C, 0x5D, 0xDB, 0xBA, 0x15, 0xCC,
+    0x32, 0x51, 0x09, 0x40, 0x40, 0xE7, 0x3A, 0x60, 0xC6, 0x92, 0xE9, 0xCA, 0xB8, 0x8E, 0x8E, 0x34,
+    0x45, 0x84, 0xE8, 0x60, 0xDA, 0xA0, 0xB7, 0x06, 0xD1, 0xAD, 0x86, 0x40, 0x6E, 0xC2, 0xC7, 0xB0,
+    0x40, 0x70, 0x7D, 0x01, 0x6E, 0xF2, 0x54, 0x96, 0xC1, 0xDE, 0x96, 0x12, 0x85, 0xC5, 0x10, 0x59,
+    0x5C, 0x55, 0xBD, 0x50, 0x78, 0xBB, 0x4F, 0x51, 0xDA, 0xA0, 0x74, 0x7B, 0xD2, 0x7D, 0xB5, 0xF6,
+    0x58, 0xE4, 0x12, 0x97, 0x7E, 0xFA, 0x8C, 0x5A, 0xEB, 0xCC, 0xC7, 0x66, 0x80, 0x59, 0xB6, 0xE5,
+    0xF5, 0xAB, 0x5F, 0xD5, 0x56, 0x78, 0xB3, 0x6A, 0xB5, 0x1A, 0x90, 0x2F, 0xCB, 0x9C, 0x02, 0x08,
+    0xE2, 0xB4, 0x3B, 0xD6, 0xED, 0x44, 0x41, 0x39, 0x7B, 0x72, 0xF3, 0xC9, 0xB2, 0xA2, 0x80, 0x77,
+    0x29, 0x52, 0xC0, 0xBB, 0x9A, 0x61, 0x99, 0x18, 0x21, 0x74, 0x00, 0x69, 0x9D, 0x1C, 0x04, 0x71,
+    0x58, 0x2E, 0x89, 0xFA, 0x88, 0x99, 0x2C, 0x94, 0xE8, 0x4E, 0x07, 0x88, 0x02, 0xB9, 0x71, 0x1B,
+    0xE6, 0x16, 0xE2, 0xB4, 0x28, 0x83, 0xBD, 0x7D, 0x91, 0xEB, 0x94, 0xAE, 0xB5, 0x12, 0x80, 0xCE,
+    0x1D, 0xCB, 0xC7, 0x01, 0x04, 0xC4, 0x87, 0x38, 0xA9, 0x34, 0x19, 0x04, 0x59, 0x81, 0x5C, 0x7C,
+    0xF8, 0xC8, 0x05, 0x41, 0x25, 0xAE, 0x9B, 0x60, 0x05, 0xE7, 0xDE, 0x23, 0x84, 0x56, 0x84, 0x3F,
+    0xAD, 0x84, 0x72, 0xE1, 0xBA, 0xA5, 0xE8, 0x8D, 0x0C, 0x5C, 0x88, 0xBD, 0x04, 0x6C, 0x95, 0x56,
+    0x03, 0x22, 0x19, 0x2F, 0x9A, 0xB2, 0x23, 0xCA, 0x56, 0x2B, 0xB2, 0xA0, 0xCF, 0x4C, 0xCA, 0x79,
+    0x75, 0x2A, 0xAA, 0x89, 0x2F, 0x58, 0xCA, 0xB6, 0x0D, 0x36, 0x59, 0x58, 0xA5, 0x5E, 0xF4, 0x5C,
+    0x0E, 0x1E, 0xFC, 0x98, 0xEC, 0x9F, 0x41, 0x86, 0xD2, 0xCA, 0x8C, 0x65, 0xA3, 0xA8, 0xDA, 0x43,
+    0x32, 0xDE, 0xEA, 0x19, 0xEB, 0x72, 0xCD, 0x5B, 0xAF, 0x94, 0x47, 0x91, 0x7D, 0x85, 0xB8, 0x6A,
+    0xBD, 0xB9, 0x88, 0xF6, 0xF1, 0x08, 0x94, 0x28, 0x6B, 0x3B, 0x42, 0xEF, 0xAA, 0xE6, 0x04, 0x08,
+    0x50, 0x6B, 0x2E, 0xAD, 0x67, 0x99, 0x00, 0x62, 0x96, 0x31, 0x67, 0x2A, 0xC3, 0x32, 0xDA, 0x16,
+    0x9E, 0x5A, 0x12, 0xA8, 0x88, 0xB3, 0xA2, 0xD8, 0x9E, 0x64, 0xBA, 0x78, 0xA3, 0x1D, 0x07, 0x25,
+    0x41, 0x80, 0x70, 0xA9, 0xB4, 0xDF, 0xAC, 0xAA, 0x20, 0x41, 0x96, 0x60, 0x54, 0xA2, 0x0F, 0xA2,
+    0x54, 0x23, 0xBE, 0xDC, 0xD0, 0x63, 0xD3, 0x25, 0x3D, 0x39, 0x76, 0x6B, 0xE9, 0xE1, 0x42, 0xA7,
+    0x0E, 0x57, 0x43, 0x25, 0xB5, 0xCE, 0xCD, 0x75, 0x4A, 0xDC, 0xDC, 0x59, 0xC9, 0xF6, 0xF2, 0xF8,
+    0xC3, 0xF7, 0xEB, 0xDC, 0x56, 0x2C, 0xCD, 0xD2, 0x9A, 0x3A, 0x39, 0x6E, 0x20, 0x0C, 0xAF, 0x84,
+    0xB0, 0x2D, 0xF0, 0xC7, 0x30, 0x88, 0x60, 0x3B, 0x76, 0xB4, 0xDD, 0x59, 0xCF, 0x91, 0x4F, 0x82,
+    0x84, 0x24, 0xBF, 0x22, 0xF7, 0x46, 0xD1, 0x15, 0x90, 0x84, 0x76, 0x06, 0x4A, 0xE1, 0xF3, 0x66,
+    0x11, 0x90, 0x8B, 0x4D, 0x49, 0x78, 0x85, 0x8C, 0xA5, 0x4B, 0x64, 0xE2, 0xDE, 0xBE, 0x3D, 0xA6,
+    0xC8, 0x9F, 0x03, 0x42, 0x74, 0x2A, 0xDA, 0xC0, 0x2A, 0xD4, 0xAD, 0xDB, 0x25, 0x31, 0x06, 0x15,
+    0x3C, 0x15, 0x49, 0x40, 0x3F, 0xC9, 0x55, 0x25, 0xA0, 0x01, 0xF8, 0x56, 0x02, 0x29, 0x2B, 0x19,
+    0x88, 0x19, 0xAA, 0xDA, 0x2B, 0x6F, 0xAE, 0x56, 0x72, 0xD5, 0xE6, 0xB2, 0x89, 0xF8, 0x6D, 0x12,
+    0xAA, 0x81, 0xBE, 0xBE, 0x53, 0x09, 0x01, 0xC4, 0xB3, 0x5A, 0x86, 0xFA, 0x81, 0x2C, 0x81, 0x46,
+    0xC2, 0x20, 0xAE, 0xB9, 0x08, 0xCA, 0x79, 0x3B, 0xB1, 0xD5, 0x22, 0xAF, 0x6F, 0x77, 0x56, 0xFD,
+    0xEA, 0xC7, 0xEC, 0xE2, 0x5B, 0xA6, 0x96, 0x50, 0xE1, 0x63, 0xCA, 0x25, 0xAD, 0xB7, 0xC8, 0x08,
+    0xBD, 0x32, 0xF4, 0xF6, 0xCA, 0xAC, 0xB6, 0x86, 0xEA, 0x82, 0xD0, 0xD1, 0xD0, 0xD0, 0x29, 0x2A,
+    0x32, 0xE9, 0x4A, 0xC6, 0x82, 0x72, 0xD5, 0x29, 0x19, 0x08, 0xE3, 0x02, 0x9C, 0xB2, 0x06, 0x52,
+    0x5A, 0x3A, 0x6F, 0x37, 0xE6, 0xD5, 0x95, 0xB6, 0x15, 0xB2, 0x92, 0x40, 0x79, 0x20, 0x02, 0xF1,
+    0x96, 0x8E, 0x81, 0xC5, 0xA7, 0x4E, 0x59, 0x9B, 0xAA, 0xEB, 0x2C, 0xD7, 0xB4, 0x5F, 0xD2, 0xCE,
+    0x1D, 0x04, 0x61, 0x19, 0x1B, 0x20, 0x81, 0xBC, 0x7A, 0x0D, 0xA4, 0x87, 0xD6, 0x5E, 0xC7, 0x8D,
+    0x00, 0x7F, 0x35, 0x21, 0x19, 0x2F, 0x5E, 0x0C, 0x6A, 0xFD, 0x25, 0xBE, 0x32, 0x8E, 0x91, 0xD5,
+    0x7E, 0x6D, 0x73, 0xB9, 0xA8, 0x37, 0xE9, 0x5D, 0xDA, 0x49, 0xF0, 0xA2, 0x89, 0x88, 0xD5, 0xA6,
+    0x12, 0x13, 0x36, 0x60, 0x11, 0xB3, 0x61, 0x53, 0x35, 0xE0, 0x83, 0x1C, 0x5B, 0x0F, 0x2F, 0xBE,
+    0x44, 0x98, 0x8B, 0x81, 0xAF, 0x5F, 0x69, 0x49, 0x2E, 0xEB, 0x08, 0x68, 0x3C, 0x46, 0xF1, 0x7E,
+    0xFE, 0x9C, 0xA0, 0x56, 0x69, 0xC9, 0xC5, 0x80, 0x85, 0x54, 0x65, 0xF9, 0xCA, 0x04, 0x20, 0xC5,
+    0x7C, 0x6A, 0x9E, 0x4A, 0x8A, 0x88, 0x2C, 0x9E, 0x84, 0xB2, 0xFE, 0xA8, 0x1D, 0x3B, 0x96, 0xAB,
+    0xDB, 0xAC, 0x8A, 0xD7, 0xB2, 0xAC, 0xAA, 0x74, 0x19, 0xDE, 0x49, 0x7A, 0x52, 0x6D, 0x5D, 0x5C,
+    0xF6, 0xF0, 0xBE, 0xB4, 0x81, 0xD8, 0x8C, 0x08, 0x64, 0xC9, 0x11, 0x95, 0x93, 0x6C, 0x03, 0x01,
+    0x08, 0xAA, 0xE8, 0xA1, 0x2C, 0xAD, 0x5C, 0x18, 0x7D, 0xED, 0x97, 0x54, 0x72, 0xD2, 0xA9, 0x71,
+    0xE8, 0xA1, 0x4A, 0x4B, 0x16, 0x8B, 0x89, 0x89, 0x7C, 0xB4, 0xBA, 0xAC, 0x73, 0xB6, 0xD3, 0x23,
+    0xAF, 0x5A, 0xD3, 0xCA, 0x79, 0x1C, 0x29, 0xC8, 0x57, 0x42, 0x59, 0xD3, 0xE6, 0x92, 0x93, 0xF6,
+    0x8F, 0x31, 0x47, 0x3D, 0x16, 0x5C, 0x99, 0x35, 0x4A, 0xD0, 0x53, 0xAD, 0x36, 0xB2, 0xEA, 0x11,
+    0xC1, 0x05, 0x2B, 0x22, 0x19, 0x58, 0xF4, 0x19, 0xD4, 0xA8, 0xD5, 0x20, 0x58, 0x11, 0x69, 0xD3,
+    0xB6, 0x85, 0x34, 0x17, 0x0C, 0xC3, 0x7A, 0x62, 0xC1, 0xAC, 0x0C, 0x71, 0x52, 0x6C, 0xB7, 0x32,
+    0x55, 0x49, 0xD4, 0x11, 0x95, 0x58, 0xC9, 0xD6, 0x40, 0x58, 0x5E, 0x95, 0x0D, 0x0B, 0x08, 0x91,
+    0x21, 0x07, 0x6F, 0x17, 0x57, 0x6D, 0x5A, 0x52, 0xEB, 0xB9, 0x73, 0x20, 0xD2, 0x32, 0x62, 0x34,
+    0xB7, 0xD8, 0xC8, 0xAA, 0x80, 0x15, 0x19, 0xA4, 0x58, 0xEC, 0x0F, 0x59, 0xC2, 0x55, 0xA9, 0x1C,
+    0xDC, 0xA9, 0x56, 0xD6, 0xE2, 0x44, 0x7B, 0xD3, 0x28, 0xE0, 0x63, 0xB7, 0x1A, 0x4B, 0x58, 0x0F,
+    0xCE, 0x38, 0x0D, 0x2A, 0xA2, 0x24, 0x14, 0x0A, 0x80, 0xBE, 0x6A, 0xCD, 0xAA, 0xD5, 0x6E, 0x9D,
+    0x3A, 0x5A, 0xED, 0x8A, 0xA5, 0x56, 0xD2, 0xE0, 0xDA, 0xB3, 0xC8, 0x5E, 0xBD, 0xCD, 0x3A, 0xD1,
+    0x4C, 0xDA, 0x80, 0xB5, 0xB4, 0x3A, 0x80, 0x20, 0x23, 0x97, 0x21, 0x97, 0x6D, 0x71, 0xD1, 0xDB,
+    0xD9, 0x96, 0x28, 0x24, 0xCA, 0x76, 0xF9, 0xB4, 0x45, 0x5C, 0xA0, 0x6A, 0x2D, 0x39, 0xEC, 0x1E,
+    0x32, 0x0A, 0x36, 0xCA, 0x64, 0x8D, 0xBF, 0x86, 0xB4, 0x6A, 0xD5, 0xDA, 0xD6, 0xAB, 0x09, 0x40,
+    0x20, 0xD8, 0x02, 0x65, 0x98, 0xF6, 0xAC, 0xC0, 0x48, 0x40, 0x98, 0xA8, 0x44, 0x74, 0xC5, 0x66,
+    0xAC, 0xB9, 0xB3, 0x94, 0x9E, 0xBC, 0x42, 0x25, 0xED, 0xD9, 0x53, 0xC5, 0x82, 0xB6, 0x65, 0x64,
+    0x6C, 0x11, 0xA2, 0xB7, 0x73, 0xDB, 0x9A, 0x3D, 0xF5, 0x73, 0x2F, 0x86, 0x9D, 0x5A, 0x15, 0x52,
+    0x7E, 0x15, 0x68, 0xF1, 0x57, 0x5A, 0x55, 0xDB, 0x7E, 0x25, 0x1C, 0x28, 0x07, 0xB9, 0x53, 0x15,
+    0xB9, 0xD6, 0x39, 0xAB, 0x08, 0x45, 0x8F, 0xB5, 0x75, 0x4E, 0x41, 0x98, 0xD8, 0xEA, 0x99, 0x02,
+    0x8D, 0xB9, 0x4A, 0x15, 0x38, 0x1B, 0xAA, 0x66, 0xAC, 0x56, 0xB9, 0x20, 0xC5, 0x4A, 0xAB, 0xF5,
+    0xEB, 0x2D, 0xB6, 0x18, 0x1A, 0xD6, 0x3D, 0x25, 0x03, 0xD2, 0x89, 0x35, 0x8E, 0x46, 0x20, 0x0B,
+    0x7A, 0x6A, 0xF1, 0x29, 0x5A, 0x35, 0xE6, 0x12, 0x26, 0xDC, 0xEE, 0x70, 0xBC, 0x12, 0x74, 0x05,
+    0x54, 0x95, 0x03, 0x09, 0x12, 0x17, 0xB6, 0x06, 0x88, 0xB0, 0x5D, 0x6B, 0x59, 0xA6, 0x94, 0x77,
+    0x2D, 0x2E, 0xE9, 0x25, 0x12, 0x30, 0x6E, 0x40, 0x7B, 0x08, 0xDE, 0x89, 0x30, 0xE4, 0x2E, 0x49,
+    0x8B, 0xB9, 0x80, 0x1F, 0x10, 0x49, 0x40, 0xA1, 0x85, 0x5C, 0xB9, 0x49, 0xD0, 0x96, 0x18, 0x37,
+    0x2E, 0x5F, 0x23, 0x68, 0x3E, 0xA3, 0xA5, 0x82, 0x28, 0xAC, 0xCA, 0xB0, 0x68, 0x60, 0xB2, 0xA6,
+    0x15, 0xB3, 0xC0, 0xA6, 0x21, 0x34, 0x72, 0xC5, 0xAC, 0x8C, 0x16, 0x04, 0x60, 0xC2, 0x84, 0x93,
+    0x87, 0x6A, 0x15, 0xA6, 0x09, 0x60, 0x56, 0x34, 0x5A, 0x5B, 0xB5, 0xE2, 0x47, 0x08, 0x0C, 0x62,
+    0x06, 0x09, 0x5F, 0x24, 0x71, 0x54, 0xC8, 0x10, 0x16, 0x7B, 0x97, 0x1C, 0x59, 0x4A, 0xA1, 0x75,
+    0x41, 0xAF, 0x44, 0xBF, 0x3A, 0x56, 0x1D, 0xC6, 0x44, 0xA9, 0xC0, 0x43, 0x5A, 0x5B, 0x25, 0x91,
+    0xE5, 0xEE, 0x1E, 0x05, 0xAD, 0x28, 0xAA, 0x8A, 0x42, 0x91, 0x30, 0xA1, 0x01, 0x2A, 0x07, 0x09,
+    0x7D, 0x90, 0x3C, 0x40, 0xCC, 0x63, 0x36, 0xBF, 0xE4, 0x56, 0xA2, 0xB0, 0x07, 0xAD, 0xDB, 0x3F,
+    0x8F, 0xED, 0x86, 0x1A, 0x17, 0x24, 0x54, 0xE2, 0x68, 0x0B, 0xEA, 0x39, 0x6A, 0xBB, 0x32, 0xDE,
+    0x56, 0xA8, 0x7C, 0x68, 0x59, 0xA9, 0xC7, 0x6D, 0xAD, 0xDC, 0x33, 0x66, 0x1D, 0xED, 0xA0, 0xD0,
+    0x89, 0xAB, 0xB8, 0x3F, 0x77, 0x10, 0xD5, 0x21, 0x4C, 0xE8, 0x6C, 0x49, 0x9F, 0x13, 0x5B, 0x2A,
+    0x4D, 0x95, 0x64, 0x2B, 0xCB, 0x4F, 0x87, 0xE7, 0xF2, 0x9C, 0xEB, 0x40, 0x98, 0xD6, 0x47, 0xAD,
+    0xB6, 0xBA, 0xD5, 0x89, 0x6A, 0x01, 0xE2, 0xB4, 0x23, 0x5B, 0xC9, 0xE1, 0xBA, 0xC8, 0x9D, 0x15,
+    0xAF, 0x07, 0xFC, 0x71, 0x83, 0xE0, 0xD6, 0x94, 0x2C, 0x43, 0x01, 0x47, 0xA5, 0x7D, 0x43, 0x19,
+    0x59, 0x88, 0xB6, 0x88, 0x0F, 0xA3, 0x3D, 0x76, 0x81, 0x06, 0x4A, 0x59, 0x42, 0x7A, 0xF1, 0xA1,
+    0xDC, 0xA6, 0x2A, 0x16, 0xAC, 0x74, 0xC3, 0x2E, 0x1E, 0x56, 0x95, 0x05, 0xD7, 0xA6, 0x68, 0xAF,
+    0x7D, 0x2D, 0xB4, 0xE7, 0x81, 0x5C, 0xB9, 0xC5, 0x3C, 0xAC, 0xE5, 0x49, 0xA1, 0x59, 0x1F, 0xBA,
+    0x38, 0x7F, 0xD1, 0xD5, 0x31, 0x97, 0x25, 0x9D, 0x80, 0x6D, 0x0D, 0x67, 0xA0, 0x13, 0x6C, 0xD1,
+    0xA1, 0x67, 0x83, 0x41, 0x14, 0x28, 0x40, 0xC7, 0x06, 0x03, 0x48, 0x0E, 0x1C, 0x00, 0xEA, 0x37,
+    0x8B, 0xAC, 0xD2, 0xB5, 0xB1, 0x6A, 0x7A, 0x6D, 0xC9, 0x04, 0x91, 0x98, 0x47, 0x49, 0x02, 0x7D,
+    0xE2, 0xFA, 0xD5, 0x27, 0xD7, 0xB3, 0xE2, 0x1E, 0x0C, 0x2A, 0x77, 0x4C, 0xD6, 0x35, 0x36, 0x2D,
+    0x73, 0xF9, 0xE4, 0x8A, 0xAC, 0xE1, 0x9F, 0x6B, 0xBD, 0xB8, 0xFA, 0x83, 0x54, 0x56, 0xD9, 0xE4,
+    0x5C, 0xB9, 0xE6, 0xE6, 0xA4, 0x7A, 0xB0, 0x4B, 0x11, 0x55, 0x06, 0x08, 0xE9, 0x09, 0xC2, 0xE2,
+    0x4B, 0xA3, 0xB9, 0xFE, 0xE6, 0x86, 0xF8, 0xA5, 0x27, 0x2B, 0x17, 0xAB, 0x89, 0xD0, 0x4A, 0x78,
+    0x90, 0xA0, 0x2E, 0x24, 0x63, 0x90, 0xA6, 0x1A, 0x2A, 0xB6, 0x23, 0x5F, 0xD5, 0x3F, 0x5C, 0x03,
+    0xD2, 0xD2, 0xD1, 0x76, 0x80, 0x3E, 0x21, 0x5C, 0xCA, 0x6A, 0xA5, 0x10, 0xE3, 0x4C, 0xA1, 0x93,
+    0xFB, 0x62, 0x5C, 0x62, 0xB8, 0x52, 0x65, 0x5B, 0xCB, 0x85, 0x98, 0x95, 0xAC, 0xE5, 0xC0, 0xB0,
+    0x61, 0x48, 0x53, 0x6E, 0x29, 0x42, 0x64, 0xA8, 0x15, 0x1B, 0xAE, 0x8A, 0xCD, 0xA4, 0x1D, 0xAB,
+    0x96, 0x6C, 0xAF, 0x9C, 0x8B, 0x09, 0xBA, 0x3D, 0xAB, 0x40, 0x4A, 0xD7, 0xB5, 0x5B, 0xE7, 0xB4,
+    0x39, 0x41, 0x16, 0x81, 0xBC, 0x54, 0x3C, 0xDE, 0x06, 0xB2, 0xEA, 0xA4, 0x44, 0x90, 0xAC, 0x59,
+    0x4B, 0x44, 0x2A, 0xB6, 0x20, 0x29, 0xD7, 0x14, 0x72, 0xCA, 0xA6, 0x3D, 0x58, 0x16, 0x55, 0xAB,
+    0xB1, 0x5C, 0x6A, 0xA1, 0xD5, 0x4A, 0xAB, 0x95, 0xA2, 0x57, 0x3D, 0x7B, 0x62, 0x99, 0x2A, 0x24,
+    0x9F, 0x60, 0x90, 0xCC, 0xE6, 0x3A, 0x22, 0x61, 0x8A, 0xD9, 0xCA, 0xAA, 0x46, 0x53, 0x68, 0x6E,
+    0x50, 0x82, 0x8F, 0x3F, 0x27, 0xA3, 0x42, 0xF8, 0x6B, 0x30, 0x35, 0x97, 0x8C, 0x35, 0x69, 0x87,
+    0x2C, 0x98, 0x45, 0xB0, 0x5E, 0x3B, 0x85, 0x92, 0x09, 0x4E, 0x51, 0x64, 0x30, 0x49, 0x22, 0x41,
+    0x73, 0x87, 0x15, 0x7B, 0x51, 0xB6, 0x68, 0x58, 0x1D, 0x14, 0x99, 0x19, 0xAA, 0x7A, 0xF1, 0xCF,
+    0x57, 0x16, 0x86, 0x1C, 0x87, 0x78, 0x95, 0x70, 0xAB, 0x12, 0xBA, 0x68, 0xAF, 0xF1, 0x79, 0x3B,
+    0x17, 0x10, 0x46, 0x90, 0xB5, 0x58, 0x4E, 0xEC, 0xB9, 0xD6, 0x6A, 0x56, 0xC3, 0x8A, 0xDE, 0xFE,
+    0x12, 0x5A, 0x2B, 0x68, 0x2B, 0x54, 0x6D, 0x0C, 0x07, 0xC4, 0x01, 0x89, 0xF0, 0x5A, 0x01, 0x12,
+    0x5C, 0x86, 0x18, 0xE5, 0x58, 0x86, 0xA2, 0xB6, 0x36, 0x64, 0xF8, 0x6B, 0xB5, 0xA8, 0xE7, 0xC1,
+    0xB2, 0x05, 0x5E, 0x19, 0x1B, 0xEC, 0x96, 0xED, 0xDB, 0xAA, 0xB9, 0xB2, 0x02, 0x19, 0xFB, 0xF7,
+    0x2C, 0x42, 0x1E, 0xB3, 0x62, 0x19, 0xCC, 0x09, 0xA8, 0x4D, 0xBF, 0x45, 0x54, 0x14, 0xD5, 0x22,
+    0x14, 0x68, 0x91, 0x00, 0x07, 0x18, 0x10, 0xEE, 0xE5, 0x81, 0xC8, 0x0D, 0xD0, 0x40, 0x7F, 0x40,
+    0xEE, 0x34, 0x9A, 0x62, 0xAE, 0xA2, 0x5C, 0x12, 0x5C, 0x5A, 0xC5, 0x7C, 0x4A, 0xEB, 0xE4, 0xB2,
+    0x17, 0xB1, 0x7A, 0x59, 0x95, 0xA4, 0x15, 0x62, 0x8A, 0xAD, 0xF2, 0x1A, 0x2C, 0xDA, 0x66, 0x67,
+    0xA9, 0x5B, 0xB9, 0x5A, 0xE5, 0x3D, 0xF5, 0x16, 0x59, 0x57, 0x83, 0x6B, 0x7A, 0xE4, 0xFD, 0x93,
+    0x86, 0x02, 0x11, 0x0A, 0x7C, 0x10, 0xDF, 0x43, 0xD0, 0xB0, 0x55, 0x54, 0x00, 0x5D, 0x01, 0x22,
+    0x98, 0x57, 0x65, 0xC7, 0x55, 0x76, 0x00, 0x00, 0x44, 0xE5, 0x43, 0xAB, 0xAD, 0xBE, 0x18, 0x07,
+    0x1E, 0x85, 0x30, 0x01, 0x80, 0xC7, 0xB1, 0x0A, 0x90, 0xF5, 0x3D, 0x50, 0x6C, 0x18, 0x40, 0x8C,
+    0xB7, 0xFE, 0xB8, 0xE2, 0x0A, 0xC2, 0xEE, 0x98, 0xE3, 0x06, 0xB3, 0xFE, 0x66, 0xAD, 0xB7, 0xE3,
+    0xEA, 0xDB, 0xB4, 0x5F, 0x74, 0xA8, 0x34, 0x6A, 0x54, 0x4E, 0x88, 0x95, 0x05, 0x55, 0x82, 0x00,
+    0x81, 0x71, 0x65, 0x4E, 0x95, 0x71, 0x61, 0xE6, 0xE2, 0x12, 0xB7, 0x01, 0x16, 0x71, 0x46, 0xE5,
+    0x16, 0x52, 0x09, 0x58, 0x08, 0x97, 0x6A, 0x42, 0xF4, 0x25, 0xED, 0x93, 0xD4, 0x30, 0xDE, 0x63,
+    0x0E, 0x1C, 0xD4, 0x3A, 0x5B, 0x2B, 0x44, 0x34, 0xBB, 0x54, 0xB8, 0x94, 0x31, 0x9A, 0x28, 0x51,
+    0xC2, 0xAA, 0x5C, 0x8C, 0x46, 0x6B, 0xF2, 0xEE, 0x50, 0xD4, 0x1C, 0xD5, 0x6A, 0x31, 0x30, 0x9C,
+    0x22, 0x5A, 0xB4, 0x0D, 0x46, 0xBD, 0x38, 0xC8, 0x81, 0x78, 0x97, 0xBF, 0x5D, 0xEF, 0xDA, 0x52,
+    0xE9, 0x83, 0x72, 0x6E, 0xB4, 0x48, 0x6D, 0x6B, 0xA1, 0x24, 0x82, 0xA2, 0x0F, 0x0F, 0xC8, 0x84,
+    0xA6, 0x1E, 0x2A, 0x11, 0xE2, 0xE9, 0x2A, 0x42, 0x1E, 0x6A, 0x11, 0x69, 0x3A, 0xEB, 0xD0, 0x21,
+    0x14, 0xF5, 0x88, 0x10, 0xA9, 0x97, 0x68, 0x87, 0x4B, 0x97, 0x88, 0xDB, 0x62, 0xA3, 0x56, 0xC4,
+    0x41, 0xA2, 0x58, 0x60, 0xC4, 0x34, 0x52, 0xBC, 0xB5, 0x24, 0x59, 0x74, 0xAD, 0xD4, 0x92, 0x90,
+    0x6B, 0x20, 0x11, 0x24, 0x7F, 0x5B, 0x6D, 0x38, 0x68, 0xDB, 0x8A, 0x72, 0x0B, 0x2C, 0x8B, 0xE3,
+    0xD5, 0xFB, 0x72, 0x29, 0x86, 0x59, 0xC4, 0x3B, 0x0C, 0x4F, 0x41, 0x4C, 0xD4, 0x11, 0x21, 0x2B,
+    0x8E, 0x4A, 0x16, 0x2A, 0x0B, 0x78, 0x02, 0xB8, 0xC3, 0x71, 0x17, 0x25, 0x24, 0xAA, 0xB4, 0x6D,
+    0xA2, 0xAA, 0x81, 0x80, 0xAA, 0x35, 0x81, 0xF8, 0x0E, 0xDA, 0x62, 0x48, 0x16, 0x79, 0x55, 0xCA,
+    0x54, 0x58, 0x3D, 0xAF, 0x3A, 0xB9, 0xB4, 0x42, 0x8C, 0xA3, 0x49, 0xD6, 0x91, 0xA9, 0x5A, 0xFE,
+    0xE1, 0xDA, 0xB6, 0xC1, 0xE0, 0x35, 0x40, 0xAD, 0xFC, 0x9A, 0x65, 0x82, 0x90, 0xD1, 0x01, 0x26,
+    0x1C, 0x38, 0x60, 0x86, 0x66, 0x89, 0x93, 0xAA, 0x73, 0x6D, 0xA0, 0x5D, 0x4C, 0x63, 0x87, 0xCA,
+    0xC4, 0x26, 0xE6, 0xEE, 0xC1, 0x52, 0x4A, 0x2D, 0x09, 0xA6, 0x73, 0xDF, 0x58, 0xFD, 0xD3, 0xA9,
+    0x90, 0xDB, 0xB6, 0xB8, 0x3E, 0x42, 0x32, 0xA1, 0x75, 0x4D, 0x5B, 0xAB, 0x84, 0x5A, 0x20, 0x08,
+    0x54, 0xEB, 0x43, 0x4B, 0x74, 0x42, 0x72, 0x44, 0x00, 0x3A, 0x18, 0x82, 0x4A, 0x1A, 0xBD, 0xDA,
+    0x52, 0x46, 0x31, 0x38, 0x30, 0x4E, 0x90, 0x0A, 0x87, 0xE0, 0xC2, 0xF5, 0x8C, 0xA0, 0xDB, 0xB7,
+    0x80, 0xB8, 0xC4, 0xBA, 0x25, 0xB0, 0x56, 0x2A, 0xAE, 0x56, 0x76, 0xB8, 0xAD, 0x23, 0x00, 0x01,
+    0xD7, 0x35, 0x6D, 0xC8, 0xCD, 0xAD, 0xDA, 0x36, 0x6E, 0xBD, 0x55, 0xAD, 0x5C, 0xEE, 0x98, 0x25,
+    0x64, 0x96, 0xA9, 0x08, 0x84, 0x4C, 0xA8, 0x2D, 0x9B, 0xE8, 0x30, 0xB1, 0x56, 0x83, 0x4C, 0x11,
+    0x12, 0x52, 0xF6, 0xAD, 0x5B, 0x84, 0x71, 0x81, 0x0A, 0xE9, 0xA5, 0x4B, 0x17, 0x05, 0x0A, 0x6D,
+    0x0C, 0x4C, 0x01, 0x32, 0xE5, 0xC0, 0x81, 0x81, 0x84, 0xF6, 0xEE, 0x1D, 0xE6, 0xA3, 0x5D, 0x22,
+    0x40, 0x6D, 0x62, 0xD0, 0x0A, 0xF3, 0x8C, 0x10, 0x22, 0x7A, 0x61, 0x04, 0x38, 0xA1, 0x23, 0xC7,
+    0xC1, 0x54, 0x14, 0x00, 0xB5, 0x0A, 0xF0, 0x4A, 0x07, 0x10, 0x1D, 0xBE, 0x36, 0xE8, 0x78, 0x65,
+    0xBB, 0x8F, 0x0E, 0x22, 0x01, 0x61, 0x01, 0xB5, 0xBA, 0x57, 0x07, 0x51, 0xBD, 0x2F, 0xF1, 0x14,
+    0x47, 0x3A, 0x78, 0x43, 0x21, 0x60, 0x34, 0x91, 0x22, 0x29, 0x06, 0x8C, 0x86, 0x70, 0x12, 0x66,
+    0xFE, 0xDE, 0xCE, 0x5D, 0x40, 0x38, 0xF1, 0xBC, 0x3A, 0x6F, 0xEB, 0xB4, 0xA5, 0x30, 0xB5, 0x0E,
+    0x01, 0xC1, 0x69, 0x0D, 0xD5, 0x99, 0x2B, 0x8A, 0x8A, 0x97, 0x1E, 0xEF, 0xB8, 0x1C, 0x5C, 0xD9,
+    0x23, 0x97, 0xE0, 0x63, 0xAD, 0x14, 0x91, 0x35, 0xF4, 0x6E, 0xCD, 0x80, 0x5C, 0x64, 0x15, 0xF3,
+    0x18, 0x80, 0xA6, 0x55, 0xB4, 0x22, 0x5F, 0xC8, 0x0A, 0xA3, 0x8A, 0xD8, 0x1F, 0x5D, 0xA3, 0x5D,
+    0x99, 0x80, 0xD5, 0xFA, 0x0E, 0x0B, 0x13, 0x66, 0xCD, 0x56, 0xB2, 0xB4, 0x9B, 0xEC, 0x5D, 0x15,
+    0x65, 0x3B, 0x8A, 0x0D, 0xA3, 0xC4, 0x95, 0x13, 0x4B, 0xB5, 0x87, 0xD7, 0xAA, 0x1C, 0x94, 0xC3,
+    0x70, 0x28, 0x47, 0x2A, 0xDB, 0xAE, 0x2C, 0xF6, 0x6C, 0xB1, 0x61, 0xC3, 0xC9, 0x58, 0xD2, 0x25,
+    0xC2, 0x6D, 0xF2, 0x64, 0x11, 0x80, 0xCB, 0x4E, 0x40, 0x76, 0x6B, 0xA7, 0x52, 0x64, 0x44, 0x82,
+    0x60, 0x6B, 0x56, 0xD6, 0x44, 0xA8, 0x47, 0xD0, 0x0C, 0x1F, 0x55, 0x9B, 0xF6, 0x59, 0xE2, 0x67,
+    0x85, 0x0F, 0x17, 0xEB, 0x79, 0x52, 0xCE, 0x9F, 0x20, 0x25, 0x70, 0x3C, 0x72, 0x12, 0x8C, 0xAB,
+    0xD6, 0x51, 0xA6, 0x0C, 0x95, 0x34, 0xEA, 0x66, 0x2A, 0x2B, 0x96, 0x06, 0x65, 0xA1, 0x5D, 0x74,
+    0xB8, 0x95, 0xA9, 0x9D, 0x8F, 0x66, 0xEE, 0x4C, 0xE2, 0xA0, 0x5E, 0x34, 0x41, 0xDC, 0x72, 0xB5,
+    0x4D, 0x74, 0x41, 0xF1, 0x5C, 0x41, 0xBF, 0xB6, 0x86, 0x0D, 0xE4, 0x06, 0xEF, 0x0B, 0x43, 0xC5,
+    0x92, 0xEC, 0x29, 0x6B, 0x54, 0x54, 0x18, 0x8C, 0xC3, 0xC8, 0x4E, 0xC1, 0xAA, 0x0C, 0x85, 0x28,
+    0x64, 0x57, 0x39, 0xF1, 0x20, 0x71, 0x09, 0xE7, 0x56, 0x83, 0xCF, 0x9A, 0x05, 0x9B, 0xC9, 0x77,
+    0x70, 0xDB, 0x21, 0x9C, 0x9E, 0xD1, 0x94, 0x81, 0xCB, 0x44, 0xB0, 0x7B, 0x25, 0xDA, 0x1C, 0x9B,
+    0x9A, 0x11, 0x9F, 0x56, 0x81, 0xFD, 0x16, 0x03, 0x51, 0x49, 0x33, 0xD6, 0x08, 0xAE, 0x94, 0xD8,
+    0x92, 0x55, 0x0A, 0x6D, 0x56, 0x1B, 0x43, 0x6C, 0x05, 0x04, 0x12, 0x6C, 0x08, 0x0D, 0x61, 0x84,
+    0xC5, 0x50, 0x7C, 0x14, 0x77, 0x76, 0xED, 0xA0, 0x63, 0xC9, 0xF2, 0x25, 0x5B, 0x15, 0x0A, 0x52,
+    0xD9, 0x64, 0x83, 0x72, 0x1D, 0xBB, 0xB5, 0x26, 0x98, 0xD6, 0x14, 0x41, 0x29, 0x2D, 0x1E, 0xA6,
+    0x48, 0xD1, 0xDC, 0x9A, 0x7C, 0x21, 0xB1, 0x6C, 0xAB, 0x12, 0xF1, 0x1E, 0x95, 0x6F, 0x1D, 0x29,
+    0x46, 0x84, 0x43, 0x89, 0x00, 0x44, 0x7F, 0xEB, 0x1A, 0x60, 0x59, 0xC4, 0x1F, 0xA1, 0xC9, 0x5F,
+    0xB2, 0x16, 0xEE, 0x04, 0x46, 0x2B, 0x95, 0x50, 0x3C, 0x7E, 0x8D, 0xDC, 0x01, 0xA9, 0x15, 0x17,
+    0x66, 0x4E, 0x06, 0x55, 0x42, 0xEC, 0x8F, 0x52, 0x22, 0x09, 0x4E, 0xD0, 0xD6, 0x2B, 0x9C, 0x76,
+    0xA7, 0xE3, 0x11, 0x4C, 0xA2, 0xA6, 0x55, 0x84, 0x65, 0xCA, 0x33, 0xC0, 0x8E, 0xE6, 0x5E, 0x82,
+    0x0A, 0x35, 0x48, 0x60, 0xC3, 0x4E, 0xB8, 0x44, 0x5B, 0x5C, 0xEA, 0x81, 0x39, 0x7D, 0xF4, 0x68,
+    0xC5, 0x53, 0xB5, 0x8F, 0xC2, 0x3E, 0x95, 0x77, 0x05, 0xB4, 0xBA, 0xA5, 0x34, 0x6E, 0xAB, 0x50,
+    0x29, 0x34, 0x25, 0x5C, 0x1C, 0xAA, 0x8D, 0x93, 0x6B, 0xFF, 0x72, 0x55, 0x15, 0x20, 0x86, 0x6B,
+    0xD8, 0xB4, 0x47, 0xE8, 0x69, 0x4D, 0xA5, 0xA7, 0xE6, 0x56, 0x81, 0x05, 0xAB, 0x0A, 0x6C, 0xAB,
+    0xC9, 0xAB, 0x42, 0x10, 0xA8, 0xF4, 0xCC, 0xF5, 0xBA, 0x55, 0x58, 0xAF, 0xB8, 0x23, 0x46, 0x60,
+    0xAD, 0xF5, 0x56, 0x98, 0xC2, 0xB4, 0x23, 0x47, 0xCD, 0x35, 0xD1, 0x27, 0x17, 0x09, 0x43, 0xE8,
+    0x6E, 0x4A, 0xD6, 0x44, 0x2F, 0x2D, 0xE4, 0x4D, 0x25, 0xFC, 0x51, 0x2E, 0x38, 0x2B, 0x12, 0x85,
+    0x22, 0xCC, 0x86, 0x18, 0xAA, 0x93, 0x4B, 0xC0, 0x4E, 0x85, 0xAC, 0x16, 0xB8, 0x5D, 0x92, 0xD5,
+    0x1F, 0xAF, 0xA9, 0x42, 0xAE, 0x2D, 0xF0, 0x47, 0xE2, 0x62, 0x5A, 0x22, 0x45, 0x92, 0x40, 0x4D,
+    0xF4, 0xF6, 0xC1, 0x25, 0x07, 0x55, 0x6B, 0x1A, 0x56, 0xB2, 0x95, 0x47, 0xD1, 0x6B, 0xF4, 0x0C,
+    0x05, 0x01, 0xEA, 0xC1, 0xA8, 0x3F, 0x26, 0x58, 0xCA, 0x2A, 0x54, 0xF8, 0xCB, 0x4C, 0xB7, 0x9C,
+    0x4E, 0x62, 0xD4, 0xB2, 0x19, 0x34, 0x41, 0x9F, 0x7A, 0x55, 0x3D, 0xAE, 0xC2, 0x61, 0x74, 0xAB,
+    0xD6, 0x57, 0xEF, 0xAA, 0xDA, 0x5D, 0x52, 0xF8, 0x52, 0x29, 0xC7, 0x6B, 0xDD, 0x38, 0x06, 0xE1,
+    0xAF, 0x00, 0xBD, 0x5A, 0xB9, 0x28, 0xB5, 0x20, 0xE1, 0x76, 0x15, 0x04, 0x7F, 0xCF, 0xFC, 0xD9,
+    0xA0, 0x5C, 0x10, 0x06, 0x2F, 0x42, 0x25, 0x53, 0x21, 0xFC, 0x0B, 0xC4, 0x90, 0xD6, 0x59, 0x45,
+    0x80, 0x02, 0x7A, 0x77, 0x57, 0x60, 0x90, 0x56, 0x86, 0x10, 0x69, 0x1D, 0x2C, 0x90, 0x89, 0xA1,
+    0xB9, 0x90, 0xEB, 0x5C, 0xE2, 0xBB, 0x2A, 0x51, 0x0A, 0xB6, 0x0A, 0x79, 0xB4, 0x3D, 0x54, 0xAF,
+    0xDE, 0xDC, 0x7C, 0x4E, 0x04, 0x5C, 0x32, 0x34, 0xF7, 0xE2, 0xB1, 0x78, 0x31, 0x28, 0xA8, 0xFD,
+    0x65, 0x81, 0x6B, 0xA8, 0x55, 0xAB, 0x10, 0xB7, 0x6A, 0x45, 0x45, 0x61, 0xBC, 0xB7, 0xAD, 0x6E,
+    0xDD, 0x7A, 0x46, 0x41, 0xE6, 0x9A, 0x53, 0x16, 0xD2, 0xB2, 0x64, 0xD9, 0x2A, 0x22, 0xCA, 0xBA,
+    0x36, 0xFD, 0xF9, 0xFC, 0xF5, 0x75, 0x2D, 0x57, 0x7F, 0xFE, 0x10, 0x37, 0x58, 0x92, 0x18, 0x62,
+    0x5B, 0x96, 0x72, 0x11, 0x1F, 0xE5, 0xC2, 0x05, 0x99, 0x65, 0xC4, 0x3A, 0x8B, 0x69, 0x46, 0xC8,
+    0x67, 0xB1, 0xCA, 0x9D, 0x31, 0x3E, 0x20, 0xCB, 0x35, 0xB7, 0x6B, 0xD6, 0xA3, 0xF7, 0x16, 0xB7,
+    0xD9, 0x8A, 0x98, 0x50, 0x18, 0xC3, 0x61, 0x66, 0x2A, 0x52, 0xE9, 0x65, 0x54, 0x90, 0x1E, 0x83,
+    0x84, 0xFA, 0x43, 0xB3, 0x06, 0x33, 0xAD, 0x5C, 0x13, 0x14, 0xF5, 0x40, 0x9C, 0x0B, 0x84, 0x83,
+    0xC2, 0x81, 0xE4, 0x6A, 0x75, 0x3B, 0x79, 0x90, 0x61, 0x2E, 0x74, 0xB3, 0x72, 0x55, 0x8B, 0xB8,
+    0x6D, 0x31, 0x9B, 0x41, 0x16, 0x48, 0x36, 0x1C, 0x97, 0x50, 0x98, 0xA0, 0x36, 0x7F, 0xF9, 0xE4,
+    0x52, 0xD6, 0xDF, 0x5C, 0xAD, 0x84, 0x6C, 0x82, 0xD8, 0xD1, 0x66, 0x67, 0x2B, 0x72, 0xC8, 0x7A,
+    0xB4, 0x6A, 0x58, 0xB7, 0x68, 0xDE, 0x55, 0x14, 0xE7, 0xCE, 0x6D, 0xF5, 0x95, 0x60, 0x1D, 0xA6,
+    0x63, 0x6D, 0x42, 0x64, 0x3A, 0xD9, 0xC3, 0x97, 0xB6, 0x5C, 0x27, 0x74, 0x3B, 0x78, 0x30, 0xF1,
+    0x15, 0x3A, 0x76, 0x2F, 0x29, 0x43, 0xBC, 0xC8, 0x01, 0xE2, 0xB9, 0xC8, 0x3A, 0x21, 0xA8, 0xC7,
+    0xAD, 0x95, 0x5C, 0xCB, 0xF5, 0x28, 0xD0, 0x7A, 0x56, 0xA2, 0x1B, 0x41, 0xB5, 0x9A, 0x11, 0x23,
+    0x76, 0xE9, 0x68, 0xF2, 0x20, 0x42, 0x25, 0x94, 0x22, 0x1E, 0x54, 0xC7, 0xED, 0x64, 0xC4, 0x89,
+    0x20, 0x26, 0x69, 0xBB, 0x38, 0x10, 0x39, 0x2E, 0x5A, 0xC3, 0xA0, 0xE2, 0x72, 0x76, 0x66, 0xAE,
+    0x51, 0x5F, 0x16, 0x15, 0x2D, 0xC1, 0xF4, 0xE4, 0x4C, 0xB4, 0xBC, 0x72, 0xA1, 0xD1, 0x0C, 0x31,
+    0x72, 0x82, 0x03, 0x84, 0x10, 0x23, 0x1E, 0xC5, 0x8A, 0xDE, 0xA5, 0x09, 0x28, 0x30, 0xCF, 0xCD,
+    0xB9, 0xAB, 0x6B, 0x5B, 0xAD, 0x0F, 0x08, 0x71, 0xA9, 0xA7, 0x2E, 0x51, 0x62, 0xCA, 0x64, 0x4B,
+    0xF4, 0xB0, 0xCA, 0x75, 0xF2, 0x5C, 0x42, 0x64, 0x0D, 0x23, 0xEE, 0x51, 0x88, 0x50, 0x98, 0x30,
+    0x68, 0x26, 0xEE, 0x9C, 0x48, 0xA8, 0x52, 0x34, 0x0C, 0xC5, 0x10, 0x13, 0xCA, 0x95, 0x93, 0xD0,
+    0x5B, 0xAB, 0x07, 0x41, 0xD6, 0x69, 0x0B, 0x68, 0x20, 0xA1, 0x9D, 0x5E, 0xFB, 0x21, 0x92, 0x9C,
+    0x18, 0x73, 0xAE, 0x9D, 0xE4, 0x40, 0x06, 0x6A, 0xA8, 0x6E, 0x6E, 0x3E, 0x42, 0x4E, 0xAD, 0x96,
+    0x18, 0x14, 0x2A, 0x17, 0x04, 0x90, 0x0D, 0x25, 0xB7, 0xAA, 0x61, 0x36, 0x6A, 0x23, 0x83, 0x5A,
+    0x0D, 0x6E, 0x9A, 0xAB, 0x72, 0xD1, 0x5A, 0x16, 0x91, 0x99, 0xA6, 0x1A, 0x18, 0x78, 0xED, 0x03,
+    0x05, 0x6B, 0x27, 0x44, 0x5D, 0x8C, 0x48, 0xE0, 0x90, 0xAC, 0x6D, 0xD6, 0x22, 0x6E, 0xB1, 0xF6,
+    0x28, 0xA2, 0x16, 0x8C, 0xBC, 0x96, 0xE0, 0x54, 0x03, 0xEB, 0x8E, 0x4E, 0x97, 0x24, 0x93, 0xCD,
+    0xB9, 0x46, 0x14, 0x12, 0xC9, 0x67, 0xB1, 0x46, 0x45, 0x3B, 0xD7, 0x91, 0xC1, 0xB5, 0x6B, 0x8F,
+    0x8A, 0x98, 0x6B, 0x74, 0x88, 0xA3, 0x58, 0x5A, 0xB3, 0x8A, 0x6A, 0x41, 0x18, 0x14, 0xA8, 0x5B,
+    0x25, 0x6C, 0xC4, 0xDA, 0x5B, 0x43, 0xA0, 0x41, 0x24, 0x7B, 0x6F, 0x0D, 0x6C, 0x95, 0x82, 0x25,
+    0x17, 0x80, 0x29, 0xF4, 0xF8, 0xA3, 0xB3, 0xF2, 0x8A, 0x4B, 0x65, 0x08, 0x05, 0x2F, 0xA6, 0x75,
+    0x6B, 0xC2, 0xA2, 0x45, 0x83, 0x0F, 0xD8, 0x8C, 0xA4, 0x47, 0xE9, 0xCD, 0x45, 0x43, 0xDA, 0xBA,
+    0x5C, 0x84, 0x30, 0x91, 0x3E, 0x25, 0xAD, 0x1C, 0x77, 0x00, 0x72, 0x43, 0xEA, 0x22, 0x4A, 0x8B,
+    0x16, 0x2F, 0x56, 0x45, 0x6F, 0xAE, 0x89, 0x2F, 0xC2, 0x16, 0x4F, 0x4D, 0x42, 0x08, 0x91, 0x01,
+    0x9D, 0x84, 0x08, 0x12, 0xE6, 0x89, 0x16, 0x32, 0x5D, 0x3E, 0x73, 0xBC, 0x72, 0x70, 0xE0, 0xC0,
+    0x50, 0xDB, 0x23, 0x25, 0x57, 0xE6, 0x08, 0xB2, 0x78, 0x9A, 0x09, 0x34, 0xAD, 0x06, 0x32, 0x53,
+    0x70, 0xD4, 0x26, 0x97, 0x0D, 0x0C, 0xA6, 0xE4, 0x98, 0x1C, 0x84, 0x16, 0x5F, 0x73, 0x5C, 0xCE,
+    0x50, 0x29, 0xF4, 0x85, 0x0A, 0xCB, 0x61, 0xFB, 0x8A, 0x1A, 0x32, 0x78, 0x8B, 0xD9, 0x83, 0x5E,
+    0x6D, 0x10, 0x9A, 0x70, 0xBB, 0x96, 0xAB, 0x03, 0x83, 0xA4, 0x80, 0x78, 0x55, 0x94, 0x90, 0x67,
+    0xC5, 0x29, 0xA1, 0x16, 0x2B, 0x25, 0x94, 0x63, 0xCE, 0x86, 0xC4, 0x9C, 0x4C, 0x39, 0x20, 0xC9,
+    0xE3, 0xF0, 0x06, 0x2E, 0x76, 0x99, 0xB6, 0x6B, 0x85, 0xCA, 0xD1, 0x1A, 0x43, 0x72, 0x94, 0x6E,
+    0x45, 0x5C, 0x42, 0x27, 0xCB, 0xC5, 0x9A, 0xBD, 0x9E, 0x4C, 0xBA, 0x21, 0x6D, 0x98, 0x4F, 0x5F,
+    0x50, 0x84, 0x02, 0x63, 0x97, 0x1D, 0x40, 0xAF, 0x86, 0xF8, 0x99, 0xAA, 0xEC, 0xC0, 0x81, 0x03,
+    0x31, 0x3F, 0xD5, 0xCC, 0x35, 0xD4, 0x03, 0x8D, 0x89, 0xC3, 0x05, 0x47, 0x2A, 0xCE, 0x45, 0x81,
+    0xD0, 0x2C, 0x9D, 0x91, 0xB8, 0x00, 0x46, 0xB3, 0x09, 0x20, 0xC0, 0x48, 0x2E, 0xD6, 0xD0, 0xDD,
+    0x60, 0x99, 0x02, 0xDF, 0x81, 0x50, 0x7B, 0xED, 0xF0, 0xAA, 0xD1, 0x50, 0xD9, 0x07, 0x3C, 0xBB,
+    0x72, 0xD5, 0x67, 0x38, 0x2C, 0x9F, 0xB6, 0x8B, 0xEB, 0xBE, 0xC8, 0x95, 0xF5, 0x48, 0x4D, 0x42,
+    0x89, 0x00, 0x85, 0x2D, 0x46, 0x85, 0x85, 0x63, 0x7B, 0x58, 0x16, 0x03, 0x1A, 0xB8, 0xE7, 0xA0,
+    0x32, 0x80, 0x68, 0x44, 0xB1, 0xC4, 0x65, 0xB7, 0x4E, 0xD0, 0xBA, 0x28, 0xC2, 0x58, 0xD1, 0x78,
+    0xF8, 0x0C, 0x38, 0x80, 0x5E, 0x6B, 0xDC, 0xA2, 0x97, 0xA4, 0x95, 0x03, 0xC9, 0x29, 0x48, 0x9A,
+    0x58, 0x1C, 0xF0, 0xD6, 0x29, 0x43, 0x15, 0x5A, 0x05, 0x72, 0x10, 0x44, 0x46, 0x5A, 0x7A, 0x18,
+    0x1C, 0xD7, 0xBB, 0x87, 0x64, 0xEE, 0xB2, 0xA6, 0x7C, 0x49, 0xB6, 0x69, 0xCB, 0x07, 0x04, 0x27,
+    0x1A, 0xFA, 0xF6, 0x12, 0x6A, 0x93, 0x13, 0xD7, 0x86, 0x5C, 0xDD, 0x7A, 0xD6, 0x18, 0xD2, 0x53,
+    0x95, 0x12, 0x58, 0x5E, 0x29, 0x20, 0x23, 0xC9, 0x23, 0xD6, 0x0E, 0x21, 0x5C, 0x0C, 0x31, 0x13,
+    0xA5, 0x03, 0x11, 0x10, 0x40, 0x3C, 0x53, 0xE5, 0xF5, 0x9A, 0x8B, 0x65, 0x5E, 0x7F, 0xEE, 0xFC,
+    0xB9, 0xFB, 0xE2, 0x28, 0x57, 0xAE, 0xB4, 0x14, 0x78, 0x70, 0x64, 0x7C, 0x06, 0xE0, 0xAB, 0x0A,
+    0x8A, 0x4D, 0xB1, 0x3C, 0x25, 0x6A, 0x6E, 0x5D, 0x3A, 0x86, 0x7F, 0x16, 0x05, 0x87, 0x82, 0x50,
+    0x5B, 0x7F, 0x44, 0x1D, 0x2B, 0xA6, 0x82, 0x53, 0x31, 0x40, 0xC9, 0x44, 0x73, 0xE5, 0x32, 0x04,
+    0xF5, 0xED, 0x5C, 0x53, 0xB7, 0x06, 0xBE, 0x3A, 0x05, 0xB0, 0x6E, 0x62, 0x84, 0xAF, 0x1E, 0x28,
+    0xB9, 0xDC, 0xCA, 0x66, 0xAF, 0xB7, 0x75, 0x25, 0xCF, 0x45, 0x16, 0x84, 0x8A, 0xCA, 0xC2, 0x2A,
+    0xCD, 0xD5, 0x59, 0xC5, 0x75, 0x32, 0xB7, 0x1B, 0x83, 0x01, 0x06, 0x76, 0x80, 0x20, 0xEB, 0xC8,
+    0x4A, 0x14, 0xAF, 0x38, 0xB0, 0xE1, 0xB6, 0x30, 0xB2, 0x9F, 0x7C, 0x0C, 0xB4, 0xFA, 0xE2, 0x68,
+    0xDF, 0x33, 0x1A, 0x82, 0x15, 0x9B, 0xC8, 0x79, 0xB4, 0x95, 0xD6, 0x9C, 0x7A, 0x94, 0x4E, 0xDE,
+    0x50, 0x57, 0xF1, 0xAC, 0xC7, 0x07, 0x52, 0x5D, 0x91, 0x82, 0xB0, 0x0E, 0x2C, 0xAE, 0x5C, 0x60,
+    0x61, 0x58, 0xD4, 0xAA, 0x6E, 0x2E, 0x47, 0xFE, 0x6C, 0x1C, 0x18, 0x3C, 0x8B, 0xF2, 0xA2, 0x37,
+    0x7D, 0x3A, 0x76, 0x0C, 0xFA, 0x80, 0x62, 0xB2, 0x3D, 0x64, 0x29, 0xF3, 0x31, 0x94, 0x37, 0x46,
+    0xAB, 0xAF, 0x5C, 0xD4, 0x2D, 0x40, 0x33, 0x36, 0x4C, 0xD0, 0x83, 0x85, 0x34, 0x3C, 0x0E, 0x8A,
+    0xAC, 0xE3, 0x95, 0xBD, 0x95, 0x0E, 0x3D, 0xEB, 0xD8, 0x51, 0x9D, 0x56, 0x58, 0x87, 0x3E, 0x51,
+    0xF8, 0xE3, 0x92, 0x32, 0x57, 0x75, 0x4D, 0xC1, 0xB5, 0xD2, 0x1C, 0x04, 0xDC, 0xD1, 0x53, 0xC8,
+    0x6C, 0x36, 0xD2, 0x6A, 0xE6, 0x70, 0x23, 0xB9, 0x84, 0x3C, 0x28, 0x3E, 0x5B, 0x57, 0xCF, 0xDC,
+    0x3A, 0x53, 0x21, 0x5A, 0xB5, 0x7A, 0x70, 0xDA, 0xE4, 0xA5, 0xE3, 0xB6, 0x10, 0x72, 0xF9, 0xA2,
+    0x9E, 0xE1, 0x91, 0x7A, 0x10, 0x13, 0xBA, 0x62, 0x17, 0xE2, 0x0E, 0x45, 0x39, 0xAB, 0xF4, 0xB4,
+    0xD1, 0xE8, 0xAE, 0x01, 0x45, 0x5C, 0x10, 0xFB, 0x9B, 0x8C, 0x42, 0xCF, 0xDD, 0x55, 0x5A, 0xB9,
+    0x7C, 0x55, 0x49, 0x61, 0x31, 0x42, 0x5A, 0x8B, 0x4F, 0x7E, 0x51, 0xCB, 0x05, 0xAA, 0x61, 0x1D,
+    0x29, 0x58, 0x26, 0xE6, 0x6A, 0x99, 0x11, 0x02, 0x84, 0xCF, 0x5C, 0x62, 0x0E, 0xB5, 0x08, 0xE2,
+    0x9C, 0xAF, 0x89, 0x16, 0xA3, 0x48, 0x73, 0x00, 0x52, 0x28, 0x3E, 0x31, 0xFE, 0x94, 0x11, 0x9A,
+    0xA8, 0x13, 0xA2, 0x84, 0x5E, 0x7A, 0x95, 0x6D, 0xC0, 0x95, 0xCB, 0x98, 0x23, 0x13, 0x8F, 0xBA,
+    0x5D, 0xF5, 0xF5, 0x11, 0x59, 0x2F, 0x44, 0x94, 0xDA, 0x3C, 0xD4, 0x35, 0x10, 0x24, 0xC4, 0x86,
+    0x1E, 0x99, 0x48, 0x66, 0x38, 0x57, 0x89, 0x83, 0x2E, 0x13, 0x28, 0xF5, 0xFA, 0x87, 0x60, 0x99,
+    0xB1, 0x45, 0x97, 0x7E, 0xD5, 0xA3, 0x95, 0x4B, 0xD2, 0x9D, 0x4B, 0x46, 0x71, 0x59, 0xC4, 0x07,
+    0x71, 0x5A, 0x46, 0x58, 0x08, 0x91, 0x85, 0x48, 0x99, 0x44, 0x93, 0x56, 0xB9, 0x60, 0xA1, 0x48,
+    0x78, 0xD2, 0x9F, 0xBF, 0xC8, 0xFE, 0xA6, 0x02, 0xE4, 0xDA, 0xB2, 0xAA, 0x3F, 0xA1, 0x53, 0xC1,
+    0x50, 0x6D, 0x00, 0xF9, 0xC2, 0x1B, 0x1B, 0xBC, 0x6A, 0xF9, 0x13, 0xEC, 0x00, 0x06, 0xAD, 0x64,
+    0xFE, 0x06, 0x1A, 0xA5, 0xEC, 0xA6, 0xB2, 0xD6, 0xC9, 0x61, 0x61, 0x29, 0xB2, 0x82, 0x91, 0xD9,
+    0x5C, 0xCA, 0x54, 0x72, 0x91, 0x7D, 0x6B, 0xD2, 0x1F, 0xD9, 0xAE, 0x86, 0x2E, 0x71, 0xBD, 0x98,
+    0x8C, 0x90, 0x92, 0x13, 0x41, 0x98, 0x29, 0xA3, 0xFB, 0x55, 0x81, 0xCD, 0x83, 0x0F, 0xFE, 0x94,
+    0x91, 0x91, 0xAC, 0x2A, 0x97, 0xAA, 0x4B, 0xCF, 0x28, 0xFB, 0xFA, 0x8A, 0xF2, 0x03, 0xBB, 0x6E,
+    0x8B, 0xA6, 0x41, 0x6C, 0xB7, 0x04, 0x08, 0x1D, 0x5B, 0xE9, 0x52, 0x26, 0xBB, 0xB2, 0x6A, 0x99,
+    0xB2, 0x6F, 0x15, 0xB5, 0x85, 0xCC, 0x2D, 0x01, 0x9A, 0x77, 0x8A, 0x0D, 0xC5, 0x48, 0x28, 0xD3,
+    0xEE, 0x56, 0x1B, 0x5A, 0x27, 0x0A, 0xE5, 0x62, 0x97, 0x44, 0x98, 0x8A, 0x7C, 0xF0, 0x12, 0xE5,
+    0x9A, 0xD3, 0x30, 0x65, 0xA1, 0x80, 0x2E, 0x38, 0xC0, 0x42, 0xA3, 0x55, 0xCF, 0xB4, 0x5A, 0x29,
+    0xAF, 0x7A, 0x04, 0x30, 0x18, 0xE2, 0x5C, 0xD1, 0xEE, 0xBD, 0x42, 0x56, 0x96, 0x32, 0xA1, 0x92,
+    0x3B, 0xA9, 0xE4, 0x6A, 0xD0, 0xF6, 0x23, 0xB4, 0xB5, 0x01, 0x05, 0x71, 0x25, 0x34, 0x72, 0x2C,
+    0xC3, 0xB2, 0x3B, 0x05, 0xFE, 0xD5, 0x8C, 0xB8, 0x64, 0xC7, 0x59, 0x73, 0xA9, 0xC4, 0x82, 0x91,
+    0xD9, 0x90, 0x43, 0x10, 0x18, 0xC7, 0x06, 0xEA, 0x73, 0x59, 0x6B, 0x40, 0xBB, 0x39, 0x56, 0x06,
+    0xD2, 0x0A, 0xD2, 0xD0, 0xA1, 0x3F, 0x7B, 0x65, 0x7C, 0x45, 0xE4, 0x60, 0x47, 0x5B, 0x72, 0x3B,
+    0xDB, 0x92, 0x24, 0x4B, 0x48, 0x02, 0xC0, 0x53, 0xFD, 0xCE, 0x5E, 0xF6, 0x47, 0x6F, 0xED, 0xB3,
+    0x55, 0x5F, 0x2F, 0x87, 0x92, 0x4B, 0x76, 0x15, 0x57, 0x10, 0x88, 0x72, 0x81, 0x78, 0x7B, 0xA1,
+    0x21, 0x57, 0xCC, 0x97, 0x7B, 0xB5, 0xEA, 0x71, 0x6A, 0xD5, 0x2B, 0x9B, 0x8D, 0xE6, 0xEA, 0x51,
+    0xCC, 0x55, 0x4C, 0x5D, 0x42, 0x53, 0x43, 0x11, 0x82, 0x58, 0xD5, 0xAE, 0x9E, 0x17, 0xF5, 0x46,
+    0x82, 0x99, 0x06, 0x91, 0x32, 0xAF, 0x2B, 0x88, 0xAD, 0x56, 0x59, 0x6C, 0x78, 0x9C, 0x4B, 0xAE,
+    0x5F, 0xBE, 0x72, 0x79, 0x65, 0x59, 0xA5, 0x56, 0xC4, 0x89, 0x15, 0x23, 0xE0, 0x92, 0xE2, 0x64,
+    0xDB, 0x45, 0x3A, 0x12, 0x4C, 0x4C, 0xD4, 0xC9, 0x21, 0x91, 0x39, 0x81, 0xC6, 0x94, 0x3D, 0xD4,
+    0x0B, 0x12, 0x22, 0xA5, 0x65, 0xBC, 0x3E, 0x1A, 0xAB, 0x75, 0xA7, 0x50, 0x42, 0x45, 0x09, 0x91,
+    0xA5, 0xF5, 0x96, 0xAC, 0x3F, 0x2B, 0x30, 0x4C, 0xBA, 0x59, 0x59, 0x35, 0x59, 0xCB, 0x06, 0x28,
+    0x84, 0xD6, 0x4A, 0x48, 0x59, 0xF0, 0xD4, 0x5C, 0x90, 0x27, 0x5F, 0xEA, 0x6A, 0x28, 0xD9, 0xA9,
+    0xA2, 0xCA, 0x08, 0xD9, 0x0D, 0x64, 0xB3, 0x89, 0x92, 0x07, 0x5C, 0xCF, 0x40, 0xFE, 0x13, 0x24,
+    0xD7, 0x03, 0x66, 0x74, 0x15, 0x71, 0xA9, 0x68, 0x18, 0x8B, 0x8D, 0x30, 0x20, 0x5A, 0xB5, 0x35,
+    0x24, 0xE1, 0x5E, 0xB0, 0x55, 0x6F, 0x7B, 0x42, 0xFB, 0xF8, 0x35, 0x56, 0xC9, 0xBF, 0x87, 0x00,
+    0x0A, 0xFC, 0x83, 0xE8, 0xF2, 0x96, 0xAF, 0x60, 0xB6, 0x28, 0xDC, 0xE2, 0x8F, 0x82, 0xBE, 0xAE,
+    0x84, 0xC1, 0xBC, 0x7D, 0x5B, 0x70, 0xEB, 0x9A, 0xCC, 0x40, 0x4B, 0xF8, 0xBB, 0xFA, 0x76, 0x15,
+    0xD0, 0x5C, 0x6B, 0xA8, 0x52, 0x05, 0x43, 0x55, 0x4E, 0xAF, 0x5E, 0x5C, 0x54, 0x4E, 0x41, 0xB3,
+    0xD8, 0xD1, 0x30, 0x34, 0xCC, 0xC0, 0x18, 0x48, 0x53, 0xF4, 0x11, 0x17, 0x95, 0x69, 0x09, 0x63,
+    0x4E, 0x23, 0x79, 0x2E, 0xE2, 0x01, 0x53, 0x4E, 0xB9, 0xB4, 0x59, 0xEF, 0x57, 0x2D, 0x03, 0x53,
+    0x5A, 0x89, 0xA8, 0xEA, 0x80, 0xD0, 0xDF, 0x13, 0xB5, 0x08, 0x3D, 0x42, 0x46, 0xB8, 0x57, 0x3D,
+    0x42, 0x84, 0x74, 0xA9, 0x45, 0x16, 0x30, 0x47, 0x31, 0xB5, 0x72, 0xE5, 0x5E, 0x31, 0x10, 0x46,
+    0x2D, 0x9A, 0x80, 0x7A, 0xC3, 0xD0, 0x6A, 0xBB, 0x38, 0xC8, 0xD8, 0x80, 0x6D, 0xB9, 0x4E, 0x5C,
+    0xB8, 0x30, 0xE0, 0x9F, 0x9E, 0x5C, 0xDB, 0xAA, 0x0D, 0x08, 0x70, 0x6E, 0x99, 0x44, 0x41, 0xE9,
+    0x6A, 0xA5, 0x52, 0xF2, 0x4A, 0xC9, 0x57, 0xAB, 0xCA, 0x94, 0x0B, 0x08, 0x62, 0xAE, 0x99, 0xB6,
+    0x27, 0xAE, 0x5E, 0xD1, 0x63, 0xC2, 0x84, 0x0D, 0x2E, 0x5B, 0x19, 0xB4, 0x2D, 0xD5, 0xB6, 0x1E,
+    0xAD, 0x5A, 0x88, 0x11, 0x6A, 0xFD, 0xDA, 0x55, 0xAB, 0xD6, 0x4B, 0x02, 0x03, 0x05, 0xF2, 0x3A,
+    0x52, 0xCF, 0xA1, 0x20, 0x36, 0xAC, 0xF4, 0x18, 0x69, 0x62, 0xB1, 0xA1, 0xB2, 0x26, 0xEC, 0x51,
+    0x9E, 0x1A, 0x68, 0x4F, 0x9D, 0x3A, 0x72, 0x0A, 0xDC, 0x6B, 0xFB, 0x6A, 0x4F, 0x81, 0x59, 0xF3,
+    0x04, 0x16, 0xA0, 0xD2, 0x36, 0x50, 0xD9, 0x1E, 0x6B, 0x53, 0xA5, 0xB2, 0x34, 0xAC, 0xB0, 0xBF,
+    0x33, 0x67, 0xCE, 0x10, 0x21, 0x22, 0xE5, 0xE5, 0x45, 0x6A, 0xD4, 0x94, 0xAC, 0x4A, 0x3A, 0xB9,
+    0x8C, 0x08, 0x3A, 0x76, 0x0D, 0xD4, 0x6B, 0x6B, 0x13, 0x61, 0x21, 0x47, 0x83, 0x52, 0xA4, 0xE2,
+    0x45, 0x28, 0x28, 0x3B, 0x5C, 0xE5, 0x0E, 0xC1, 0x03, 0x8C, 0x8B, 0x50, 0xAA, 0x41, 0x72, 0x9F,
+    0xF9, 0x91, 0xD2, 0xB6, 0x08, 0xDB, 0x1C, 0x37, 0x09, 0xDA, 0x35, 0xB1, 0x63, 0x87, 0x9E, 0x32,
+    0x88, 0xDF, 0x81, 0xDB, 0x61, 0x78, 0x04, 0xAD, 0xC3, 0x72, 0xA3, 0xC6, 0xBA, 0x85, 0x58, 0xDC,
+    0x51, 0x29, 0x68, 0x91, 0xA6, 0x21, 0xFB, 0x8A, 0xCE, 0x4A, 0x59, 0xF9, 0x16, 0x39, 0x72, 0x10,
+    0xE4, 0x8D, 0x55, 0xB2, 0xFA, 0x64, 0x14, 0xE1, 0x96, 0xD4, 0x91, 0x0C, 0x51, 0xAF, 0x44, 0xC9,
+    0x78, 0x75, 0x55, 0xD4, 0xAB, 0x57, 0x32, 0x0A, 0xAC, 0xBC, 0x99, 0x54, 0x14, 0x38, 0xC4, 0x3B,
+    0xC4, 0x0D, 0xE4, 0x96, 0x34, 0xE9, 0xAD, 0xB9, 0x73, 0x09, 0xDB, 0xCC, 0xD9, 0x36, 0xA7, 0x4D,
+    0xC2, 0x84, 0x29, 0xB6, 0x55, 0x45, 0xE8, 0x60, 0x26, 0x0D, 0x62, 0x28, 0xFC, 0x01, 0x64, 0x02,
+    0xA2, 0xD7, 0x8A, 0x8A, 0xE9, 0x26, 0x01, 0x33, 0xF1, 0x8B, 0x07, 0xAC, 0x21, 0xD0, 0x20, 0x96,
+    0xC3, 0xC5, 0xCA, 0x15, 0x79, 0xF0, 0x0C, 0x55, 0x89, 0x2C, 0x77, 0x1A, 0x81, 0x4C, 0x0C, 0xCD,
+    0xCC, 0xB5, 0xBA, 0xD6, 0x5F, 0x3D, 0x80, 0x5A, 0xB5, 0x5A, 0xC9, 0xB4, 0xE8, 0xA7, 0xCA, 0xC4,
+    0x83, 0xBF, 0xAA, 0xAC, 0xAA, 0x98, 0xC8, 0x0E, 0x2B, 0x06, 0x28, 0x20, 0x34, 0xBA, 0x20, 0xCD,
+    0xCF, 0xC9, 0x56, 0x10, 0x73, 0xD3, 0x37, 0x99, 0x0B, 0x3C, 0xC3, 0x5C, 0x35, 0xCB, 0x2B, 0xB4,
+    0x12, 0xB1, 0x82, 0x68, 0x08, 0xF9, 0x5C, 0x32, 0xE1, 0x96, 0xAC, 0xDA, 0x5B, 0x47, 0x24, 0xE5,
+    0x5A, 0x64, 0x2E, 0x2D, 0x3C, 0x4F, 0x6D, 0xD9, 0xC4, 0x11, 0x73, 0xC4, 0x04, 0x22, 0xB1, 0x62,
+    0xA5, 0x0C, 0xC0, 0x63, 0x6F, 0xDB, 0xE4, 0x36, 0x25, 0x8E, 0x22, 0xB6, 0x51, 0xEC, 0xAB, 0x8D,
+    0xAF, 0xC0, 0x80, 0x11, 0xFA, 0x1A, 0xEE, 0xD3, 0x46, 0xBD, 0xFE, 0xAE, 0x21, 0x23, 0xA7, 0x6B,
+    0x2A, 0x05, 0xAB, 0x53, 0xC7, 0x22, 0x5A, 0x24, 0x17, 0x0F, 0x0E, 0x59, 0x25, 0x93, 0x16, 0x7B,
+    0xA1, 0x12, 0xA0, 0x8F, 0x47, 0x34, 0xC6, 0x82, 0x85, 0x1A, 0xAF, 0x44, 0xB6, 0x7E, 0x48, 0xA0,
+    0x7E, 0xBB, 0x56, 0x0F, 0x4D, 0xAF, 0x56, 0xAF, 0x06, 0xDB, 0x48, 0x04, 0x6B, 0x66, 0x3D, 0x08,
+    0xBC, 0xEC, 0xAD, 0x12, 0xE5, 0x62, 0x87, 0xD1, 0x6C, 0x8B, 0xA8, 0x95, 0x62, 0x9B, 0x16, 0xA2,
+    0x4A, 0x18, 0x5C, 0xB8, 0x38, 0xB2, 0x12, 0x70, 0xEA, 0x91, 0x7A, 0x6F, 0x28, 0x17, 0xC1, 0x5A,
+    0x8C, 0x9B, 0x63, 0x13, 0x33, 0x7A, 0xB1, 0x0B, 0x32, 0x20, 0xEC, 0x35, 0x97, 0x31, 0xAB, 0xD9,
+    0x4D, 0x4C, 0xD1, 0x09, 0x47, 0xA6, 0x6B, 0x0D, 0x55, 0x45, 0x34, 0xB7, 0x90, 0x12, 0x07, 0x21,
+    0xB8, 0x70, 0xE5, 0x96, 0x2C, 0x2A, 0x51, 0xA7, 0x09, 0x00, 0xE6, 0x8A, 0xDA, 0x32, 0x68, 0x4E,
+    0xC8, 0x62, 0xDA, 0x52, 0x88, 0x45, 0xA8, 0xDE, 0xD7, 0x30, 0xB9, 0x24, 0xB0, 0x0B, 0x91, 0xEB,
+    0x0D, 0xBC, 0x15, 0x10, 0x0E, 0x71, 0x09, 0xFA, 0x4C, 0xAB, 0xE3, 0x5C, 0x88, 0xDE, 0xE6, 0x42,
+    0x6C, 0xF6, 0xC6, 0x2C, 0xA5, 0xF4, 0xB8, 0xAD, 0x88, 0x65, 0xA3, 0x8D, 0x57, 0xA2, 0x54, 0x10,
+    0x23, 0x2A, 0xC9, 0xC7, 0x46, 0xC6, 0xAE, 0x3B, 0xAF, 0xBC, 0x2D, 0xC9, 0x78, 0xC7, 0x27, 0x72,
+    0x4F, 0x5F, 0x39, 0x88, 0x0B, 0x29, 0x45, 0xDB, 0x47, 0xA5, 0x5E, 0x7D, 0x7C, 0x8A, 0xC6, 0x9F,
+    0x0D, 0x09, 0x67, 0xAF, 0x61, 0xD5, 0xCB, 0x15, 0x42, 0x58, 0x50, 0xA5, 0xD2, 0xE6, 0x1A, 0x74,
+    0xB7, 0x17, 0x42, 0xBD, 0xBA, 0xB8, 0xDD, 0x25, 0x01, 0x10, 0x2B, 0x1B, 0xBD, 0xB3, 0xD8, 0x4C,
+    0x46, 0x04, 0x0E, 0x05, 0xA1, 0x30, 0x28, 0x92, 0x81, 0x43, 0x8C, 0x58, 0x8C, 0x21, 0x22, 0x88,
+    0xC7, 0xFE, 0x34, 0xDC, 0x88, 0xEB, 0x5C, 0x0F, 0x6B, 0xE7, 0x9E, 0xD0, 0xAA, 0xB5, 0xD1, 0xDC,
+    0xB9, 0x61, 0x1D, 0x35, 0x02, 0x8B, 0x12, 0x25, 0xCA, 0x46, 0x2C, 0x81, 0xBA, 0x64, 0x69, 0x14,
+    0x68, 0xBF, 0x7E, 0x6B, 0xFA, 0x18, 0x65, 0x41, 0x73, 0x6B, 0x56, 0xC5, 0x3D, 0x58, 0x94, 0x6C,
+    0x4B, 0xA5, 0xDD, 0x4F, 0x2A, 0x08, 0x58, 0xCC, 0xA9, 0x82, 0xC0, 0x41, 0xAE, 0xC4, 0x86, 0x32,
+    0xD0, 0x5A, 0xCC, 0xB7, 0x09, 0x05, 0xAE, 0x62, 0x58, 0x6C, 0xCD, 0x65, 0x10, 0x9E, 0x56, 0x4F,
+    0x5C, 0xF6, 0x62, 0x69, 0x75, 0x72, 0x2E, 0xAA, 0xA4, 0x73, 0xAB, 0x52, 0x38, 0xD6, 0xCD, 0x11,
+    0xA0, 0x96, 0x97, 0x1E, 0x44, 0x23, 0xD2, 0x23, 0x81, 0x87, 0xB6, 0x38, 0x33, 0x68, 0xC0, 0xA5,
+    0xC3, 0xEC, 0xDA, 0x13, 0x40, 0x78, 0x04, 0xCC, 0xD5, 0x96, 0x90, 0xA1, 0x41, 0xC7, 0xFC, 0xE5,
+    0xCA, 0x05, 0x42, 0x26, 0x19, 0x58, 0x86, 0x0C, 0x81, 0x4C, 0xCB, 0x45, 0x5F, 0xDA, 0xB4, 0x1A,
+    0x34, 0xB4, 0x55, 0x95, 0x14, 0x91, 0x00, 0x6A, 0x47, 0x11, 0x25, 0xA2, 0x37, 0xB5, 0xED, 0x87,
+    0x64, 0xC8, 0xBE, 0x00, 0x9C, 0x3B, 0xF7, 0xA4, 0xC1, 0x24, 0x7C, 0xFC, 0x09, 0x9B, 0x1C, 0x68,
+    0x27, 0xE2, 0xAE, 0xF5, 0xB8, 0x3C, 0xAD, 0x9A, 0x15, 0xB1, 0xBF, 0x92, 0x56, 0x01, 0x42, 0xE4,
+    0xC2, 0x29, 0x51, 0x2E, 0xB2, 0x84, 0x08, 0xFA, 0x4B, 0x7B, 0xC5, 0x00, 0x46, 0xB0, 0x84, 0xFA,
+    0xF4, 0xA9, 0x92, 0x15, 0xD2, 0x19, 0xC4, 0x76, 0x09, 0x16, 0x48, 0x31, 0x0C, 0xAD, 0x95, 0x88,
+    0x73, 0x64, 0xB8, 0x95, 0xFB, 0xA0, 0xED, 0xC0, 0xAA, 0xAD, 0xEA, 0x39, 0xE1, 0x1A, 0x22, 0xC3,
+    0xE2, 0x9C, 0x45, 0xE9, 0x32, 0xA4, 0xF5, 0xF3, 0x64, 0x10, 0x65, 0x05, 0x5B, 0xC5, 0xBD, 0x14,
+    0x6D, 0x81, 0x82, 0x33, 0xCC, 0xDA, 0xB6, 0x75, 0x84, 0x4F, 0x63, 0x27, 0x71, 0xDC, 0x28, 0x4C,
+    0x28, 0x39, 0x76, 0x2D, 0x57, 0x06, 0x7A, 0xDE, 0x02, 0x3E, 0xE2, 0x88, 0x08, 0xB8, 0x2F, 0x7C,
+    0xF4, 0x15, 0xE3, 0xB2, 0x12, 0x8D, 0x83, 0xAA, 0x5C, 0x24, 0x0F, 0xA3, 0x52, 0x68, 0xD8, 0x30,
+    0x03, 0x31, 0x9E, 0x4D, 0x46, 0x6C, 0x82, 0xD0, 0xA2, 0x5B, 0x32, 0xBE, 0xD1, 0x35, 0xFB, 0xD6,
+    0xA0, 0x98, 0x66, 0xAD, 0x26, 0xBA, 0x25, 0x03, 0xF0, 0x03, 0x89, 0xB9, 0x74, 0x26, 0xCB, 0xCA,
+    0x4A, 0xA8, 0x4D, 0x0C, 0x43, 0x31, 0xCE, 0xB0, 0x11, 0xE6, 0x01, 0x11, 0x22, 0x2E, 0x73, 0x17,
+    0x4F, 0x3E, 0x14, 0xC8, 0xAD, 0x87, 0x29, 0x13, 0x2B, 0x9E, 0x10, 0xA6, 0x34, 0x31, 0xC0, 0xC5,
+    0x67, 0xFF, 0x70, 0x49, 0xE8, 0x25, 0xC7, 0xA2, 0xB0, 0x2C, 0x34, 0x2C, 0x92, 0x32, 0x40, 0xA0,
+    0x09, 0x88, 0x86, 0x8A, 0x02, 0xD2, 0xD7, 0x4A, 0x51, 0x2A, 0x97, 0x8F, 0x73, 0x14, 0x72, 0xE8,
+    0x60, 0x83, 0xC0, 0x40, 0x84, 0x78, 0x4C, 0x9E, 0x28, 0x28, 0x6C, 0xAF, 0xB7, 0x67, 0x15, 0xF1,
+    0x74, 0x0B, 0x4C, 0x8F, 0xE2, 0xB5, 0x49, 0xAA, 0xB6, 0x42, 0xC2, 0x05, 0xA2, 0xDB, 0x3A, 0x0E,
+    0x2A, 0xD8, 0x0D, 0xC2, 0x74, 0xE7, 0xCE, 0x12, 0x24, 0xB2, 0x46, 0xD0, 0x5A, 0xA6, 0x55, 0xBF,
+    0xC5, 0xCF, 0x5A, 0x3D, 0xD6, 0x0C, 0xF5, 0xE0, 0xC8, 0x9E, 0x24, 0xE8, 0x39, 0x2A, 0x76, 0x2C,
+    0xEC, 0xA2, 0x11, 0x2A, 0x23, 0xA5, 0x4D, 0x2A, 0x17, 0xC7, 0x1A, 0x39, 0x72, 0x71, 0x14, 0xA2,
+    0x9A, 0x73, 0xDC, 0x49, 0xAE, 0xA8, 0xB8, 0x38, 0x79, 0x66, 0x35, 0x51, 0xB5, 0x68, 0x94, 0x4C,
+    0xBD, 0x62, 0x89, 0x95, 0x29, 0xD7, 0x41, 0x72, 0xDF, 0xBE, 0x35, 0xF3, 0x42, 0x98, 0xB0, 0x18,
+    0x53, 0x17, 0x05, 0x41, 0x78, 0xC4, 0x50, 0x65, 0x34, 0xA5, 0x72, 0x39, 0xAA, 0x1A, 0x09, 0xDC,
+    0xA8, 0x3A, 0xFD, 0xF0, 0x86, 0x79, 0xC3, 0x85, 0x57, 0x08, 0x14, 0x37, 0x5D, 0x08, 0x36, 0x76,
+    0xC1, 0x40, 0x2B, 0xA6, 0x14, 0xE4, 0x28, 0x20, 0xF8, 0x48, 0x2B, 0xC1, 0x20, 0x89, 0xFA, 0xF1,
+    0x50, 0x24, 0xF0, 0x67, 0x99, 0x3E, 0x68, 0x68, 0x59, 0x21, 0x38, 0x80, 0x6A, 0x03, 0xC5, 0x69,
+    0x1D, 0x19, 0x9A, 0x05, 0xD4, 0xA5, 0xD1, 0x1E, 0x7C, 0xFC, 0xD5, 0xB1, 0x21, 0xF4, 0x85, 0x83,
+    0x10, 0x7F, 0xAC, 0x98, 0xF2, 0x77, 0x4C, 0x5F, 0xD5, 0x1D, 0x23, 0xFF, 0xA4, 0x6D, 0x7B, 0xD4,
+    0xDF, 0xD4, 0x0D, 0xD4, 0x0C, 0x43, 0x6D, 0x84, 0xB4, 0x97, 0x83, 0xB6, 0xEF, 0x28, 0xC4, 0x2B,
+    0xF2, 0xF6, 0xED, 0x5B, 0xAF, 0x1B, 0x0F, 0x5E, 0xEA, 0x3A, 0x75, 0xEE, 0x5C, 0x2E, 0xAF, 0xCA,
+    0x96, 0xAD, 0xB6, 0x01, 0xEB, 0x0B, 0xAF, 0x73, 0x1F, 0x0C, 0x1B, 0xE0, 0xA4, 0xD7, 0x5B, 0x52,
+    0xA4, 0x0E, 0x25, 0xD3, 0xAC, 0xD9, 0xB2, 0x02, 0x8A, 0x5A, 0xD9, 0x0E, 0x40, 0x68, 0x88, 0x4B,
+    0xAE, 0x45, 0xF3, 0xB0, 0xE8, 0xD1, 0xB3, 0x27, 0x2D, 0xD3, 0xC2, 0x93, 0xBB, 0x42, 0x14, 0xF3,
+    0xAF, 0x20, 0x32, 0x40, 0x2A, 0xFB, 0x79, 0x39, 0xA2, 0xD8, 0x50, 0x55, 0x0A, 0x55, 0xDB, 0x11,
+    0xE2, 0xA3, 0xB7, 0x90, 0x92, 0xB5, 0x3B, 0x65, 0x24, 0xAC, 0x6A, 0x58, 0x54, 0x52, 0x41, 0x5A,
+    0x59, 0xFA, 0x3B, 0x45, 0x79, 0x2D, 0xDD, 0x62, 0x76, 0x5D, 0x06, 0x71, 0xBC, 0x86, 0xA1, 0x59,
+    0x10, 0x93, 0x44, 0xF5, 0x39, 0x84, 0xAB, 0xAA, 0x3B, 0xB9, 0x38, 0xDD, 0xB2, 0x7C, 0xC1, 0xD2,
+    0xAE, 0x61, 0x54, 0x15, 0x8F, 0xB5, 0x52, 0xA8, 0x93, 0x6E, 0x2B, 0x47, 0x5A, 0x13, 0xA4, 0x20,
+    0xCB, 0xB4, 0xD6, 0x20, 0x21, 0x00, 0x2D, 0xEF, 0xC3, 0x41, 0x37, 0xC5, 0xDC, 0x4F, 0xEF, 0xFA,
+    0xF5, 0x9B, 0x56, 0x53, 0xEB, 0x15, 0xBB, 0x87, 0x0D, 0x11, 0xD2, 0x98, 0x01, 0x0A, 0x32, 0x3A,
+    0x3C, 0x0D, 0x37, 0xC3, 0x49, 0xB6, 0x96, 0x56, 0x34, 0xA8, 0x26, 0x5E, 0xF5, 0x82, 0x83, 0x65,
+    0xD0, 0x5E, 0x15, 0x7B, 0x96, 0x5D, 0xB0, 0xB6, 0x8D, 0x03, 0xCA, 0x6E, 0x34, 0x1F, 0xDD, 0x20,
+    0xEF, 0xD4, 0x0E, 0x42, 0xAD, 0x54, 0xA2, 0x9A, 0x4B, 0xEB, 0xED, 0xB3, 0x21, 0x47, 0x87, 0x29,
+    0x4D, 0x41, 0x6F, 0xC0, 0x2B, 0x19, 0x5A, 0xF5, 0x1D, 0x54, 0xF4, 0x22, 0x51, 0x55, 0xA7, 0x1A,
+    0xE6, 0xB6, 0x9D, 0x1C, 0xCB, 0x41, 0x2E, 0xB2, 0x15, 0x06, 0xAF, 0x0A, 0x18, 0x2C, 0x2D, 0x2D,
+    0x42, 0x10, 0xDC, 0xC8, 0x09, 0x92, 0x33, 0x17, 0x4A, 0x93, 0x41, 0x96, 0x9D, 0x0D, 0x46, 0x21,
+    0x08, 0x8E, 0xC2, 0x2A, 0xCB, 0x56, 0xE5, 0x53, 0x00, 0x19, 0x2E, 0x1A, 0x89, 0x2F, 0xEC, 0x3B,
+    0x84, 0x4C, 0xC6, 0xB7, 0x40, 0x8F, 0xDC, 0x1A, 0xEA, 0xE6, 0xD2, 0xED, 0x1B, 0x12, 0x7C, 0x46,
+    0x72, 0x02, 0xF8, 0x4B, 0x2F, 0xDF, 0x80, 0x48, 0x5E, 0xCD, 0xE2, 0x24, 0xC0, 0x41, 0xAB, 0xAA,
+    0x84, 0x00, 0xAE, 0xA4, 0x72, 0x8C, 0x1D, 0x08, 0x21, 0x67, 0x11, 0x61, 0xC4, 0xB8, 0x6A, 0xAE,
+    0xC0, 0x14, 0x7D, 0x0C, 0x01, 0xB3, 0xAB, 0x40, 0x2E, 0xC2, 0x5C, 0x0E, 0x03, 0x39, 0x29, 0x6A,
+    0x05, 0x12, 0xE6, 0x29, 0x15, 0xAF, 0x88, 0xA2, 0x89, 0x11, 0x2D, 0x59, 0x2E, 0x90, 0x78, 0x64,
+    0x3D, 0x62, 0xD3, 0xAB, 0xD6, 0x5B, 0x56, 0x4F, 0xFA, 0x33, 0x64, 0x97, 0x27, 0xAD, 0xB9, 0x5B,
+    0xAF, 0x12, 0xD2, 0x63, 0x93, 0xDC, 0xAA, 0xB2, 0x76, 0xE7, 0x6A, 0xA5, 0xA3, 0x80, 0x8E, 0x80,
+    0xAA, 0x81, 0x02, 0x11, 0x8A, 0xD1, 0x75, 0xEA, 0xB2, 0xB6, 0xAC, 0x0E, 0x61, 0x50, 0x19, 0xF0,
+    0xD5, 0x25, 0xBA, 0x39, 0x8A, 0x06, 0x35, 0xEB, 0x40, 0x30, 0x4F, 0xAE, 0x54, 0x8A, 0x7C, 0x45,
+    0xF3, 0xD5, 0xA5, 0x21, 0x3A, 0x7A, 0x36, 0x82, 0x3D, 0xBB, 0xF6, 0x00, 0x4E, 0x97, 0x67, 0x97,
+    0xE4, 0xAB, 0x2A, 0x0E, 0x05, 0xB0, 0x8A, 0xF7, 0x7E, 0x12, 0xDA, 0x4B, 0xC2, 0xB0, 0x14, 0x6E,
+    0x6F, 0xC3, 0xC8, 0xF0, 0xEA, 0x6F, 0x8A, 0x21, 0xB2, 0xA2, 0x08, 0x3D, 0x18, 0x82, 0xEC, 0x94,
+    0xA2, 0x0C, 0xCA, 0x0C, 0x0E, 0xE4, 0x1A, 0x8B, 0x1D, 0xD7, 0x9C, 0xB9, 0xDA, 0x92, 0xFD, 0xDA,
+    0xAA, 0x6D, 0xA9, 0x55, 0x88, 0x82, 0x20, 0x5E, 0x40, 0x74, 0xED, 0xB3, 0x3F, 0x10, 0xA8, 0xE0,
+    0x04, 0xEA, 0xD4, 0xA0, 0xC0, 0xAA, 0xB5, 0x02, 0xB1, 0x0B, 0x63, 0x57, 0x41, 0x2B, 0x97, 0x29,
+    0x04, 0xCC, 0xDA, 0x5B, 0x96, 0xA0, 0xA9, 0x41, 0x50, 0xB3, 0x62, 0xC4, 0xE8, 0x0F, 0x4F, 0xAE,
+    0x9C, 0x4E, 0x8F, 0xD9, 0xD5, 0x37, 0xF7, 0x2C, 0x21, 0x46, 0x65, 0x9F, 0x1D, 0xCC, 0xC9, 0x88,
+    0x1E, 0x38, 0x0A, 0x0D, 0xDB, 0x72, 0x9D, 0xEB, 0xE8, 0xD5, 0x2B, 0xB7, 0x01, 0xDF, 0xDE, 0x5A,
+    0xDA, 0xA7, 0x2E, 0x2D, 0x84, 0x6B, 0xA9, 0x14, 0x93, 0x23, 0xEA, 0x14, 0x21, 0x1E, 0xC1, 0x56,
+    0xAD, 0x0A, 0x84, 0x05, 0x71, 0x55, 0x51, 0x82, 0xFD, 0xB4, 0x22, 0x84, 0x6C, 0x95, 0x9F, 0x5E,
+    0x84, 0x44, 0xE5, 0x32, 0xB4, 0x91, 0xE8, 0xAA, 0x84, 0x5E, 0xDB, 0xEA, 0x32, 0x16, 0x81, 0x0F,
+    0x9F, 0x5C, 0xE8, 0x72, 0xD9, 0xF4, 0x0A, 0x30, 0x05, 0x1F, 0xB2, 0x38, 0xB8, 0x90, 0x25, 0x9B,
+    0x8B, 0xCF, 0x5C, 0x3A, 0x88, 0x1C, 0xBD, 0x51, 0x90, 0x56, 0xB0, 0x60, 0x51, 0x12, 0xB4, 0xBA,
+    0x3C, 0x71, 0x70, 0x08, 0xA1, 0x83, 0x45, 0x58, 0x6E, 0x85, 0x54, 0x18, 0xE5, 0x5C, 0x39, 0x93,
+    0xF5, 0x04, 0x3A, 0x26, 0x66, 0xE7, 0xD6, 0x0F, 0x2C, 0xDB, 0xFE, 0xEA, 0x5A, 0xC5, 0x89, 0x01,
+    0x13, 0x00, 0xAD, 0x5A, 0xC5, 0x98, 0xA0, 0x5E, 0xDD, 0xBA, 0x91, 0xFC, 0x29, 0x75, 0xEB, 0x0F,
+    0x03, 0x5D, 0x48, 0x81, 0x08, 0xFA, 0x4B, 0x8C, 0x96, 0x4E, 0x34, 0xAA, 0x57, 0xAE, 0xCC, 0x31,
+    0xB3, 0x97, 0x0B, 0xC3, 0x44, 0x5C, 0x4C, 0x20, 0x51, 0xC0, 0x95, 0x9B, 0x8E, 0x83, 0x72, 0x01,
+    0xEB, 0x33, 0x21, 0xB7, 0x8E, 0x1C, 0x47, 0xAD, 0xB8, 0x30, 0x04, 0x7C, 0xA6, 0x5E, 0x3D, 0xAE,
+    0x8B, 0x87, 0x44, 0x98, 0x80, 0x46, 0x30, 0x42, 0x94, 0x48, 0x69, 0xA1, 0xD9, 0x81, 0xE6, 0x6D,
+    0xAB, 0x12, 0x08, 0xA1, 0x89, 0x89, 0x11, 0x28, 0x90, 0x30, 0x2E, 0x6A, 0xA3, 0xCA, 0x5A, 0xDC,
+    0x96, 0x2B, 0x29, 0x44, 0xAD, 0xDA, 0xEA, 0xF3, 0x07, 0x07, 0x65, 0x5B, 0xAA, 0xCF, 0x0C, 0x0E,
+    0x6C, 0x63, 0x10, 0x71, 0xB0, 0x54, 0x85, 0x0B, 0x5D, 0xB3, 0xE9, 0x2F, 0x6C, 0xA2, 0x83, 0x27,
+    0xE3, 0x16, 0x72, 0x3A, 0x62, 0x81, 0x13, 0x39, 0x2E, 0xCB, 0x62, 0x51, 0xA9, 0x92, 0x0B, 0xD7,
+    0xC2, 0x59, 0xB9, 0xB4, 0x42, 0xE5, 0x20, 0x05, 0x5D, 0xB9, 0x89, 0x76, 0xA4, 0x4D, 0x2A, 0xC4,
+    0x69, 0x20, 0xAC, 0x88, 0x6F, 0x5A, 0x71, 0x84, 0xCC, 0x9F, 0xBF, 0xB9, 0x91, 0x4A, 0x1D, 0x0B,
+    0x68, 0x53, 0x2B, 0xAF, 0x56, 0x44, 0x8E, 0x0A, 0x1D, 0x25, 0x47, 0xCE, 0xDC, 0x04, 0x56, 0xEA,
+    0x55, 0x65, 0xD2, 0x96, 0x6E, 0xCF, 0x84, 0x00, 0x31, 0x72, 0x2B, 0x58, 0x15, 0xD6, 0x9B, 0xA9,
+    0x47, 0x9C, 0x20, 0x08, 0x42, 0x15, 0x83, 0xDA, 0xB7, 0x6F, 0x40, 0x14, 0x29, 0x75, 0x29, 0xD1,
+    0xD7, 0xA4, 0xC3, 0xC8, 0x26, 0x9B, 0x9B, 0x88, 0x65, 0x59, 0x40, 0x69, 0x1F, 0x50, 0xAC, 0xCA,
+    0x85, 0x6E, 0xB1, 0xAA, 0x5C, 0x2A, 0x7E, 0x95, 0x7B, 0x70, 0xD8, 0xD6, 0xB7, 0x2C, 0x4F, 0x04,
+    0x5D, 0x4C, 0xB9, 0x28, 0x17, 0xBA, 0xA2, 0x8E, 0x95, 0x4A, 0xC2, 0xE7, 0x20, 0x91, 0x56, 0x58,
+    0xED, 0x22, 0xAC, 0x86, 0xEB, 0xC5, 0xC4, 0xB7, 0x87, 0x10, 0xA0, 0x82, 0x67, 0x53, 0x6B, 0x0C,
+    0xAD, 0x74, 0xAF, 0xBE, 0xC2, 0x89, 0x60, 0xE2, 0x44, 0x42, 0x59, 0xC7, 0xCA, 0x21, 0xD8, 0xD6,
+    0x41, 0x9F, 0xA0, 0x6D, 0x93, 0x50, 0xAB, 0xC3, 0xA7, 0xCD, 0xAF, 0x66, 0x6D, 0xAD, 0xBE, 0x1D,
+    0x9A, 0x38, 0xC3, 0x47, 0x7F, 0xC1, 0x8E, 0x9A, 0x64, 0xA9, 0xC1, 0x44, 0x90, 0x02, 0xB9, 0xAA,
+    0x22, 0x0E, 0x4A, 0xE2, 0x1E, 0xC2, 0x7A, 0x73, 0x0D, 0xF5, 0xC2, 0x45, 0x30, 0xB1, 0xDB, 0x43,
+    0x30, 0xAD, 0x7A, 0x9D, 0x5A, 0xB8, 0xF0, 0xAF, 0x5F, 0x6F, 0x6A, 0x0D, 0xD3, 0x2A, 0xA3, 0x55,
+    0x30, 0xAF, 0x21, 0x06, 0x0B, 0xEB, 0xFA, 0x0C, 0xB3, 0xCD, 0x83, 0x43, 0x11, 0xD3, 0xA3, 0x87,
+    0x08, 0x61, 0x84, 0x58, 0xEF, 0xDA, 0x68, 0x25, 0xE4, 0x18, 0x90, 0x95, 0x54, 0x90, 0x20, 0x05,
+    0x72, 0x0B, 0x02, 0x51, 0xC9, 0x6B, 0x5E, 0xB3, 0x9E, 0x38, 0x6B, 0x33, 0x45, 0x09, 0x1E, 0xAD,
+    0xBE, 0x96, 0x6C, 0xBB, 0x28, 0x07, 0x08, 0x7F, 0x31, 0xBA, 0xA2, 0xEC, 0x45, 0xF0, 0xED, 0x87,
+    0x56, 0x7D, 0xCB, 0xBE, 0x5A, 0xCC, 0xF7, 0xAB, 0xB0, 0xAF, 0xFE, 0x26, 0x1A, 0x3A, 0x46, 0xA7,
+    0xE2, 0x20, 0xC9, 0x89, 0xF2, 0xD5, 0x59, 0x46, 0x65, 0x55, 0xA2, 0x52, 0xCC, 0x5A, 0xBD, 0x68,
+    0x75, 0x10, 0x5C, 0xAE, 0x24, 0x5E, 0x17, 0xDF, 0x6A, 0x75, 0x0B, 0x0B, 0xDB, 0x7A, 0xD6, 0xD0,
+    0x3C, 0x7A, 0xEB, 0x52, 0x2B, 0x06, 0x84, 0x09, 0x93, 0x60, 0x08, 0x86, 0x30, 0xD1, 0x62, 0xC9,
+    0x66, 0x01, 0x99, 0x93, 0x67, 0x0E, 0x6C, 0x62, 0x60, 0x52, 0x24, 0x2D, 0xD3, 0x1A, 0x36, 0x2D,
+    0x25, 0xBA, 0x08, 0x69, 0x95, 0x75, 0xC9, 0x55, 0x69, 0xD7, 0x44, 0x5C, 0xD1, 0xF2, 0xA9, 0xDA,
+    0xE3, 0x44, 0xD5, 0x1E, 0x91, 0xF1, 0x20, 0x6C, 0xDB, 0xB6, 0xC2, 0x97, 0xB9, 0x10, 0x3C, 0xB4,
+    0x2D, 0x49, 0x82, 0x8B, 0x9B, 0x2B, 0x30, 0x13, 0x4D, 0x4B, 0xBC, 0xA3, 0x6D, 0xE2, 0xC4, 0x89,
+    0x10, 0x7F, 0x65, 0x88, 0x18, 0x22, 0x41, 0x45, 0x91, 0xE8, 0x16, 0xFB, 0x50, 0xE0, 0x5B, 0x20,
+    0x86, 0x85, 0xA0, 0xD2, 0xD2, 0xA1, 0x20, 0xDE, 0x5A, 0xCD, 0x0E, 0x4E, 0x02, 0x75, 0x54, 0xC7,
+    0xEC, 0x58, 0xC3, 0x6D, 0xDB, 0x51, 0x08, 0x12, 0x95, 0x8B, 0x1B, 0xC4, 0x88, 0x19, 0xBE, 0x6B,
+    0x3B, 0x0C, 0xEA, 0xB4, 0x33, 0x65, 0x0B, 0x23, 0x5C, 0x30, 0x57, 0x2B, 0x32, 0x0A, 0x14, 0xB8,
+    0x98, 0x30, 0xD1, 0x09, 0xE2, 0xA1, 0x7F, 0x86, 0x28, 0x24, 0x92, 0x22, 0xA6, 0xE2, 0xE2, 0x36,
+    0x6E, 0x2F, 0xC8, 0x92, 0x14, 0xF6, 0x31, 0x0F, 0xB2, 0xA3, 0x32, 0x7D, 0x73, 0x59, 0x68, 0x54,
+    0x89, 0x56, 0x8F, 0x54, 0xF2, 0x13, 0xD3, 0x76, 0xAE, 0xE1, 0x5A, 0x07, 0x17, 0x12, 0x6A, 0x5B,
+    0xE1, 0xF1, 0xCC, 0x91, 0x0B, 0x5B, 0xBD, 0x7A, 0xD5, 0xC9, 0xD0, 0x16, 0x10, 0x0E, 0x46, 0x09,
+    0xA5, 0x4B, 0xCB, 0x44, 0x08, 0x14, 0x4D, 0x20, 0xC0, 0x32, 0x29, 0x4F, 0x9E, 0x15, 0xBA, 0xBD,
+    0xDE, 0xA4, 0x4D, 0x52, 0x14, 0xB1, 0xA3, 0xB6, 0xFE, 0xDE, 0xA4, 0xC9, 0xE4, 0xAF, 0x68, 0x51,
+    0x2E, 0x27, 0xBE, 0x3E, 0x20, 0x32, 0x4A, 0xC9, 0xD8, 0xB1, 0x75, 0xE8, 0x2A, 0x50, 0xC0, 0x65,
+    0x6E, 0xD3, 0xB4, 0x81, 0x16, 0xA4, 0xC8, 0x15, 0x6F, 0x87, 0x5D, 0x9F, 0x67, 0x72, 0xF8, 0x99,
+    0x48, 0xB7, 0x22, 0x35, 0x46, 0x3D, 0x11, 0x38, 0x35, 0xE1, 0xF1, 0xDB, 0xDB, 0x44, 0x00, 0xFD,
+    0x74, 0x7A, 0x75, 0xAA, 0x55, 0x61, 0x96, 0xB9, 0xDA, 0x12, 0xF9, 0xCA, 0xB5, 0x2A, 0x04, 0x0D,
+    0x84, 0x02, 0x86, 0x54, 0xD0, 0xD5, 0x01, 0x17, 0x43, 0x8E, 0x0D, 0xD9, 0x20, 0xB4, 0xE3, 0x2E,
+    0x15, 0x0A, 0x5D, 0xC1, 0x46, 0x70, 0x18, 0xEC, 0x54, 0x01, 0xBE, 0x6D, 0x34, 0xEC, 0x24, 0x07,
+    0xE2, 0x95, 0x03, 0x45, 0x3C, 0x5C, 0x02, 0x75, 0x70, 0x8A, 0x4B, 0x45, 0xC4, 0x4B, 0x5C, 0x46,
+    0x65, 0x79, 0xE0, 0x2B, 0x05, 0x12, 0xA6, 0x6E, 0x69, 0xE5, 0x7A, 0xAA, 0xB0, 0x0E, 0x47, 0x79,
+    0x59, 0x1A, 0x7A, 0xD7, 0xF6, 0x14, 0x5A, 0xAD, 0x5A, 0xD7, 0x62, 0x01, 0xCA, 0x25, 0x0B, 0x17,
+    0x03, 0x75, 0x08, 0x11, 0x32, 0xB4, 0xE6, 0x41, 0xDA, 0x36, 0x90, 0xEC, 0x0D, 0x43, 0x86, 0x6C,
+    0x19, 0x4B, 0x9B, 0x20, 0x7A, 0x41, 0x42, 0x76, 0xF4, 0xD5, 0x5A, 0xC4, 0x91, 0xB4, 0x96, 0xAC,
+    0xAA, 0xD5, 0xE8, 0xDC, 0x53, 0x4E, 0x92, 0x10, 0x84, 0x47, 0xA8, 0xD9, 0xDB, 0x33, 0x08, 0x05,
+    0x2B, 0x5A, 0x03, 0xC4, 0x50, 0x2F, 0x84, 0x86, 0xAA, 0x42, 0x42, 0xD8, 0xEB, 0x94, 0xCA, 0x20,
+    0x6B, 0x0C, 0xAD, 0x49, 0xDB, 0x06, 0x19, 0x4B, 0x10, 0xA7, 0x20, 0x11, 0xD2, 0x1A, 0xC4, 0xE8,
+    0xDC, 0x33, 0x8A, 0x10, 0x22, 0x3A, 0xA8, 0x88, 0x06, 0x24, 0xC4, 0x22, 0x08, 0xA1, 0xD9, 0x31,
+    0x39, 0x88, 0xC9, 0x3E, 0x09, 0xC5, 0xB0, 0x4C, 0xD4, 0xC6, 0x4C, 0x8A, 0x44, 0x82, 0x0E, 0x86,
+    0xCD, 0xC9, 0x8D, 0x50, 0x2E, 0xC4, 0x80, 0x1D, 0x84, 0xE5, 0x63, 0xD2, 0x0C, 0x62, 0xB3, 0x29,
+    0xB4, 0xB6, 0x6D, 0x05, 0x49, 0x6B, 0x5A, 0xAD, 0x69, 0xD3, 0x16, 0xE1, 0x72, 0xF0, 0x20, 0x22,
+    0x3D, 0x84, 0xA8, 0x9C, 0x1D, 0xA2, 0xE7, 0x83, 0x50, 0xB2, 0x89, 0xDA, 0x42, 0x3C, 0xEB, 0xB6,
+    0xA4, 0x3F, 0xA8, 0x84, 0xCE, 0xBA, 0x75, 0x72, 0x05, 0xED, 0xDA, 0x9B, 0x2A, 0xDD, 0x82, 0x85,
+    0xE4, 0x15, 0x1B, 0x09, 0xB9, 0x88, 0xC5, 0x56, 0x01, 0x2B, 0x02, 0x65, 0xDA, 0x8D, 0x91, 0xC9,
+    0xB6, 0x6D, 0x9B, 0xD3, 0x44, 0x1D, 0x95, 0x75, 0xC8, 0x1A, 0x5E, 0x7C, 0xF8, 0xCC, 0xE4, 0xC9,
+    0x82, 0xD1, 0x70, 0x31, 0x44, 0x84, 0x56, 0x10, 0xB5, 0xAD, 0xAE, 0xBD, 0x53, 0xFC, 0xA5, 0xAD,
+    0xA3, 0xB5, 0x80, 0xDB, 0xB6, 0x45, 0x48, 0x58, 0x9F, 0x03, 0xB1, 0x08, 0x0D, 0xE4, 0xB0, 0x2C,
+    0x74, 0x71, 0x8C, 0xC2, 0x71, 0xC9, 0x9E, 0x6D, 0x0B, 0xA8, 0x0E, 0x4B, 0x0F, 0x5E, 0x59, 0xDE,
+    0xF1, 0x70, 0xA6, 0x4D, 0xC2, 0x40, 0x89, 0xFA, 0x78, 0xE9, 0x5A, 0x55, 0xA5, 0x62, 0xA5, 0xC8,
+    0x04, 0x37, 0x73, 0x12, 0x28, 0xAD, 0xD8, 0x34, 0x52, 0x26, 0x1C, 0x6D, 0xBB, 0x6A, 0x71, 0x28,
+    0x4F, 0x59, 0xE7, 0x12, 0x25, 0x84, 0x18, 0x22, 0x0D, 0x54, 0x4E, 0x42, 0x3D, 0x61, 0x99, 0x74,
+    0xC7, 0x02, 0x10, 0x72, 0x35, 0x09, 0x24, 0xF8, 0x72, 0xC0, 0x5C, 0xAF, 0x25, 0x12, 0x71, 0xCD,
+    0x9A, 0x35, 0xCC, 0xCD, 0x0A, 0x81, 0x16, 0xD5, 0x34, 0x5C, 0x33, 0x49, 0x9F, 0x10, 0x33, 0x13,
+    0x5D, 0x42, 0x28, 0xC3, 0xEB, 0x4E, 0xAA, 0x5C, 0xAD, 0x98, 0xF0, 0xD9, 0x96, 0x9B, 0xDB, 0x21,
+    0xF5, 0x24, 0x83, 0x20, 0x11, 0x99, 0x90, 0x3F, 0xA0, 0x90, 0xAB, 0x3A, 0x2A, 0x78, 0xE4, 0x30,
+    0xDF, 0xCA, 0x00, 0x25, 0xC3, 0x32, 0x94, 0x82, 0x0E, 0x2F, 0x95, 0x10, 0xFA, 0xD8, 0x9B, 0x4B,
+    0x84, 0xAC, 0x3D, 0x96, 0x65, 0x59, 0x0A, 0xEA, 0xE3, 0x24, 0x71, 0x90, 0xAF, 0x5C, 0xFA, 0x25,
+    0x35, 0xE4, 0x6F, 0xEE, 0x64, 0xC7, 0x5A, 0x03, 0xB9, 0x1D, 0xC0, 0xB5, 0x1A, 0x09, 0x2C, 0x8B,
+    0xD5, 0xA6, 0x05, 0x54, 0x56, 0x8C, 0x3A, 0x7F, 0xD0, 0xD8, 0x56, 0x0D, 0x4B, 0x54, 0x71, 0x49,
+    0x43, 0xFB, 0x44, 0x01, 0x1A, 0x24, 0xE6, 0x2D, 0x32, 0xAF, 0xC8, 0xB4, 0x06, 0x24, 0x61, 0xB6,
+    0x68, 0xCE, 0x04, 0x26, 0x00, 0xB2, 0x3C, 0x44, 0xF7, 0x6B, 0x1D, 0xA1, 0x6B, 0xD7, 0xE6, 0x9A,
+    0x0B, 0x41, 0x46, 0xC1, 0x56, 0xCF, 0x9E, 0x99, 0x2C, 0xEC, 0xCC, 0x10, 0xDF, 0x44, 0xAF, 0x70,
+    0x61, 0x60, 0xE7, 0x46, 0xAB, 0xE4, 0x02, 0x05, 0x14, 0x15, 0x6E, 0xCB, 0xE7, 0x50, 0x30, 0x11,
+    0x72, 0xFA, 0x80, 0x20, 0xFB, 0x17, 0xA4, 0x56, 0xC0, 0x4B, 0x0E, 0x5F, 0x3B, 0xE5, 0xE4, 0x2D,
+    0x24, 0x42, 0x99, 0x11, 0x51, 0x08, 0xE4, 0x38, 0xAB, 0x5F, 0xC0, 0x2C, 0x05, 0x02, 0xF5, 0xDB,
+    0x6F, 0x65, 0xD9, 0xBD, 0x40, 0x79, 0xEC, 0xE4, 0x4A, 0x08, 0xD1, 0x22, 0xC1, 0xD6, 0xDA, 0x0A,
+    0x10, 0x5C, 0x2F, 0x50, 0x9F, 0xB6, 0x6D, 0x4B, 0x36, 0x2C, 0x07, 0x70, 0x89, 0x4F, 0x3E, 0x8A,
+    0xE9, 0x08, 0x78, 0x6B, 0x68, 0xAE, 0xA1, 0x40, 0x49, 0x0A, 0x97, 0xCD, 0xBB, 0x4A, 0x65, 0x55,
+    0x10, 0xAD, 0xDA, 0x3E, 0x28, 0x9C, 0xD6, 0x09, 0x8A, 0xAA, 0x28, 0xD6, 0x82, 0x68, 0xE8, 0xF6,
+    0x14, 0x89, 0xAF, 0xE0, 0xFE, 0xE4, 0x6D, 0xCB, 0x43, 0x70, 0xDA, 0x24, 0x69, 0x09, 0x15, 0xE1,
+    0x02, 0x91, 0x50, 0x22, 0x3D, 0x42, 0x1B, 0x96, 0xF4, 0x07, 0xF5, 0x6C, 0xDB, 0xB3, 0x84, 0x20,
+    0x1E, 0x0A, 0xC4, 0xCE, 0x11, 0x5A, 0x6C, 0x64, 0x9D, 0xF0, 0x12, 0x7B, 0x13, 0x0B, 0xCA, 0x2A,
+    0x90, 0x0E, 0xA3, 0xA9, 0xA3, 0xCF, 0x32, 0x4B, 0xB1, 0x80, 0x73, 0x1A, 0x0E, 0xA2, 0x38, 0x06,
+    0x42, 0xC2, 0x0E, 0xDA, 0xB6, 0x0D, 0xB5, 0x8A, 0x65, 0x1A, 0x96, 0x84, 0x02, 0x95, 0x58, 0xAC,
+    0xB2, 0xCF, 0x8E, 0x33, 0x09, 0xDB, 0x9C, 0x6D, 0x7B, 0xD8, 0x4B, 0x57, 0x0F, 0x82, 0xC8, 0x2A,
+    0x4E, 0x94, 0x75, 0xAE, 0xC0, 0xAC, 0x61, 0xE4, 0x06, 0x0A, 0x55, 0xF3, 0xE6, 0x93, 0x82, 0x8B,
+    0x2B, 0xAB, 0x4B, 0x22, 0xD9, 0xCA, 0xA5, 0xAA, 0x73, 0x53, 0xAA, 0x1C, 0x02, 0x02, 0x56, 0xE4,
+    0x9D, 0x40, 0x55, 0xB6, 0x85, 0x46, 0x82, 0x08, 0x20, 0x43, 0x5F, 0xCD, 0xB2, 0xAD, 0xEA, 0x64,
+    0x6E, 0x59, 0x10, 0x93, 0x07, 0xA4, 0x0D, 0x82, 0xCC, 0x1E, 0xD9, 0x67, 0x3C, 0x72, 0x7E, 0x5D,
+    0x9B, 0x80, 0x25, 0x40, 0x64, 0x8A, 0x82, 0x15, 0x36, 0xE4, 0x0C, 0xA8, 0x5F, 0x81, 0xA7, 0xFA,
+    0x41, 0x4A, 0x0B, 0x50, 0x30, 0x09, 0x34, 0x00, 0xF5, 0x6C, 0x25, 0xA4, 0x47, 0x8E, 0x1E, 0xAD,
+    0x5A, 0x07, 0xC5, 0x92, 0x93, 0xE4, 0x16, 0x92, 0x43, 0xFE, 0x58, 0xB6, 0x02, 0x32, 0xD5, 0x81,
+    0x4B, 0xAE, 0x58, 0x10, 0x23, 0x4E, 0x9B, 0x96, 0x65, 0x8A, 0x40, 0x4F, 0xDB, 0x3E, 0x6D, 0x6B,
+    0xC8, 0xC0, 0x1E, 0x27, 0x29, 0xBA, 0xFE, 0x31, 0x94, 0xC9, 0x8B, 0x23, 0x2E, 0x5A, 0x25, 0xD0,
+    0x99, 0xBB, 0xB8, 0xD0, 0x15, 0xAD, 0x14, 0xAC, 0xFE, 0x91, 0x10, 0x84, 0xF2, 0x95, 0xB6, 0x88,
+    0x15, 0x7C, 0x18, 0x50, 0x6F, 0x5A, 0xBD, 0x33, 0xD3, 0xE4, 0x0E, 0x79, 0x66, 0x73, 0xEC, 0x9F,
+    0x51, 0x75, 0xE8, 0x3C, 0x1B, 0x30, 0xAC, 0x15, 0x37, 0x07, 0x73, 0x0B, 0x35, 0x1D, 0x56, 0x4F,
+    0x6B, 0x5B, 0x47, 0xCF, 0x52, 0x00, 0xFD, 0x03, 0x69, 0x81, 0x61, 0xBA, 0x5C, 0x2E, 0x98, 0x19,
+    0xDA, 0x76, 0xCE, 0xD4, 0x7C, 0x83, 0xA8, 0x00, 0x5D, 0xC3, 0x17, 0xB1, 0x94, 0xC5, 0x2C, 0x1D,
+    0x4C, 0x96, 0xD2, 0xC6, 0xDE, 0x03, 0x60, 0x3A, 0x56, 0x86, 0xB2, 0x82, 0xB4, 0xAD, 0x89, 0x61,
+    0x75, 0x1C, 0xE4, 0x9A, 0x15, 0xC8, 0x8B, 0xBD, 0xC9, 0x85, 0xC8, 0xF6, 0x45, 0xE4, 0x45, 0xAF,
+    0xA1, 0xB7, 0x67, 0x0D, 0xA3, 0x94, 0x20, 0xE1, 0x20, 0x4A, 0x16, 0x7A, 0x15, 0x9B, 0xCA, 0x1B,
+    0x83, 0x84, 0x49, 0xA3, 0xF2, 0xCA, 0x70, 0x05, 0x66, 0x68, 0x27, 0x17, 0xA0, 0x32, 0x64, 0x20,
+    0x26, 0x34, 0x38, 0x89, 0x22, 0xB1, 0x2F, 0xEC, 0x2A, 0xC0, 0x6B, 0x0A, 0x4B, 0x06, 0x42, 0x2B,
+    0xDB, 0x3A, 0xE6, 0x72, 0x86, 0x23, 0xDF, 0x58, 0x6D, 0x0F, 0x90, 0x98, 0x8A, 0x18, 0x32, 0x04,
+    0xBB, 0x7F, 0x77, 0xE4, 0x4D, 0xDB, 0xAF, 0xE4, 0xD4, 0xB7, 0x8A, 0xBE, 0x70, 0xD5, 0xEB, 0x20,
+    0x89, 0xCB, 0xB4, 0x26, 0xCB, 0xDE, 0xFA, 0xA2, 0x77, 0x81, 0x61, 0x2E, 0x74, 0xCD, 0x5C, 0xE0,
+    0xCB, 0xF5, 0xC0, 0xE0, 0x41, 0x88, 0xA9, 0x00, 0xCD, 0xF7, 0xE0, 0xCC, 0xE2, 0x35, 0x52, 0x0C,
+    0x31, 0x60, 0x89, 0xB4, 0x4D, 0x28, 0x1D, 0xC3, 0xAC, 0xD4, 0x69, 0xDB, 0x17, 0x71, 0xA1, 0x40,
+    0x93, 0x67, 0xE5, 0xD2, 0x3B, 0xD9, 0x8B, 0xA2, 0x83, 0x86, 0x4D, 0xA1, 0xE4, 0x92, 0x84, 0x90,
+    0x4B, 0x93, 0x31, 0x1C, 0x28, 0x2E, 0x23, 0x6F, 0x87, 0x29, 0x2C, 0x90, 0xB9, 0x38, 0xE6, 0xC8,
+    0x37, 0x6D, 0x5E, 0xBB, 0x7F, 0x4B, 0xBE, 0xFD, 0x62, 0x42, 0x2B, 0xCA, 0x6A, 0x4A, 0xB5, 0x96,
+    0xA8, 0x53, 0xA2, 0xF0, 0xD6, 0xA0, 0x95, 0x2B, 0xB7, 0x6A, 0xC4, 0x85, 0xF0, 0x17, 0x7F, 0x25,
+    0x0D, 0xBA, 0xE5, 0x3A, 0x19, 0x12, 0x41, 0x13, 0x31, 0x48, 0x90, 0x20, 0xE2, 0x48, 0x44, 0x10,
+    0xAD, 0x82, 0x21, 0xD5, 0x45, 0x48, 0xC8, 0x44, 0x8A, 0x34, 0x66, 0x27, 0x1F, 0x6D, 0x22, 0xEB,
+    0x4B, 0x4F, 0x1A, 0x5A, 0x09, 0xE7, 0x74, 0xEB, 0xC8, 0x90, 0xC2, 0xA0, 0x30, 0x6C, 0xE4, 0x42,
+    0xC8, 0xE3, 0xE0, 0xE4, 0xA2, 0x08, 0x4D, 0x00, 0x12, 0x28, 0x10, 0xD1, 0xDE, 0xA2, 0x52, 0xF2,
+    0xE6, 0xB5, 0xDC, 0x4E, 0x41, 0xA7, 0x4B, 0x4C, 0x20, 0x71, 0x21, 0x61, 0xA8, 0x0A, 0x62, 0x9F,
+    0x75, 0x0D, 0xF8, 0xAB, 0x1B, 0x10, 0xEA, 0xCF, 0xB6, 0xDD, 0x68, 0x15, 0x33, 0x40, 0xA4, 0x13,
+    0xD4, 0x42, 0x31, 0xE2, 0xFD, 0x5B, 0xEC, 0x48, 0x08, 0x62, 0x2E, 0xEF, 0x1C, 0x95, 0xA4, 0xC0,
+    0xCD, 0x51, 0x2B, 0x32, 0x6D, 0x09, 0x35, 0xE1, 0x8A, 0xA8, 0xC9, 0xE2, 0x84, 0x9E, 0x1A, 0xB7,
+    0x31, 0x28, 0xAA, 0xAB, 0x89, 0x5C, 0xF6, 0x10, 0x17, 0x3A, 0x7A, 0xC1, 0x50, 0x0E, 0x81, 0x0E,
+    0xB8, 0x36, 0x21, 0xE4, 0x88, 0x90, 0x4B, 0xA6, 0x29, 0x16, 0x81, 0xF3, 0x5A, 0xC1, 0xEC, 0x8D,
+    0x68, 0x2E, 0x61, 0xC5, 0x45, 0x84, 0x42, 0x20, 0x34, 0x9F, 0x86, 0xFC, 0x61, 0xAD, 0x0A, 0x23,
+    0x11, 0x21, 0x70, 0x8E, 0xC0, 0xF1, 0xCA, 0xC5, 0xCA, 0x8F, 0x23, 0x13, 0x53, 0x13, 0x16, 0xA5,
+    0x60, 0x79, 0x60, 0x5B, 0x1A, 0x94, 0x2F, 0x50, 0xA6, 0x87, 0xF8, 0xB0, 0x10, 0xC4, 0x73, 0x9B,
+    0x30, 0x61, 0x11, 0x37, 0x71, 0x10, 0xC0, 0x24, 0x56, 0x18, 0x4A, 0x13, 0xD4, 0x11, 0x17, 0xCB,
+    0x44, 0xEC, 0x51, 0x54, 0x57, 0xD4, 0x83, 0x53, 0x43, 0x3D, 0x70, 0xF8, 0xF3, 0x19, 0xB0, 0x9B,
+    0x90, 0xA2, 0x84, 0xC0, 0x05, 0xAB, 0x95, 0xD7, 0xC1, 0x89, 0x5C, 0xB1, 0x68, 0x04, 0xD5, 0x91,
+    0x53, 0xAB, 0x28, 0x42, 0x88, 0x03, 0x06, 0x79, 0x47, 0xF9, 0x55, 0x83, 0xBD, 0xDD, 0x22, 0x38,
+    0x75, 0x04, 0xA4, 0x03, 0x57, 0x2A, 0x29, 0x12, 0x33, 0xA1, 0x40, 0x83, 0x06, 0x24, 0x48, 0xB3,
+    0x7C, 0x0A, 0x84, 0xD4, 0x2F, 0x16, 0x93, 0x1A, 0x6B, 0xF6, 0xE6, 0x70, 0xE0, 0x60, 0xB1, 0xA3,
+    0x14, 0x02, 0x99, 0xA0, 0x20, 0x94, 0xB5, 0x6E, 0xB7, 0x59, 0xB2, 0x10, 0xB7, 0x42, 0x0C, 0x22,
+    0x85, 0x92, 0xAA, 0xB7, 0x66, 0x71, 0xAD, 0x7A, 0xF9, 0xD4, 0xD7, 0x86, 0x1B, 0xC1, 0xF9, 0x44,
+    0x48, 0xA8, 0x06, 0x0E, 0xAD, 0xA2, 0x20, 0xCD, 0x52, 0x69, 0x66, 0xC7, 0x15, 0x84, 0x45, 0x9B,
+    0x34, 0x31, 0x83, 0x0A, 0x62, 0x2F, 0x01, 0x84, 0x1C, 0x05, 0xDD, 0x94, 0x2A, 0x6D, 0xB1, 0x4A,
+    0x08, 0x71, 0xA5, 0x6A, 0x82, 0x38, 0x6D, 0xD1, 0x1E, 0x6F, 0xE7, 0x8E, 0x40, 0xDB, 0x26, 0x52,
+    0xD5, 0xBA, 0x60, 0x75, 0x94, 0xA5, 0x02, 0xB1, 0x64, 0x28, 0x97, 0x4F, 0x49, 0xE8, 0x70, 0x32,
+    0xCD, 0xDF, 0xB0, 0x8B, 0xA1, 0x00, 0x3A, 0xD6, 0xC3, 0x07, 0x61, 0xA8, 0x20, 0xB4, 0x74, 0x14,
+    0x30, 0x4C, 0x25, 0x94, 0x5A, 0x7A, 0x0B, 0xD0, 0xA0, 0x89, 0xB7, 0x78, 0xA2, 0x13, 0x03, 0x8A,
+    0x11, 0xAF, 0xBD, 0xD4, 0x16, 0x31, 0x4B, 0x7D, 0x52, 0xCC, 0x38, 0x42, 0xC4, 0xA6, 0xCE, 0xA4,
+    0x84, 0x8A, 0xF1, 0x22, 0x46, 0x09, 0x6B, 0xEE, 0x49, 0xB9, 0x53, 0xDD, 0x16, 0x9E, 0xCA, 0xA5,
+    0xA0, 0x62, 0x6E, 0xAC, 0x0A, 0x0B, 0x86, 0x35, 0x39, 0x10, 0x55, 0x18, 0x6F, 0x28, 0xB5, 0xA5,
+    0x07, 0xD0, 0x4D, 0x37, 0x7D, 0x6B, 0x16, 0xF0, 0x72, 0x07, 0xEB, 0x22, 0x45, 0x42, 0x6A, 0xB9,
+    0xB2, 0x98, 0xF1, 0x42, 0x8C, 0x5C, 0x3D, 0x2E, 0xB9, 0x4C, 0xE6, 0x62, 0x95, 0x81, 0xE0, 0xB9,
+    0x56, 0x85, 0xA2, 0x31, 0xBC, 0x95, 0x6E, 0x2E, 0x44, 0x22, 0x1C, 0x57, 0x15, 0x64, 0xB6, 0x30,
+    0x22, 0xC1, 0x15, 0x52, 0x5D, 0xA1, 0x32, 0x4B, 0x0C, 0x48, 0x4A, 0x7F, 0xDA, 0x12, 0x82, 0x2C,
+    0x65, 0xAE, 0x21, 0x3D, 0xAB, 0xE4, 0xB5, 0x6A, 0x95, 0x6B, 0xD6, 0x08, 0xB4, 0x6D, 0xCA, 0xEA,
+    0x80, 0xE8, 0xD8, 0x09, 0xAF, 0x8B, 0x7A, 0xD0, 0x5C, 0xCA, 0xA5, 0x18, 0x71, 0x5B, 0x3E, 0x86,
+    0x5B, 0xAD, 0x2D, 0xC8, 0x12, 0x2F, 0x62, 0x44, 0x8A, 0x13, 0xE6, 0x42, 0x54, 0x98, 0x0B, 0xAC,
+    0x6E, 0x0B, 0x02, 0xB9, 0xA1, 0x0A, 0x0B, 0xC6, 0xE4, 0x19, 0x5C, 0x08, 0x59, 0x75, 0x29, 0x8F,
+    0xEE, 0xD6, 0x6E, 0xB9, 0x0A, 0xCF, 0x02, 0x8B, 0x26, 0x46, 0x8C, 0x7A, 0x98, 0x1F, 0x94, 0x2A,
+    0x15, 0xC3, 0x2C, 0x82, 0x07, 0x0F, 0x1E, 0x98, 0x7D, 0x80, 0x20, 0xC6, 0x83, 0x07, 0x24, 0x2A,
+    0x92, 0x23, 0x07, 0x02, 0x06, 0x8C, 0xB6, 0x11, 0x1F, 0x3C, 0x60, 0x39, 0x37, 0x56, 0x0E, 0x10,
+    0x5F, 0x00, 0xCE, 0x9D, 0xEB, 0xEF, 0x6C, 0xDB, 0x37, 0xC0, 0xFC, 0xDD, 0xA5, 0xCA, 0x34, 0xF2,
+    0xDB, 0x1C, 0x76, 0x15, 0xCD, 0x41, 0x4B, 0x25, 0x6B, 0x0E, 0x27, 0x71, 0x0A, 0xE7, 0x50, 0x44,
+    0xB7, 0xEA, 0x2B, 0x13, 0x23, 0xB8, 0x1D, 0x45, 0xDC, 0x96, 0x51, 0x21, 0x12, 0x3A, 0xA4, 0x04,
+    0xD9, 0xB7, 0x98, 0x08, 0x5F, 0xA1, 0x2E, 0xA1, 0x22, 0x5C, 0x14, 0xE8, 0x88, 0x5C, 0x64, 0x0D,
+    0x08, 0x51, 0x6B, 0x9B, 0x08, 0xB2, 0xAC, 0xB3, 0x4E, 0x6F, 0xB2, 0x14, 0x0A, 0x6F, 0x0F, 0x37,
+    0x26, 0x8C, 0xCA, 0x9E, 0xAD, 0x20, 0xD7, 0xEB, 0xC1, 0xA5, 0x8B, 0x0F, 0x06, 0x09, 0xC2, 0x74,
+    0x51, 0x51, 0x24, 0x6D, 0x0B, 0x2B, 0x65, 0x93, 0x95, 0x65, 0x89, 0x9C, 0x7B, 0x17, 0x62, 0x79,
+    0xD5, 0x33, 0x50, 0x2B, 0x34, 0xA6, 0x18, 0xE0, 0x80, 0xD4, 0xE0, 0x8F, 0x8E, 0x5C, 0x72, 0x15,
+    0x2B, 0x9A, 0x0B, 0x43, 0x54, 0xD5, 0xA2, 0x6D, 0x73, 0xD0, 0xED, 0xE5, 0x40, 0xDD, 0x5C, 0x1E,
+    0x3B, 0x99, 0xEC, 0x4C, 0xCB, 0xC2, 0x44, 0xD1, 0xB9, 0x2C, 0x0D, 0xCB, 0xB5, 0xEB, 0xE4, 0xC1,
+    0x1B, 0x27, 0x5B, 0x01, 0x1D, 0xEC, 0x91, 0xA3, 0x6A, 0xB5, 0xB6, 0x67, 0xD6, 0xA2, 0xA8, 0x75,
+    0xD6, 0x67, 0x10, 0x13, 0x74, 0x73, 0xFA, 0x04, 0xF8, 0x6B, 0xED, 0x9A, 0xC1, 0x05, 0x58, 0x5A,
+    0x30, 0x91, 0x73, 0x6F, 0x61, 0x26, 0x41, 0x70, 0x99, 0xC0, 0x31, 0x2B, 0xB3, 0x43, 0x80, 0x65,
+    0xE7, 0xB6, 0x75, 0x12, 0xCB, 0x11, 0x4B, 0x07, 0x6B, 0x81, 0x7D, 0xDD, 0x19, 0x47, 0x30, 0x51,
+    0x29, 0xCA, 0x1E, 0x3C, 0x28, 0xD5, 0x8A, 0xEE, 0xDA, 0x5E, 0xAD, 0xDA, 0x26, 0x05, 0xE2, 0x2F,
+    0x6E, 0x49, 0x39, 0x73, 0x85, 0x55, 0x34, 0xA8, 0x35, 0x14, 0x97, 0x4A, 0x12, 0xAA, 0x84, 0x9D,
+    0x06, 0x56, 0x65, 0x02, 0xBA, 0x37, 0x06, 0x7D, 0x4D, 0x90, 0xD5, 0x91, 0x5C, 0x39, 0x3F, 0x0F,
+    0x3A, 0xA8, 0x37, 0xE1, 0xE4, 0x82, 0xA8, 0x41, 0x2A, 0xB3, 0x9D, 0x15, 0xAA, 0xCD, 0x62, 0x96,
+    0x9D, 0xE6, 0x7A, 0xA9, 0x33, 0x10, 0x31, 0xA1, 0x3F, 0x7B, 0xC2, 0x22, 0xD2, 0xDA, 0x46, 0x1D,
+    0xAA, 0x42, 0x9F, 0x0E, 0xA3, 0xB2, 0x9B, 0xB6, 0x04, 0x12, 0xAD, 0xB9, 0xB8, 0x64, 0xE5, 0x12,
+    0x86, 0x0E, 0xAA, 0x42, 0x65, 0x22, 0xBD, 0xA5, 0xA0, 0x75, 0x41, 0x2B, 0xBB, 0x15, 0xBC, 0xFA,
+    0xAB, 0x57, 0xF0, 0x8D, 0x62, 0xA0, 0x95, 0xF5, 0x99, 0xE2, 0x46, 0x42, 0x6E, 0x85, 0xAE, 0x3B,
+    0x1C, 0xC5, 0x15, 0xD8, 0x16, 0x49, 0xDA, 0x62, 0x1A, 0x17, 0x38, 0x71, 0xF9, 0x68, 0xAE, 0xDD,
+    0x3D, 0xA2, 0xBA, 0x76, 0xC5, 0x19, 0xB4, 0x99, 0xD6, 0x8A, 0x29, 0x26, 0x57, 0x66, 0x9B, 0xB5,
+    0xAB, 0x5D, 0x3A, 0x71, 0x1D, 0x0C, 0x13, 0xC1, 0x25, 0x96, 0x5B, 0xC7, 0x7C, 0x04, 0xA6, 0x1D,
+    0x1C, 0x4C, 0x20, 0x59, 0x20, 0x0E, 0xCE, 0x3A, 0xF8, 0x5B, 0xF5, 0xF0, 0xB0, 0x92, 0xB3, 0xF6,
+    0xED, 0x38, 0xC6, 0x56, 0xC3, 0x27, 0x2C, 0xC7, 0x2A, 0x87, 0x7A, 0x95, 0x17, 0x84, 0x5C, 0x42,
+    0x69, 0x41, 0xE0, 0xA0, 0xF5, 0x47, 0x2B, 0x96, 0xBC, 0xAD, 0xE4, 0x16, 0x39, 0x28, 0x59, 0x9E,
+    0xE2, 0xB6, 0x5F, 0xE6, 0x36, 0x4A, 0x8B, 0x79, 0x98, 0x61, 0xB2, 0x48, 0x0C, 0x5F, 0xA1, 0xCB,
+    0xC5, 0xEE, 0x4F, 0xA3, 0xFF, 0xA0, 0xD2, 0x90, 0x83, 0x26, 0xE7, 0x3E, 0x14, 0x78, 0x9B, 0xA5,
+    0x82, 0x81, 0x42, 0xAE, 0x52, 0xC4, 0x5C, 0x0F, 0x95, 0x70, 0xCB, 0x14, 0x51, 0xB1, 0x4E, 0x3A,
+    0x57, 0xF5, 0xC3, 0x1C, 0x27, 0x2D, 0x49, 0x6F, 0x55, 0x73, 0x9D, 0x4A, 0x2B, 0x54, 0x9E, 0xE0,
+    0x17, 0x40, 0x31, 0x43, 0xA6, 0x31, 0xAA, 0x28, 0xD7, 0x24, 0x7C, 0xC8, 0x86, 0x05, 0x7A, 0xF0,
+    0x85, 0xDD, 0x7D, 0x97, 0x70, 0x22, 0x4B, 0x88, 0x02, 0x87, 0xDD, 0xB8, 0x04, 0x00, 0xC7, 0x09,
+    0x7A, 0xE8, 0x1E, 0x89, 0xB9, 0xAD, 0xF6, 0xA6, 0x6A, 0x7B, 0xA8, 0x02, 0x22, 0xAD, 0x40, 0xA7,
+    0x90, 0x6B, 0xDB, 0xCA, 0x51, 0xDA, 0xB6, 0xDE, 0x2A, 0x9E, 0x45, 0x91, 0x96, 0x16, 0x32, 0x64,
+    0xDE, 0xC0, 0x22, 0x22, 0x89, 0x2C, 0xED, 0x83, 0x0B, 0x2C, 0xE5, 0xB2, 0x64, 0xD9, 0x2A, 0x31,
+    0x5B, 0x58, 0x5A, 0x15, 0x29, 0x3A, 0xD8, 0x36, 0x56, 0x0F, 0xC2, 0x45, 0xF6, 0x1D, 0x34, 0xC0,
+    0xC5, 0x30, 0x62, 0x03, 0xBA, 0xB8, 0x50, 0x1B, 0x52, 0x52, 0x20, 0x27, 0x16, 0x93, 0xA9, 0xF4,
+    0xE9, 0x23, 0x07, 0x8C, 0x3F, 0x61, 0x12, 0x83, 0xD8, 0xD4, 0xDA, 0xF6, 0x03, 0x4B, 0xA6, 0x5A,
+    0xCD, 0x01, 0x3C, 0x68, 0xA8, 0x1E, 0x5B, 0x45, 0x06, 0xAA, 0x90, 0x08, 0x8B, 0xA4, 0x2E, 0x40,
+    0x2E, 0xF5, 0xA6, 0x81, 0x75, 0x02, 0x89, 0xC9, 0x19, 0xB7, 0x00, 0x11, 0x6C, 0x84, 0x28, 0x62,
+    0xDC, 0x15, 0xBB, 0x6D, 0x09, 0xD6, 0x7B, 0xA3, 0xC7, 0x6D, 0xA4, 0x21, 0x6D, 0x13, 0x6B, 0xF5,
+    0x22, 0x71, 0xD0, 0xCF, 0x4A, 0x74, 0x73, 0x39, 0x21, 0xD8, 0x64, 0x32, 0x37, 0xA6, 0x2C, 0x99,
+    0xA1, 0xB9, 0x44, 0x6B, 0x82, 0x4D, 0x34, 0x14, 0xEA, 0xCD, 0xB5, 0xA9, 0xB9, 0x82, 0x5C, 0xA3,
+    0x85, 0x0C, 0xB3, 0x64, 0x89, 0xD8, 0x11, 0x08, 0x96, 0x2C, 0xCB, 0x12, 0x56, 0x50, 0xC7, 0xC1,
+    0xCA, 0x14, 0x2C, 0x29, 0x2C, 0x36, 0x71, 0x77, 0x9F, 0x52, 0x80, 0x5C, 0x02, 0xD7, 0x02, 0xC8,
+    0xA5, 0x55, 0xDD, 0x7A, 0x6A, 0x11, 0x50, 0x48, 0x74, 0xC6, 0xE5, 0xE1, 0x68, 0x5A, 0xB5, 0x06,
+    0x29, 0x14, 0x0D, 0xE8, 0x9F, 0xB6, 0x36, 0x43, 0x49, 0x5A, 0x60, 0x48, 0x69, 0x58, 0x3D, 0x88,
+    0x4C, 0x48, 0xE9, 0x35, 0x81, 0x25, 0xB4, 0x42, 0x6E, 0x23, 0x29, 0x3E, 0xD1, 0x55, 0xE9, 0xB3,
+    0x55, 0x84, 0xE6, 0x92, 0x85, 0x98, 0x19, 0xB1, 0xC1, 0x92, 0x26, 0xB8, 0x86, 0x4D, 0x58, 0x0F,
+    0xE9, 0xE2, 0xAE, 0xCD, 0x3C, 0xAD, 0xE5, 0xCA, 0x75, 0x6C, 0x24, 0x0F, 0xA9, 0x08, 0xD5, 0xAB,
+    0x88, 0xAC, 0xAD, 0x5B, 0x36, 0x03, 0x8C, 0xC8, 0x05, 0x69, 0x09, 0xA0, 0x2E, 0x9B, 0x02, 0x86,
+    0xC8, 0xC1, 0xC8, 0x52, 0xD3, 0x41, 0xAF, 0x85, 0xC7, 0xEA, 0x2D, 0x8A, 0x23, 0x8D, 0x9E, 0xC4,
+    0x4B, 0x73, 0x15, 0x43, 0x35, 0x15, 0xAC, 0xDD, 0x05, 0x59, 0x73, 0xCE, 0x05, 0x51, 0x84, 0x82,
+    0x9C, 0x42, 0x7A, 0x6A, 0x60, 0x01, 0x31, 0x15, 0xB1, 0xCD, 0xB2, 0x7D, 0xE6, 0x1E, 0x0D, 0x25,
+    0x79, 0x57, 0x58, 0x82, 0x2A, 0xE5, 0xEC, 0x62, 0x9B, 0xE2, 0xAF, 0x23, 0xAE, 0x48, 0x85, 0xF5,
+    0x6B, 0xF5, 0x0E, 0x63, 0x89, 0x30, 0xAD, 0x86, 0x4E, 0x58, 0x6C, 0x98, 0x69, 0x2D, 0xCC, 0x8E,
+    0x42, 0xD0, 0x35, 0x04, 0x66, 0x88, 0xD0, 0x10, 0xBC, 0xDE, 0xD0, 0xAA, 0x97, 0xAB, 0x55, 0x40,
+    0x7E, 0x8F, 0x98, 0x61, 0xA6, 0x37, 0xA0, 0x1E, 0x57, 0xB4, 0x90, 0x57, 0x5D, 0xDA, 0xE4, 0x73,
+    0x54, 0x92, 0x6C, 0x2E, 0x26, 0x1F, 0x66, 0x00, 0x8E, 0xF2, 0x0B, 0xA0, 0x45, 0xFC, 0x01, 0x84,
+    0x4C, 0x68, 0xAE, 0xA2, 0x35, 0xC3, 0x42, 0x18, 0xD5, 0xFA, 0x4A, 0x28, 0x1A, 0x1C, 0x2E, 0x0D,
+    0xE7, 0x3A, 0x96, 0xAB, 0x0F, 0x84, 0x2E, 0xA6, 0x32, 0x55, 0xC9, 0x4A, 0x6D, 0x6A, 0x5E, 0x3E,
+    0x3E, 0xB8, 0xDA, 0x1B, 0x04, 0x6B, 0x8A, 0xB1, 0x49, 0x6F, 0x83, 0xBC, 0x7A, 0xC3, 0x35, 0x09,
+    0xD3, 0xAA, 0x94, 0xB9, 0x50, 0x24, 0xE4, 0x24, 0x12, 0x89, 0xA2, 0x80, 0xF9, 0xA8, 0x55, 0xB2,
+    0x75, 0xAE, 0xA6, 0x95, 0x80, 0xAA, 0x72, 0x21, 0xEC, 0x61, 0x20, 0x4B, 0x3D, 0xA2, 0x8C, 0x42,
+    0x13, 0x28, 0x70, 0xCF, 0x52, 0x19, 0x7F, 0xD8, 0x32, 0x33, 0xA4, 0xC4, 0xD0, 0x4D, 0x51, 0x7C,
+    0xCA, 0x36, 0x49, 0x64, 0xF8, 0x41, 0xE2, 0xC9, 0x63, 0xD9, 0x16, 0x73, 0x27, 0x20, 0x11, 0xC0,
+    0x62, 0x3D, 0x73, 0x24, 0xD8, 0xFA, 0xAA, 0xE7, 0xA4, 0x5A, 0x6B, 0xD9, 0x96, 0xBB, 0x3A, 0x31,
+    0x68, 0xCF, 0x80, 0xAD, 0x6A, 0xBA, 0xA0, 0xF0, 0x2E, 0x87, 0x03, 0x8F, 0x60, 0x26, 0x67, 0x7D,
+    0x0B, 0xE8, 0x68, 0xAD, 0x49, 0x3C, 0x47, 0xE2, 0x9C, 0x4A, 0xC7, 0xB0, 0x61, 0x54, 0x6D, 0xE9,
+    0x06, 0x05, 0xA7, 0xB5, 0x90, 0x98, 0x5F, 0x8F, 0x6E, 0x5A, 0xEE, 0xB9, 0x15, 0x8B, 0xD5, 0x69,
+    0xB9, 0x7A, 0xB2, 0xB3, 0xDC, 0x74, 0xEC, 0x9A, 0xB2, 0xAF, 0x5A, 0x16, 0x08, 0xF6, 0xAC, 0x97,
+    0x83, 0xAA, 0xB5, 0x82, 0x74, 0xA4, 0xDC, 0x36, 0x57, 0x01, 0x4D, 0x01, 0x6D, 0xF8, 0x0B, 0x11,
+    0x34, 0x58, 0x5C, 0x10, 0x58, 0x16, 0x41, 0x70, 0x89, 0x6B, 0xAC, 0x8C, 0x5B, 0x79, 0x0D, 0x69,
+    0x68, 0xB5, 0x55, 0x6B, 0x25, 0x99, 0x0D, 0x06, 0x03, 0x2C, 0x91, 0xAB, 0x0F, 0xA1, 0x7E, 0x81,
+    0x02, 0xEE, 0x9B, 0x05, 0x72, 0x6C, 0xC7, 0x12, 0xA2, 0x6C, 0xD6, 0xBA, 0x06, 0x08, 0xDF, 0x4E,
+    0x2A, 0x02, 0x13, 0xAA, 0x0D, 0xDA, 0x15, 0x12, 0xA2, 0xCC, 0xB1, 0x06, 0xA6, 0x5A, 0x02, 0x36,
+    0x2F, 0x21, 0x43, 0x89, 0x81, 0xA0, 0x7D, 0xBB, 0x04, 0x52, 0xB9, 0xBC, 0xFD, 0x90, 0x52, 0x29,
+    0x51, 0xA4, 0xE4, 0x24, 0x43, 0x56, 0x76, 0xE6, 0x7A, 0x14, 0x68, 0xEE, 0x2B, 0xC9, 0x02, 0x0D,
+    0x49, 0x5E, 0xE5, 0x00, 0xE9, 0x1F, 0xB6, 0x4D, 0xDE, 0xF0, 0x70, 0x74, 0x25, 0xC7, 0x82, 0xB6,
+    0x02, 0x28, 0x9F, 0x1D, 0xB2, 0x18, 0x0F, 0x64, 0x42, 0xE0, 0xEA, 0x0C, 0x2A, 0x28, 0xE1, 0xAD,
+    0x28, 0x71, 0x64, 0x0D, 0x19, 0x02, 0xE8, 0x01, 0xF1, 0xB2, 0x56, 0xAB, 0x08, 0x5D, 0x0E, 0x65,
+    0x92, 0x5E, 0xA9, 0x24, 0x35, 0x61, 0xE4, 0x82, 0xA0, 0x20, 0x17, 0x57, 0x50, 0xB7, 0x9C, 0xE4,
+    0x02, 0x6B, 0xE8, 0x14, 0x05, 0x43, 0x6B, 0x41, 0x74, 0x35, 0xA4, 0x75, 0x4D, 0x06, 0x70, 0xAB,
+    0x6A, 0x20, 0x7C, 0xD7, 0xEB, 0xB2, 0xAE, 0xBD, 0xE0, 0x20, 0x05, 0x5D, 0x7C, 0x4A, 0x51, 0x97,
+    0xB6, 0x86, 0x8B, 0x10, 0xDE, 0x17, 0x8B, 0x29, 0x40, 0x16, 0x25, 0x37, 0x52, 0x19, 0x62, 0xCC,
+    0x9C, 0xDA, 0x0F, 0x61, 0xBD, 0x54, 0xF8, 0xE9, 0x88, 0x89, 0x88, 0xC4, 0xD3, 0x16, 0x80, 0x41,
+    0x00, 0x70, 0x2D, 0xC1, 0x48, 0x59, 0xCF, 0x54, 0xAA, 0x32, 0x68, 0xE9, 0x38, 0x03, 0x73, 0x01,
+    0x1E, 0x06, 0x88, 0x86, 0xC2, 0xA5, 0x7D, 0x15, 0x28, 0xD4, 0xBD, 0x1C, 0x0D, 0x68, 0x21, 0x21,
+    0x72, 0x91, 0x52, 0xA0, 0x55, 0x13, 0xE0, 0x30, 0x05, 0x2C, 0xCB, 0xFA, 0x74, 0xC0, 0xAD, 0x5E,
+    0x93, 0xB0, 0x96, 0x52, 0x49, 0x11, 0x86, 0x56, 0x6E, 0x89, 0x42, 0x6C, 0xAF, 0x21, 0xE6, 0xA1,
+    0x34, 0xD7, 0x10, 0xB7, 0x93, 0x00, 0x2F, 0xD6, 0x5A, 0xC4, 0x08, 0xD7, 0x3E, 0x09, 0x47, 0xC2,
+    0x19, 0x22, 0xA6, 0xD9, 0x61, 0x90, 0x88, 0xDA, 0x82, 0x38, 0x11, 0x74, 0x80, 0xDB, 0x8A, 0x8B,
+    0x53, 0xF5, 0xCB, 0x6A, 0x6A, 0xE8, 0x2B, 0x4D, 0x5E, 0x7B, 0xB6, 0xFA, 0x9B, 0xE2, 0x4D, 0x18,
+    0x27, 0x63, 0x71, 0xEC, 0xC2, 0x02, 0xB6, 0xD6, 0x24, 0x43, 0x18, 0x8B, 0xA2, 0x22, 0xE8, 0x28,
+    0x40, 0xC0, 0xC2, 0xEA, 0x70, 0x0C, 0x63, 0xE0, 0xCF, 0xC7, 0xA5, 0x51, 0x21, 0xB4, 0xA2, 0xE9,
+    0xE5, 0x02, 0xB2, 0x22, 0xC4, 0x5C, 0x1F, 0x0D, 0x92, 0x07, 0xB4, 0x88, 0x21, 0x47, 0xC7, 0x26,
+    0x0F, 0x7C, 0x3B, 0x29, 0xA0, 0x4D, 0x27, 0x1E, 0x04, 0x26, 0x56, 0x82, 0x13, 0xD0, 0x1F, 0x01,
+    0x49, 0x8A, 0xE1, 0x9A, 0x6C, 0xA5, 0xD8, 0x33, 0xC3, 0x14, 0xC4, 0x80, 0x0B, 0xFA, 0x08, 0xDC,
+    0xB4, 0x5A, 0x61, 0x12, 0xB4, 0x2D, 0x24, 0x61, 0x22, 0x84, 0xA0, 0xC1, 0x7A, 0x35, 0x88, 0xBB,
+    0x28, 0x88, 0xE5, 0xB2, 0xB5, 0x40, 0x40, 0x8A, 0xD5, 0x2F, 0xD7, 0x92, 0x53, 0xFD, 0x6A, 0x04,
+    0x04, 0x32, 0x68, 0xD5, 0x1F, 0xC9, 0xAF, 0xDA, 0x7A, 0x80, 0x50, 0x0A, 0x44, 0xD7, 0xC1, 0x21,
+    0x1A, 0x15, 0x20, 0x82, 0x30, 0x16, 0xB2, 0xC1, 0xC6, 0x7E, 0xC5, 0x2C, 0x39, 0xC8, 0x58, 0x5A,
+    0x07, 0x72, 0x1C, 0x94, 0x9C, 0x54, 0xA9, 0x81, 0x9E, 0x8C, 0x1D, 0xB9, 0x72, 0x35, 0xC4, 0x6C,
+    0xEB, 0x4C, 0x24, 0x80, 0xAF, 0x09, 0xA6, 0xB7, 0x95, 0xD6, 0x03, 0x07, 0x19, 0x05, 0xAC, 0x11,
+    0x23, 0x66, 0x4A, 0x0A, 0x3D, 0x6D, 0x98, 0x81, 0x1C, 0x85, 0x2A, 0x57, 0xD2, 0x91, 0x8E, 0xEA,
+    0xD6, 0x05, 0x81, 0x70, 0x56, 0x08, 0x92, 0xA3, 0xD2, 0x5A, 0x4D, 0xEB, 0x44, 0xD0, 0x5C, 0xAB,
+    0x7A, 0x14, 0xE8, 0x41, 0xB8, 0xD6, 0x2A, 0x82, 0x01, 0x55, 0xDD, 0x92, 0x52, 0x78, 0x2A, 0x49,
+    0x42, 0x2C, 0x46, 0xC1, 0xF9, 0x9C, 0x54, 0x47, 0x61, 0x8B, 0x35, 0x48, 0xFC, 0x89, 0x0A, 0xBA,
+    0xE6, 0x1E, 0x25, 0xAD, 0x81, 0x40, 0xD4, 0xE3, 0xF1, 0xC7, 0xA7, 0x55, 0x9F, 0xC6, 0x62, 0x96,
+    0x4C, 0x2B, 0xC7, 0x81, 0xD5, 0x16, 0x19, 0xAB, 0x72, 0xD5, 0x63, 0x88, 0x59, 0x25, 0x63, 0x80,
+    0xAF, 0xB5, 0xB1, 0xEA, 0x93, 0x59, 0xAE, 0x49, 0x53, 0xC4, 0xD4, 0x19, 0xD5, 0xA8, 0x2E, 0xAA,
+    0x24, 0x73, 0xD3, 0x86, 0xD0, 0x6A, 0x55, 0x50, 0x5A, 0x27, 0x20, 0x4E, 0x21, 0x0C, 0x44, 0x4A,
+    0x61, 0x1D, 0xA3, 0x39, 0x14, 0xCA, 0xF9, 0xC3, 0x85, 0x8B, 0xAA, 0x25, 0x60, 0x01, 0x66, 0xF5,
+    0x82, 0xD8, 0xAD, 0x5A, 0x24, 0x4E, 0x56, 0x22, 0x90, 0xA7, 0xC9, 0xEE, 0x45, 0xC4, 0xF5, 0x16,
+    0x55, 0x51, 0xEB, 0xD6, 0x70, 0xA2, 0x12, 0x4E, 0x10, 0x06, 0xB1, 0xAC, 0x59, 0x08, 0xAD, 0x00,
+    0x50, 0xA1, 0x2E, 0x98, 0xC0, 0x85, 0x50, 0xAE, 0x5B, 0x24, 0xC2, 0x36, 0xC1, 0xF5, 0xEC, 0x90,
+    0xCB, 0x26, 0x5C, 0xA5, 0xB4, 0x99, 0xEB, 0xA5, 0x64, 0x24, 0x81, 0x61, 0x5F, 0x70, 0x71, 0xB0,
+    0xB5, 0xE4, 0x4A, 0xC4, 0xFD, 0x90, 0xD0, 0x35, 0x9C, 0x82, 0x6B, 0x0F, 0x70, 0x76, 0xB9, 0xCA,
+    0xB3, 0x52, 0xB9, 0xED, 0x12, 0x5E, 0x6E, 0x1D, 0xB9, 0x20, 0x51, 0x8F, 0x96, 0x50, 0xAE, 0xB9,
+    0x56, 0x72, 0x75, 0xBB, 0x58, 0x6D, 0xC4, 0xAD, 0x27, 0xD2, 0xBA, 0x75, 0x19, 0x64, 0xEE, 0xAD,
+    0xAA, 0x55, 0xC1, 0x2D, 0xD9, 0x39, 0x00, 0x50, 0xA2, 0x9D, 0x6E, 0xBD, 0xA4, 0x0D, 0x24, 0xC6,
+    0x6E, 0x56, 0x51, 0x02, 0xB4, 0x06, 0x25, 0x34, 0xB8, 0x47, 0x01, 0xAD, 0x6E, 0x37, 0x3A, 0x9C,
+    0xE5, 0x14, 0x08, 0xA2, 0x9D, 0x3B, 0x0B, 0x70, 0xBD, 0xC2, 0x4D, 0x0A, 0xA1, 0x1E, 0x5A, 0xDD,
+    0x22, 0x0E, 0x74, 0x4B, 0x6B, 0xAB, 0x56, 0xAD, 0x20, 0xF3, 0x41, 0xCC, 0xF3, 0x51, 0xB5, 0xB6,
+    0x0A, 0xD3, 0x12, 0x04, 0x28, 0x16, 0x2D, 0x21, 0x34, 0x7F, 0x10, 0x9F, 0x79, 0x14, 0x23, 0xAE,
+    0xA3, 0x14, 0x7C, 0xEE, 0xF6, 0x9A, 0x8B, 0x62, 0xC8, 0x4E, 0x39, 0x58, 0x65, 0xAE, 0x49, 0x71,
+    0x37, 0x2E, 0x21, 0xAD, 0x28, 0x6A, 0xB5, 0xAA, 0x66, 0xF6, 0x2E, 0x21, 0x42, 0x73, 0xE7, 0x9A,
+    0x9D, 0xB6, 0x05, 0x64, 0x34, 0xAB, 0x57, 0xE0, 0xD9, 0x6D, 0x65, 0x42, 0x2D, 0xAD, 0x55, 0x03,
+    0x14, 0x64, 0x15, 0xC2, 0x83, 0x4F, 0xD6, 0x21, 0x64, 0x09, 0x45, 0x23, 0xE1, 0x15, 0x70, 0x52,
+    0xC3, 0xF2, 0x8A, 0xD1, 0xF2, 0xA7, 0x78, 0xD0, 0x48, 0x2B, 0x7A, 0x04, 0xBB, 0xE5, 0xB6, 0xF8,
+    0xE9, 0x2C, 0x5A, 0x47, 0xDE, 0x66, 0xA5, 0x25, 0x93, 0xD6, 0x56, 0x3D, 0x6E, 0x81, 0x01, 0xB3,
+    0x5B, 0xEB, 0x98, 0x84, 0xAC, 0x55, 0x49, 0xB9, 0xD5, 0xDA, 0x56, 0xC0, 0x0E, 0xA2, 0x5C, 0xE7,
+    0xE6, 0xBA, 0xA5, 0x83, 0x10, 0x3C, 0xB5, 0x06, 0xEA, 0x55, 0xC5, 0xA2, 0x95, 0x10, 0xB0, 0x63,
+    0xC7, 0x56, 0xB5, 0x1A, 0x24, 0xC0, 0x8A, 0x8E, 0x5B, 0xB4, 0x04, 0x60, 0x69, 0xA5, 0xA0, 0x4E,
+    0x9D, 0x3A, 0x13, 0x0A, 0x16, 0x5C, 0x64, 0xD4, 0xF0, 0xA2, 0x12, 0x05, 0x17, 0x2D, 0x12, 0xB2,
+    0xC8, 0xA8, 0x15, 0x2B, 0x96, 0x90, 0x25, 0x4B, 0xA6, 0x80, 0xAD, 0xD1, 0x40, 0x6C, 0xC5, 0x14,
+    0xF1, 0x00, 0x10, 0x62, 0x90, 0x24, 0x59, 0x21, 0x12, 0x54, 0x64, 0x76, 0x9C, 0x01, 0xB7, 0x1B,
+    0xA7, 0x3D, 0xB3, 0x9C, 0x03, 0x41, 0xDB, 0xB5, 0x42, 0x17, 0x24, 0xD2, 0x13, 0x4F, 0xED, 0x04,
+    0xB7, 0x62, 0x84, 0x26, 0xFA, 0x3A, 0x60, 0xC0, 0x1D, 0x33, 0xFF, 0x72, 0x08, 0x4C, 0x1A, 0xEC,
+    0xED, 0xCE, 0xA3, 0x02, 0xCB, 0x6E, 0x6A, 0xE0, 0xD3, 0xE4, 0x04, 0x52, 0x8E, 0x4A, 0x7D, 0xA5,
+    0x98, 0x20, 0xCA, 0xC1, 0x83, 0x75, 0x04, 0x46, 0x73, 0x64, 0xE8, 0x41, 0x10, 0x43, 0x56, 0x85,
+    0x9E, 0xF1, 0xB9, 0xE0, 0xEB, 0x3B, 0x31, 0x0E, 0x48, 0x05, 0xC5, 0xD5, 0x46, 0xA0, 0x59, 0x42,
+    0x86, 0x0E, 0x81, 0xC8, 0xC1, 0x87, 0x2B, 0xC0, 0x24, 0x51, 0x0D, 0x9D, 0xAA, 0x0A, 0x91, 0x4B,
+    0xB1, 0x84, 0x62, 0xAA, 0x0A, 0x94, 0x13, 0x82, 0x14, 0x45, 0xBB, 0x28, 0xAB, 0x8A, 0x39, 0x20,
+    0xF4, 0x8C, 0xDD, 0x30, 0x0E, 0xAA, 0xEE, 0x4C, 0x12, 0x35, 0x49, 0x55, 0x88, 0x5C, 0xE4, 0x54,
+    0xB5, 0x2B, 0xB4, 0x51, 0x23, 0xAE, 0x5F, 0xB9, 0x12, 0x72, 0x7B, 0xD7, 0xEE, 0x49, 0x55, 0xF4,
+    0x00, 0xBD, 0xB5, 0x4B, 0x6F, 0x80, 0xDB, 0xAE, 0x7C, 0xD8, 0x16, 0x29, 0x28, 0xAA, 0x2B, 0x4D,
+    0x39, 0x64, 0xDB, 0x92, 0x75, 0x72, 0x53, 0x94, 0xBF, 0x39, 0x73, 0xA7, 0x22, 0x60, 0x12, 0x64,
+    0xC7, 0xBB, 0x7D, 0xB4, 0x46, 0x2C, 0x5A, 0x55, 0x47, 0xA0, 0x13, 0x27, 0x55, 0xBF, 0x92, 0x52,
+    0xD9, 0xB6, 0x6D, 0x9C, 0x25, 0x73, 0xF5, 0xAD, 0xE2, 0x52, 0x68, 0x69, 0x20, 0x51, 0x85, 0x7A,
+    0x25, 0x2D, 0xF1, 0xD6, 0x2E, 0x1F, 0x39, 0x8B, 0x9C, 0x3A, 0xCD, 0x67, 0xCA, 0xE9, 0xE4, 0xC9,
+    0x2E, 0x8A, 0x98, 0x02, 0x2A, 0x07, 0xE0, 0x25, 0x1B, 0x65, 0x09, 0xB6, 0xE5, 0x58, 0xD4, 0x89,
+    0x93, 0xB4, 0x56, 0x29, 0xC5, 0x75, 0x9C, 0x96, 0x2B, 0xD8, 0xB6, 0x74, 0x3D, 0x0A, 0x11, 0x72,
+    0x48, 0xD4, 0xAA, 0x54, 0xF7, 0xA4, 0x06, 0xA3, 0xB1, 0x96, 0x8E, 0x40, 0x34, 0x67, 0xD3, 0x06,
+    0x02, 0x51, 0xF1, 0x98, 0x04, 0xAE, 0xF9, 0x72, 0x9D, 0x02, 0x97, 0x90, 0x6D, 0x91, 0x82, 0x72,
+    0xBA, 0xD2, 0x24, 0x4B, 0x76, 0x2A, 0x1A, 0x26, 0xFE, 0x10, 0xDC, 0x9C, 0x33, 0x37, 0x17, 0xAD,
+    0x7D, 0x8B, 0x12, 0x15, 0x4A, 0x5A, 0xE7, 0x2D, 0xA3, 0x4B, 0x6D, 0xF3, 0x05, 0x72, 0x2A, 0xE7,
+    0xED, 0xDB, 0x4B, 0x45, 0xE3, 0x3A, 0x71, 0x9C, 0xD6, 0x09, 0xB8, 0x60, 0x42, 0x3C, 0xD2, 0x59,
+    0x05, 0xA2, 0x62, 0xBE, 0x84, 0x58, 0x20, 0xA4, 0xE1, 0xB2, 0x55, 0x30, 0x84, 0x8D, 0x06, 0x7E,
+    0xCA, 0x4A, 0x53, 0xF6, 0xA4, 0x23, 0x08, 0x36, 0xAB, 0xAA, 0x5D, 0x8B, 0x73, 0x12, 0x4E, 0x2A,
+    0xB5, 0xB4, 0xD6, 0xBA, 0x77, 0xAF, 0x16, 0x04, 0x08, 0x10, 0x62, 0x41, 0x00, 0x89, 0x65, 0x2C,
+    0x16, 0xB5, 0x82, 0x21, 0x6C, 0x74, 0x64, 0x13, 0xE7, 0xDA, 0x5A, 0xF7, 0x20, 0x40, 0xB0, 0x42,
+    0xC5, 0x8A, 0x15, 0x96, 0x2C, 0x31, 0x10, 0x2A, 0x62, 0x13, 0xAA, 0x60, 0x9E, 0x5D, 0x9F, 0x42,
+    0x9C, 0xFB, 0xC8, 0x84, 0x5B, 0x2A, 0x54, 0x78, 0xBA, 0x5D, 0xDA, 0x56, 0xB3, 0x83, 0x44, 0x42,
+    0x15, 0xC4, 0x40, 0x6A, 0x53, 0x01, 0xCB, 0x26, 0x71, 0x20, 0x1A, 0x45, 0x54, 0x68, 0xC2, 0x5A,
+    0xA5, 0x31, 0xBA, 0xAA, 0x7D, 0x24, 0x25, 0xAD, 0x2A, 0xAD, 0x18, 0x28, 0x64, 0x73, 0x52, 0x21,
+    0x12, 0x92, 0x9C, 0x73, 0x59, 0xAE, 0x15, 0xF4, 0x86, 0xA5, 0x21, 0xC8, 0x13, 0xB8, 0x56, 0x60,
+    0x0B, 0xD4, 0xCA, 0xE0, 0xAA, 0x6B, 0x9C, 0x9C, 0xB3, 0xCB, 0x07, 0x10, 0xD2, 0x40, 0x86, 0xF6,
+    0x08, 0x08, 0x7A, 0xA5, 0x2A, 0x1A, 0x0F, 0x37, 0x83, 0x52, 0x08, 0xA3, 0x55, 0x54, 0x2D, 0x9C,
+    0x42, 0xD9, 0x5A, 0x7D, 0x16, 0x34, 0x98, 0x83, 0xB9, 0x63, 0x15, 0x75, 0x14, 0xE5, 0xB8, 0xA4,
+    0x89, 0x1D, 0x6D, 0x09, 0x39, 0x2C, 0x11, 0x57, 0x68, 0xD5, 0xAE, 0x82, 0xAF, 0xC4, 0x39, 0x96,
+    0xF6, 0x19, 0x88, 0xAE, 0xBD, 0xF2, 0x5A, 0x63, 0x59, 0x84, 0x10, 0xD4, 0xA0, 0x4F, 0xB5, 0x42,
+    0x9C, 0x6B, 0x82, 0x8A, 0x5B, 0x43, 0x2C, 0x15, 0xD8, 0x6C, 0xD2, 0x56, 0x8A, 0xC3, 0xAE, 0x75,
+    0x54, 0x21, 0xD2, 0x3A, 0x81, 0x02, 0x12, 0x27, 0x73, 0xB3, 0x45, 0x7A, 0x23, 0x88, 0xEB, 0x1A,
+    0x0F, 0xA2, 0xD0, 0xE0, 0x04, 0xC1, 0xF6, 0x19, 0x85, 0x5A, 0x63, 0x15, 0x05, 0xEB, 0xE8, 0xD8,
+    0x5A, 0x4B, 0x51, 0x6F, 0xBA, 0x5E, 0xA1, 0xC0, 0xCD, 0x01, 0x05, 0xA6, 0x72, 0xAC, 0x18, 0x1A,
+    0x20, 0x80, 0x0B, 0x57, 0xBB, 0x60, 0xAF, 0xE4, 0x03, 0xFB, 0x6B, 0x2E, 0x16, 0x39, 0x41, 0xA0,
+    0x16, 0x36, 0x71, 0x76, 0x31, 0x62, 0x79, 0x60, 0x25, 0x6E, 0xB4, 0x6B, 0x15, 0xF1, 0x8E, 0x5C,
+    0x72, 0x29, 0x28, 0x80, 0x04, 0xB5, 0x2D, 0x42, 0xAB, 0x08, 0x19, 0xED, 0x23, 0x4C, 0x57, 0x9E,
+    0x62, 0x47, 0x8B, 0xCD, 0x39, 0xAA, 0xA7, 0xB7, 0x10, 0x2D, 0xC3, 0x3F, 0xB9, 0xA8, 0x65, 0xE9,
+    0x00, 0x2A, 0x54, 0x9B, 0xB5, 0x7E, 0xD9, 0x13, 0x8A, 0x78, 0x22, 0xD1, 0x23, 0x67, 0x13, 0xAA,
+    0x64, 0x24, 0x25, 0x0E, 0x85, 0xC5, 0x6E, 0x7B, 0x29, 0xDE, 0x11, 0xA7, 0x96, 0xA3, 0x9B, 0x04,
+    0x85, 0xA1, 0x92, 0xC3, 0xB4, 0xAC, 0xD3, 0x48, 0x4E, 0x4A, 0x84, 0x15, 0x90, 0x0B, 0xB2, 0x62,
+    0x94, 0xF6, 0x46, 0x09, 0x35, 0x45, 0xF9, 0x92, 0x3F, 0x7F, 0x69, 0xAD, 0x7C, 0x4C, 0x2B, 0x66,
+    0x6D, 0x56, 0x7B, 0x32, 0xEC, 0x01, 0xB4, 0x02, 0x08, 0xE0, 0xA0, 0xB9, 0x45, 0x13, 0x6E, 0xA5,
+    0x2C, 0x8A, 0xA2, 0xCD, 0x34, 0x50, 0xDB, 0xE0, 0x04, 0x58, 0x02, 0x71, 0x2D, 0x7A, 0x44, 0xB5,
+    0x6A, 0x48, 0x92, 0x96, 0x6E, 0xE5, 0x8F, 0x25, 0xFD, 0x21, 0x96, 0x99, 0x4B, 0x6B, 0xAF, 0xC1,
+    0xCF, 0x0A, 0x60, 0x80, 0x20, 0x03, 0xA1, 0x03, 0xC4, 0x73, 0xC9, 0xF6, 0xA1, 0x90, 0xD3, 0xEB,
+    0x2C, 0xC1, 0x4C, 0x6A, 0x41, 0xED, 0x20, 0x04, 0x11, 0xD2, 0xB4, 0xBD, 0x04, 0x2F, 0x6A, 0xCB,
+    0x16, 0x6A, 0x3E, 0xC5, 0x69, 0x6F, 0xE5, 0x22, 0xDA, 0x95, 0x90, 0x4C, 0x47, 0x5A, 0xFF, 0xB4,
+    0x82, 0xF0, 0x6B, 0x2E, 0xD4, 0xB3, 0x26, 0x10, 0x4A, 0xA4, 0x90, 0x4B, 0x2F, 0x4B, 0x9B, 0x5C,
+    0x1C, 0x55, 0x5E, 0x0C, 0xD5, 0x5C, 0xA1, 0xB6, 0x3A, 0xBC, 0xFE, 0x72, 0x8B, 0xA8, 0x4F, 0xAF,
+    0x38, 0xF6, 0x20, 0xB4, 0x2A, 0x91, 0x36, 0x2C, 0xC1, 0x48, 0xFE, 0xFC, 0x5D, 0x82, 0x4C, 0x39,
+    0x27, 0x06, 0x7B, 0x88, 0x45, 0x7D, 0xCC, 0x5A, 0xA0, 0x16, 0xC0, 0x92, 0x10, 0x7A, 0xC9, 0x00,
+    0xA1, 0x98, 0x90, 0xCC, 0xAE, 0x68, 0xAA, 0x56, 0xAD, 0x3A, 0xF7, 0x4B, 0x5B, 0x02, 0x4B, 0x13,
+    0x29, 0x58, 0x10, 0xA3, 0x68, 0x90, 0x4E, 0x71, 0x04, 0xEE, 0xF1, 0x24, 0xC6, 0x69, 0x19, 0x7B,
+    0x0E, 0x2E, 0xFD, 0x9B, 0xBB, 0x13, 0x17, 0x05, 0xAF, 0x09, 0x28, 0xC4, 0x00, 0x25, 0xE1, 0x59,
+    0x2C, 0x5C, 0x5E, 0x93, 0xE8, 0xDD, 0x59, 0x54, 0x02, 0xA8, 0x5C, 0x61, 0xC2, 0x08, 0xB4, 0x24,
+    0x30, 0xD5, 0x47, 0x08, 0xA3, 0x46, 0x05, 0xA9, 0x32, 0x96, 0xE1, 0xB0, 0x1D, 0xA3, 0x24, 0x4C,
+    0x39, 0x5A, 0x6F, 0xF2, 0x14, 0x86, 0x45, 0x15, 0x38, 0x18, 0xC6, 0x45, 0xCA, 0x44, 0x84, 0x66,
+    0xC6, 0x92, 0x22, 0x44, 0x8F, 0xF1, 0xC9, 0x9E, 0x45, 0x5B, 0x49, 0xA0, 0x1C, 0x84, 0xDE, 0xCD,
+    0xC3, 0x09, 0x29, 0xD3, 0x34, 0x04, 0x95, 0x4F, 0xA9, 0x46, 0xFE, 0x5E, 0x19, 0x96, 0x40, 0xEF,
+    0x57, 0xC7, 0x60, 0xC1, 0x44, 0x92, 0x95, 0x05, 0x10, 0xA0, 0xB5, 0x3F, 0xA4, 0xC4, 0x49, 0x90,
+    0xD5, 0x10, 0x09, 0x92, 0x6B, 0x7A, 0xB4, 0x22, 0x91, 0x83, 0x04, 0x49, 0xA3, 0x10, 0x73, 0xE7,
+    0x8A, 0x49, 0xCB, 0x85, 0x60, 0x1B, 0xCA, 0xB5, 0xDA, 0x98, 0x9C, 0xDB, 0xA6, 0x18, 0x21, 0x7F,
+    0x5D, 0x44, 0x09, 0x32, 0xB0, 0xAF, 0x18, 0xD9, 0xB4, 0x5E, 0x61, 0xCD, 0x75, 0xEA, 0x8F, 0x2A,
+    0xAC, 0xAA, 0x5F, 0x4C, 0xDC, 0x73, 0xF0, 0x8C, 0x10, 0x59, 0x14, 0x69, 0x05, 0xCF, 0xED, 0x01,
+    0x31, 0x91, 0x01, 0x3D, 0x50, 0x87, 0x10, 0x22, 0xEB, 0xC4, 0xC9, 0xC8, 0x39, 0x4F, 0x9F, 0x25,
+    0x52, 0x89, 0x80, 0x6E, 0xBD, 0x5C, 0x56, 0xF9, 0xE4, 0xBA, 0x5B, 0xE5, 0xCA, 0x34, 0xB9, 0xF6,
+    0x9E, 0xD5, 0xD9, 0x8A, 0x50, 0x4E, 0x3D, 0x5A, 0x50, 0x29, 0x1C, 0xD4, 0xC7, 0xC5, 0x41, 0x8C,
+    0xAA, 0x8E, 0x86, 0x18, 0x90, 0xEB, 0xA6, 0x5E, 0xB7, 0xB0, 0x3F, 0x15, 0x70, 0x01, 0xEC, 0x08,
+    0x0D, 0xCB, 0x23, 0x3A, 0x7C, 0x26, 0x72, 0xB9, 0xA7, 0xAB, 0x94, 0x01, 0x55, 0x09, 0x2F, 0x76,
+    0x2B, 0xAB, 0x97, 0xD2, 0xA2, 0x6D, 0x27, 0x54, 0x45, 0xD4, 0xA9, 0x0D, 0x57, 0x31, 0x81, 0x52,
+    0x71, 0xB1, 0x34, 0xB6, 0x49, 0xA4, 0xA2, 0xC9, 0x4E, 0x02, 0xEE, 0x49, 0x70, 0x6E, 0xB6, 0xC2,
+    0x6E, 0xCA, 0xE4, 0xCC, 0x7A, 0xB0, 0x64, 0xBF, 0x3F, 0x47, 0x5B, 0x8D, 0x1C, 0x69, 0xE9, 0x58,
+    0x89, 0x56, 0x95, 0xB5, 0xC6, 0x55, 0x39, 0xD9, 0xDF, 0xE1, 0xAE, 0xD9, 0x5E, 0x10, 0x1A, 0x32,
+    0x10, 0x8D, 0xE2, 0x23, 0xA6, 0xAC, 0x70, 0x6B, 0x3B, 0x2A, 0x57, 0xA3, 0x10, 0x8B, 0x78, 0xD1,
+    0xAA, 0xDC, 0xEA, 0x18, 0x65, 0xC4, 0xDD, 0xF8, 0xCC, 0x0D, 0xC2, 0x52, 0xE5, 0x9F, 0xA2, 0x7B,
+    0xC2, 0x2E, 0x2E, 0x45, 0xB9, 0xEF, 0x83, 0x07, 0x7F, 0x12, 0xF6, 0xAD, 0x5A, 0x75, 0xEE, 0x0B,
+    0x8A, 0x44, 0x00, 0xBD, 0x4A, 0x7B, 0xF0, 0xA0, 0x21, 0x07, 0x4E, 0xD4, 0x72, 0xE1, 0xF8, 0x65,
+    0x2B, 0x54, 0x3E, 0x2C, 0x35, 0x96, 0xB5, 0x0A, 0x90, 0x4E, 0xD6, 0x2A, 0x1F, 0x6B, 0xFD, 0x62,
+    0xC9, 0x72, 0xCD, 0x64, 0xA2, 0x3E, 0xD7, 0x3A, 0x89, 0x0B, 0xD0, 0x9F, 0x55, 0x8D, 0x2A, 0x5F,
+    0x15, 0x50, 0x15, 0x88, 0x19, 0xA1, 0xA3, 0x08, 0x0D, 0xA9, 0x0C, 0xA6, 0xF5, 0x20, 0x04, 0x42,
+    0x84, 0x16, 0x1F, 0x1A, 0xEB, 0x38, 0xEE, 0xE0, 0x4A, 0x66, 0x23, 0xCC, 0x45, 0xD8, 0x95, 0x02,
+    0xA2, 0xB3, 0x39, 0x01, 0x65, 0x2E, 0x59, 0x92, 0x4A, 0x9B, 0x59, 0x67, 0x95, 0x69, 0xFD, 0xDB,
+    0xF5, 0xCA, 0x9A, 0x3D, 0x9F, 0xFA, 0x7E, 0x14, 0xFC, 0xA5, 0xCD, 0xDB, 0x56, 0x21, 0x56, 0xB9,
+    0x14, 0x50, 0x91, 0x10, 0x59, 0x3E, 0x2E, 0x5B, 0xC9, 0x6A, 0xB5, 0xCC, 0x70, 0x57, 0x27, 0xB9,
+    0xD6, 0xB4, 0xE2, 0x3A, 0xB7, 0x07, 0x21, 0xB9, 0x4F, 0x73, 0x55, 0x31, 0x50, 0xC7, 0x80, 0xBE,
+    0x6E, 0xB9, 0xE4, 0x02, 0xE6, 0x62, 0x40, 0xC1, 0x9E, 0x7A, 0x3F, 0xDB, 0x24, 0xB2, 0x54, 0x55,
+    0x8A, 0xD2, 0xBE, 0x7B, 0x3E, 0x11, 0x42, 0xC4, 0x15, 0x70, 0xD7, 0xB3, 0x65, 0x5A, 0xBD, 0x32,
+    0xD4, 0x8A, 0xE5, 0x51, 0x37, 0x23, 0xFF, 0x44, 0x22, 0x14, 0xB7, 0x20, 0x2D, 0x7F, 0x95, 0xAD,
+    0x8C, 0x0A, 0x81, 0x86, 0x5B, 0xB7, 0x21, 0x8B, 0x54, 0xB2, 0x9C, 0x7C, 0x85, 0x88, 0x83, 0x10,
+    0x45, 0xAD, 0x56, 0xE5, 0xE8, 0xE4, 0x20, 0x17, 0x40, 0x09, 0x0F, 0x3D, 0xF8, 0x58, 0xC0, 0x9F,
+    0xCF, 0x35, 0x6B, 0xE1, 0x19, 0x52, 0x05, 0xC1, 0x6C, 0x84, 0x60, 0xCC, 0xE2, 0x56, 0xD5, 0xDA,
+    0xA6, 0xE4, 0xAC, 0xCC, 0x7C, 0xBE, 0xB4, 0x12, 0xBC, 0xE6, 0x5B, 0x5B, 0x2E, 0xAD, 0x1A, 0x55,
+    0x48, 0xCB, 0x65, 0x08, 0x21, 0x2C, 0x15, 0xBF, 0xB0, 0xC4, 0xD2, 0x4C, 0x01, 0x5D, 0xC4, 0x7C,
+    0x08, 0x72, 0x41, 0x60, 0xD5, 0x10, 0xCB, 0xB9, 0x5B, 0xD6, 0x42, 0x82, 0x54, 0xEF, 0x8F, 0x61,
+    0x05, 0x69, 0xD1, 0x1E, 0xAE, 0x82, 0xC5, 0x2A, 0x3B, 0x1D, 0x62, 0x2A, 0xD2, 0x5A, 0xC6, 0x05,
+    0x2A, 0xB3, 0x56, 0x0F, 0x10, 0x8B, 0xA1, 0x1B, 0x03, 0xA1, 0x57, 0x13, 0x3B, 0x1C, 0xAD, 0x45,
+    0x93, 0x78, 0xAE, 0xDA, 0xB9, 0x68, 0x91, 0xCE, 0x35, 0xFA, 0x76, 0x49, 0x56, 0x29, 0x69, 0x04,
+    0x20, 0x4E, 0x8B, 0xC7, 0x6B, 0x21, 0x59, 0x8B, 0xD5, 0x16, 0xD5, 0xD3, 0xAB, 0x22, 0x34, 0x31,
+    0x10, 0x11, 0x8D, 0x55, 0x6C, 0xA2, 0x17, 0x9E, 0x6E, 0x4E, 0x74, 0x15, 0x22, 0xC4, 0xF4, 0x0F,
+    0xD4, 0x0A, 0x59, 0x1F, 0xCD, 0xA5, 0x10, 0x29, 0x92, 0x03, 0xAD, 0x91, 0x1C, 0x31, 0x5D, 0x54,
+    0xD4, 0x89, 0x93, 0x50, 0x7C, 0xB2, 0xAA, 0x34, 0x85, 0xE8, 0x5D, 0xAE, 0x7A, 0x2E, 0xB9, 0x0C,
+    0x90, 0x4C, 0x8F, 0x20, 0xC0, 0x05, 0x43, 0x72, 0x29, 0x34, 0xE4, 0x88, 0x29, 0x5A, 0xBA, 0xFE,
+    0x5A, 0xB1, 0x85, 0xBC, 0xA9, 0xC9, 0xA8, 0x95, 0xFE, 0x16, 0xB5, 0x6D, 0xBB, 0x68, 0xB2, 0xA9,
+    0x23, 0xFE, 0x5E, 0x94, 0x71, 0x04, 0xA9, 0x6D, 0x66, 0x42, 0x2E, 0xDF, 0x9A, 0x50, 0x46, 0x71,
+    0xC0, 0xC1, 0xA2, 0x7C, 0x8A, 0x3A, 0x49, 0x34, 0x8C, 0xCB, 0x0B, 0xA6, 0x69, 0xEB, 0xD0, 0xB5,
+    0x37, 0xAA, 0x18, 0x9F, 0xB7, 0x2C, 0xB2, 0x3A, 0x3A, 0x92, 0xA1, 0x4A, 0x9D, 0xB7, 0x74, 0xB9,
+    0x5E, 0x65, 0x59, 0x27, 0x45, 0xD0, 0xAD, 0x1A, 0x6B, 0x11, 0x42, 0x63, 0x88, 0xA7, 0x9C, 0x18,
+    0x31, 0xDA, 0xAE, 0x4D, 0x4B, 0xA8, 0x95, 0x51, 0x4E, 0x45, 0x8B, 0xB6, 0x65, 0xFA, 0xCB, 0x6B,
+    0x18, 0xA3, 0x24, 0x08, 0x35, 0x2D, 0x5C, 0x60, 0x6D, 0x5B, 0x76, 0x26, 0x10, 0xD7, 0x8A, 0x9B,
+    0xCB, 0x81, 0x4C, 0xC9, 0x73, 0xB3, 0x42, 0x72, 0x5B, 0xD4, 0x26, 0xA2, 0xB6, 0x7D, 0x1C, 0xBC,
+    0xCD, 0x09, 0x88, 0x0A, 0xA2, 0x58, 0x69, 0xC3, 0x34, 0xE2, 0xCA, 0x95, 0x29, 0xB0, 0xCC, 0x73,
+    0xDF, 0xE6, 0x6A, 0xCA, 0xD5, 0x6C, 0xDB, 0x7A, 0x2E, 0x7B, 0x69, 0x6D, 0x4B, 0x88, 0xEF, 0x5C,
+    0xC1, 0x6C, 0xD5, 0xD6, 0x13, 0xC7, 0x07, 0xD9, 0xDB, 0x63, 0x41, 0xEA, 0xCE, 0x5D, 0x55, 0x21,
+    0x57, 0x9D, 0x5B, 0x32, 0xEB, 0xBE, 0x5D, 0x83, 0xB0, 0x95, 0xAE, 0x6F, 0x8D, 0x08, 0xD1, 0x6D,
+    0xC6, 0x92, 0x1D, 0xDA, 0x0C, 0x0A, 0x0C, 0xA3, 0x39, 0x92, 0x0B, 0xAD, 0x57, 0xB5, 0xB4, 0x4C,
+    0x20, 0xA4, 0x6B, 0x16, 0xAA, 0x4D, 0xC4, 0x52, 0xD2, 0x8C, 0xC5, 0xA3, 0x58, 0x8C, 0x2E, 0x3D,
+    0x59, 0x29, 0xB4, 0x7A, 0x84, 0xC6, 0xC9, 0x5C, 0xAE, 0x45, 0xB3, 0x2A, 0x54, 0x36, 0x60, 0xD4,
+    0x02, 0x7A, 0x00, 0x5F, 0x94, 0xA1, 0x9B, 0x93, 0x4F, 0x1D, 0x27, 0x68, 0x0E, 0xC6, 0x28, 0x96,
+    0xB5, 0xED, 0xDA, 0xAB, 0xB5, 0x08, 0xB5, 0x35, 0x54, 0xA7, 0xED, 0xDB, 0xC2, 0xB5, 0x62, 0x21,
+    0x6A, 0x34, 0x37, 0xD7, 0x1F, 0xC1, 0x6F, 0xF9, 0x1C, 0x5B, 0x23, 0x33, 0x97, 0x22, 0x5A, 0x86,
+    0xB8, 0xE2, 0x30, 0x64, 0x28, 0x2D, 0x8E, 0x5C, 0x72, 0x69, 0x10, 0x8A, 0x47, 0x23, 0xDE, 0xE2,
+    0x48, 0x8B, 0x0D, 0x21, 0x43, 0x36, 0xB7, 0x16, 0x89, 0x48, 0xB3, 0xB8, 0xF9, 0xCB, 0xD5, 0x28,
+    0xD2, 0xA2, 0x56, 0x5D, 0xB9, 0x16, 0x42, 0xD6, 0x0A, 0xE5, 0xE0, 0x59, 0x8B, 0xFC, 0xD1, 0x4A,
+    0x4B, 0x03, 0x18, 0xB0, 0x3A, 0x22, 0xB8, 0x24, 0x4B, 0xC6, 0x25, 0x1E, 0x42, 0x84, 0xD0, 0xB8,
+    0x70, 0x35, 0x85, 0x30, 0x99, 0x09, 0x2C, 0x5C, 0x10, 0x26, 0xFB, 0x45, 0xEC, 0x59, 0xA0, 0x67,
+    0x95, 0xD3, 0x5D, 0x01, 0x04, 0x48, 0x11, 0x1B, 0xA3, 0x4B, 0xF5, 0xF4, 0x09, 0xA5, 0xC7, 0x65,
+    0xAB, 0x6E, 0x26, 0xEC, 0xD8, 0x69, 0x0B, 0x70, 0x87, 0xD6, 0xA7, 0xCF, 0x9E, 0x01, 0xD4, 0x91,
+    0x42, 0xAE, 0x90, 0xB6, 0x5B, 0xD3, 0x22, 0x2C, 0x96, 0xB6, 0x60, 0xDD, 0x56, 0x3C, 0x92, 0x60,
+    0x48, 0x9B, 0x36, 0xED, 0x8E, 0x01, 0x86, 0x75, 0x60, 0x68, 0x5B, 0x4C, 0x70, 0xDA, 0x24, 0xB9,
+    0x10, 0x5F, 0xE1, 0xC2, 0x25, 0x59, 0x32, 0xBA, 0x34, 0x10, 0x8A, 0x88, 0xBA, 0x18, 0xF1, 0xB1,
+    0x02, 0x11, 0xA0, 0x3A, 0xA0, 0x2B, 0x02, 0x6A, 0x11, 0x64, 0xD4, 0x8A, 0x4C, 0x46, 0x83, 0xE6,
+    0xC8, 0x15, 0xA1, 0x74, 0xEB, 0x85, 0x08, 0xE3, 0x8F, 0x6E, 0x50, 0xA2, 0x2E, 0x5D, 0x5E, 0xB1,
+    0x62, 0xD5, 0xC0, 0x10, 0xA8, 0x89, 0x11, 0xAE, 0x64, 0x29, 0x97, 0x65, 0xD2, 0xAC, 0x8E, 0x16,
+    0x09, 0x72, 0x94, 0x96, 0xA9, 0x4D, 0xAD, 0x5C, 0xD3, 0xAE, 0x72, 0xB0, 0xF6, 0xA0, 0x9C, 0xAC,
+    0x59, 0xF7, 0x7C, 0x75, 0x02, 0x78, 0xEC, 0x55, 0xC0, 0xE4, 0xAC, 0xF9, 0x0B, 0x4C, 0x68, 0x32,
+    0x21, 0x42, 0xFE, 0x08, 0x99, 0x20, 0x41, 0xA2, 0x0E, 0x5A, 0xB7, 0x5F, 0x15, 0xF0, 0xFD, 0xFA,
+    0xC1, 0x44, 0x5A, 0x47, 0x47, 0x69, 0xD1, 0x4A, 0x91, 0xF0, 0x6B, 0x26, 0x70, 0x8D, 0xD6, 0xC2,
+    0xB0, 0x3B, 0x37, 0x45, 0x5B, 0x6E, 0x7C, 0x2B, 0x23, 0xB4, 0x9B, 0x96, 0x9D, 0x13, 0xAC, 0x6D,
+    0x63, 0x54, 0x16, 0x92, 0x42, 0x11, 0x5A, 0x13, 0x24, 0xEA, 0xB8, 0x75, 0x44, 0x4B, 0xC1, 0xD1,
+    0xC9, 0x99, 0xE6, 0xC2, 0x40, 0x88, 0xF5, 0x16, 0x3C, 0x33, 0xF0, 0xD2, 0xDE, 0xBA, 0x65, 0x86,
+    0x52, 0x0E, 0x5A, 0x39, 0x6E, 0x99, 0xA1, 0xD4, 0xE6, 0x60, 0x84, 0x36, 0x75, 0x5D, 0xD4, 0x81,
+    0xF4, 0x75, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x28, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+    0x4F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x20, 0x66, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x60, 0x94, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x04, 0x31, 0xAA, 0x01, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xCA, 0x8C, 0x28, 0xD4, 0x87, 0x85, 0xA3,
+    0x36, 0x6D, 0xFC, 0x29, 0x2A, 0x45, 0xED, 0x94, 0xA9, 0x5E, 0xBD, 0x7A, 0xF5, 0xEA, 0xA5, 0xAA,
+    0x57, 0xAA, 0x5E, 0xBD, 0x52, 0xF5, 0xD2, 0xA5, 0xEB, 0xD4, 0xA9, 0x53, 0xBA, 0x4E, 0x9D, 0x3A,
+    0x75, 0xAA, 0x54, 0xA9, 0x52, 0xA8, 0x50, 0xA1, 0x42, 0x85, 0xCA, 0x14, 0xAB, 0x54, 0xB9, 0x72,
+    0xE5, 0xCA, 0x95, 0x2A, 0x57, 0xAE, 0x5C, 0xB9, 0x72, 0xE5, 0xCA, 0x95, 0x2B, 0x57, 0xAE, 0x5C,
+    0xB9, 0x78, 0xDD, 0x22, 0x77, 0xEB, 0x56, 0xAA, 0x55, 0xB9, 0x56, 0xAD, 0xCA, 0x85, 0x6B, 0x15,
+    0xAE, 0x55, 0xB9, 0x70, 0xAD, 0x52, 0x35, 0x8B, 0x16, 0x2B, 0x5A, 0xB4, 0x68, 0x25, 0x99, 0xA6,
+    0x4A, 0xDD, 0x0E, 0x71, 0xE6, 0x72, 0xB5, 0x5D, 0xF0, 0xEE, 0x01, 0x97, 0x0A, 0xC8, 0x5C, 0xF6,
+    0xC4, 0xC0, 0x71, 0x25, 0xDB, 0x9A, 0x23, 0x49, 0xA8, 0x64, 0xA9, 0x71, 0xD7, 0x2E, 0x58, 0xB0,
+    0x60, 0xC1, 0x82, 0x05, 0x0B, 0x16, 0xAC, 0x56, 0xB9, 0xCC, 0xE5, 0xCA, 0x95, 0xAB, 0x55, 0xAE,
+    0x56, 0xAD, 0x5A, 0xB5, 0x6A, 0xD5, 0xAA, 0x55, 0xB7, 0x57, 0xAF, 0xBA, 0xBD, 0x7A, 0xF5, 0xAA,
+    0xDB, 0xAB, 0x57, 0xDD, 0x5E, 0xBD, 0x7A, 0x25, 0x4B, 0x56, 0x5A, 0x59, 0xB2, 0x6A, 0xBE, 0xEA,
+    0xD6, 0xED, 0xD5, 0x2B, 0x59, 0xB4, 0x68, 0x89, 0xA3, 0xF5, 0x8A, 0xD6, 0x5B, 0x5A, 0xB4, 0x68,
+    0xD1, 0xA2, 0x45, 0xAB, 0x55, 0xAB, 0x56, 0xAD, 0x9C, 0xA8, 0x8A, 0x15, 0xEB, 0x5B, 0x2C, 0x55,
+    0xB1, 0x62, 0xC5, 0x8A, 0x75, 0xCB, 0xEE, 0xC5, 0x5A, 0x28, 0x6A, 0xD5, 0xAA, 0x55, 0xAB, 0x56,
+    0xAD, 0x71, 0xAB, 0x6A, 0xE5, 0xCA, 0xC5, 0x8B, 0x17, 0x2F, 0x5E, 0xB9, 0x5A, 0xB5, 0xCA, 0x75,
+    0xAB, 0x55, 0xAB, 0x5C, 0x6D, 0x5B, 0xB5, 0xE2, 0xD6, 0xAA, 0x55, 0xAB, 0x56, 0xAD, 0x5A, 0xB5,
+    0xE2, 0xC6, 0x6D, 0xD6, 0xAC, 0x59, 0xB3, 0x66, 0xCD, 0x9A, 0x35, 0x6B, 0xD6, 0xAC, 0x56, 0xAD,
+    0x5A, 0x3D, 0x46, 0xCC, 0x52, 0xA5, 0x87, 0x18, 0x03, 0x93, 0xF8, 0x0C, 0x1A, 0xF8, 0x88, 0x02,
+    0x2E, 0x61, 0x0F, 0x19, 0x22, 0x95, 0x95, 0x0F, 0x00, 0x00, 0x89, 0x01, 0x14, 0x04, 0x00, 0x40,
+    0xEB, 0xE2, 0xB6, 0xAD, 0x54, 0x76, 0xE5, 0xB2, 0x68, 0xD1, 0x5C, 0x00, 0x07, 0x01, 0x2C, 0x06,
+    0x00, 0xA0, 0x2D, 0x12, 0x00, 0x00, 0x00, 0x50, 0xB1, 0xB9, 0xA6, 0x0E, 0xAA, 0x56, 0x59, 0x45,
+    0x26, 0x4B, 0x46, 0x70, 0x41, 0x1D, 0xA0, 0xFE, 0xF4, 0x3D, 0xEB, 0x30, 0x22, 0xD0, 0xA4, 0xBF,
+    0x25, 0x98, 0x11, 0x72, 0x59, 0x2C, 0xCE, 0x62, 0x39, 0x8B, 0x09, 0x6B, 0x5E, 0x80, 0x12, 0xB1,
+    0x3F, 0xB9, 0x96, 0x17, 0x0F, 0x32, 0x8C, 0x86, 0x69, 0xA2, 0x57, 0x8A, 0xA8, 0xB8, 0x2C, 0x8C,
+    0x42, 0x83, 0x86, 0xC2, 0x75, 0x58, 0xB2, 0x55, 0x24, 0xE1, 0x2F, 0x8C, 0xB6, 0xD5, 0xBA, 0xE6,
+    0x0B, 0x04, 0x60, 0x0D, 0x00, 0x00, 0x13, 0x42, 0x25, 0x0C, 0x7B, 0x82, 0x50, 0xDC, 0x93, 0x75,
+    0x84, 0x06, 0x8A, 0x9A, 0xF8, 0x4A, 0x5A, 0x06, 0x0E, 0x62, 0x14, 0x68, 0x7B, 0x61, 0x2D, 0x55,
+    0x95, 0x73, 0xFF, 0x16, 0x28, 0xA1, 0x63, 0x2E, 0xCE, 0x09, 0x05, 0x0A, 0xA2, 0xA2, 0x3A, 0x58,
+    0xC7, 0xC8, 0x5A, 0x6E, 0x27, 0xCB, 0x59, 0xB4, 0x58, 0x20, 0x24, 0x2A, 0x8B, 0x0D, 0xC7, 0xE8,
+    0xB3, 0xC6, 0x6A, 0xDB, 0x95, 0x88, 0x1F, 0x15, 0x36, 0x7A, 0x34, 0xD1, 0x2A, 0xA1, 0xAF, 0xF4,
+    0x15, 0x06, 0xD4, 0xC7, 0x6E, 0x40, 0x2E, 0x2C, 0x87, 0x2C, 0x2E, 0xC8, 0x56, 0xDD, 0x5C, 0x45,
+    0x0F, 0xFE, 0xBA, 0x34, 0x81, 0x33, 0xEC, 0xE2, 0x6A, 0x8B, 0x0E, 0x74, 0x75, 0x92, 0xCF, 0x70,
+    0x1B, 0x00, 0x00, 0x00, 0xD4, 0xF9, 0x9A, 0x08, 0x00, 0xC0, 0x06, 0x4E, 0xE0, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+#endif
@@ -48,7 +48,7 @@ int test_slugify_overlong(const overlong_test_t *test)
     input_str[test->input_len] = '\0';
 
     // Use custom options if specified, otherwise use defaults
-    slugify_options_t opts;
+    slugify_options_t opts = {0};
     if (test->use_custom_opts)
     {
         opts = test->custom_opts;
@@ -102,6 +102,1531 @@ int test_slugify_overlong(const overlong_test_t *test)
     return test_passed;
 }
 
+int test_exact_length(void)
+{
+    printf("\n=== EXACT OUTPUT SIZING TEST ===\n");
+    printf("slugify_length() must equal strlen(slug) + 1\n");
+
+    const char *inputs[] = {
+        "Hello World",
+        "  Hello,   World!!  ",
+        "Ecewo Brings Together Web Development & C Programming",
+        "--- leading and trailing ---",
+        "caf\xC3\xA9 \xE2\x82\xAC 100",
+        "\xD0\x92\xD1\x81\xD0\xB5\xD0\xBC \xD0\xBF\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82",
+        "a \xE2\x80\x93 b",
+    };
+    slugify_options_t opts[] = {
+        {.separator = '-', .max_length = 0, .preserve_case = false},
+        {.separator = '_', .max_length = 0, .preserve_case = true},
+        {.separator = '-', .max_length = 7, .preserve_case = false},
+    };
+
+    int total = 0;
+    int passed = 0;
+
+    for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++)
+    {
+        for (size_t k = 0; k < sizeof(opts) / sizeof(opts[0]); k++)
+        {
+            size_t len = slugify_length(inputs[i], &opts[k]);
+            char *result = slugify(inputs[i], &opts[k]);
+            int ok = result != NULL && len == strlen(result) + 1;
+
+            total++;
+            if (ok)
+                passed++;
+            else
+                printf("FAILED: '%s' -> '%s' (slugify_length=%zu)\n",
+                       inputs[i], result ? result : "(null)", len);
+            free(result);
+        }
+    }
+
+    printf("Exact sizing tests passed: %d/%d\n", passed, total);
+    return passed == total;
+}
+
+int test_max_output_bound(void)
+{
+    printf("\n=== MAX OUTPUT BOUND TEST ===\n");
+    printf("No code point may expand past SLUGIFY_MAX_EXPANSION bytes per input byte\n");
+
+    slugify_options_t opts[] = {
+        {.separator = '-', .max_length = 0, .preserve_case = false},
+        {.separator = '-', .max_length = 0, .preserve_case = true},
+    };
+    int failures = 0;
+
+    for (uint32_t cp = 1; cp <= UNICODE_MAX_CODEPOINT; cp++)
+    {
+        if (cp >= UNICODE_SURROGATE_HIGH_START && cp <= UNICODE_SURROGATE_LOW_END)
+            continue;
+
+        char input[5] = {0};
+        size_t n;
+        if (cp < 0x80)
+        {
+            input[0] = (char)cp;
+            n = 1;
+        }
+        else if (cp < 0x800)
+        {
+            input[0] = (char)(0xC0 | (cp >> 6));
+            input[1] = (char)(0x80 | (cp & 0x3F));
+            n = 2;
+        }
+        else if (cp < 0x10000)
+        {
+            input[0] = (char)(0xE0 | (cp >> 12));
+            input[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+            input[2] = (char)(0x80 | (cp & 0x3F));
+            n = 3;
+        }
+        else
+        {
+            input[0] = (char)(0xF0 | (cp >> 18));
+            input[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+            input[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+            input[3] = (char)(0x80 | (cp & 0x3F));
+            n = 4;
+        }
+
+        for (size_t k = 0; k < sizeof(opts) / sizeof(opts[0]); k++)
+        {
+            size_t len = slugify_length(input, &opts[k]);
+            if (len > SLUGIFY_MAX_OUTPUT(n))
+            {
+                if (failures++ < 10)
+                    printf("FAILED: U+%04X needs %zu bytes, bound is %zu\n",
+                           (unsigned)cp, len, (size_t)SLUGIFY_MAX_OUTPUT(n));
+            }
+        }
+    }
+
+    // Every byte of every input encoding, with and without escaping
+    for (int enc = SLUGIFY_ENCODING_UTF8; enc < SLUGIFY_ENCODING_COUNT; enc++)
+    {
+        for (int mode = 0; mode < 4; mode++)
+        {
+            slugify_options_t o = {.separator = '-', .input_encoding = enc, .preserve_case = mode & 1,
+                                   .percent_encode = mode >> 1};
+            for (int b = 1; b < 256; b++)
+            {
+                char input[2] = {(char)b, '\0'};
+                char out[SLUGIFY_MAX_OUTPUT(1)];
+                int rc = slugify_ex(input, out, sizeof(out), &o);
+                if (rc == SLUGIFY_ERROR_BUFFER || slugify_length(input, &o) > SLUGIFY_MAX_OUTPUT(1))
+                {
+                    if (failures++ < 10)
+                        printf("FAILED: byte 0x%02X in encoding %d (mode %d) exceeds the bound\n", b, enc, mode);
+                }
+            }
+        }
+    }
+
+    // A bound-sized stack buffer must always be enough for slugify_ex()
+    const char *title = "100% & <more> $ | \xE2\x82\xB8";
+    char buf[SLUGIFY_MAX_OUTPUT(32)];
+    int rc = slugify_ex(title, buf, sizeof(buf), NULL);
+    if (rc != SLUGIFY_SUCCESS)
+    {
+        printf("FAILED: slugify_ex() into a bound-sized buffer returned %d\n", rc);
+        failures++;
+    }
+    else
+    {
+        printf("Stack buffer slug: '%s'\n", buf);
+    }
+
+    printf("Max output bound failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_short_fast_path(void)
+{
+    printf("\n=== INLINE FAST PATH TEST ===\n");
+    printf("slugify_short() must match slugify_ex() byte for byte\n");
+
+    const char *inputs[] = {
+        "Hello World",
+        "  Hello,   World!!  ",
+        "C-Programming_101",
+        "tab\tand\nnewline",
+        "50% off & more",
+        "caf\xC3\xA9",
+        "ascii then \xC0\xAF overlong",
+        "---",
+    };
+    slugify_options_t opts[] = {
+        {.separator = '-', .max_length = 0, .preserve_case = false},
+        {.separator = '_', .max_length = 0, .preserve_case = true},
+        {.separator = '-', .max_length = 5, .preserve_case = false},
+        /* Out of range, rejected by both */
+        {.separator = '-', .language = SLUGIFY_LANG_COUNT},
+        {.separator = '-', .language = -1},
+        {.separator = '-', .truncate = SLUGIFY_TRUNCATE_WORD + 1},
+        {.separator = '-', .input_encoding = SLUGIFY_ENCODING_COUNT},
+        {.separator = '-', .invalid_input = SLUGIFY_INVALID_DROP + 1},
+    };
+
+    int total = 0;
+    int passed = 0;
+
+    for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++)
+    {
+        for (size_t k = 0; k < sizeof(opts) / sizeof(opts[0]); k++)
+        {
+            char fast[SLUGIFY_MAX_OUTPUT(64)];
+            char full[SLUGIFY_MAX_OUTPUT(64)];
+            int rc_fast = slugify_short(inputs[i], fast, sizeof(fast), &opts[k]);
+            int rc_full = slugify_ex(inputs[i], full, sizeof(full), &opts[k]);
+            int ok = rc_fast == rc_full && (rc_full != SLUGIFY_SUCCESS || strcmp(fast, full) == 0);
+
+            total++;
+            if (ok)
+                passed++;
+            else
+                printf("FAILED: '%s' -> fast %d '%s', full %d '%s'\n", inputs[i],
+                       rc_fast, rc_fast == SLUGIFY_SUCCESS ? fast : "",
+                       rc_full, rc_full == SLUGIFY_SUCCESS ? full : "");
+        }
+    }
+
+    printf("Fast path tests passed: %d/%d\n", passed, total);
+    return passed == total;
+}
+
+int test_small_slug(void)
+{
+    printf("\n=== SMALL SLUG VALUE TEST ===\n");
+
+    int failures = 0;
+
+    slugify_small_t inline_slug = slugify_small("Hello, World!", NULL);
+    if (inline_slug.status != SLUGIFY_SUCCESS || inline_slug.heap != NULL ||
+        strcmp(slugify_small_str(&inline_slug), "hello-world") != 0 || inline_slug.length != 11)
+    {
+        printf("FAILED: short slug should be stored inline\n");
+        failures++;
+    }
+    slugify_small_free(&inline_slug);
+
+    char long_title[300];
+    memset(long_title, 'a', sizeof(long_title) - 1);
+    long_title[sizeof(long_title) - 1] = '\0';
+
+    slugify_small_t heap_slug = slugify_small(long_title, NULL);
+    if (heap_slug.status != SLUGIFY_SUCCESS || heap_slug.heap == NULL ||
+        heap_slug.length != sizeof(long_title) - 1 ||
+        strcmp(slugify_small_str(&heap_slug), long_title) != 0)
+    {
+        printf("FAILED: long slug should spill to the heap\n");
+        failures++;
+    }
+    slugify_small_free(&heap_slug);
+
+    slugify_small_t bad_slug = slugify_small("\xC0\xAF", NULL);
+    if (bad_slug.status != SLUGIFY_ERROR_INVALID || slugify_small_str(&bad_slug) != NULL)
+    {
+        printf("FAILED: overlong input should be rejected\n");
+        failures++;
+    }
+    slugify_small_free(&bad_slug);
+
+    printf("Small slug failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_slugifier(void)
+{
+    printf("\n=== REUSABLE SLUGIFIER TEST ===\n");
+
+    int failures = 0;
+    slugify_options_t opts = {.separator = '_', .max_length = 0, .preserve_case = false};
+    slugifier_t *s = slugifier_create(&opts);
+    if (!s)
+    {
+        printf("FAILED: slugifier_create() returned NULL\n");
+        return 0;
+    }
+
+    const char *inputs[] = {"Hello World", "Caf\xC3\xA9 & Cr\xC3\xA8me", "\xC0\xAF", ""};
+    for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++)
+    {
+        const char *slug = NULL;
+        size_t length = 0;
+        int rc = slugifier_run(s, inputs[i], &slug, &length);
+        char *expected = slugify(inputs[i], &opts);
+
+        int ok = expected ? (rc == SLUGIFY_SUCCESS && length == strlen(expected) &&
+                             strcmp(slug, expected) == 0)
+                          : rc != SLUGIFY_SUCCESS;
+        if (!ok)
+        {
+            printf("FAILED: '%s' -> rc %d\n", inputs[i], rc);
+            failures++;
+        }
+        free(expected);
+    }
+
+    // Longer than the initial buffer, forces one grow
+    char long_title[1000];
+    memset(long_title, 'x', sizeof(long_title) - 1);
+    long_title[sizeof(long_title) - 1] = '\0';
+
+    const char *slug = NULL;
+    size_t length = 0;
+    if (slugifier_run(s, long_title, &slug, &length) != SLUGIFY_SUCCESS || length != sizeof(long_title) - 1)
+    {
+        printf("FAILED: long input\n");
+        failures++;
+    }
+
+    slugifier_stats_t stats = slugifier_stats(s);
+    printf("Stats: calls=%zu errors=%zu grows=%zu bytes_out=%zu\n",
+           stats.calls, stats.errors, stats.grows, stats.bytes_out);
+    if (stats.calls != 5 || stats.errors != 2 || stats.grows != 1)
+    {
+        printf("FAILED: unexpected stats\n");
+        failures++;
+    }
+
+    slugifier_destroy(s);
+
+    printf("Slugifier failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_custom_table(void)
+{
+    printf("\n=== CUSTOM TRANSLITERATION TABLE TEST ===\n");
+
+    const transliteration_entry_t entries[] = {
+        {0xDF, "sz"},     /* Override the built-in "ss" */
+        {0xE000, "acme"}, /* Brand glyph in the private use area */
+        {0x2B, "plus"},   /* Punctuation that has no built-in entry */
+        {0x26, "und"},
+        {0x26, "n"},      /* Later duplicates win */
+    };
+
+    int failures = 0;
+    slugify_table_t *table = slugify_table_create(entries, sizeof(entries) / sizeof(entries[0]));
+    if (!table)
+    {
+        printf("FAILED: slugify_table_create() returned NULL\n");
+        return 0;
+    }
+
+    slugify_options_t opts = {.separator = '-', .max_length = 0, .preserve_case = false, .table = table};
+    struct
+    {
+        const char *input;
+        const char *expected;
+    } cases[] = {
+        {"Stra\xC3\x9F" "e", "strasze"},
+        {"\xEE\x80\x80 Cloud", "acme-cloud"},
+        {"C++ & Go", "cplusplus-n-go"},
+        {"Caf\xC3\xA9 $5", "cafe-dollar5"},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        char *result = slugify(cases[i].input, &opts);
+        if (!result || strcmp(result, cases[i].expected) != 0)
+        {
+            printf("FAILED: '%s' -> '%s', expected '%s'\n", cases[i].input,
+                   result ? result : "(null)", cases[i].expected);
+            failures++;
+        }
+        free(result);
+    }
+
+    /* Letters and digits can be remapped as well */
+    const transliteration_entry_t alnum_entries[] = {{'a', "x"}, {'-', "dash"}, {'7', "seven"}, {'Q', NULL}};
+    slugify_table_t *alnum = slugify_table_create(alnum_entries, 4);
+    slugify_options_t alnum_opts = {.separator = '-', .table = alnum};
+    char buf[64];
+    if (!alnum || slugify_ex("a-b", buf, sizeof(buf), &alnum_opts) != SLUGIFY_SUCCESS || strcmp(buf, "xdashb") != 0 ||
+        slugify_ex("A7 Qq", buf, sizeof(buf), &alnum_opts) != SLUGIFY_SUCCESS || strcmp(buf, "aseven-q") != 0)
+    {
+        printf("FAILED: table entries for letters and digits\n");
+        failures++;
+    }
+    slugify_table_free(alnum);
+
+    const transliteration_entry_t bad[] = {{0xD800, "x"}};
+    if (slugify_table_create(bad, 1) != NULL)
+    {
+        printf("FAILED: surrogate code point accepted\n");
+        failures++;
+    }
+
+    slugify_table_free(table);
+
+    printf("Custom table failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_language_profiles(void)
+{
+    printf("\n=== LANGUAGE PROFILE TEST ===\n");
+
+    struct
+    {
+        int language;
+        const char *input;
+        const char *expected;
+    } cases[] = {
+        {SLUGIFY_LANG_DEFAULT, "M\xC3\xBCller Gr\xC3\xB6\xC3\x9F" "e", "muller-grosse"},
+        {SLUGIFY_LANG_GERMAN, "M\xC3\xBCller Gr\xC3\xB6\xC3\x9F" "e", "mueller-groesse"},
+        {SLUGIFY_LANG_DANISH, "Bl\xC3\xA5" "b\xC3\xA6rgr\xC3\xB8" "d", "blaabaergroed"},
+        {SLUGIFY_LANG_RUSSIAN_BGN, "\xD0\xA9\xD1\x83\xD0\xBA\xD0\xB8\xD0\xBD \xD0\xA5\xD0\xB0\xD0\xB9", "shchukin-khay"},
+        {SLUGIFY_LANG_RUSSIAN_GOST, "\xD0\xA9\xD1\x83\xD0\xBA\xD0\xB8\xD0\xBD \xD0\xA5\xD0\xB0\xD0\xB9", "shhukin-xaj"},
+        {SLUGIFY_LANG_RUSSIAN_ICAO, "\xD0\xAE\xD0\xBB\xD0\xB8\xD1\x8F", "iuliia"},
+        {SLUGIFY_LANG_UKRAINIAN, "\xD0\x93\xD1\x80\xD0\xB8\xD0\xB3\xD0\xBE\xD1\x80\xD1\x96\xD0\xB9", "hryhoriy"},
+    };
+
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        slugify_options_t opts = {.separator = '-', .language = cases[i].language};
+        char *result = slugify(cases[i].input, &opts);
+        if (!result || strcmp(result, cases[i].expected) != 0)
+        {
+            printf("FAILED: language %d '%s' -> '%s', expected '%s'\n", cases[i].language,
+                   cases[i].input, result ? result : "(null)", cases[i].expected);
+            failures++;
+        }
+        free(result);
+    }
+
+    slugify_options_t bad = {.separator = '-', .language = SLUGIFY_LANG_COUNT};
+    if (slugify("abc", &bad) != NULL)
+    {
+        printf("FAILED: unknown language accepted\n");
+        failures++;
+    }
+
+    // A custom table can start from a profile
+    const transliteration_entry_t brand[] = {{0xE000, "acme"}};
+    slugify_table_t *table = slugify_table_create_for(SLUGIFY_LANG_GERMAN, brand, 1);
+    slugify_options_t custom = {.separator = '-', .table = table};
+    char *result = slugify("\xEE\x80\x80 \xC3\x9C" "ber", &custom);
+    if (!result || strcmp(result, "acme-ueber") != 0)
+    {
+        printf("FAILED: profile-based custom table -> '%s'\n", result ? result : "(null)");
+        failures++;
+    }
+    free(result);
+    slugify_table_free(table);
+
+    printf("Language profile failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_decomposition(void)
+{
+    printf("\n=== DECOMPOSITION TEST ===\n");
+
+    struct
+    {
+        const char *input;
+        const char *expected;
+    } cases[] = {
+        {"Cafe\xCC\x81 cre\xCC\x80me", "cafe-creme"},                   /* NFD: e + U+0301 */
+        {"Ti\xE1\xBA\xBFng Vi\xE1\xBB\x87t", "tieng-viet"},          /* Vietnamese */
+        {"\xC4\x88" "ef \xC5\x9C" "ipo", "cef-sipo"},                  /* Esperanto, no table entry */
+        {"\xE1\xBC\x84\xCE\xBB\xCF\x86\xCE\xB1", "alfa"},         /* Greek extended */
+        {"\xC3\x85ngstr\xC3\xB6m", "angstrom"},
+    };
+
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        char *result = slugify(cases[i].input, NULL);
+        if (!result || strcmp(result, cases[i].expected) != 0)
+        {
+            printf("FAILED: '%s' -> '%s', expected '%s'\n", cases[i].input,
+                   result ? result : "(null)", cases[i].expected);
+            failures++;
+        }
+        free(result);
+    }
+
+    printf("Decomposition failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_unicode_separators(void)
+{
+    printf("\n=== UNICODE SEPARATOR TEST ===\n");
+
+    struct
+    {
+        const char *input;
+        bool preserve_case;
+        const char *expected;
+    } cases[] = {
+        {"Hello\xE2\x80\x94World", false, "hello-world"},           /* Em dash */
+        {"New\xC2\xA0York", false, "new-york"},                      /* NBSP */
+        {"Tokyo\xE3\x80\x80Osaka", false, "tokyo-osaka"},           /* Ideographic space */
+        {"\xC2\xAB" "Bonjour\xC2\xBB le monde", false, "bonjour-le-monde"}, /* Guillemets */
+        {"One\xE3\x80\x81Two\xE3\x80\x82", false, "one-two"},    /* CJK comma and full stop */
+        {"Caf\xC3\xA9\xE2\x80\x94" "Bar", true, "Caf\xC3\xA9-Bar"}, /* preserve_case keeps letters only */
+        {"Don\xE2\x80\x99t", false, "don't"},                       /* Table entries still win */
+    };
+
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        slugify_options_t opts = {.separator = '-', .preserve_case = cases[i].preserve_case};
+        char *result = slugify(cases[i].input, &opts);
+        if (!result || strcmp(result, cases[i].expected) != 0)
+        {
+            printf("FAILED: '%s' -> '%s', expected '%s'\n", cases[i].input,
+                   result ? result : "(null)", cases[i].expected);
+            failures++;
+        }
+        free(result);
+    }
+
+    printf("Unicode separator failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_pinyin(void)
+{
+    printf("\n=== PINYIN ROMANIZATION TEST ===\n");
+
+    struct
+    {
+        const char *input;
+        const char *expected;
+    } cases[] = {
+#ifndef SLUGIFY_NO_PINYIN
+        {"\xE4\xB8\xAD\xE6\x96\x87\xE6\xA0\x87\xE9\xA2\x98", "zhong-wen-biao-ti"},
+        {"\xE5\x8C\x97\xE4\xBA\xAC 2008", "bei-jing-2008"},
+        {"iPhone\xE6\x89\x8B\xE6\x9C\xBA", "iphone-shou-ji"},
+        {"\xE3\x90\x80", "qiu"},                   /* Extension A */
+#endif
+        {"\xE5\x85\x83 \xE5\x86\x86", "yuan-yen"}, /* Table entries still win */
+    };
+
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        char *result = slugify(cases[i].input, NULL);
+        if (!result || strcmp(result, cases[i].expected) != 0)
+        {
+            printf("FAILED: '%s' -> '%s', expected '%s'\n", cases[i].input,
+                   result ? result : "(null)", cases[i].expected);
+            failures++;
+        }
+        free(result);
+    }
+
+    printf("Pinyin failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_hangul_kana(void)
+{
+    printf("\n=== HANGUL AND KANA ROMANIZATION TEST ===\n");
+
+    struct
+    {
+        const char *input;
+        const char *expected;
+    } cases[] = {
+        {"\xED\x95\x9C\xEA\xB5\xAD\xEC\x96\xB4", "hangugeo"}, /* Liaison onto a silent lead */
+        {"\xEC\x84\x9C\xEC\x9A\xB8 \xED\x8A\xB9\xEB\xB3\x84\xEC\x8B\x9C", "seoul-teukbyeolsi"},
+        {"\xEC\x95\x88\xEB\x85\x95\xED\x95\x98\xEC\x84\xB8\xEC\x9A\x94", "annyeonghaseyo"},
+        {"\xE3\x81\xB2\xE3\x82\x89\xE3\x81\x8C\xE3\x81\xAA", "hiragana"},
+        {"\xE3\x82\xAB\xE3\x82\xBF\xE3\x82\xAB\xE3\x83\x8A", "katakana"},
+        {"\xE3\x81\xA8\xE3\x81\x86\xE3\x81\x8D\xE3\x82\x87\xE3\x81\x86", "tokyo"}, /* Long vowels */
+        {"\xE3\x83\x9E\xE3\x83\x83\xE3\x83\x81\xE3\x83\xA3", "matcha"}, /* Small tsu */
+        {"\xE3\x83\xA9\xE3\x83\xBC\xE3\x83\xA1\xE3\x83\xB3", "ramen"},
+        {"\xE3\x81\x8C\xE3\x81\xA3\xE3\x81\x93\xE3\x81\x86", "gakko"},
+        {"\xE3\x83\x91\xE3\x83\xBC\xE3\x83\x86\xE3\x82\xA3\xE3\x83\xBC", "pati"}, /* Small vowel */
+        {"\xE3\x82\xA6\xE3\x82\xA3\xE3\x82\xAD\xE3\x83\xBB\xE3\x83\x9A\xE3\x83\x87\xE3\x82\xA3\xE3\x82\xA2", "wiki-pedia"},
+    };
+
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        char *result = slugify(cases[i].input, NULL);
+        if (!result || strcmp(result, cases[i].expected) != 0)
+        {
+            printf("FAILED: '%s' -> '%s', expected '%s'\n", cases[i].input,
+                   result ? result : "(null)", cases[i].expected);
+            failures++;
+        }
+        free(result);
+    }
+
+    printf("Hangul and kana failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_more_scripts(void)
+{
+    printf("\n=== INDIC, THAI, HEBREW AND ARMENIAN TEST ===\n");
+
+    struct
+    {
+        const char *input;
+        const char *expected;
+    } cases[] = {
+        {"\xE0\xA4\xA8\xE0\xA4\xAE\xE0\xA4\xB8\xE0\xA5\x8D\xE0\xA4\xA4\xE0\xA5\x87 \xE0\xA4\xA6\xE0\xA5\x81\xE0\xA4\xA8\xE0\xA4\xBF\xE0\xA4\xAF\xE0\xA4\xBE", "namaste-duniya"},
+        {"\xE0\xA4\xAD\xE0\xA4\xBE\xE0\xA4\xB0\xE0\xA4\xA4", "bharat"}, /* Final schwa deletion */
+        {"\xE0\xA4\xB9\xE0\xA4\xBF\xE0\xA4\x82\xE0\xA4\xA6\xE0\xA5\x80", "hindi"}, /* Anusvara */
+        {"\xE0\xA4\x95\xE0\xA4\xBC\xE0\xA4\xBF\xE0\xA4\xB2\xE0\xA4\xBE", "qila"}, /* Nukta */
+        {"\xE0\xA8\xAA\xE0\xA9\xB0\xE0\xA8\x9C\xE0\xA8\xBE\xE0\xA8\xAC", "panjab"}, /* Tippi */
+        {"\xE0\xAE\xA4\xE0\xAE\xAE\xE0\xAE\xBF\xE0\xAE\xB4\xE0\xAF\x8D", "tamizh"}, /* Virama */
+        {"\xE0\xB4\x95\xE0\xB5\x87\xE0\xB4\xB0\xE0\xB4\xB3\xE0\xB4\x82", "keralam"},
+        {"\xE0\xA5\xA8\xE0\xA5\xA6\xE0\xA5\xA8\xE0\xA5\xAA", "2024"},
+        {"\xE0\xB9\x80\xE0\xB8\x94\xE0\xB9\x87\xE0\xB8\x81", "dek"}, /* Leading vowel */
+        {"\xE0\xB8\x81\xE0\xB8\xA3\xE0\xB8\xB8\xE0\xB8\x87\xE0\xB9\x80\xE0\xB8\x97\xE0\xB8\x9E", "krungtheph"},
+        {"\xD7\xA9\xD6\xB8\xD7\x81\xD7\x9C\xD7\x95\xD6\xB9\xD7\x9D", "shalvom"}, /* Vowel points */
+        {"\xD4\xB5\xD6\x80\xD6\x87\xD5\xA1\xD5\xB6", "erevan"},
+    };
+
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        char *result = slugify(cases[i].input, NULL);
+        if (!result || strcmp(result, cases[i].expected) != 0)
+        {
+            printf("FAILED: '%s' -> '%s', expected '%s'\n", cases[i].input,
+                   result ? result : "(null)", cases[i].expected);
+            failures++;
+        }
+        free(result);
+    }
+
+    printf("Script failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_multi_rules(void)
+{
+    printf("\n=== MULTI-CODE-POINT RULES TEST ===\n");
+
+    struct
+    {
+        const char *input;
+        int language;
+        const char *expected;
+    } cases[] = {
+        {"\xCE\x9F\xCF\x85\xCF\x81\xCE\xB1\xCE\xBD\xCF\x8C\xCF\x82", SLUGIFY_LANG_DEFAULT, "ouranos"},
+        {"\xCE\x9F\xCE\xA5\xCE\xA1\xCE\x91\xCE\x9D\xCE\x9F\xCE\xA3", SLUGIFY_LANG_DEFAULT, "ouranos"}, /* Upper case folds */
+        {"\xCE\xBF\xCF\x8D\xCE\xB6\xCE\xBF", SLUGIFY_LANG_DEFAULT, "ouzo"}, /* Accents fold */
+        {"\xCE\x95\xCF\x85\xCF\x81\xCF\x8E\xCF\x80\xCE\xB7", SLUGIFY_LANG_DEFAULT, "evrwph"},
+        {"\xCE\x86\xCE\xB3\xCE\xB3\xCE\xB5\xCE\xBB\xCE\xBF\xCF\x82", SLUGIFY_LANG_DEFAULT, "angelos"},
+        {"\xCE\xBF \xCF\x85", SLUGIFY_LANG_DEFAULT, "o-y"}, /* No rule across a space */
+        {"\xD0\xA0\xD0\xBE\xD0\xB7\xD0\xB3\xD0\xBE\xD0\xBD", SLUGIFY_LANG_DEFAULT, "rozgon"}, /* Profile rules stay in their profile */
+        {"\xD0\xA0\xD0\xBE\xD0\xB7\xD0\xB3\xD0\xBE\xD0\xBD", SLUGIFY_LANG_UKRAINIAN, "rozghon"},
+    };
+
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        slugify_options_t opts = {.separator = '-', .language = cases[i].language};
+        char *result = slugify(cases[i].input, &opts);
+        if (!result || strcmp(result, cases[i].expected) != 0)
+        {
+            printf("FAILED: '%s' -> '%s', expected '%s'\n", cases[i].input,
+                   result ? result : "(null)", cases[i].expected);
+            failures++;
+        }
+        free(result);
+    }
+
+    printf("Multi-code-point rule failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_phrases(void)
+{
+    printf("\n=== PHRASE REPLACEMENT TEST ===\n");
+
+    slugify_phrase_t phrases[] = {
+        {"C++", "cpp"},
+        {"C#", "csharp"},
+        {".NET", "dotnet"},
+        {"new", "new"},
+        {"New York", "nyc"},
+        {"Node.js", "node js"},
+        {"(draft)", NULL},
+    };
+    slugify_phrases_t *compiled = slugify_phrases_create(phrases, sizeof(phrases) / sizeof(phrases[0]));
+    if (!compiled)
+    {
+        printf("FAILED: slugify_phrases_create returned NULL\n");
+        return 0;
+    }
+
+    struct
+    {
+        const char *input;
+        const char *expected;
+    } cases[] = {
+        {"Learning C++ and C# on .NET", "learning-cpp-and-csharp-on-dotnet"},
+        {"c++ TIPS", "cpp-tips"},                       /* Case-insensitive */
+        {"New York Times", "nyc-times"},                /* Longest match wins */
+        {"Newsletter", "newsletter"},                   /* Word boundary */
+        {"C++11", "cpp11"},                             /* No boundary after + */
+        {"Node.js tips", "node-js-tips"},               /* Separator in the replacement */
+        {"Release (draft) notes", "release-notes"},     /* Removal */
+        {"Caf\xC3\xA9 C#", "cafe-csharp"},
+    };
+
+    int failures = 0;
+    slugify_options_t opts = {.separator = '-', .phrases = compiled};
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        char *result = slugify(cases[i].input, &opts);
+        if (!result || strcmp(result, cases[i].expected) != 0)
+        {
+            printf("FAILED: '%s' -> '%s', expected '%s'\n", cases[i].input,
+                   result ? result : "(null)", cases[i].expected);
+            failures++;
+        }
+        else if (slugify_length(cases[i].input, &opts) != strlen(result) + 1)
+        {
+            printf("FAILED: slugify_length('%s') is not exact\n", cases[i].input);
+            failures++;
+        }
+        free(result);
+    }
+
+    // Empty and malformed phrases are rejected
+    slugify_phrase_t empty[] = {{"", "x"}};
+    slugify_phrase_t malformed[] = {{"\xC3", "x"}};
+    if (slugify_phrases_create(empty, 1) || slugify_phrases_create(malformed, 1))
+    {
+        printf("FAILED: invalid phrase accepted\n");
+        failures++;
+    }
+
+    slugify_phrases_free(compiled);
+    printf("Phrase failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_stop_words(void)
+{
+    printf("\n=== STOP WORD TEST ===\n");
+
+    const char *const extra[] = {"Guide", "how"};
+    slugify_stop_words_t *custom =
+        slugify_stop_words_create(slugify_stop_words_builtin(SLUGIFY_LANG_DEFAULT), extra, 2);
+    if (!custom)
+    {
+        printf("FAILED: slugify_stop_words_create returned NULL\n");
+        return 0;
+    }
+
+    struct
+    {
+        const char *input;
+        const slugify_stop_words_t *stop_words;
+        size_t max_length;
+        const char *expected;
+    } cases[] = {
+        {"The Lord of the Rings", slugify_stop_words_builtin(SLUGIFY_LANG_DEFAULT), 0, "lord-rings"},
+        {"Theory of Everything", slugify_stop_words_builtin(SLUGIFY_LANG_DEFAULT), 0, "theory-everything"},
+        {"\xC3\x9C" "ber die Br\xC3\xBC" "cke f\xC3\xBCr den K\xC3\xB6nig",
+         slugify_stop_words_builtin(SLUGIFY_LANG_GERMAN), 0, "brucke-konig"},
+        {"How to: The C Guide", custom, 0, "c"},
+        {"Cats and the Dogs", custom, 8, "cats-dog"}, /* Dropped words make room */
+        {"the a of", custom, 0, NULL},                /* Nothing left */
+    };
+
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        slugify_options_t opts = {.separator = '-', .max_length = cases[i].max_length,
+                                  .stop_words = cases[i].stop_words};
+        char *result = slugify(cases[i].input, &opts);
+        int ok = cases[i].expected ? (result && strcmp(result, cases[i].expected) == 0) : (result == NULL);
+        if (!ok)
+        {
+            printf("FAILED: '%s' -> '%s', expected '%s'\n", cases[i].input,
+                   result ? result : "(null)", cases[i].expected ? cases[i].expected : "(null)");
+            failures++;
+        }
+        else if (result && slugify_length(cases[i].input, &opts) != strlen(result) + 1)
+        {
+            printf("FAILED: slugify_length('%s') is not exact\n", cases[i].input);
+            failures++;
+        }
+        free(result);
+    }
+
+    const char *const too_long[] = {"abcdefghijklmnopq"};
+    if (slugify_stop_words_create(NULL, too_long, 1) || slugify_stop_words_builtin(SLUGIFY_LANG_DANISH))
+    {
+        printf("FAILED: unexpected stop-word set\n");
+        failures++;
+    }
+
+    slugify_stop_words_free(custom);
+    printf("Stop word failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_truncation(void)
+{
+    printf("\n=== TRUNCATION TEST ===\n");
+
+    struct
+    {
+        const char *input;
+        size_t max_length;
+        int truncate;
+        bool preserve_case;
+        const char *expected;
+    } cases[] = {
+        {"Hello World Again", 8, SLUGIFY_TRUNCATE_UTF8, false, "hello-wo"},
+        {"Hello World Again", 8, SLUGIFY_TRUNCATE_BYTE, false, "hello-wo"},
+        {"Hello World Again", 8, SLUGIFY_TRUNCATE_WORD, false, "hello"},
+        {"Hello World Again", 11, SLUGIFY_TRUNCATE_WORD, false, "hello-world"},
+        {"Hello World", 11, SLUGIFY_TRUNCATE_WORD, false, "hello-world"},
+        {"Supercalifragilistic", 5, SLUGIFY_TRUNCATE_WORD, false, "super"}, /* First word is cut */
+        {"ab stra\xC3\x9F" "e", 7, SLUGIFY_TRUNCATE_WORD, false, "ab"},     /* ss cut in half */
+        {"Caf\xC3\xA9", 4, SLUGIFY_TRUNCATE_UTF8, true, "Caf"},              /* No overshoot */
+        {"Caf\xC3\xA9", 4, SLUGIFY_TRUNCATE_BYTE, true, "Caf\xC3"},
+        {"Caf\xC3\xA9 Bar", 5, SLUGIFY_TRUNCATE_WORD, true, "Caf\xC3\xA9"},
+        {"Hello", 3, 7, false, NULL}, /* Unknown policy */
+    };
+
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        slugify_options_t opts = {.separator = '-', .max_length = cases[i].max_length,
+                                  .truncate = cases[i].truncate, .preserve_case = cases[i].preserve_case};
+        char *result = slugify(cases[i].input, &opts);
+        int ok = cases[i].expected ? (result && strcmp(result, cases[i].expected) == 0) : (result == NULL);
+        if (!ok)
+        {
+            printf("FAILED: '%s' (max %zu, policy %d) -> '%s', expected '%s'\n", cases[i].input,
+                   cases[i].max_length, cases[i].truncate, result ? result : "(null)",
+                   cases[i].expected ? cases[i].expected : "(null)");
+            failures++;
+            free(result);
+            continue;
+        }
+        if (!result)
+            continue;
+
+        // max_length + 1 bytes are always enough, and the fast path agrees
+        char buf[16];
+        char fast[16];
+        if (slugify_length(cases[i].input, &opts) != strlen(result) + 1 ||
+            slugify_ex(cases[i].input, buf, cases[i].max_length + 1, &opts) != SLUGIFY_SUCCESS ||
+            strcmp(buf, result) != 0 ||
+            slugify_short(cases[i].input, fast, sizeof(fast), &opts) != SLUGIFY_SUCCESS ||
+            strcmp(fast, result) != 0)
+        {
+            printf("FAILED: sizing for '%s' (max %zu, policy %d)\n", cases[i].input,
+                   cases[i].max_length, cases[i].truncate);
+            failures++;
+        }
+        free(result);
+    }
+
+    printf("Truncation failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_session(void)
+{
+    printf("\n=== EDIT SESSION TEST ===\n");
+
+    struct
+    {
+        size_t offset;
+        size_t deleted;
+        const char *inserted;
+        int status;
+        const char *expected;
+    } edits[] = {
+        {6, 0, "Big ", SLUGIFY_SUCCESS, "hello-big-world-again"},
+        {5, 1, "", SLUGIFY_SUCCESS, "hellobig-world-again"},
+        {20, 0, "!!", SLUGIFY_SUCCESS, "hellobig-world-again"},
+        {0, 0, "Caf\xC3\xA9 ", SLUGIFY_SUCCESS, "cafe-hellobig-world-again"},
+        {4, 1, "\xC3", SLUGIFY_ERROR_INVALID, NULL}, /* Half a character */
+        {4, 1, "\xA9", SLUGIFY_SUCCESS, "cafe-hellobig-world-again"},
+        {0, 28, "", SLUGIFY_ERROR_EMPTY, NULL},
+        {0, 0, "\xD0\x96" "ar", SLUGIFY_SUCCESS, "zhar"},
+        {99, 0, "x", SLUGIFY_ERROR_INVALID, NULL}, /* Out of range, nothing changes */
+    };
+
+    int failures = 0;
+    slugify_options_t opts = {.separator = '-'};
+    slugify_session_t *s = slugify_session_create(&opts);
+    char input[128] = "Hello World Again";
+    const char *slug = NULL;
+    size_t length = 0;
+
+    if (!s || slugify_session_set(s, input, &slug, &length) != SLUGIFY_SUCCESS ||
+        strcmp(slug, "hello-world-again") != 0)
+    {
+        printf("FAILED: slugify_session_set\n");
+        slugify_session_destroy(s);
+        return 0;
+    }
+
+    for (size_t i = 0; i < sizeof(edits) / sizeof(edits[0]); i++)
+    {
+        int rc = slugify_session_edit(s, edits[i].offset, edits[i].deleted, edits[i].inserted,
+                                      strlen(edits[i].inserted), &slug, &length);
+        if (rc != edits[i].status || (edits[i].expected && (strcmp(slug, edits[i].expected) != 0 ||
+                                                            length != strlen(edits[i].expected))))
+        {
+            printf("FAILED: edit %zu -> %d '%s', expected %d '%s'\n", i, rc,
+                   rc == SLUGIFY_SUCCESS ? slug : "", edits[i].status,
+                   edits[i].expected ? edits[i].expected : "");
+            failures++;
+        }
+        if (edits[i].status == SLUGIFY_ERROR_INVALID && edits[i].offset > strlen(input))
+            continue;
+
+        // Mirror the edit and check the session against a full run
+        memmove(input + edits[i].offset + strlen(edits[i].inserted), input + edits[i].offset + edits[i].deleted,
+                strlen(input + edits[i].offset + edits[i].deleted) + 1);
+        memcpy(input + edits[i].offset, edits[i].inserted, strlen(edits[i].inserted));
+        char *full = slugify(input, &opts);
+        if ((full == NULL) != (rc != SLUGIFY_SUCCESS) || (full && strcmp(full, slug) != 0))
+        {
+            printf("FAILED: edit %zu disagrees with slugify('%s')\n", i, input);
+            failures++;
+        }
+        free(full);
+    }
+
+    slugify_session_destroy(s);
+
+    // Edits inside an escape: "%20a" becomes "%a"
+    slugify_options_t url_opts = {.separator = '-', .url_decode = true};
+    s = slugify_session_create(&url_opts);
+    if (!s || slugify_session_set(s, "%20a", &slug, &length) != SLUGIFY_SUCCESS ||
+        slugify_session_edit(s, 1, 2, "", 0, &slug, &length) != SLUGIFY_SUCCESS || strcmp(slug, "percenta") != 0)
+    {
+        printf("FAILED: edit inside an escape\n");
+        failures++;
+    }
+    slugify_session_destroy(s);
+
+    // A broken sequence reads the escaped space after it, which the edit turns into a continuation byte
+    for (int mode = 0; mode < 4; mode++)
+    {
+        slugify_options_t lenient = {.separator = '-', .url_decode = true, .preserve_case = mode & 1,
+                                     .invalid_input = (mode & 2) ? SLUGIFY_INVALID_SEPARATOR : SLUGIFY_INVALID_DROP};
+        char expected[64];
+        s = slugify_session_create(&lenient);
+        if (!s || slugify_session_set(s, "a \xE3%20\x81 b", &slug, &length) != SLUGIFY_SUCCESS ||
+            slugify_session_edit(s, 4, 1, "B", 1, &slug, &length) != SLUGIFY_SUCCESS ||
+            slugify_ex("a \xE3%B0\x81 b", expected, sizeof(expected), &lenient) != SLUGIFY_SUCCESS ||
+            strcmp(slug, expected) != 0)
+        {
+            printf("FAILED: edit inside an escape after a broken sequence (mode %d)\n", mode);
+            failures++;
+        }
+        slugify_session_destroy(s);
+    }
+
+    printf("Edit session failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_wide_input(void)
+{
+    printf("\n=== UTF-16 / UTF-32 INPUT TEST ===\n");
+
+    /* "Straße 😀 Ελλάδα" in all three encodings */
+    const char *utf8 = "Stra\xC3\x9F" "e \xF0\x9F\x98\x80 \xCE\x95\xCE\xBB\xCE\xBB\xCE\xAC\xCE\xB4\xCE\xB1";
+    const uint16_t utf16[] = {'S', 't', 'r', 'a', 0xDF, 'e', ' ', 0xD83D, 0xDE00, ' ',
+                              0x395, 0x3BB, 0x3BB, 0x3AC, 0x3B4, 0x3B1};
+    const uint32_t utf32[] = {'S', 't', 'r', 'a', 0xDF, 'e', ' ', 0x1F600, ' ',
+                              0x395, 0x3BB, 0x3BB, 0x3AC, 0x3B4, 0x3B1};
+    size_t len16 = sizeof(utf16) / sizeof(utf16[0]);
+    size_t len32 = sizeof(utf32) / sizeof(utf32[0]);
+
+    const slugify_phrase_t phrases[] = {{"Stra\xC3\x9F" "e", "street"}};
+    slugify_phrases_t *compiled = slugify_phrases_create(phrases, 1);
+    slugify_options_t options[] = {
+        {.separator = '-'},
+        {.separator = '_', .preserve_case = true},
+        {.separator = '-', .max_length = 9, .truncate = SLUGIFY_TRUNCATE_WORD},
+        {.separator = '-', .phrases = compiled},
+    };
+
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(options) / sizeof(options[0]); i++)
+    {
+        char *expected = slugify(utf8, &options[i]);
+        char *from16 = slugify_utf16(utf16, len16, &options[i]);
+        char *from32 = slugify_utf32(utf32, len32, &options[i]);
+        char buf[SLUGIFY_MAX_OUTPUT(3 * 16)];
+        int rc = slugify_ex_utf16(utf16, len16, buf, sizeof(buf), &options[i]);
+
+        if (!expected || !from16 || !from32 || rc != SLUGIFY_SUCCESS || strcmp(expected, from16) != 0 ||
+            strcmp(expected, from32) != 0 || strcmp(expected, buf) != 0)
+        {
+            printf("FAILED: options %zu: '%s' vs '%s' / '%s'\n", i, expected ? expected : "(null)",
+                   from16 ? from16 : "(null)", from32 ? from32 : "(null)");
+            failures++;
+        }
+        free(expected);
+        free(from16);
+        free(from32);
+    }
+
+    /* Options for char input do not apply to wide input, with or without phrases */
+    slugify_options_t narrow_only = {.separator = '-', .phrases = compiled,
+                                     .input_encoding = SLUGIFY_ENCODING_LATIN1, .url_decode = true};
+    char *plain16 = slugify_utf16(utf16, len16, &options[3]);
+    char *narrow16 = slugify_utf16(utf16, len16, &narrow_only);
+    if (!plain16 || !narrow16 || strcmp(plain16, narrow16) != 0)
+    {
+        printf("FAILED: char input options applied to UTF-16 with phrases\n");
+        failures++;
+    }
+    free(plain16);
+    free(narrow16);
+
+    /* Unpaired surrogates, nulls and values past U+10FFFF are rejected */
+    const uint16_t lone_low[] = {'a', 0xDC00, 'b'};
+    const uint16_t lone_high[] = {'a', 0xD800};
+    const uint16_t null16[] = {'a', 0, 'b'};
+    const uint32_t surrogate32[] = {'a', 0xD800};
+    const uint32_t beyond32[] = {'a', 0x110000};
+    char buf[64];
+    if (slugify_ex_utf16(lone_low, 3, buf, sizeof(buf), NULL) != SLUGIFY_ERROR_INVALID ||
+        slugify_ex_utf16(lone_high, 2, buf, sizeof(buf), NULL) != SLUGIFY_ERROR_INVALID ||
+        slugify_ex_utf16(null16, 3, buf, sizeof(buf), NULL) != SLUGIFY_ERROR_INVALID ||
+        slugify_ex_utf32(surrogate32, 2, buf, sizeof(buf), NULL) != SLUGIFY_ERROR_INVALID ||
+        slugify_ex_utf32(beyond32, 2, buf, sizeof(buf), NULL) != SLUGIFY_ERROR_INVALID ||
+        slugify_ex_utf16(utf16, 0, buf, sizeof(buf), NULL) != SLUGIFY_ERROR_EMPTY)
+    {
+        printf("FAILED: malformed UTF-16/UTF-32 accepted\n");
+        failures++;
+    }
+
+    slugify_phrases_free(compiled);
+    printf("UTF-16 / UTF-32 failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_single_byte_input(void)
+{
+    printf("\n=== LATIN-1 / CP1252 INPUT TEST ===\n");
+
+    struct
+    {
+        const char *input;
+        int encoding;
+        int language;
+        bool preserve_case;
+        const char *expected;
+    } cases[] = {
+        {"Caf\xE9 \xE0 la cr\xE8me", SLUGIFY_ENCODING_LATIN1, SLUGIFY_LANG_DEFAULT, false, "cafe-a-la-creme"},
+        {"M\xFCller \xC6sir \xDF", SLUGIFY_ENCODING_LATIN1, SLUGIFY_LANG_GERMAN, false, "mueller-aesir-ss"},
+        {"\x8C" "uvre \x96 \x80" " 5", SLUGIFY_ENCODING_CP1252, SLUGIFY_LANG_DEFAULT, false, "oeuvre-euro-5"},
+        {"\x8C" "uvre \x96 \x80" " 5", SLUGIFY_ENCODING_LATIN1, SLUGIFY_LANG_DEFAULT, false, "uvre-5"}, /* C1 controls */
+        {"Caf\xE9", SLUGIFY_ENCODING_LATIN1, SLUGIFY_LANG_DEFAULT, true, "Caf\xC3\xA9"},             /* UTF-8 out */
+        {"\xA0\xBF", SLUGIFY_ENCODING_CP1252, SLUGIFY_LANG_DEFAULT, false, NULL},
+    };
+
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        slugify_options_t opts = {.separator = '-', .input_encoding = cases[i].encoding,
+                                  .language = cases[i].language, .preserve_case = cases[i].preserve_case};
+        char *result = slugify(cases[i].input, &opts);
+        int ok = cases[i].expected ? (result && strcmp(result, cases[i].expected) == 0) : (result == NULL);
+        if (!ok)
+        {
+            printf("FAILED: case %zu -> '%s', expected '%s'\n", i, result ? result : "(null)",
+                   cases[i].expected ? cases[i].expected : "(null)");
+            failures++;
+        }
+        else if (result && slugify_length(cases[i].input, &opts) != strlen(result) + 1)
+        {
+            printf("FAILED: slugify_length() for case %zu is not exact\n", i);
+            failures++;
+        }
+        free(result);
+    }
+
+    slugify_options_t bad = {.separator = '-', .input_encoding = SLUGIFY_ENCODING_COUNT};
+    char buf[16];
+    if (slugify_ex("abc", buf, sizeof(buf), &bad) != SLUGIFY_ERROR_INVALID)
+    {
+        printf("FAILED: unknown encoding accepted\n");
+        failures++;
+    }
+
+    /* Phrases are UTF-8 and match the decoded text */
+    const slugify_phrase_t phrases[] = {{"caf\xC3\xA9", "coffee"}, {"\xE2\x82\xAC", "eur"}};
+    slugify_phrases_t *compiled = slugify_phrases_create(phrases, 2);
+    for (int encoding = SLUGIFY_ENCODING_LATIN1; encoding < SLUGIFY_ENCODING_COUNT; encoding++)
+    {
+        slugify_options_t opts = {.separator = '-', .input_encoding = encoding, .phrases = compiled};
+        const char *expected = encoding == SLUGIFY_ENCODING_CP1252 ? "coffee-time-eur" : "coffee-time";
+        if (slugify_ex("Caf\xE9 time \x80", buf, sizeof(buf), &opts) != SLUGIFY_SUCCESS || strcmp(buf, expected) != 0)
+        {
+            printf("FAILED: phrase in encoding %d\n", encoding);
+            failures++;
+        }
+    }
+    slugify_phrases_free(compiled);
+
+    printf("Latin-1 / CP1252 failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_lenient_input(void)
+{
+    printf("\n=== LENIENT DECODING TEST ===\n");
+
+    struct
+    {
+        const char *input;
+        int policy;
+        size_t max_length;
+        const char *expected;
+    } cases[] = {
+        {"abc\xFF" "def", SLUGIFY_INVALID_SEPARATOR, 0, "abc-def"},
+        {"abc\xFF" "def", SLUGIFY_INVALID_DROP, 0, "abcdef"},
+        {"abc\xFF" "def", SLUGIFY_INVALID_REJECT, 0, NULL},
+        {"caf\xC3 au lait", SLUGIFY_INVALID_SEPARATOR, 0, "caf-au-lait"}, /* truncated sequence */
+        {"\xE2\x82" "x\xC3\xA9", SLUGIFY_INVALID_DROP, 0, "xe"},
+        {"\xED\xA0\x80" "ok", SLUGIFY_INVALID_SEPARATOR, 0, "ok"},      /* surrogate */
+        {"\xF8\x88\x80\x80\x80" "z", SLUGIFY_INVALID_DROP, 0, "z"},
+        {"ab\xFF" "cdef", SLUGIFY_INVALID_DROP, 3, "abc"},
+        {"abc\xFF", SLUGIFY_INVALID_REJECT, 2, NULL},
+        {"abc\xFF", SLUGIFY_INVALID_SEPARATOR, 2, "ab"},
+    };
+
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        slugify_options_t opts = {.separator = '-', .invalid_input = cases[i].policy,
+                                  .max_length = cases[i].max_length};
+        char *result = slugify(cases[i].input, &opts);
+        int ok = cases[i].expected ? (result && strcmp(result, cases[i].expected) == 0) : (result == NULL);
+        if (!ok)
+        {
+            printf("FAILED: case %zu -> '%s', expected '%s'\n", i, result ? result : "(null)",
+                   cases[i].expected ? cases[i].expected : "(null)");
+            failures++;
+        }
+        else if (result && slugify_length(cases[i].input, &opts) != strlen(result) + 1)
+        {
+            printf("FAILED: slugify_length() for case %zu is not exact\n", i);
+            failures++;
+        }
+        free(result);
+    }
+
+    // A lone surrogate in UTF-16, with and without phrases in play
+    const uint16_t utf16[] = {'a', 'b', 0xD800, 'c', 'd'};
+    const slugify_phrase_t phrase[] = {{"cd", "x"}};
+    slugify_phrases_t *compiled = slugify_phrases_create(phrase, 1);
+    slugify_options_t lenient = {.separator = '_', .invalid_input = SLUGIFY_INVALID_SEPARATOR};
+    for (int with_phrase = 0; with_phrase < 2; with_phrase++)
+    {
+        lenient.phrases = with_phrase ? compiled : NULL;
+        char *result = slugify_utf16(utf16, 5, &lenient);
+        const char *expected = with_phrase ? "ab_x" : "ab_cd";
+        if (!result || strcmp(result, expected) != 0)
+        {
+            printf("FAILED: UTF-16 lone surrogate -> '%s', expected '%s'\n", result ? result : "(null)", expected);
+            failures++;
+        }
+        free(result);
+    }
+    slugify_phrases_free(compiled);
+
+    slugify_options_t bad = {.separator = '-', .invalid_input = SLUGIFY_INVALID_DROP + 1};
+    char buf[16];
+    if (slugify_ex("abc", buf, sizeof(buf), &bad) != SLUGIFY_ERROR_INVALID)
+    {
+        printf("FAILED: unknown invalid_input policy accepted\n");
+        failures++;
+    }
+
+    printf("Lenient decoding failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_percent_encoding(void)
+{
+    printf("\n=== PERCENT-ENCODING TEST ===\n");
+
+    struct
+    {
+        const char *input;
+        char separator;
+        bool preserve_case;
+        size_t max_length;
+        int truncate;
+        const char *expected;
+    } cases[] = {
+        {"Caf\xC3\xA9 au lait", '-', true, 0, SLUGIFY_TRUNCATE_UTF8, "Caf%C3%A9-au-lait"},
+        {"Caf\xC3\xA9 au lait", '-', false, 0, SLUGIFY_TRUNCATE_UTF8, "cafe-au-lait"},
+        {"rock & roll", '+', false, 0, SLUGIFY_TRUNCATE_UTF8, "rock%2Band%2Broll"},
+        {"\xE6\x97\xA5\xE6\x9C\xAC", '-', true, 0, SLUGIFY_TRUNCATE_UTF8, "%E6%97%A5%E6%9C%AC"},
+        {"\xE6\x97\xA5\xE6\x9C\xAC", '-', true, 13, SLUGIFY_TRUNCATE_UTF8, "%E6%97%A5"},
+        {"\xE6\x97\xA5\xE6\x9C\xAC", '-', true, 13, SLUGIFY_TRUNCATE_BYTE, "%E6%97%A5%E6"},
+        {"ab cd", '|', false, 4, SLUGIFY_TRUNCATE_UTF8, "ab"},
+        {"ab cd", '|', false, 6, SLUGIFY_TRUNCATE_UTF8, "ab%7Cc"},
+        {"x \xC3\xA9t\xC3\xA9 y", '-', true, 8, SLUGIFY_TRUNCATE_WORD, "x"},
+    };
+
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        slugify_options_t opts = {.separator = cases[i].separator, .preserve_case = cases[i].preserve_case,
+                                  .max_length = cases[i].max_length, .truncate = cases[i].truncate,
+                                  .percent_encode = true};
+        char *result = slugify(cases[i].input, &opts);
+        if (!result || strcmp(result, cases[i].expected) != 0)
+        {
+            printf("FAILED: case %zu -> '%s', expected '%s'\n", i, result ? result : "(null)", cases[i].expected);
+            failures++;
+            free(result);
+            continue;
+        }
+
+        // Exact sizing: the reported length fits, one byte less does not
+        size_t length = slugify_length(cases[i].input, &opts);
+        char buf[SLUGIFY_MAX_OUTPUT(32)];
+        if (length != strlen(result) + 1 ||
+            slugify_ex(cases[i].input, buf, length, &opts) != SLUGIFY_SUCCESS ||
+            slugify_ex(cases[i].input, buf, length - 1, &opts) != SLUGIFY_ERROR_BUFFER ||
+            slugify_short(cases[i].input, buf, length, &opts) != SLUGIFY_SUCCESS || strcmp(buf, result) != 0)
+        {
+            printf("FAILED: sizing for case %zu\n", i);
+            failures++;
+        }
+        free(result);
+    }
+
+    // SLUGIFY_MAX_OUTPUT still bounds the worst case
+    const char *dense = "\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80 ,;";
+    char bound[SLUGIFY_MAX_OUTPUT(12)];
+    slugify_options_t opts = {.separator = '!', .preserve_case = true, .percent_encode = true};
+    if (slugify_ex(dense, bound, sizeof(bound), &opts) != SLUGIFY_SUCCESS)
+    {
+        printf("FAILED: SLUGIFY_MAX_OUTPUT too small with percent_encode\n");
+        failures++;
+    }
+
+    printf("Percent-encoding failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_url_decoding(void)
+{
+    printf("\n=== URL DECODING TEST ===\n");
+
+    struct
+    {
+        const char *input;
+        int encoding;
+        int policy;
+        bool preserve_case;
+        const char *expected;
+    } cases[] = {
+        {"Caf%C3%A9+au+lait", SLUGIFY_ENCODING_UTF8, SLUGIFY_INVALID_REJECT, false, "cafe-au-lait"},
+        {"Caf%c3%a9", SLUGIFY_ENCODING_UTF8, SLUGIFY_INVALID_REJECT, true, "Caf\xC3\xA9"},
+        {"%e2%82%ac5", SLUGIFY_ENCODING_UTF8, SLUGIFY_INVALID_REJECT, false, "euro5"},
+        {"caf%E9", SLUGIFY_ENCODING_LATIN1, SLUGIFY_INVALID_REJECT, false, "cafe"},
+        {"100%+off", SLUGIFY_ENCODING_UTF8, SLUGIFY_INVALID_REJECT, false, "100percent-off"}, /* partial escapes */
+        {"50%2x", SLUGIFY_ENCODING_UTF8, SLUGIFY_INVALID_REJECT, false, "50percent2x"},
+        {"%C3x", SLUGIFY_ENCODING_UTF8, SLUGIFY_INVALID_REJECT, false, NULL},
+        {"%C3x", SLUGIFY_ENCODING_UTF8, SLUGIFY_INVALID_DROP, false, "x"},
+        {"a%00b", SLUGIFY_ENCODING_UTF8, SLUGIFY_INVALID_REJECT, false, NULL},
+        {"a%00b", SLUGIFY_ENCODING_UTF8, SLUGIFY_INVALID_SEPARATOR, false, "a-b"},
+        {"a%C0%AFb", SLUGIFY_ENCODING_UTF8, SLUGIFY_INVALID_SEPARATOR, false, NULL},        /* overlong '/' */
+    };
+
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        slugify_options_t opts = {.separator = '-', .input_encoding = cases[i].encoding,
+                                  .invalid_input = cases[i].policy, .preserve_case = cases[i].preserve_case,
+                                  .url_decode = true};
+        char *result = slugify(cases[i].input, &opts);
+        int ok = cases[i].expected ? (result && strcmp(result, cases[i].expected) == 0) : (result == NULL);
+        if (!ok)
+        {
+            printf("FAILED: case %zu -> '%s', expected '%s'\n", i, result ? result : "(null)",
+                   cases[i].expected ? cases[i].expected : "(null)");
+            failures++;
+        }
+        else if (result && slugify_length(cases[i].input, &opts) != strlen(result) + 1)
+        {
+            printf("FAILED: slugify_length() for case %zu is not exact\n", i);
+            failures++;
+        }
+        free(result);
+    }
+
+    // Phrases see the unescaped text
+    const slugify_phrase_t phrases[] = {{"C++", "cpp"}};
+    slugify_phrases_t *compiled = slugify_phrases_create(phrases, 1);
+    slugify_options_t opts = {.separator = '-', .phrases = compiled, .url_decode = true};
+    char *result = slugify("C%2B%2B+tips", &opts);
+    if (!result || strcmp(result, "cpp-tips") != 0)
+    {
+        printf("FAILED: phrase over escapes -> '%s'\n", result ? result : "(null)");
+        failures++;
+    }
+    free(result);
+    slugify_phrases_free(compiled);
+
+    // Without the option the escapes are plain text
+    slugify_options_t plain = {.separator = '-'};
+    result = slugify("a+b%41", &plain);
+    if (!result || strcmp(result, "a-bpercent41") != 0)
+    {
+        printf("FAILED: escapes decoded without url_decode -> '%s'\n", result ? result : "(null)");
+        failures++;
+    }
+    free(result);
+
+    printf("URL decoding failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_html_decoding(void)
+{
+    printf("\n=== HTML DECODING TEST ===\n");
+
+    struct
+    {
+        const char *input;
+        int policy;
+        const char *expected;
+    } cases[] = {
+#ifndef SLUGIFY_NO_ENTITIES
+        {"Tom &amp; Jerry", SLUGIFY_INVALID_REJECT, "tom-and-jerry"},
+        {"Caf&eacute; &Eacute;t&eacute;", SLUGIFY_INVALID_REJECT, "cafe-ete"},
+        {"5 < 6 &lt; 7", SLUGIFY_INVALID_REJECT, "5-less-6-less-7"}, /* '<' without a tag */
+#endif
+        {"&#x41;&#66;c", SLUGIFY_INVALID_REJECT, "abc"},
+        {"<em>Hello</em> World", SLUGIFY_INVALID_REJECT, "hello-world"},
+        {"Hello<br/>World", SLUGIFY_INVALID_REJECT, "hello-world"},
+        {"5 < 6", SLUGIFY_INVALID_REJECT, "5-less-6"},
+        {"R&D &amp &nosuch;", SLUGIFY_INVALID_REJECT, "randd-andamp-andnosuch"},
+        {"a &#150; b", SLUGIFY_INVALID_REJECT, "a-b"}, /* Windows-1252 en dash */
+        {"a&#0;b", SLUGIFY_INVALID_REJECT, NULL},
+        {"a&#0;b", SLUGIFY_INVALID_SEPARATOR, "a-b"},
+        {"a&#xD800;b", SLUGIFY_INVALID_DROP, "ab"},
+        {"&#99999999999;", SLUGIFY_INVALID_REJECT, NULL},
+    };
+
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        slugify_options_t opts = {.separator = '-', .invalid_input = cases[i].policy, .html_decode = true};
+        char *result = slugify(cases[i].input, &opts);
+        int ok = cases[i].expected ? (result && strcmp(result, cases[i].expected) == 0) : (result == NULL);
+        if (!ok)
+        {
+            printf("FAILED: case %zu -> '%s', expected '%s'\n", i, result ? result : "(null)",
+                   cases[i].expected ? cases[i].expected : "(null)");
+            failures++;
+        }
+        else if (result && slugify_length(cases[i].input, &opts) != strlen(result) + 1)
+        {
+            printf("FAILED: slugify_length() for case %zu is not exact\n", i);
+            failures++;
+        }
+        free(result);
+    }
+
+    // Phrases see the decoded text
+    const slugify_phrase_t phrases[] = {{"C++", "cpp"}};
+    slugify_phrases_t *compiled = slugify_phrases_create(phrases, 1);
+    slugify_options_t opts = {.separator = '-', .phrases = compiled, .html_decode = true};
+    char *result = slugify("<b>C&#43;&#x2B;</b> tips", &opts);
+    if (!result || strcmp(result, "cpp-tips") != 0)
+    {
+        printf("FAILED: phrase over references -> '%s'\n", result ? result : "(null)");
+        failures++;
+    }
+    free(result);
+    slugify_phrases_free(compiled);
+
+    // The two decoders do not combine
+    slugify_options_t both = {.separator = '-', .url_decode = true, .html_decode = true};
+    char buf[16];
+    if (slugify_ex("a", buf, sizeof(buf), &both) != SLUGIFY_ERROR_INVALID)
+    {
+        printf("FAILED: url_decode with html_decode accepted\n");
+        failures++;
+    }
+
+    printf("HTML decoding failures: %d\n", failures);
+    return failures == 0;
+}
+
+int test_digest(void)
+{
+    printf("\n=== DIGEST TEST ===\n");
+
+    struct
+    {
+        const char *input;
+        size_t max_length;
+        int truncate;
+        const char *slug;
+        uint64_t hash;
+        const char *id;
+    } cases[] = {
+        {"ABC", 0, SLUGIFY_TRUNCATE_UTF8, "abc", 0x44BC2CF5AD770999ull, "5tsFwslE9e5"},
+        {"Caf\xC3\xA9 au lait", 0, SLUGIFY_TRUNCATE_UTF8, "cafe-au-lait", 0x738FD945E0D1FCDAull, "9v8GWLlX5dC"},
+        /* Longer than a stripe, with the last word taken back */
+        {"The quick brown fox jumps over the lazy dog again", 40, SLUGIFY_TRUNCATE_WORD,
+         "the-quick-brown-fox-jumps-over-the-lazy", 0x20AC860DA8A1413Dull, "2nvC8SWPdG9"},
+    };
+
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        slugify_options_t opts = {.separator = '-', .max_length = cases[i].max_length, .truncate = cases[i].truncate};
+        char buf[64];
+        slugify_digest_t digest;
+        int rc = slugify_ex_digest(cases[i].input, buf, sizeof(buf), &opts, &digest);
+        if (rc != SLUGIFY_SUCCESS || strcmp(buf, cases[i].slug) != 0 || digest.hash != cases[i].hash ||
+            strcmp(digest.id, cases[i].id) != 0)
+        {
+            printf("FAILED: case %zu -> '%s' %016llx '%s'\n", i, rc == SLUGIFY_SUCCESS ? buf : "(error)",
+                   (unsigned long long)digest.hash, digest.id);
+            failures++;
+        }
+    }
+
+    // Errors are the same as slugify_ex() and leave the digest alone
+    slugify_digest_t digest = {42, "unchanged"};
+    char small[4];
+    if (slugify_ex_digest("Hello World", small, sizeof(small), NULL, &digest) != SLUGIFY_ERROR_BUFFER ||
+        digest.hash != 42)
+    {
+        printf("FAILED: digest of a slug that does not fit\n");
+        failures++;
+    }
+
+    printf("Digest failures: %d\n", failures);
+    return failures == 0;
+}
+
+typedef struct
+{
+    char data[4096];
+    size_t len;
+    int calls;
+    int fail_at; /* Call that reports an error, 0 for none */
+} sink_buffer_t;
+
+static int collect_sink(void *ctx, const char *data, size_t len)
+{
+    sink_buffer_t *b = ctx;
+    if (++b->calls == b->fail_at || len == 0 || b->len + len >= sizeof(b->data))
+        return 1;
+    memcpy(b->data + b->len, data, len);
+    b->len += len;
+    return 0;
+}
+
+int test_sink(void)
+{
+    printf("\n=== SINK OUTPUT TEST ===\n");
+
+    char long_input[2048];
+    size_t pos = 0;
+    for (int k = 0; k < 150; k++)
+        pos += (size_t)sprintf(long_input + pos, "%s ", k % 2 ? "\xC3\xA9t\xC3\xA9" : "Word");
+    char long_word[1500];
+    memset(long_word, 'x', sizeof(long_word) - 1);
+    long_word[sizeof(long_word) - 1] = '\0';
+    const slugify_stop_words_t *stop = slugify_stop_words_builtin(SLUGIFY_LANG_DEFAULT);
+
+    struct
+    {
+        const char *input;
+        slugify_options_t opts;
+        int max_calls;
+    } cases[] = {
+        {"Hello, World!", {.separator = '-'}, 1},
+        {"The Lord of the Rings", {.separator = '-', .stop_words = stop}, 1},
+        {long_input, {.separator = '-'}, 3},
+        {long_input, {.separator = '_', .max_length = 700, .truncate = SLUGIFY_TRUNCATE_WORD}, 1},
+        {long_word, {.separator = '-', .max_length = 1200, .truncate = SLUGIFY_TRUNCATE_WORD}, 1},
+        {long_word, {.separator = '-', .max_length = 1200}, 3},
+    };
+
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        sink_buffer_t b = {.len = 0};
+        char *expected = slugify(cases[i].input, &cases[i].opts);
+        int rc = slugify_to_sink(cases[i].input, collect_sink, &b, &cases[i].opts);
+        if (rc != SLUGIFY_SUCCESS || !expected || b.len != strlen(expected) ||
+            memcmp(b.data, expected, b.len) != 0 || b.calls > cases[i].max_calls)
+        {
+            printf("FAILED: case %zu -> rc %d, %zu bytes in %d calls\n", i, rc, b.len, b.calls);
+            failures++;
+        }
+        free(expected);
+    }
+
+    // Errors: nothing reaches the sink for a short invalid or empty slug
+    sink_buffer_t b = {.len = 0};
+    slugify_options_t opts = {.separator = '-'};
+    if (slugify_to_sink("abc\xFF", collect_sink, &b, &opts) != SLUGIFY_ERROR_INVALID ||
+        slugify_to_sink("!!!", collect_sink, &b, &opts) != SLUGIFY_ERROR_EMPTY || b.calls != 0)
+    {
+        printf("FAILED: error cases reached the sink\n");
+        failures++;
+    }
+
+    b.fail_at = 2;
+    if (slugify_to_sink(long_input, collect_sink, &b, &opts) != SLUGIFY_ERROR_SINK || b.calls != 2)
+    {
+        printf("FAILED: sink error not propagated\n");
+        failures++;
+    }
+
+    printf("Sink failures: %d\n", failures);
+    return failures == 0;
+}
+
 int main()
 {
     printf("=== SLUGIFY OVERLONG ENCODING SECURITY TEST ===\n");
@@ -281,6 +1806,22 @@ int main()
          {.separator = '|', .max_length = 100, .preserve_case = true},
          1}, // Custom options
 
+        {"Overlong '/' with lenient decoding",
+         (unsigned char[]){'a', 0xC0, 0xAF, 'b'},
+         4,
+         0, // Should fail
+         "Lenient decoding still rejects overlong ASCII",
+         {.separator = '-', .invalid_input = SLUGIFY_INVALID_SEPARATOR},
+         1}, // Custom options
+
+        {"Overlong NUL past max_length with lenient decoding",
+         (unsigned char[]){'a', 'b', 'c', 0xE0, 0x80, 0x80},
+         6,
+         0, // Should fail
+         "A truncated tail is still checked for overlong ASCII",
+         {.separator = '-', .max_length = 2, .invalid_input = SLUGIFY_INVALID_DROP},
+         1}, // Custom options
+
         {"Valid UTF-8 'café' with preserve_case=1",
          (unsigned char[]){'c', 'a', 'f', 0xC3, 0xA9},
          5, // 'café' in UTF-8
@@ -357,5 +1898,39 @@ int main()
     printf("Security should be consistent across all option combinations\n");
     printf("Custom options should not weaken overlong detection\n");
 
-    return (passed_tests == total_tests) ? 0 : 1;
+    int sizing_passed = test_exact_length();
+    int bound_passed = test_max_output_bound();
+    int fast_passed = test_short_fast_path();
+    int small_passed = test_small_slug();
+    int slugifier_passed = test_slugifier();
+    int table_passed = test_custom_table();
+    int language_passed = test_language_profiles();
+    int decomposition_passed = test_decomposition();
+    int separators_passed = test_unicode_separators();
+    int pinyin_passed = test_pinyin();
+    int hangul_kana_passed = test_hangul_kana();
+    int scripts_passed = test_more_scripts();
+    int multi_rules_passed = test_multi_rules();
+    int phrases_passed = test_phrases();
+    int stop_words_passed = test_stop_words();
+    int truncation_passed = test_truncation();
+    int session_passed = test_session();
+    int wide_passed = test_wide_input();
+    int single_byte_passed = test_single_byte_input();
+    int lenient_passed = test_lenient_input();
+    int sink_passed = test_sink();
+    int percent_passed = test_percent_encoding();
+    int url_passed = test_url_decoding();
+    int html_passed = test_html_decoding();
+    int digest_passed = test_digest();
+
+    return (passed_tests == total_tests && sizing_passed && bound_passed && fast_passed &&
+            small_passed && slugifier_passed && table_passed && language_passed &&
+            decomposition_passed && separators_passed && pinyin_passed &&
+            hangul_kana_passed && scripts_passed && multi_rules_passed &&
+            phrases_passed && stop_words_passed && truncation_passed && session_passed &&
+            wide_passed && single_byte_passed && lenient_passed && sink_passed &&
+            percent_passed && url_passed && html_passed && digest_passed)
+               ? 0
+               : 1;
 }